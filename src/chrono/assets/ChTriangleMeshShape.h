@@ -32,7 +32,7 @@ class ChApi ChTriangleMeshShape : public ChVisualization {
     //
     // DATA
     //
-    geometry::ChTriangleMeshConnected trimesh;
+    std::shared_ptr<geometry::ChTriangleMeshConnected> trimesh;  ///< possibly shared, copied on write (see GetMesh)
 
     bool wireframe;
     bool backface_cull;
@@ -46,6 +46,7 @@ class ChApi ChTriangleMeshShape : public ChVisualization {
     //
 
     ChTriangleMeshShape() {
+        trimesh = std::make_shared<geometry::ChTriangleMeshConnected>();
         wireframe = false;
         backface_cull = false;
     };
@@ -56,8 +57,32 @@ class ChApi ChTriangleMeshShape : public ChVisualization {
     // FUNCTIONS
     //
 
-    geometry::ChTriangleMeshConnected& GetMesh() { return trimesh; }
-    void SetMesh(const geometry::ChTriangleMeshConnected& mesh) { trimesh = mesh; }
+    /// Access the mesh of this asset for modification.
+    /// If the mesh is shared (with other assets, or with the owner of a shared mesh given to SetMesh),
+    /// this asset first gets its own copy of the mesh, so that the changes do not affect anybody else.
+    geometry::ChTriangleMeshConnected& GetMesh() {
+        if (trimesh.use_count() > 1)
+            trimesh = std::make_shared<geometry::ChTriangleMeshConnected>(*trimesh);
+        return *trimesh;
+    }
+
+    /// Access the mesh of this asset, read only.
+    const geometry::ChTriangleMeshConnected& GetMesh() const { return *trimesh; }
+
+    /// Set the mesh of this asset to a copy of the given mesh.
+    void SetMesh(const geometry::ChTriangleMeshConnected& mesh) {
+        trimesh = std::make_shared<geometry::ChTriangleMeshConnected>(mesh);
+    }
+
+    /// Set the mesh of this asset, without copying it. The mesh can be shared by several assets
+    /// (e.g. a mesh obtained from a ChCollisionShapeLibrary); modifying it through GetMesh works on a copy.
+    void SetMesh(std::shared_ptr<const geometry::ChTriangleMeshConnected> mesh) {
+        trimesh = std::const_pointer_cast<geometry::ChTriangleMeshConnected>(mesh);
+    }
+
+    /// Get the (possibly shared) mesh of this asset, read only.
+    /// Use this rather than GetMesh to read the mesh of a non-const asset, since GetMesh copies a shared mesh.
+    std::shared_ptr<const geometry::ChTriangleMeshConnected> GetSharedMesh() const { return trimesh; }
 
     bool IsWireframe() const { return wireframe; }
     void SetWireframe(bool mw) { wireframe = mw; }
@@ -83,7 +108,7 @@ class ChApi ChTriangleMeshShape : public ChVisualization {
         // serialize parent class
         ChVisualization::ArchiveOUT(marchive);
         // serialize all member data:
-        marchive << CHNVP(trimesh);
+        marchive << CHNVP(*trimesh, "trimesh");
         marchive << CHNVP(wireframe);
         marchive << CHNVP(backface_cull);
         marchive << CHNVP(name);
@@ -98,7 +123,8 @@ class ChApi ChTriangleMeshShape : public ChVisualization {
         // deserialize parent class
         ChVisualization::ArchiveIN(marchive);
         // stream in all member data:
-        marchive >> CHNVP(trimesh);
+        trimesh = std::make_shared<geometry::ChTriangleMeshConnected>();
+        marchive >> CHNVP(*trimesh, "trimesh");
         marchive >> CHNVP(wireframe);
         marchive >> CHNVP(backface_cull);
         marchive >> CHNVP(name);
@@ -24,7 +24,7 @@ ChCollisionInfo::ChCollisionInfo()
       vpB(VNULL),
       vN(ChVector<>(1, 0, 0)),
       distance(0),
-      eff_radius(default_eff_radius),
+      eff_radius(GetDefaultEffectiveCurvatureRadius()),
       reaction_cache(nullptr) {}
 
 ChCollisionInfo::ChCollisionInfo(const ChCollisionInfo& other, const bool swap) {
@@ -60,10 +60,15 @@ void ChCollisionInfo::SwapModels() {
 }
 
 void ChCollisionInfo::SetDefaultEffectiveCurvatureRadius(double radius) {
-    default_eff_radius = radius;
+    if (auto defaults = ChCollisionDefaults::GetScoped())
+        defaults->eff_radius = radius;
+    else
+        default_eff_radius = radius;
 }
 
 double ChCollisionInfo::GetDefaultEffectiveCurvatureRadius() {
+    if (auto defaults = ChCollisionDefaults::GetScoped())
+        return defaults->eff_radius;
     return default_eff_radius;
 }
 
@@ -12,6 +12,7 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include "chrono/collision/ChCCollisionInfo.h"
 #include "chrono/collision/ChCCollisionModel.h"
 #include "chrono/physics/ChBody.h"
 
@@ -26,9 +27,30 @@ namespace collision {
 static double default_model_envelope = 0.03;
 static double default_safe_margin = 0.01;
 
+// Defaults replacing the process-wide ones on this thread (see ChCollisionDefaults::Scope).
+static thread_local ChCollisionDefaults* scoped_defaults = nullptr;
+
+ChCollisionDefaults::ChCollisionDefaults()
+    : envelope(ChCollisionModel::GetDefaultSuggestedEnvelope()),
+      margin(ChCollisionModel::GetDefaultSuggestedMargin()),
+      eff_radius(ChCollisionInfo::GetDefaultEffectiveCurvatureRadius()) {}
+
+ChCollisionDefaults::Scope::Scope(ChCollisionDefaults& defaults) : m_previous(scoped_defaults) {
+    scoped_defaults = &defaults;
+}
+
+ChCollisionDefaults::Scope::~Scope() {
+    scoped_defaults = m_previous;
+}
+
+// static
+ChCollisionDefaults* ChCollisionDefaults::GetScoped() {
+    return scoped_defaults;
+}
+
 ChCollisionModel::ChCollisionModel() : family_group(1), family_mask(0x7FFF), mcontactable(0) {
-    model_envelope = (float)default_model_envelope;
-    model_safe_margin = (float)default_safe_margin;
+    model_envelope = (float)GetDefaultSuggestedEnvelope();
+    model_safe_margin = (float)GetDefaultSuggestedMargin();
 }
 
 ChPhysicsItem* ChCollisionModel::GetPhysicsItem() {
@@ -36,20 +58,30 @@ ChPhysicsItem* ChCollisionModel::GetPhysicsItem() {
 }
 
 void ChCollisionModel::SetDefaultSuggestedEnvelope(double menv) {
-    default_model_envelope = menv;
+    if (auto defaults = ChCollisionDefaults::GetScoped())
+        defaults->envelope = menv;
+    else
+        default_model_envelope = menv;
 }
 
 void ChCollisionModel::SetDefaultSuggestedMargin(double mmargin) {
-    default_safe_margin = mmargin;
+    if (auto defaults = ChCollisionDefaults::GetScoped())
+        defaults->margin = mmargin;
+    else
+        default_safe_margin = mmargin;
 }
 
 // static
 double ChCollisionModel::GetDefaultSuggestedEnvelope() {
+    if (auto defaults = ChCollisionDefaults::GetScoped())
+        return defaults->envelope;
     return default_model_envelope;
 }
 
 // static
 double ChCollisionModel::GetDefaultSuggestedMargin() {
+    if (auto defaults = ChCollisionDefaults::GetScoped())
+        return defaults->margin;
     return default_safe_margin;
 }
 
@@ -47,6 +47,34 @@ enum ShapeType {
     TETRAHEDRON   // Currently implemented in parallel only
 };
 
+/// Set of collision defaults: suggested envelope and margin of new collision models (see
+/// ChCollisionModel::SetDefaultSuggestedEnvelope) and effective curvature radius of new contacts
+/// (see ChCollisionInfo::SetDefaultEffectiveCurvatureRadius).
+/// By default these are process-wide. A Scope object makes the calling thread use (and modify) the
+/// given set instead, until the scope ends; ChSystemEnsemble uses this to give each member its own
+/// copy of the defaults.
+struct ChApi ChCollisionDefaults {
+    double envelope;    ///< suggested collision envelope
+    double margin;      ///< suggested collision margin
+    double eff_radius;  ///< effective curvature radius
+
+    /// Construct a set holding the current defaults of the calling thread.
+    ChCollisionDefaults();
+
+    /// Replace the defaults of the calling thread with the given set, for the lifetime of this object.
+    class ChApi Scope {
+      public:
+        Scope(ChCollisionDefaults& defaults);
+        ~Scope();
+
+      private:
+        ChCollisionDefaults* m_previous;
+    };
+
+    /// Return the set used by the calling thread (nullptr if it uses the process-wide defaults).
+    static ChCollisionDefaults* GetScoped();
+};
+
 ///
 /// Class containing the geometric model ready for collision detection.
 /// Each rigid body will have a ChCollisionModel.
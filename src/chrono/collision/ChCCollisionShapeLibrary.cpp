@@ -0,0 +1,373 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#include <algorithm>
+#include <cstring>
+
+#include "chrono/collision/ChCCollisionShapeLibrary.h"
+#include "chrono/collision/ChCModelBullet.h"
+
+#include "chrono/collision/bullet/BulletCollision/BroadphaseCollision/btQuantizedBvh.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btBvhTriangleMeshShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btConvexHullShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btConvexTriangleMeshShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btTriangleIndexVertexArray.h"
+
+namespace chrono {
+namespace collision {
+
+// Tags identifying the type of cached item in the keys
+enum KeyTag { CONVEX_HULL = 1, STATIC_MESH, CONVEX_MESH, DECOMPOSITION, MESH };
+
+// -----------------------------------------------------------------------------
+// Keys, hashes, and memory estimates
+// -----------------------------------------------------------------------------
+
+// FNV-1a hash of the key content.
+static uint64_t HashKey(const std::vector<double>& key) {
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(key.data());
+    size_t size = key.size() * sizeof(double);
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+template <typename T>
+static void AppendVectors(std::vector<double>& key, const std::vector<ChVector<T>>& vectors) {
+    key.push_back((double)vectors.size());
+    for (const auto& v : vectors) {
+        key.push_back(v.x());
+        key.push_back(v.y());
+        key.push_back(v.z());
+    }
+}
+
+static void AppendTriangles(std::vector<double>& key, const geometry::ChTriangleMesh& trimesh) {
+    int num_triangles = trimesh.getNumTriangles();
+    key.reserve(key.size() + 1 + 9 * num_triangles);
+    key.push_back((double)num_triangles);
+    for (int i = 0; i < num_triangles; i++) {
+        geometry::ChTriangle triangle = trimesh.getTriangle(i);
+        for (const auto& p : {triangle.p1, triangle.p2, triangle.p3}) {
+            key.push_back(p.x());
+            key.push_back(p.y());
+            key.push_back(p.z());
+        }
+    }
+}
+
+static size_t MeshInterfaceMemory(const btStridingMeshInterface* minterface) {
+    auto array = dynamic_cast<const btTriangleIndexVertexArray*>(minterface);
+    if (!array)
+        return 0;
+
+    size_t memory = sizeof(btTriangleIndexVertexArray);
+    for (int i = 0; i < array->getIndexedMeshArray().size(); i++) {
+        const btIndexedMesh& mesh = array->getIndexedMeshArray()[i];
+        memory += (size_t)mesh.m_numVertices * mesh.m_vertexStride;
+        memory += (size_t)mesh.m_numTriangles * mesh.m_triangleIndexStride;
+    }
+    return memory;
+}
+
+static size_t ShapeMemory(btCollisionShape* shape) {
+    if (auto hull = dynamic_cast<btConvexHullShape*>(shape))
+        return sizeof(btConvexHullShape) + hull->getNumPoints() * sizeof(btVector3);
+
+    if (auto bvh = dynamic_cast<btBvhTriangleMeshShape*>(shape)) {
+        size_t memory = sizeof(btBvhTriangleMeshShape) + MeshInterfaceMemory(bvh->getMeshInterface());
+        if (bvh->getOptimizedBvh())
+            memory += bvh->getOptimizedBvh()->calculateSerializeBufferSize();
+        return memory;
+    }
+
+    if (auto convex = dynamic_cast<btConvexTriangleMeshShape*>(shape))
+        return sizeof(btConvexTriangleMeshShape) + MeshInterfaceMemory(convex->getMeshInterface());
+
+    return sizeof(btCollisionShape);
+}
+
+static size_t MeshMemory(const geometry::ChTriangleMeshConnected& mesh) {
+    return sizeof(geometry::ChTriangleMeshConnected) +
+           sizeof(ChVector<double>) * (mesh.m_vertices.size() + mesh.m_normals.size() + mesh.m_UV.size()) +
+           sizeof(ChVector<float>) * mesh.m_colors.size() +
+           sizeof(ChVector<int>) * (mesh.m_face_v_indices.size() + mesh.m_face_n_indices.size() +
+                                    mesh.m_face_uv_indices.size() + mesh.m_face_col_indices.size());
+}
+
+// -----------------------------------------------------------------------------
+
+ChCollisionShapeLibrary::ChCollisionShapeLibrary() : m_num_reused(0) {}
+
+ChCollisionShapeLibrary::~ChCollisionShapeLibrary() {}
+
+template <typename T>
+bool ChCollisionShapeLibrary::Find(std::unordered_map<uint64_t, std::vector<Entry<T>>>& cache,
+                                   uint64_t hash,
+                                   const std::vector<double>& key,
+                                   T& item) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto bucket = cache.find(hash);
+    if (bucket == cache.end())
+        return false;
+    for (const auto& entry : bucket->second) {
+        if (entry.key == key) {
+            item = entry.item;
+            m_num_reused++;
+            return true;
+        }
+    }
+    return false;
+}
+
+template <typename T>
+T ChCollisionShapeLibrary::FindOrInsert(std::unordered_map<uint64_t, std::vector<Entry<T>>>& cache,
+                                        uint64_t hash,
+                                        std::vector<double>& key,
+                                        const T& item,
+                                        size_t memory) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto& bucket = cache[hash];
+    // The same item may have been built concurrently by another thread
+    for (const auto& entry : bucket) {
+        if (entry.key == key)
+            return entry.item;
+    }
+    Entry<T> entry;
+    entry.key.swap(key);
+    entry.item = item;
+    entry.memory = memory;
+    bucket.push_back(std::move(entry));
+    return item;
+}
+
+// -----------------------------------------------------------------------------
+
+bool ChCollisionShapeLibrary::AddConvexHull(ChCollisionModel* model,
+                                            const std::vector<ChVector<double>>& pointlist,
+                                            const ChVector<>& pos,
+                                            const ChMatrix33<>& rot) {
+    auto bt_model = dynamic_cast<ChModelBullet*>(model);
+    if (!bt_model) {
+        std::vector<ChVector<double>> points(pointlist);
+        return model->AddConvexHull(points, pos, rot);
+    }
+
+    // The hull is shrunk by the safe margin, so the margins are part of the key
+    bt_model->_adjustSafeMargin(pointlist);
+
+    std::vector<double> key = {CONVEX_HULL, bt_model->GetSafeMargin(), bt_model->GetSuggestedFullMargin()};
+    key.reserve(key.size() + 1 + 3 * pointlist.size());
+    AppendVectors(key, pointlist);
+    uint64_t hash = HashKey(key);
+
+    std::shared_ptr<btCollisionShape> shape;
+    if (!Find(m_shapes, hash, key, shape)) {
+        std::vector<ChVector<double>> points(pointlist);
+        shape = std::shared_ptr<btCollisionShape>(bt_model->_createConvexHull(points));
+        shape = FindOrInsert(m_shapes, hash, key, shape, ShapeMemory(shape.get()));
+    }
+
+    bt_model->_injectShape(pos, rot, shape);
+
+    return true;
+}
+
+bool ChCollisionShapeLibrary::AddTriangleMesh(ChCollisionModel* model,
+                                              const geometry::ChTriangleMesh& trimesh,
+                                              bool is_static,
+                                              bool is_convex,
+                                              const ChVector<>& pos,
+                                              const ChMatrix33<>& rot,
+                                              double sphereswept_thickness) {
+    // Connected meshes are represented by per-triangle proxies of this particular mesh
+    auto bt_model = dynamic_cast<ChModelBullet*>(model);
+    if (!bt_model || dynamic_cast<const geometry::ChTriangleMeshConnected*>(&trimesh))
+        return model->AddTriangleMesh(trimesh, is_static, is_convex, pos, rot, sphereswept_thickness);
+
+    if (!trimesh.getNumTriangles())
+        return false;
+
+    // Static and convex meshes are single shapes, with the safe margin or the envelope baked in
+    if (is_static || is_convex) {
+        std::vector<double> key;
+        if (is_static)
+            key = {STATIC_MESH, bt_model->GetSafeMargin()};
+        else
+            key = {CONVEX_MESH, bt_model->GetEnvelope()};
+        AppendTriangles(key, trimesh);
+        uint64_t hash = HashKey(key);
+
+        std::shared_ptr<btCollisionShape> shape;
+        if (!Find(m_shapes, hash, key, shape)) {
+            shape = std::shared_ptr<btCollisionShape>(bt_model->_createTriangleMesh(trimesh, is_static));
+            shape = FindOrInsert(m_shapes, hash, key, shape, ShapeMemory(shape.get()));
+        }
+
+        bt_model->_injectShape(pos, rot, shape);
+
+        return true;
+    }
+
+    // Other meshes are decomposed in convex hulls, which are then shared as any other hull
+    std::vector<double> key = {DECOMPOSITION};
+    AppendTriangles(key, trimesh);
+    uint64_t hash = HashKey(key);
+
+    std::shared_ptr<HullList> hulls;
+    if (!Find(m_decompositions, hash, key, hulls)) {
+        hulls = std::make_shared<HullList>();
+        ChModelBullet::_decomposeTriangleMesh(trimesh, *hulls);
+        size_t memory = sizeof(HullList);
+        for (const auto& hull : *hulls)
+            memory += hull.size() * sizeof(ChVector<double>);
+        hulls = FindOrInsert(m_decompositions, hash, key, hulls, memory);
+    }
+
+    // note: since the convex hulls are not shrunk, the safe margin will be set to zero
+    bt_model->SetSafeMargin(0);
+    for (const auto& hull : *hulls) {
+        if (hull.size())
+            AddConvexHull(model, hull, pos, rot);
+    }
+
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> ChCollisionShapeLibrary::GetMesh(const std::string& filename,
+                                                                                    bool load_normals,
+                                                                                    bool load_uv) {
+    std::string name = filename + (load_normals ? "|n" : "|") + (load_uv ? "|uv" : "|");
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto entry = m_mesh_files.find(name);
+        if (entry != m_mesh_files.end()) {
+            m_num_reused++;
+            return entry->second;
+        }
+    }
+
+    auto mesh = std::make_shared<geometry::ChTriangleMeshConnected>();
+    mesh->LoadWavefrontMesh(filename, load_normals, load_uv);
+
+    // Share the mesh with any identical mesh already in the library
+    mesh = GetMesh(*mesh);
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_mesh_files.insert(std::make_pair(name, mesh)).first->second;
+}
+
+std::shared_ptr<geometry::ChTriangleMeshConnected> ChCollisionShapeLibrary::GetMesh(
+    const geometry::ChTriangleMeshConnected& mesh) {
+    std::vector<double> key = {MESH};
+    AppendVectors(key, mesh.m_vertices);
+    AppendVectors(key, mesh.m_normals);
+    AppendVectors(key, mesh.m_UV);
+    AppendVectors(key, mesh.m_colors);
+    AppendVectors(key, mesh.m_face_v_indices);
+    AppendVectors(key, mesh.m_face_n_indices);
+    AppendVectors(key, mesh.m_face_uv_indices);
+    AppendVectors(key, mesh.m_face_col_indices);
+    uint64_t hash = HashKey(key);
+
+    std::shared_ptr<geometry::ChTriangleMeshConnected> shared_mesh;
+    if (!Find(m_meshes, hash, key, shared_mesh)) {
+        shared_mesh = std::make_shared<geometry::ChTriangleMeshConnected>(mesh);
+        shared_mesh = FindOrInsert(m_meshes, hash, key, shared_mesh, MeshMemory(mesh));
+    }
+
+    return shared_mesh;
+}
+
+// -----------------------------------------------------------------------------
+
+size_t ChCollisionShapeLibrary::GetNumShapes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t num_shapes = 0;
+    for (const auto& bucket : m_shapes)
+        num_shapes += bucket.second.size();
+    return num_shapes;
+}
+
+size_t ChCollisionShapeLibrary::GetNumMeshes() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t num_meshes = 0;
+    for (const auto& bucket : m_meshes)
+        num_meshes += bucket.second.size();
+    return num_meshes;
+}
+
+size_t ChCollisionShapeLibrary::GetNumReused() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_num_reused;
+}
+
+size_t ChCollisionShapeLibrary::GetMemoryUsage() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t memory = 0;
+    for (const auto& bucket : m_shapes)
+        for (const auto& entry : bucket.second)
+            memory += entry.memory;
+    for (const auto& bucket : m_decompositions)
+        for (const auto& entry : bucket.second)
+            memory += entry.memory;
+    for (const auto& bucket : m_meshes)
+        for (const auto& entry : bucket.second)
+            memory += entry.memory;
+    return memory;
+}
+
+void ChCollisionShapeLibrary::Purge() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Meshes loaded from files are also referenced by the content cache
+    for (auto entry = m_mesh_files.begin(); entry != m_mesh_files.end();) {
+        if (entry->second.use_count() <= 2)
+            entry = m_mesh_files.erase(entry);
+        else
+            ++entry;
+    }
+
+    auto purge = [](auto& cache) {
+        for (auto bucket = cache.begin(); bucket != cache.end();) {
+            auto& entries = bucket->second;
+            entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                         [](const auto& entry) { return entry.item.use_count() == 1; }),
+                          entries.end());
+            if (entries.empty())
+                bucket = cache.erase(bucket);
+            else
+                ++bucket;
+        }
+    };
+    purge(m_shapes);
+    purge(m_meshes);
+}
+
+void ChCollisionShapeLibrary::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_shapes.clear();
+    m_decompositions.clear();
+    m_meshes.clear();
+    m_mesh_files.clear();
+}
+
+}  // end namespace collision
+}  // end namespace chrono
@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#ifndef CHC_COLLISIONSHAPELIBRARY_H
+#define CHC_COLLISIONSHAPELIBRARY_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+class btCollisionShape;
+
+namespace chrono {
+namespace collision {
+
+/// Library of immutable collision shapes and visualization meshes, shared by many collision models.
+/// Shapes are keyed by their geometry content (and by the collision margins baked into them), so that
+/// identical convex hulls, triangle mesh BVH trees, and convex decompositions are built only once, no
+/// matter how many bodies use them. Likewise, visualization meshes are loaded (or copied) only once and
+/// can be referenced by any number of ChTriangleMeshShape assets.
+///
+/// The library can be shared by systems simulated concurrently on different threads: lookups are
+/// serialized with a mutex, while new shapes are built outside the lock. Shapes are kept alive by the
+/// models using them; Purge() releases the ones not referenced anymore.
+///
+/// Only ChModelBullet collision models share shapes. For other collision models, the geometry is
+/// forwarded to the corresponding ChCollisionModel function.
+class ChApi ChCollisionShapeLibrary {
+  public:
+    ChCollisionShapeLibrary();
+    ~ChCollisionShapeLibrary();
+
+    /// Add a convex hull to the given collision model (see ChCollisionModel::AddConvexHull), reusing an
+    /// identical hull (same points and margins) previously built by this library.
+    bool AddConvexHull(ChCollisionModel* model,
+                       const std::vector<ChVector<double>>& pointlist,
+                       const ChVector<>& pos = ChVector<>(),
+                       const ChMatrix33<>& rot = ChMatrix33<>(1));
+
+    /// Add a triangle mesh to the given collision model, reusing an identical shape previously built by
+    /// this library. Static meshes are represented by a BVH tree and convex meshes by a convex triangle
+    /// mesh shape; other meshes are decomposed into convex hulls (the decomposition is also cached).
+    /// Connected meshes (ChTriangleMeshConnected) are not shared: as with ChCollisionModel::AddTriangleMesh,
+    /// they are represented by per-triangle sphere-swept proxies, which reference the vertices of that mesh.
+    bool AddTriangleMesh(ChCollisionModel* model,
+                         const geometry::ChTriangleMesh& trimesh,
+                         bool is_static,
+                         bool is_convex,
+                         const ChVector<>& pos = ChVector<>(),
+                         const ChMatrix33<>& rot = ChMatrix33<>(1),
+                         double sphereswept_thickness = 0.0);
+
+    /// Get the visualization mesh loaded from the specified Wavefront OBJ file.
+    /// The file is loaded only once for a given set of flags.
+    std::shared_ptr<geometry::ChTriangleMeshConnected> GetMesh(const std::string& filename,
+                                                               bool load_normals = true,
+                                                               bool load_uv = false);
+
+    /// Get a shared copy of the given visualization mesh.
+    /// A copy is made only if no mesh with the same content is already in the library.
+    std::shared_ptr<geometry::ChTriangleMeshConnected> GetMesh(const geometry::ChTriangleMeshConnected& mesh);
+
+    /// Get the number of collision shapes in the library.
+    size_t GetNumShapes() const;
+
+    /// Get the number of visualization meshes in the library.
+    size_t GetNumMeshes() const;
+
+    /// Get the number of requests served with a shape, decomposition, or mesh already in the library.
+    size_t GetNumReused() const;
+
+    /// Get the (approximate) memory used by the shapes, decompositions, and meshes in the library, in bytes.
+    size_t GetMemoryUsage() const;
+
+    /// Remove the shapes and meshes which are not used anymore by any collision model or asset.
+    /// Cached convex decompositions are kept.
+    void Purge();
+
+    /// Remove all shapes, decompositions, and meshes from the library.
+    /// Shapes and meshes still in use are kept alive by their users.
+    void Clear();
+
+  private:
+    template <typename T>
+    struct Entry {
+        std::vector<double> key;  ///< geometry content and parameters
+        T item;                   ///< cached item
+        size_t memory;            ///< approximate memory used by the item
+    };
+
+    typedef std::vector<std::vector<ChVector<double>>> HullList;
+
+    /// Find the item with the given key in a cache, or insert the provided one.
+    template <typename T>
+    T FindOrInsert(std::unordered_map<uint64_t, std::vector<Entry<T>>>& cache,
+                   uint64_t hash,
+                   std::vector<double>& key,
+                   const T& item,
+                   size_t memory);
+
+    /// Find the item with the given key in a cache.
+    template <typename T>
+    bool Find(std::unordered_map<uint64_t, std::vector<Entry<T>>>& cache,
+              uint64_t hash,
+              const std::vector<double>& key,
+              T& item);
+
+    std::unordered_map<uint64_t, std::vector<Entry<std::shared_ptr<btCollisionShape>>>> m_shapes;
+    std::unordered_map<uint64_t, std::vector<Entry<std::shared_ptr<HullList>>>> m_decompositions;
+    std::unordered_map<uint64_t, std::vector<Entry<std::shared_ptr<geometry::ChTriangleMeshConnected>>>> m_meshes;
+    std::unordered_map<std::string, std::shared_ptr<geometry::ChTriangleMeshConnected>> m_mesh_files;
+
+    size_t m_num_reused;
+    mutable std::mutex m_mutex;
+};
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
@@ -116,26 +116,32 @@ static void ChCoordsToBullet(const ChCoordsys<>& mcoords, btTransform& mtransfor
 }
 
 void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, btCollisionShape* mshape) {
-    bool centered = (pos.IsNull() && rot.IsIdentity());
-    
     // This is needed so later one can access ChModelBullet::GetSafeMargin and ChModelBullet::GetEnvelope
     mshape->setUserPointer(this);
-    
+
+    _injectShape(pos, rot, std::shared_ptr<btCollisionShape>(mshape));
+}
+
+void ChModelBullet::_injectShape(const ChVector<>& pos,
+                                 const ChMatrix33<>& rot,
+                                 std::shared_ptr<btCollisionShape> mshape) {
+    bool centered = (pos.IsNull() && rot.IsIdentity());
+
     // start_vector = ||    -- description is still empty
     if (shapes.size() == 0) {
         if (centered) {
-            shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
-            bt_collision_object->setCollisionShape(mshape);
+            shapes.push_back(mshape);
+            bt_collision_object->setCollisionShape(mshape.get());
             // end_vector=  | centered shape |
             return;
         } else {
             btCompoundShape* mcompound = new btCompoundShape(true);
             shapes.push_back(std::shared_ptr<btCollisionShape>(mcompound));
-            shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
+            shapes.push_back(mshape);
             bt_collision_object->setCollisionShape(mcompound);
             btTransform mtransform;
             ChPosMatrToBullet(pos, rot, mtransform);
-            mcompound->addChildShape(mtransform, mshape);
+            mcompound->addChildShape(mtransform, mshape.get());
             // vector=  | compound | not centered shape |
             return;
         }
@@ -144,7 +150,7 @@ void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot,
     if (shapes.size() == 1) {
         btTransform mtransform;
         shapes.push_back(shapes[0]);
-        shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
+        shapes.push_back(mshape);
         btCompoundShape* mcompound = new btCompoundShape(true);
         shapes[0] = std::shared_ptr<btCollisionShape>(mcompound);
         bt_collision_object->setCollisionShape(mcompound);
@@ -158,10 +164,10 @@ void ChModelBullet::_injectShape(const ChVector<>& pos, const ChMatrix33<>& rot,
     // vector=  | compound | old | old.. |   ----already working with compounds..
     if (shapes.size() > 1) {
         btTransform mtransform;
-        shapes.push_back(std::shared_ptr<btCollisionShape>(mshape));
+        shapes.push_back(mshape);
         ChPosMatrToBullet(pos, rot, mtransform);
         btCollisionShape* mcom = shapes[0].get();
-        ((btCompoundShape*)mcom)->addChildShape(mtransform, mshape);
+        ((btCompoundShape*)mcom)->addChildShape(mtransform, mshape.get());
         // vector=  | compound | old | old.. | new shape | ...
         return;
     }
@@ -384,7 +390,13 @@ bool ChModelBullet::AddTriangleProxy(ChVector<>* p1,                ///< points
 bool ChModelBullet::AddConvexHull(std::vector<ChVector<double> >& pointlist,
                                   const ChVector<>& pos,
                                   const ChMatrix33<>& rot) {
+    _adjustSafeMargin(pointlist);
+    _injectShape(pos, rot, _createConvexHull(pointlist));
 
+    return true;
+}
+
+void ChModelBullet::_adjustSafeMargin(const std::vector<ChVector<double> >& pointlist) {
     // adjust default inward margin (if object too thin)
     ChVector<> aabbMax(-1e9,-1e9,-1e9);
     ChVector<> aabbMin(1e9,1e9,1e9);
@@ -400,8 +412,9 @@ bool ChModelBullet::AddConvexHull(std::vector<ChVector<double> >& pointlist,
     double approx_chord = ChMin( ChMin(aabbsize.x(), aabbsize.y()), aabbsize.z() );
     // override the inward margin if larger than 0.2 chord:
     this->SetSafeMargin((btScalar)ChMin(this->GetSafeMargin(), approx_chord*0.2));
+}
 
-
+btCollisionShape* ChModelBullet::_createConvexHull(std::vector<ChVector<double> >& pointlist) {
     btConvexHullShape* mshape = new btConvexHullShape;
 
     // shrink the convex hull by GetSafeMargin()
@@ -417,9 +430,7 @@ bool ChModelBullet::AddConvexHull(std::vector<ChVector<double> >& pointlist,
     mshape->setMargin((btScalar) this->GetSuggestedFullMargin());
     mshape->recalcLocalAabb();
 
-    _injectShape(pos, rot, mshape);
-
-    return true;
+    return mshape;
 }
 
 // These classes inherits the Bullet triangle mesh, but adds just a single feature:
@@ -580,6 +591,72 @@ bool ChModelBullet::AddTriangleMesh(const geometry::ChTriangleMesh& trimesh,
         return true;
     }
 
+    if (is_static || is_convex) {
+        _injectShape(pos, rot, _createTriangleMesh(trimesh, is_static));
+    } else {
+        // Note: currently there's no 'perfect' convex decomposition method,
+        // so here the code is a bit experimental...
+
+        /*
+        // ----- use this? (using GImpact collision method without decomposition) :
+        this->AddTriangleMeshConcave(trimesh,pos,rot);
+        */
+
+        // ----- ..or use this? (using the JR convex decomposition) :
+        std::vector<std::vector<ChVector<double> > > hulls;
+        _decomposeTriangleMesh(trimesh, hulls);
+        GetLog() << " found n.hulls=" << (unsigned int)hulls.size() << "\n";
+
+        // note: since the convex hulls are not shrunk, the safe margin will be set to zero
+        this->SetSafeMargin(0);
+        for (auto& hull : hulls) {
+            if (hull.size())
+                this->AddConvexHull(hull, pos, rot);
+        }
+
+        /*
+        // ----- ..or use this? (using the HACD convex decomposition) :
+        ChConvexDecompositionHACD mydecompositionHACD;
+        mydecompositionHACD.AddTriangleMesh(trimesh);
+        mydecompositionHACD.SetParameters          (2, // clusters
+                                                    0, // no decimation
+                                                    0.0, // small cluster threshold
+                                                    false, // add faces points
+                                                    false, // add extra dist points
+                                                    100.0, // max concavity
+                                                    30, // cc connect dist
+                                                    0.0, // volume weight beta
+                                                    0.0, // compacity alpha
+                                                    50 // vertices per cc
+                                                    );
+        mydecompositionHACD.ComputeConvexDecomposition();
+        this->AddTriangleMeshConcaveDecomposed(mydecompositionHACD, pos, rot);
+        */
+    }
+
+    return true;
+}
+
+void ChModelBullet::_decomposeTriangleMesh(const geometry::ChTriangleMesh& trimesh,
+                                           std::vector<std::vector<ChVector<double> > >& hulls) {
+    ChConvexDecompositionJR mydecompositionJR;
+    mydecompositionJR.AddTriangleMesh(trimesh);
+    mydecompositionJR.SetParameters(0,      // skin width
+                                    9, 64,  // depth, max vertices in hull
+                                    5,      // concavity percent
+                                    5,      // merge threshold percent
+                                    5,      // split threshold percent
+                                    true,   // use initial island generation
+                                    false   // use island generation (unsupported-disabled)
+                                    );
+    mydecompositionJR.ComputeConvexDecomposition();
+
+    hulls.resize(mydecompositionJR.GetHullCount());
+    for (unsigned int j = 0; j < mydecompositionJR.GetHullCount(); j++)
+        mydecompositionJR.GetConvexHullResult(j, hulls[j]);
+}
+
+btCollisionShape* ChModelBullet::_createTriangleMesh(const geometry::ChTriangleMesh& trimesh, bool is_static) {
     btTriangleMesh* bulletMesh = new btTriangleMesh;
     for (int i = 0; i < trimesh.getNumTriangles(); i++) {
         // bulletMesh->m_weldingThreshold = ...
@@ -597,58 +674,12 @@ bool ChModelBullet::AddTriangleMesh(const geometry::ChTriangleMesh& trimesh,
         // btCollisionShape* pShape = new btGImpactMeshShape_handlemesh(bulletMesh);
         // pShape->setMargin((btScalar) this->GetSafeMargin() );
         //((btGImpactMeshShape_handlemesh*)pShape)->updateBound();
-        _injectShape(pos, rot, pShape);
-    } else {
-        if (is_convex) {
-            btCollisionShape* pShape = (btConvexTriangleMeshShape*)new btConvexTriangleMeshShape_handlemesh(bulletMesh);
-            pShape->setMargin((btScalar) this->GetEnvelope());
-            _injectShape(pos, rot, pShape);
-        } else {
-            // Note: currently there's no 'perfect' convex decomposition method,
-            // so here the code is a bit experimental...
-
-            /*
-            // ----- use this? (using GImpact collision method without decomposition) :
-            this->AddTriangleMeshConcave(trimesh,pos,rot);
-            */
-
-            // ----- ..or use this? (using the JR convex decomposition) :
-            ChConvexDecompositionJR mydecompositionJR;
-            mydecompositionJR.AddTriangleMesh(trimesh);
-            mydecompositionJR.SetParameters(0,      // skin width
-                                            9, 64,  // depth, max vertices in hull
-                                            5,      // concavity percent
-                                            5,      // merge threshold percent
-                                            5,      // split threshold percent
-                                            true,   // use initial island generation
-                                            false   // use island generation (unsupported-disabled)
-                                            );
-            mydecompositionJR.ComputeConvexDecomposition();
-            GetLog() << " found n.hulls=" << mydecompositionJR.GetHullCount() << "\n";
-            this->AddTriangleMeshConcaveDecomposed(mydecompositionJR, pos, rot);
-
-            /*
-            // ----- ..or use this? (using the HACD convex decomposition) :
-            ChConvexDecompositionHACD mydecompositionHACD;
-            mydecompositionHACD.AddTriangleMesh(trimesh);
-            mydecompositionHACD.SetParameters          (2, // clusters
-                                                        0, // no decimation
-                                                        0.0, // small cluster threshold
-                                                        false, // add faces points
-                                                        false, // add extra dist points
-                                                        100.0, // max concavity
-                                                        30, // cc connect dist
-                                                        0.0, // volume weight beta
-                                                        0.0, // compacity alpha
-                                                        50 // vertices per cc
-                                                        );
-            mydecompositionHACD.ComputeConvexDecomposition();
-            this->AddTriangleMeshConcaveDecomposed(mydecompositionHACD, pos, rot);
-            */
-        }
+        return pShape;
     }
 
-    return true;
+    btCollisionShape* pShape = (btConvexTriangleMeshShape*)new btConvexTriangleMeshShape_handlemesh(bulletMesh);
+    pShape->setMargin((btScalar) this->GetEnvelope());
+    return pShape;
 }
 
 bool ChModelBullet::AddTriangleMeshConcave(const geometry::ChTriangleMesh& trimesh,
@@ -32,6 +32,7 @@ class ChBody;
 namespace collision {
 
 class ChConvexDecomposition;
+class ChCollisionShapeLibrary;
 
 ///  A wrapper to use the Bullet collision detection
 ///  library
@@ -287,8 +288,23 @@ class ChApi ChModelBullet : public ChCollisionModel {
 
   private:
     void _injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, btCollisionShape* mshape);
+    void _injectShape(const ChVector<>& pos, const ChMatrix33<>& rot, std::shared_ptr<btCollisionShape> mshape);
+
+    // Reduce the inward safe margin if too large for the given convex hull.
+    void _adjustSafeMargin(const std::vector<ChVector<double>>& pointlist);
+
+    // Create the Bullet shapes for a convex hull and for a (static or convex) triangle mesh,
+    // using the current margins of this model.
+    btCollisionShape* _createConvexHull(std::vector<ChVector<double>>& pointlist);
+    btCollisionShape* _createTriangleMesh(const geometry::ChTriangleMesh& trimesh, bool is_static);
+
+    // Convex decomposition used for triangle meshes which are neither static nor convex.
+    static void _decomposeTriangleMesh(const geometry::ChTriangleMesh& trimesh,
+                                       std::vector<std::vector<ChVector<double>>>& hulls);
 
     void onFamilyChange();
+
+    friend class ChCollisionShapeLibrary;
 };
 
 }  // end namespace collision
@@ -0,0 +1,164 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+#include "chrono/collision/ChCNeighborGrid.h"
+
+namespace chrono {
+namespace collision {
+
+// Number of bits used for each cell coordinate in the Morton codes.
+static const int MORTON_BITS = 21;
+
+// Spread the lowest 21 bits of v, inserting two zero bits between consecutive bits.
+static uint64_t SpreadBits(uint64_t v) {
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffffULL;
+    v = (v | v << 16) & 0x1f0000ff0000ffULL;
+    v = (v | v << 8) & 0x100f00f00f00f00fULL;
+    v = (v | v << 4) & 0x10c30c30c30c30c3ULL;
+    v = (v | v << 2) & 0x1249249249249249ULL;
+    return v;
+}
+
+static uint64_t MortonKey(int ix, int iy, int iz) {
+    return SpreadBits(ix) | (SpreadBits(iy) << 1) | (SpreadBits(iz) << 2);
+}
+
+ChNeighborGrid::ChNeighborGrid() : skin(0), built_radius(0), cell_size(1), num_rebuilds(0) {
+    start.push_back(0);
+}
+
+bool ChNeighborGrid::Update(const std::vector<ChVector<>>& positions, double radius) {
+    if (positions.size() != built_positions.size() || radius != built_radius) {
+        Rebuild(positions, radius);
+        return true;
+    }
+
+    // Verlet criterion: the lists are still valid if no particle moved more than half the skin
+    double max_dist2 = 0.25 * skin * skin;
+    for (size_t i = 0; i < positions.size(); i++) {
+        if ((positions[i] - built_positions[i]).Length2() > max_dist2) {
+            Rebuild(positions, radius);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void ChNeighborGrid::Rebuild(const std::vector<ChVector<>>& positions, double radius) {
+    int n = (int)positions.size();
+    built_positions = positions;
+    built_radius = radius;
+    num_rebuilds++;
+
+    order.resize(n);
+    particle_keys.resize(n);
+    cell_keys.clear();
+    cell_start.clear();
+    start.assign(n + 1, 0);
+    neighbors.clear();
+
+    if (n == 0)
+        return;
+
+    // Size the grid: cells are at least as large as the search radius (plus skin), so that
+    // all neighbors are found in the 27 cells around a particle. The grid has an empty layer
+    // of cells around the particles, so that cell coordinates are never negative.
+    ChVector<> pmin = positions[0];
+    ChVector<> pmax = positions[0];
+    for (int i = 1; i < n; i++) {
+        for (int d = 0; d < 3; d++) {
+            pmin[d] = std::min(pmin[d], positions[i][d]);
+            pmax[d] = std::max(pmax[d], positions[i][d]);
+        }
+    }
+    double extent = (pmax - pmin).LengthInf();
+    cell_size = std::max(radius + skin, extent / ((1 << MORTON_BITS) - 4));
+    if (cell_size <= 0)
+        cell_size = 1;
+    corner = pmin - ChVector<>(cell_size);
+
+    // Sort the particles along the Morton curve of their cells
+    std::vector<std::pair<uint64_t, int>> sorted(n);
+#pragma omp parallel for schedule(static)
+    for (int i = 0; i < n; i++) {
+        ChVector<> c = (positions[i] - corner) / cell_size;
+        sorted[i] = std::make_pair(MortonKey((int)c.x(), (int)c.y(), (int)c.z()), i);
+    }
+    std::sort(sorted.begin(), sorted.end());
+
+    for (int k = 0; k < n; k++) {
+        particle_keys[k] = sorted[k].first;
+        order[k] = sorted[k].second;
+        if (k == 0 || particle_keys[k] != particle_keys[k - 1]) {
+            cell_keys.push_back(particle_keys[k]);
+            cell_start.push_back(k);
+        }
+    }
+    cell_start.push_back(n);
+
+    // Build the CSR neighbor lists: count, prefix sum, fill
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < n; k++)
+        start[k + 1] = FindNeighbors(positions, k, nullptr);
+
+    std::partial_sum(start.begin(), start.end(), start.begin());
+    neighbors.resize(start[n]);
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < n; k++)
+        FindNeighbors(positions, k, neighbors.data() + start[k]);
+}
+
+int ChNeighborGrid::FindNeighbors(const std::vector<ChVector<>>& positions, int k, int* list) const {
+    int i = order[k];
+    const ChVector<>& pos = positions[i];
+    double reach2 = (built_radius + skin) * (built_radius + skin);
+
+    ChVector<> c = (pos - corner) / cell_size;
+    int ix = (int)c.x();
+    int iy = (int)c.y();
+    int iz = (int)c.z();
+
+    int count = 0;
+    for (int dz = -1; dz <= 1; dz++) {
+        for (int dy = -1; dy <= 1; dy++) {
+            for (int dx = -1; dx <= 1; dx++) {
+                uint64_t key = MortonKey(ix + dx, iy + dy, iz + dz);
+                auto cell = std::lower_bound(cell_keys.begin(), cell_keys.end(), key);
+                if (cell == cell_keys.end() || *cell != key)
+                    continue;
+                size_t ic = cell - cell_keys.begin();
+                for (int m = cell_start[ic]; m < cell_start[ic + 1]; m++) {
+                    int j = order[m];
+                    if (j == i || (positions[j] - pos).Length2() >= reach2)
+                        continue;
+                    if (list)
+                        list[count] = j;
+                    count++;
+                }
+            }
+        }
+    }
+
+    return count;
+}
+
+}  // end namespace collision
+}  // end namespace chrono
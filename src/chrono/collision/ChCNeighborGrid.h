@@ -0,0 +1,94 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#ifndef CHC_NEIGHBORGRID_H
+#define CHC_NEIGHBORGRID_H
+
+#include <cstdint>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChVector.h"
+
+namespace chrono {
+namespace collision {
+
+/// Neighbor search for large sets of particles (SPH, meshless FEA), based on a uniform cell list.
+/// The particles are binned in cubic cells and sorted along a Morton (Z-order) curve of the cells,
+/// so that particles close in space are also close in memory. For each particle, the neighbors
+/// within the search radius plus a 'skin' distance are stored in compressed (CSR) arrays, built
+/// in parallel. As long as no particle moved more than half the skin since the last build, the
+/// neighbor lists remain a superset of the actual neighbors and are not rebuilt (Verlet lists):
+/// callers must still check the distance of each neighbor.
+///
+/// The neighbor lists are stored in Morton order: for the k-th particle along the curve, that is
+/// particle GetOrder()[k], the neighbors are GetNeighbors()[n] with n in [GetStart()[k], GetStart()[k+1]).
+/// Lists are symmetric (if j is a neighbor of i, then i is a neighbor of j) and exclude the particle itself.
+class ChApi ChNeighborGrid {
+  public:
+    ChNeighborGrid();
+
+    /// Set the skin distance added to the search radius (default: 0).
+    /// A larger skin means more neighbors to check, but less frequent rebuilds.
+    void SetSkin(double mskin) { skin = mskin; }
+    double GetSkin() const { return skin; }
+
+    /// Update the neighbor lists for the given particle positions and search radius.
+    /// The lists are rebuilt only if the number of particles or the radius changed, or if some
+    /// particle moved more than half the skin since the last build.
+    /// Returns true if the lists were rebuilt.
+    bool Update(const std::vector<ChVector<>>& positions, double radius);
+
+    /// Unconditionally rebuild the neighbor lists.
+    void Rebuild(const std::vector<ChVector<>>& positions, double radius);
+
+    /// Get the number of particles in the lists.
+    int GetNumParticles() const { return (int)order.size(); }
+
+    /// Get the particle indices, in Morton order.
+    const std::vector<int>& GetOrder() const { return order; }
+
+    /// Get the offsets of the neighbor lists, in Morton order (size: number of particles + 1).
+    const std::vector<int>& GetStart() const { return start; }
+
+    /// Get the concatenated neighbor lists (particle indices).
+    const std::vector<int>& GetNeighbors() const { return neighbors; }
+
+    /// Get the number of times the lists were rebuilt.
+    unsigned int GetNumRebuilds() const { return num_rebuilds; }
+
+  private:
+    /// Find the neighbors of the k-th particle (in Morton order). If list is null, only count them.
+    int FindNeighbors(const std::vector<ChVector<>>& positions, int k, int* list) const;
+
+    double skin;          ///< extra distance added to the search radius
+    double built_radius;  ///< search radius of the last build
+    double cell_size;     ///< size of the (cubic) cells
+    ChVector<> corner;    ///< minimum corner of the grid
+
+    std::vector<ChVector<>> built_positions;  ///< particle positions at the last build
+    std::vector<int> order;                   ///< particle indices, sorted by cell Morton code
+    std::vector<uint64_t> particle_keys;      ///< Morton codes of the particle cells, in Morton order
+    std::vector<uint64_t> cell_keys;          ///< Morton codes of the non-empty cells, sorted
+    std::vector<int> cell_start;              ///< first particle (in Morton order) of each non-empty cell
+    std::vector<int> start;                   ///< CSR offsets of the neighbor lists
+    std::vector<int> neighbors;               ///< CSR neighbor lists
+
+    unsigned int num_rebuilds;
+};
+
+}  // end namespace collision
+}  // end namespace chrono
+
+#endif
@@ -107,8 +107,8 @@ btQuantizedBvh::~btQuantizedBvh()
 }
 
 #ifdef DEBUG_TREE_BUILDING
-int gStackDepth = 0;
-int gMaxStackDepth = 0;
+thread_local int gStackDepth = 0;
+thread_local int gMaxStackDepth = 0;
 #endif //DEBUG_TREE_BUILDING
 
 void	btQuantizedBvh::buildTree	(int startIndex,int endIndex)
@@ -347,7 +347,7 @@ void	btQuantizedBvh::reportAabbOverlappingNodex(btNodeOverlapCallback* nodeCallb
 }
 
 
-int maxIterations = 0;
+thread_local int maxIterations = 0;
 
 
 void	btQuantizedBvh::walkStacklessTree(btNodeOverlapCallback* nodeCallback,const btVector3& aabbMin,const btVector3& aabbMax) const
@@ -18,7 +18,8 @@
 #ifndef BT_NO_PROFILE
 
 
-static btClock gProfileClock;
+// Profiling clock, one per thread (Chrono: concurrent systems in ChSystemEnsemble)
+static thread_local btClock gProfileClock;
 
 
 #ifdef __CELLOS_LV2__
@@ -421,10 +422,32 @@ void	CProfileIterator::Enter_Parent( void )
 **
 ***************************************************************************************************/
 
-CProfileNode	CProfileManager::Root( "Root", NULL );
-CProfileNode *	CProfileManager::CurrentNode = &CProfileManager::Root;
-int				CProfileManager::FrameCounter = 0;
-unsigned long int			CProfileManager::ResetTime = 0;
+// Profiling state of one thread (Chrono: concurrent systems in ChSystemEnsemble)
+struct CProfileState {
+	CProfileState() : Root( "Root", NULL ), CurrentNode( &Root ), FrameCounter( 0 ), ResetTime( 0 ) {}
+
+	CProfileNode			Root;
+	CProfileNode *			CurrentNode;
+	int						FrameCounter;
+	unsigned long int		ResetTime;
+};
+
+static thread_local CProfileState gProfileState;
+
+void	CProfileManager::CleanupMemory(void)
+{
+	gProfileState.Root.CleanupMemory();
+}
+
+int		CProfileManager::Get_Frame_Count_Since_Reset( void )
+{
+	return gProfileState.FrameCounter;
+}
+
+CProfileIterator *	CProfileManager::Get_Iterator( void )
+{
+	return new CProfileIterator( &gProfileState.Root );
+}
 
 
 /***********************************************************************************************
@@ -442,11 +465,11 @@ unsigned long int			CProfileManager::ResetTime = 0;
  *=============================================================================================*/
 void	CProfileManager::Start_Profile( const char * name )
 {
-	if (name != CurrentNode->Get_Name()) {
-		CurrentNode = CurrentNode->Get_Sub_Node( name );
+	if (name != gProfileState.CurrentNode->Get_Name()) {
+		gProfileState.CurrentNode = gProfileState.CurrentNode->Get_Sub_Node( name );
 	} 
 	
-	CurrentNode->Call();
+	gProfileState.CurrentNode->Call();
 }
 
 
@@ -457,8 +480,8 @@ void	CProfileManager::Stop_Profile( void )
 {
 	// Return will indicate whether we should back up to our parent (we may
 	// be profiling a recursive function)
-	if (CurrentNode->Return()) {
-		CurrentNode = CurrentNode->Get_Parent();
+	if (gProfileState.CurrentNode->Return()) {
+		gProfileState.CurrentNode = gProfileState.CurrentNode->Get_Parent();
 	}
 }
 
@@ -471,10 +494,10 @@ void	CProfileManager::Stop_Profile( void )
 void	CProfileManager::Reset( void )
 { 
 	gProfileClock.reset();
-	Root.Reset();
-    Root.Call();
-	FrameCounter = 0;
-	Profile_Get_Ticks(&ResetTime);
+	gProfileState.Root.Reset();
+    gProfileState.Root.Call();
+	gProfileState.FrameCounter = 0;
+	Profile_Get_Ticks(&gProfileState.ResetTime);
 }
 
 
@@ -483,7 +506,7 @@ void	CProfileManager::Reset( void )
  *=============================================================================================*/
 void CProfileManager::Increment_Frame_Counter( void )
 {
-	FrameCounter++;
+	gProfileState.FrameCounter++;
 }
 
 
@@ -494,7 +517,7 @@ float CProfileManager::Get_Time_Since_Reset( void )
 {
 	unsigned long int time;
 	Profile_Get_Ticks(&time);
-	time -= ResetTime;
+	time -= gProfileState.ResetTime;
 	return (float)time / Profile_Get_Tick_Rate();
 }
 
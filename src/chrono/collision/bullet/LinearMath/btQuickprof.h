@@ -130,38 +130,27 @@ protected:
 };
 
 
-///The Manager for the Profile system
+///The Manager for the Profile system.
+///Chrono: the profile tree, frame counter and reset time are kept per thread, since
+///several systems (each with its own collision world) may run concurrently.
 class	CProfileManager {
 public:
 	static	void						Start_Profile( const char * name );
 	static	void						Stop_Profile( void );
 
-	static	void						CleanupMemory(void)
-	{
-		Root.CleanupMemory();
-	}
+	static	void						CleanupMemory(void);
 
 	static	void						Reset( void );
 	static	void						Increment_Frame_Counter( void );
-	static	int						Get_Frame_Count_Since_Reset( void )		{ return FrameCounter; }
+	static	int						Get_Frame_Count_Since_Reset( void );
 	static	float						Get_Time_Since_Reset( void );
 
-	static	CProfileIterator *	Get_Iterator( void )	
-	{ 
-		
-		return new CProfileIterator( &Root ); 
-	}
+	static	CProfileIterator *	Get_Iterator( void );
 	static	void						Release_Iterator( CProfileIterator * iterator ) { delete ( iterator); }
 
 	static void	dumpRecursive(CProfileIterator* profileIterator, int spacing);
 
 	static void	dumpAll();
-
-private:
-	static	CProfileNode			Root;
-	static	CProfileNode *			CurrentNode;
-	static	int						FrameCounter;
-	static	unsigned long int					ResetTime;
 };
 
 
@@ -40,6 +40,7 @@
 #include <fstream>
 
 #include "chrono/core/ChBezierCurve.h"
+#include "chrono/core/ChBezierCurveNetwork.h"
 #include "chrono/core/ChMathematics.h"
 
 namespace chrono {
@@ -405,35 +406,33 @@ ChVector<> ChBezierCurve::calcClosestPoint(const ChVector<>& loc, size_t i, doub
 //
 // This function reinitializes the pathTracker at the specified location. It
 // calculates an appropriate initial guess for the curve segment and sets the
-// curve parameter to 0.5.
+// curve parameter to 0.5. If a path network was specified, the closest point
+// on the curve is found through the network spatial index instead.
 // -----------------------------------------------------------------------------
-class PointSpec {
-  public:
-    PointSpec() {}
-    PointSpec(size_t index, double dist2) : m_index(index), m_dist2(dist2) {}
-
-    size_t m_index;
-    double m_dist2;
-};
-
-static bool comparePoints(const PointSpec& p1, const PointSpec& p2) {
-    return p1.m_dist2 < p2.m_dist2;
-}
-
 void ChBezierCurveTracker::reset(const ChVector<>& loc) {
-    // Walk all curve points and calculate the distance to the specified reset
-    // location, then sort them in increasing order.
-    std::vector<PointSpec> points;
+    ChBezierCurveNetwork::Location location;
+    if (m_network && m_network->calcClosestPoint(loc, location, m_networkPath)) {
+        m_curInterval = location.interval;
+        m_curParam = location.param;
+        return;
+    }
 
-    for (size_t i = 0; i < m_path->getNumPoints(); i++)
-        points.push_back(PointSpec(i, (loc - m_path->m_points[i]).Length2()));
+    // Find the curve point with minimum distance to the specified reset location.
+    size_t closest = 0;
+    double closest_dist2 = (loc - m_path->m_points[0]).Length2();
 
-    std::sort(points.begin(), points.end(), comparePoints);
+    for (size_t i = 1; i < m_path->getNumPoints(); i++) {
+        double dist2 = (loc - m_path->m_points[i]).Length2();
+        if (dist2 < closest_dist2) {
+            closest = i;
+            closest_dist2 = dist2;
+        }
+    }
 
     // Set the initial guess to be at t=0.5 in either the interval starting at
     // the point with minimum distance or in the previous interval.
     m_curParam = 0.5f;
-    m_curInterval = points[0].m_index;
+    m_curInterval = closest;
 
     if (m_curInterval == 0)
         return;
@@ -565,7 +564,20 @@ int ChBezierCurveTracker::calcClosestPoint(const ChVector<>& loc, ChFrame<>& tnb
 // -----------------------------------------------------------------------------
 
 void ChBezierCurveTracker::setIsClosedPath(bool isClosedPath){
+    if (m_network && m_network->isClosedPath(m_networkPath) != isClosedPath)
+        throw ChException("ChBezierCurveTracker: closed path flag does not match the path network");
     m_isClosedPath = isClosedPath;
 }
 
+void ChBezierCurveTracker::setNetwork(std::shared_ptr<ChBezierCurveNetwork> network, int path) {
+    if (network) {
+        if (path < 0 || path >= network->getNumPaths() || network->getPath(path) != m_path)
+            throw ChException("ChBezierCurveTracker: tracked curve is not the specified path of the network");
+        if (network->isClosedPath(path) != m_isClosedPath)
+            throw ChException("ChBezierCurveTracker: closed path flag does not match the path network");
+    }
+    m_network = network;
+    m_networkPath = path;
+}
+
 }  // end of namespace chrono
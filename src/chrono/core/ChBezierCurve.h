@@ -48,6 +48,8 @@
 
 namespace chrono {
 
+class ChBezierCurveNetwork;
+
 // -----------------------------------------------------------------------------
 /// Definition of a piece-wise cubic Bezier approximation of a 3D curve.
 ///
@@ -197,6 +199,7 @@ class ChApi ChBezierCurve {
     static const double m_paramTol;     ///< tolerance for change in parameter value
 
     friend class ChBezierCurveTracker;
+    friend class ChBezierCurveNetwork;
 };
 
 // -----------------------------------------------------------------------------
@@ -209,8 +212,8 @@ class ChApi ChBezierCurve {
 class ChApi ChBezierCurveTracker {
   public:
     /// Create a tracker associated with the specified Bezier curve.
-      ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path, bool isClosedPath = false)
-          : m_path(path), m_curInterval(0), m_curParam(0), m_isClosedPath(isClosedPath) {}
+    ChBezierCurveTracker(std::shared_ptr<ChBezierCurve> path, bool isClosedPath = false)
+        : m_path(path), m_curInterval(0), m_curParam(0), m_isClosedPath(isClosedPath), m_networkPath(-1) {}
 
     /// Destructor for ChBezierCurveTracker.
     ~ChBezierCurveTracker() {}
@@ -239,14 +242,25 @@ class ChApi ChBezierCurveTracker {
     /// In such cases, we return an orthonormal frame with X axis along the tangent.
     int calcClosestPoint(const ChVector<>& loc, ChFrame<>& tnb, double& curvature);
 
-    /// Set if the path is treated as an open loop or a closed loop for tracking
+    /// Set if the path is treated as an open loop or a closed loop for tracking.
+    /// If a path network is used, this must match the closed flag of the path in the network
+    /// (a ChException is thrown otherwise).
     void setIsClosedPath(bool isClosedPath);
 
+    /// Use a shared path network for resetting the tracker.
+    /// The tracked curve must be the path with the specified index in the network, with the same closed
+    /// flag as this tracker (a ChException is thrown otherwise). With a network, reset() finds the closest
+    /// point on the curve through the network spatial index, instead of using the closest knot point as
+    /// initial guess. Pass an empty pointer to stop using a network.
+    void setNetwork(std::shared_ptr<ChBezierCurveNetwork> network, int path);
+
   private:
-    std::shared_ptr<ChBezierCurve> m_path;  ///< associated Bezier curve
-    size_t m_curInterval;                   ///< current search interval
-    double m_curParam;                      ///< parameter for current closest point
-    bool m_isClosedPath;                    ///< treat the path as a closed loop curve
+    std::shared_ptr<ChBezierCurve> m_path;            ///< associated Bezier curve
+    size_t m_curInterval;                             ///< current search interval
+    double m_curParam;                                ///< parameter for current closest point
+    bool m_isClosedPath;                              ///< treat the path as a closed loop curve
+    std::shared_ptr<ChBezierCurveNetwork> m_network;  ///< optional path network (used on reset)
+    int m_networkPath;                                ///< index of the tracked curve in the network
 };
 
 CH_CLASS_VERSION(ChBezierCurve,0)
@@ -0,0 +1,304 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Implementation of the spatial index over a set of Bezier paths.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "chrono/core/ChBezierCurveNetwork.h"
+#include "chrono/core/ChMathematics.h"
+
+namespace chrono {
+
+// Maximum number of segments in a leaf of the hierarchy.
+static const int leaf_size = 4;
+
+// Number of curve parameter samples used to initialize the Newton search in a segment.
+static const int num_samples = 5;
+
+// Number of integration steps per curve interval when measuring arc length.
+static const int num_arc_steps = 16;
+
+// Squared distance from a point to an axis-aligned box.
+static double BoxDistance2(const ChVector<>& p, const ChVector<>& min, const ChVector<>& max) {
+    double d2 = 0;
+    for (int k = 0; k < 3; k++) {
+        double d = std::max(std::max(min[k] - p[k], p[k] - max[k]), 0.0);
+        d2 += d * d;
+    }
+    return d2;
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurveNetwork::addPath()
+// ChBezierCurveNetwork::initialize()
+//
+// The hierarchy is built top-down, splitting the segments of each node at the
+// median of their centers along the longest axis of the node.  Nodes are
+// stored in depth-first order, so that the left child of a node immediately
+// follows it.
+// -----------------------------------------------------------------------------
+int ChBezierCurveNetwork::addPath(std::shared_ptr<ChBezierCurve> path, bool isClosedPath) {
+    m_paths.push_back(path);
+    m_closed.push_back(isClosedPath);
+    return (int)m_paths.size() - 1;
+}
+
+void ChBezierCurveNetwork::initialize() {
+    m_segments.clear();
+    m_nodes.clear();
+
+    for (int p = 0; p < (int)m_paths.size(); p++) {
+        const ChBezierCurve& curve = *m_paths[p];
+        for (size_t i = 0; i + 1 < curve.getNumPoints(); i++) {
+            // The curve interval is contained in the convex hull of its control polygon
+            const ChVector<>* cp[4] = {&curve.m_points[i], &curve.m_outCV[i], &curve.m_inCV[i + 1],
+                                       &curve.m_points[i + 1]};
+            Segment segment;
+            segment.path = p;
+            segment.interval = i;
+            segment.min = *cp[0];
+            segment.max = *cp[0];
+            for (int j = 1; j < 4; j++) {
+                for (int k = 0; k < 3; k++) {
+                    segment.min[k] = std::min(segment.min[k], (*cp[j])[k]);
+                    segment.max[k] = std::max(segment.max[k], (*cp[j])[k]);
+                }
+            }
+            m_segments.push_back(segment);
+        }
+    }
+
+    if (m_segments.empty())
+        return;
+
+    m_nodes.reserve(2 * m_segments.size() / leaf_size + 1);
+    buildNode(0, (int)m_segments.size());
+}
+
+int ChBezierCurveNetwork::buildNode(int first, int count) {
+    Node node;
+    node.min = m_segments[first].min;
+    node.max = m_segments[first].max;
+    ChVector<> cmin = (node.min + node.max) * 0.5;
+    ChVector<> cmax = cmin;
+    for (int s = first + 1; s < first + count; s++) {
+        ChVector<> center = (m_segments[s].min + m_segments[s].max) * 0.5;
+        for (int k = 0; k < 3; k++) {
+            node.min[k] = std::min(node.min[k], m_segments[s].min[k]);
+            node.max[k] = std::max(node.max[k], m_segments[s].max[k]);
+            cmin[k] = std::min(cmin[k], center[k]);
+            cmax[k] = std::max(cmax[k], center[k]);
+        }
+    }
+    node.right = -1;
+    node.first = first;
+    node.count = count;
+
+    int index = (int)m_nodes.size();
+    m_nodes.push_back(node);
+
+    if (count <= leaf_size)
+        return index;
+
+    // Split at the median of the segment centers along the longest axis
+    ChVector<> extent = cmax - cmin;
+    int axis = (extent.x() > extent.y()) ? (extent.x() > extent.z() ? 0 : 2) : (extent.y() > extent.z() ? 1 : 2);
+    int half = count / 2;
+    std::nth_element(m_segments.begin() + first, m_segments.begin() + first + half, m_segments.begin() + first + count,
+                     [axis](const Segment& a, const Segment& b) {
+                         return a.min[axis] + a.max[axis] < b.min[axis] + b.max[axis];
+                     });
+
+    buildNode(first, half);
+    int right = buildNode(first + half, count - half);
+
+    m_nodes[index].right = right;
+    m_nodes[index].count = 0;
+
+    return index;
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurveNetwork::calcClosestPoint()
+//
+// Depth-first traversal of the hierarchy, visiting the closer child first and
+// pruning all nodes farther than the current best candidate. In each segment,
+// the Newton search starts from the closest of a few uniformly spaced samples.
+// -----------------------------------------------------------------------------
+void ChBezierCurveNetwork::searchSegment(const ChVector<>& loc, const Segment& segment, Location& result) const {
+    const ChBezierCurve& curve = *m_paths[segment.path];
+
+    double t = 0;
+    double d2 = std::numeric_limits<double>::max();
+    for (int j = 0; j < num_samples; j++) {
+        double tj = j / (num_samples - 1.0);
+        double dj2 = (curve.eval(segment.interval, tj) - loc).Length2();
+        if (dj2 < d2) {
+            d2 = dj2;
+            t = tj;
+        }
+    }
+
+    ChVector<> point = curve.calcClosestPoint(loc, segment.interval, t);
+    d2 = (point - loc).Length2();
+
+    if (d2 < result.dist2) {
+        result.path = segment.path;
+        result.interval = segment.interval;
+        result.param = t;
+        result.point = point;
+        result.dist2 = d2;
+    }
+}
+
+bool ChBezierCurveNetwork::calcClosestPoint(const ChVector<>& loc, Location& result, int path) const {
+    result.path = -1;
+    result.interval = 0;
+    result.param = 0;
+    result.dist2 = std::numeric_limits<double>::max();
+
+    if (m_nodes.empty())
+        return false;
+
+    // The depth of the (balanced) hierarchy is logarithmic in the number of segments
+    int stack[64];
+    int top = 0;
+    stack[top++] = 0;
+
+    while (top > 0) {
+        const Node& node = m_nodes[stack[--top]];
+        if (BoxDistance2(loc, node.min, node.max) >= result.dist2)
+            continue;
+
+        if (node.right < 0) {
+            for (int s = node.first; s < node.first + node.count; s++) {
+                const Segment& segment = m_segments[s];
+                if (path >= 0 && segment.path != path)
+                    continue;
+                if (BoxDistance2(loc, segment.min, segment.max) >= result.dist2)
+                    continue;
+                searchSegment(loc, segment, result);
+            }
+            continue;
+        }
+
+        int left = (int)(&node - &m_nodes[0]) + 1;
+        double dl = BoxDistance2(loc, m_nodes[left].min, m_nodes[left].max);
+        double dr = BoxDistance2(loc, m_nodes[node.right].min, m_nodes[node.right].max);
+        if (dl < dr) {
+            stack[top++] = node.right;
+            stack[top++] = left;
+        } else {
+            stack[top++] = left;
+            stack[top++] = node.right;
+        }
+    }
+
+    return result.path >= 0;
+}
+
+void ChBezierCurveNetwork::calcClosestPoints(const std::vector<ChVector<> >& locs,
+                                             std::vector<Location>& results,
+                                             const std::vector<int>& paths) const {
+    results.resize(locs.size());
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int i = 0; i < (int)locs.size(); i++)
+        calcClosestPoint(locs[i], results[i], paths.empty() ? -1 : paths[i]);
+}
+
+// -----------------------------------------------------------------------------
+// ChBezierCurveNetwork::calcLocationAhead()
+//
+// March along the path, integrating the arc length with the midpoint rule
+// over a fixed number of steps per curve interval, until the requested
+// distance is covered (or an end of an open path is reached).
+// -----------------------------------------------------------------------------
+ChBezierCurveNetwork::Location ChBezierCurveNetwork::calcLocationAhead(const Location& from, double distance) const {
+    Location result = from;
+    if (from.path < 0)
+        return result;
+
+    const ChBezierCurve& curve = *m_paths[from.path];
+    bool closed = m_closed[from.path];
+    size_t num_intervals = curve.getNumPoints() - 1;
+    double dir = (distance >= 0) ? 1 : -1;
+    double remaining = std::abs(distance);
+    double step = 1.0 / num_arc_steps;
+
+    size_t i = from.interval;
+    double t = from.param;
+    double loop_length = 0;
+    int num_loops = 0;
+
+    while (remaining > 0) {
+        double t_end = (dir > 0) ? 1 : 0;
+        double h = std::min(step, std::abs(t_end - t));
+
+        if (h <= 0) {
+            // At the end of the current interval: move to the adjacent one
+            if (dir > 0 && i + 1 < num_intervals) {
+                i++;
+                t = 0;
+            } else if (dir < 0 && i > 0) {
+                i--;
+                t = 1;
+            } else if (closed && (num_loops == 0 || loop_length > 0)) {
+                // wrap around, unless the last complete loop had zero length
+                i = (dir > 0) ? 0 : num_intervals - 1;
+                t = (dir > 0) ? 0 : 1;
+                loop_length = 0;
+                num_loops++;
+            } else {
+                break;
+            }
+            continue;
+        }
+
+        double ds = curve.evalD(i, t + dir * h / 2).Length() * h;
+        if (ds >= remaining) {
+            t += dir * h * remaining / ds;
+            remaining = 0;
+        } else {
+            t += dir * h;
+            remaining -= ds;
+            loop_length += ds;
+        }
+    }
+
+    ChClampValue(t, 0.0, 1.0);
+    result.interval = i;
+    result.param = t;
+    result.point = curve.eval(i, t);
+    result.dist2 = 0;
+
+    return result;
+}
+
+void ChBezierCurveNetwork::calcLocationsAhead(const std::vector<Location>& from,
+                                              double distance,
+                                              std::vector<Location>& results) const {
+    results.resize(from.size());
+
+#pragma omp parallel for schedule(dynamic, 16)
+    for (int i = 0; i < (int)from.size(); i++)
+        results[i] = calcLocationAhead(from[i], distance);
+}
+
+}  // end of namespace chrono
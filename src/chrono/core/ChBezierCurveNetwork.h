@@ -0,0 +1,129 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Spatial index over a set of Bezier paths.
+//
+// ChBezierCurveNetwork
+//    This class holds a set of ChBezierCurve paths (e.g. the lanes of a road
+//    network) shared by many path followers. A bounding volume hierarchy over
+//    all curve intervals allows global closest-point queries with a cost
+//    logarithmic in the total number of intervals, without any initial guess.
+//    Once initialized, the network is read-only and all queries can be issued
+//    concurrently from multiple threads.
+//
+// =============================================================================
+
+#ifndef CH_BEZIER_CURVE_NETWORK_H
+#define CH_BEZIER_CURVE_NETWORK_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChBezierCurve.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+/// Spatial index over a set of Bezier paths.
+///
+/// Paths are added with addPath() and the index is built by initialize().
+/// The bounding volume hierarchy is built over the bounding boxes of the
+/// control polygons of all curve intervals (which contain the curve intervals).
+/// Closest-point queries traverse the hierarchy and refine the best candidate
+/// intervals with the Newton search of ChBezierCurve::calcClosestPoint.
+/// After initialize(), the network must not be modified and all query
+/// functions are thread-safe.
+// -----------------------------------------------------------------------------
+class ChApi ChBezierCurveNetwork {
+  public:
+    /// Location on a path of the network.
+    struct Location {
+        int path;          ///< path index (-1 if no path was found)
+        size_t interval;   ///< curve interval in the path
+        double param;      ///< curve parameter in the interval, in [0,1]
+        ChVector<> point;  ///< point on the curve
+        double dist2;      ///< squared distance from the query location (0 for look-ahead locations)
+    };
+
+    ChBezierCurveNetwork() {}
+    ~ChBezierCurveNetwork() {}
+
+    /// Add a path to the network and return its index.
+    int addPath(std::shared_ptr<ChBezierCurve> path, bool isClosedPath = false);
+
+    /// Build the spatial index. Must be called after all paths were added.
+    void initialize();
+
+    /// Return the number of paths in the network.
+    int getNumPaths() const { return (int)m_paths.size(); }
+
+    /// Return the path with specified index.
+    std::shared_ptr<ChBezierCurve> getPath(int path) const { return m_paths[path]; }
+
+    /// Return true if the path with specified index is a closed loop.
+    bool isClosedPath(int path) const { return m_closed[path]; }
+
+    /// Calculate the closest point to the specified location.
+    /// If 'path' is non-negative, only the specified path is considered.
+    /// Return false if the network (or the specified path) has no curve interval.
+    bool calcClosestPoint(const ChVector<>& loc, Location& result, int path = -1) const;
+
+    /// Calculate the closest points to a set of locations (e.g. the sentinel points of many vehicles).
+    /// If 'paths' is not empty, it specifies the path to be considered for each location (-1 for all).
+    /// The queries are processed in parallel.
+    void calcClosestPoints(const std::vector<ChVector<> >& locs,
+                           std::vector<Location>& results,
+                           const std::vector<int>& paths = std::vector<int>()) const;
+
+    /// Calculate the location at the given arc length ahead of (or behind, if negative) the specified
+    /// location, along the same path. For an open path, the result is clamped to the path ends.
+    Location calcLocationAhead(const Location& from, double distance) const;
+
+    /// Calculate the locations at the given arc length ahead of a set of locations.
+    /// The queries are processed in parallel.
+    void calcLocationsAhead(const std::vector<Location>& from, double distance, std::vector<Location>& results) const;
+
+  private:
+    /// Curve interval indexed by the hierarchy.
+    struct Segment {
+        int path;         ///< path index
+        size_t interval;  ///< interval in the path
+        ChVector<> min;   ///< bounding box of the control polygon
+        ChVector<> max;
+    };
+
+    /// Node of the bounding volume hierarchy.
+    /// Internal nodes have two children (the left one immediately follows the node); leaves
+    /// reference a range of segments.
+    struct Node {
+        ChVector<> min;  ///< bounding box of all segments in this subtree
+        ChVector<> max;
+        int right;       ///< index of right child (-1 for a leaf)
+        int first;       ///< first segment (leaves only)
+        int count;       ///< number of segments (leaves only)
+    };
+
+    int buildNode(int first, int count);
+    void searchSegment(const ChVector<>& loc, const Segment& segment, Location& result) const;
+
+    std::vector<std::shared_ptr<ChBezierCurve> > m_paths;  ///< paths in the network
+    std::vector<bool> m_closed;                            ///< closed loop flags
+    std::vector<Segment> m_segments;                       ///< curve intervals, in hierarchy order
+    std::vector<Node> m_nodes;                             ///< hierarchy nodes (root first)
+};
+
+}  // end of namespace chrono
+
+#endif
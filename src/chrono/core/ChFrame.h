@@ -17,6 +17,7 @@
 
 #include "chrono/core/ChCoordsys.h"
 #include "chrono/core/ChMatrix33.h"
+#include "chrono/core/ChMatrixDynamic.h"
 #include "chrono/core/ChMatrixNM.h"
 #include "chrono/core/ChTransform.h"
 
@@ -378,6 +378,9 @@ class ChMatrix {
             // NORMAL array-based serialization:
             int tot_elements = GetRows() * GetColumns();
             ChValueSpecific< Real* > specVal(this->address, "data", 0);
+            if (marchive.out_array_pod(specVal, (const char*)this->address, tot_elements, ChArchivePOD<Real>::tag(),
+                                       sizeof(Real), ChArchivePOD<Real>::scalar_size()))
+                return;
             marchive.out_array_pre(specVal, tot_elements);
 			char idname[20];
             for (int i = 0; i < tot_elements; i++) {
@@ -403,6 +406,13 @@ class ChMatrix {
 
         // custom input of matrix data as array
         size_t tot_elements = GetRows() * GetColumns();
+        size_t pod_elements;
+        if (marchive.in_array_pod_pre("data", ChArchivePOD<Real>::tag(), sizeof(Real), pod_elements)) {
+            if (pod_elements != tot_elements)
+                throw ChExceptionArchive("Size of saved matrix data does not match its rows and columns.");
+            marchive.in_array_pod("data", (char*)this->address, tot_elements, sizeof(Real), ChArchivePOD<Real>::scalar_size());
+            return;
+        }
         marchive.in_array_pre("data", tot_elements);
 		char idname[20];
         for (int i = 0; i < tot_elements; i++) {
@@ -547,29 +557,13 @@ class ChMatrix {
     /// Multiplies two matrices, and stores the result in "this" matrix: [this]=[A]*[B].
     /// AVX implementation: The speed up is marginal if size of the matrices are small, e.g. 3*3
     /// Generally, as the matra.GetColumns() increases the method performs better
+    /// Note: for double matrices, MatrMultiply already uses this implementation.
     void MatrMultiplyAVX(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
         assert(matra.GetColumns() == matrb.GetRows());
         assert(this->rows == matra.GetRows());
         assert(this->columns == matrb.GetColumns());
-        int A_Nrow = matra.GetRows();
-        int B_Nrow = matrb.GetRows();
-        int A_NCol = matra.GetColumns();
-        int B_NCol = matrb.GetColumns();
-        const double* A_add = matra.GetAddress();
-        const double* B_add = matrb.GetAddress();
-        double* this_Add = this->GetAddress();
-        for (int rowA = 0; rowA < A_Nrow; rowA++) {
-            for (int colB = 0; colB < B_NCol; colB += 4) {
-                __m256d sum = _mm256_setzero_pd();
-                for (int elem = 0; elem < A_NCol; elem++) {
-                    __m256d ymmA = _mm256_broadcast_sd(A_add + A_NCol * rowA + elem);
-                    __m256d ymmB = _mm256_loadu_pd(B_add + elem * B_NCol + colB);
-                    __m256d prod = _mm256_mul_pd(ymmA, ymmB);
-                    sum = _mm256_add_pd(sum, prod);
-                }
-                _mm256_storeu_pd(this_Add + rowA * B_NCol + colB, sum);
-            }
-        }
+        MatrMultiplyKernelAVX(matra.GetAddress(), matra.GetColumns(), 1, matrb.GetAddress(), this->GetAddress(),
+                              matra.GetRows(), matra.GetColumns(), matrb.GetColumns());
     }
 
     /// Multiplies two matrices (the second is considered transposed): [this]=[A]*[B]'
@@ -609,6 +603,46 @@ class ChMatrix {
         }
     }
 
+    /// Computes C = A*B, with the element (i,k) of A at A[i*a_row_stride + k*a_col_stride] and with B and C
+    /// stored by rows. Columns of B and C are processed in packs of 4, the last pack with masked loads/stores.
+    /// Products are accumulated in the same order as in the scalar implementation. Results are the same only if
+    /// the compiler does not contract the scalar multiply-adds into FMA instructions (e.g. -ffp-contract=off),
+    /// otherwise they may differ in the last bits.
+    static void MatrMultiplyKernelAVX(const double* A,
+                                      int a_row_stride,
+                                      int a_col_stride,
+                                      const double* B,
+                                      double* C,
+                                      int nrows,
+                                      int ninner,
+                                      int ncols) {
+        const int nfull = ncols & ~3;
+        const int nlast = ncols - nfull;
+        const __m256i mask = _mm256_setr_epi64x(nlast > 0 ? -1 : 0, nlast > 1 ? -1 : 0, nlast > 2 ? -1 : 0, 0);
+        for (int row = 0; row < nrows; ++row) {
+            const double* Arow = A + row * a_row_stride;
+            double* Crow = C + row * ncols;
+            for (int col = 0; col < nfull; col += 4) {
+                __m256d sum = _mm256_setzero_pd();
+                for (int k = 0; k < ninner; ++k) {
+                    __m256d ymmA = _mm256_broadcast_sd(Arow + k * a_col_stride);
+                    __m256d ymmB = _mm256_loadu_pd(B + k * ncols + col);
+                    sum = _mm256_add_pd(sum, _mm256_mul_pd(ymmA, ymmB));
+                }
+                _mm256_storeu_pd(Crow + col, sum);
+            }
+            if (nlast) {
+                __m256d sum = _mm256_setzero_pd();
+                for (int k = 0; k < ninner; ++k) {
+                    __m256d ymmA = _mm256_broadcast_sd(Arow + k * a_col_stride);
+                    __m256d ymmB = _mm256_maskload_pd(B + k * ncols + nfull, mask);
+                    sum = _mm256_add_pd(sum, _mm256_mul_pd(ymmA, ymmB));
+                }
+                _mm256_maskstore_pd(Crow + nfull, mask, sum);
+            }
+        }
+    }
+
 #endif
 
     /// Multiplies two matrices (the second is considered transposed): [this]=[A]*[B]'
@@ -1203,6 +1237,32 @@ class ChMatrix {
     }
 };
 
+#ifdef CHRONO_HAS_AVX
+
+/// Multiplies two double matrices: [this]=[A]*[B] (AVX implementation).
+template <>
+template <>
+inline void ChMatrix<double>::MatrMultiply(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
+    assert(matra.GetColumns() == matrb.GetRows());
+    assert(this->rows == matra.GetRows());
+    assert(this->columns == matrb.GetColumns());
+    MatrMultiplyKernelAVX(matra.GetAddress(), matra.GetColumns(), 1, matrb.GetAddress(), address, matra.GetRows(),
+                          matra.GetColumns(), matrb.GetColumns());
+}
+
+/// Multiplies two double matrices (the first is considered transposed): [this]=[A]'*[B] (AVX implementation).
+template <>
+template <>
+inline void ChMatrix<double>::MatrTMultiply(const ChMatrix<double>& matra, const ChMatrix<double>& matrb) {
+    assert(matra.GetRows() == matrb.GetRows());
+    assert(this->rows == matra.GetColumns());
+    assert(this->columns == matrb.GetColumns());
+    MatrMultiplyKernelAVX(matra.GetAddress(), 1, matra.GetColumns(), matrb.GetAddress(), address, matra.GetColumns(),
+                          matra.GetRows(), matrb.GetColumns());
+}
+
+#endif
+
 }  // end namespace chrono
 
 #endif
@@ -879,7 +879,24 @@ class ChMatrix33 : public ChMatrixNM<Real, 3, 3> {
     }
 };
 
+#ifdef CHRONO_HAS_AVX
+
+/// Multiplies a double 3x3 matrix (transposed) by a vector, as [M]'*v (AVX implementation).
+/// Note: [M]*v is left to the scalar implementation, since it requires horizontal sums and it is not faster.
+template <>
+template <>
+inline ChVector<double> ChMatrix33<double>::MatrT_x_Vect(const ChVector<double>& va) const {
+    const __m256i mask = _mm256_setr_epi64x(-1, -1, -1, 0);
+    const double* M = this->GetAddress();
+    __m256d r = _mm256_mul_pd(_mm256_maskload_pd(M, mask), _mm256_set1_pd(va.x()));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_maskload_pd(M + 3, mask), _mm256_set1_pd(va.y())));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_maskload_pd(M + 6, mask), _mm256_set1_pd(va.z())));
+    double res[4];
+    _mm256_storeu_pd(res, r);
+    return ChVector<double>(res[0], res[1], res[2]);
+}
 
+#endif
 
 
 // Compute a 3x3 matrix as a tensor product between two vectors (outer product of vectors)
@@ -0,0 +1,133 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#include <atomic>
+#include <new>
+
+#include "chrono/core/ChAlignedAllocator.h"
+#include "chrono/core/ChMatrixArena.h"
+
+namespace chrono {
+
+namespace {
+
+const size_t ALIGNMENT = 32;     // alignment of all blocks (AVX)
+const int MIN_CLASS = 6;         // smallest size class: 64 bytes
+const int NUM_CLASSES = 48;      // size classes up to 2^(MIN_CLASS+NUM_CLASSES-1) bytes
+const int MAX_CACHED_BLOCKS = 64;  // maximum number of cached blocks per size class and thread
+
+std::atomic<bool> arena_enabled(false);
+std::atomic<size_t> num_heap_allocations(0);
+
+// Index of the smallest size class with blocks of at least 'bytes' bytes.
+int SizeClass(size_t bytes) {
+    int c = 0;
+    while (c < NUM_CLASSES - 1 && (size_t(1) << (MIN_CLASS + c)) < bytes)
+        c++;
+    return c;
+}
+
+// Set once the pool of the calling thread has been destroyed (at thread exit), so that matrices
+// destroyed afterwards (e.g. static objects) release their blocks directly to the heap.
+thread_local bool pool_destroyed = false;
+
+// Pool of cached blocks of the calling thread: one free list per size class.
+// Cached blocks are freed at thread exit.
+struct ChMatrixPool {
+    void* blocks[NUM_CLASSES][MAX_CACHED_BLOCKS];
+    int num_blocks[NUM_CLASSES];
+
+    ChMatrixPool() {
+        for (int c = 0; c < NUM_CLASSES; c++)
+            num_blocks[c] = 0;
+    }
+    ~ChMatrixPool() {
+        Clear();
+        pool_destroyed = true;
+    }
+
+    void Clear() {
+        for (int c = 0; c < NUM_CLASSES; c++) {
+            while (num_blocks[c] > 0)
+                aligned_free(blocks[c][--num_blocks[c]]);
+        }
+    }
+};
+
+ChMatrixPool* GetPool() {
+    if (pool_destroyed)
+        return nullptr;
+    static thread_local ChMatrixPool pool;
+    return &pool;
+}
+
+void* HeapAllocate(size_t bytes) {
+    void* ptr = aligned_malloc(bytes > 0 ? bytes : 1, ALIGNMENT);
+    if (!ptr)
+        throw std::bad_alloc();
+    num_heap_allocations++;
+    return ptr;
+}
+
+}  // end anonymous namespace
+
+void ChMatrixArena::Enable(bool val) {
+    arena_enabled = val;
+}
+
+bool ChMatrixArena::IsEnabled() {
+    return arena_enabled;
+}
+
+void* ChMatrixArena::Allocate(size_t& bytes) {
+    if (!arena_enabled)
+        return HeapAllocate(bytes);
+
+    int c = SizeClass(bytes);
+    size_t class_bytes = size_t(1) << (MIN_CLASS + c);
+    if (class_bytes < bytes)
+        return HeapAllocate(bytes);  // larger than the largest size class
+
+    bytes = class_bytes;
+    ChMatrixPool* pool = GetPool();
+    if (pool && pool->num_blocks[c] > 0)
+        return pool->blocks[c][--pool->num_blocks[c]];
+    return HeapAllocate(bytes);
+}
+
+void ChMatrixArena::Release(void* ptr, size_t bytes) {
+    if (arena_enabled) {
+        // Only blocks with the exact size of a size class can be cached.
+        int c = SizeClass(bytes);
+        if ((size_t(1) << (MIN_CLASS + c)) == bytes) {
+            ChMatrixPool* pool = GetPool();
+            if (pool && pool->num_blocks[c] < MAX_CACHED_BLOCKS) {
+                pool->blocks[c][pool->num_blocks[c]++] = ptr;
+                return;
+            }
+        }
+    }
+    aligned_free(ptr);
+}
+
+void ChMatrixArena::Clear() {
+    if (ChMatrixPool* pool = GetPool())
+        pool->Clear();
+}
+
+size_t ChMatrixArena::GetNumHeapAllocations() {
+    return num_heap_allocations;
+}
+
+}  // end namespace chrono
@@ -0,0 +1,55 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#ifndef CHMATRIXARENA_H
+#define CHMATRIXARENA_H
+
+#include <cstddef>
+
+#include "chrono/core/ChApiCE.h"
+
+namespace chrono {
+
+/// Allocator for the elements of dynamic matrices and vectors (ChMatrixDynamic, ChVectorDynamic).
+/// Blocks are obtained from the heap with 32-byte alignment (see ChAlignedAllocator.h).
+/// If the arena is enabled, blocks are allocated in power-of-two size classes and released blocks are
+/// cached in a pool local to the releasing thread, to be reused by later allocations of the same size
+/// class on that thread. In this way, the temporary matrices created in the inner loops of a simulation
+/// do not hit the heap once the pools are warm.
+class ChApi ChMatrixArena {
+  public:
+    /// Enable or disable the per-thread pools (default: disabled).
+    /// Disabling the arena does not free the cached blocks (see Clear).
+    static void Enable(bool val);
+
+    /// Return true if the per-thread pools are enabled.
+    static bool IsEnabled();
+
+    /// Allocate a block of at least 'bytes' bytes.
+    /// On return, 'bytes' is set to the actual (usable) size of the block.
+    static void* Allocate(size_t& bytes);
+
+    /// Release a block of the given size, as returned by Allocate.
+    static void Release(void* ptr, size_t bytes);
+
+    /// Free all the blocks cached in the pools of the calling thread.
+    static void Clear();
+
+    /// Return the total number of blocks obtained from the heap so far (all threads).
+    static size_t GetNumHeapAllocations();
+};
+
+}  // end namespace chrono
+
+#endif
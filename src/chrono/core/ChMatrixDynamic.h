@@ -17,6 +17,7 @@
 #include "chrono/core/ChStream.h"
 #include "chrono/core/ChException.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChMatrixArena.h"
 
 namespace chrono {
 
@@ -37,15 +38,44 @@ namespace chrono {
 /// where you know in advance its size because there are more efficient
 /// types for those matrices with 'static' size (for example, 3x3 rotation
 /// matrices are faster if created as ChMatrix33).
+///  Matrices with up to SMALL_SIZE elements are stored in an internal buffer, without
+/// heap allocations. Larger matrices get their elements from ChMatrixArena, which can
+/// recycle the memory of temporary matrices. Resizing to a smaller size keeps the memory.
 
 template <class Real>
 class ChMatrixDynamic : public ChMatrix<Real> {
+  public:
+    /// Maximum number of elements stored in the internal buffer.
+    /// Enough for the 6-dof and 7-coordinate vectors of a rigid body; the buffer makes each object
+    /// 64 bytes larger, so it is kept small (these objects are also used as members of bodies and links).
+    static const int SMALL_SIZE = 7;
+
   private:
     //
     // DATA
     //
 
     /// [simply use the  "Real* address" pointer of the base class
+    Real small_buffer[SMALL_SIZE];  ///< internal storage for small matrices
+    int capacity;                   ///< number of elements available at "address"
+
+    /// Set "address" to a memory block for (at least) n elements.
+    void Allocate(int n) {
+        if (n <= SMALL_SIZE) {
+            this->address = small_buffer;
+            capacity = SMALL_SIZE;
+        } else {
+            size_t bytes = n * sizeof(Real);
+            this->address = static_cast<Real*>(ChMatrixArena::Allocate(bytes));
+            capacity = (int)(bytes / sizeof(Real));
+        }
+    }
+
+    /// Release the memory block at "address", if not the internal buffer.
+    void Deallocate() {
+        if (this->address != small_buffer)
+            ChMatrixArena::Release(this->address, capacity * sizeof(Real));
+    }
 
   public:
     //
@@ -56,7 +86,7 @@ class ChMatrixDynamic : public ChMatrix<Real> {
     ChMatrixDynamic() {
         this->rows = 3;
         this->columns = 3;
-        this->address = new Real[9];
+        Allocate(9);
         for (int i = 0; i < 9; ++i)
             this->address[i] = 0;
     }
@@ -65,7 +95,7 @@ class ChMatrixDynamic : public ChMatrix<Real> {
     ChMatrixDynamic(const ChMatrixDynamic<Real>& msource) {
         this->rows = msource.GetRows();
         this->columns = msource.GetColumns();
-        this->address = new Real[this->rows * this->columns];
+        Allocate(this->rows * this->columns);
         // ElementsCopy(this->address, msource.GetAddress(), this->rows*this->columns);
         for (int i = 0; i < this->rows * this->columns; ++i)
             this->address[i] = (Real)msource.GetAddress()[i];
@@ -76,7 +106,7 @@ class ChMatrixDynamic : public ChMatrix<Real> {
     ChMatrixDynamic(const ChMatrix<RealB>& msource) {
         this->rows = msource.GetRows();
         this->columns = msource.GetColumns();
-        this->address = new Real[this->rows * this->columns];
+        Allocate(this->rows * this->columns);
         // ElementsCopy(this->address, msource.GetAddress(), this->rows*this->columns);
         for (int i = 0; i < this->rows * this->columns; ++i)
             this->address[i] = (Real)msource.GetAddress()[i];
@@ -88,20 +118,15 @@ class ChMatrixDynamic : public ChMatrix<Real> {
         assert(row >= 0 && col >= 0);
         this->rows = row;
         this->columns = col;
-#ifdef CHRONO_HAS_AVX
-        this->address = new Real[row * col + 3];
-#else
-        this->address = new Real[row * col];
-
-#endif
+        Allocate(row * col);
         // SetZero(row*col);
         for (int i = 0; i < this->rows * this->columns; ++i)
             this->address[i] = 0;
     }
 
     /// Destructor
-    /// Delete allocated heap mem.
-    virtual ~ChMatrixDynamic() { delete[] this->address; }
+    /// Release the allocated memory.
+    virtual ~ChMatrixDynamic() { Deallocate(); }
 
     //
     // OPERATORS
@@ -160,14 +185,17 @@ class ChMatrixDynamic : public ChMatrix<Real> {
     // FUNCTIONS
     //
 
-    /// Reallocate memory for a new size.
+    /// Change the size of the matrix (elements are reset to zero if the size changes).
+    /// Memory is reallocated only if the current block is too small.
     virtual void Resize(int nrows, int ncols) {
         assert(nrows >= 0 && ncols >= 0);
         if ((nrows != this->rows) || (ncols != this->columns)) {
             this->rows = nrows;
             this->columns = ncols;
-            delete[] this->address;
-            this->address = new Real[this->rows * this->columns];
+            if (nrows * ncols > capacity) {
+                Deallocate();
+                Allocate(nrows * ncols);
+            }
             // SetZero(this->rows*this->columns);
             for (int i = 0; i < this->rows * this->columns; ++i)
                 this->address[i] = 0;
@@ -15,9 +15,14 @@
 #ifndef CHQUATERNION_H
 #define CHQUATERNION_H
 
+#include "chrono/ChConfig.h"
 #include "chrono/core/ChVector.h"
 #include "chrono/core/ChApiCE.h"
 
+#ifdef CHRONO_HAS_AVX
+#include <immintrin.h>
+#endif
+
 namespace chrono {
 
 /// Definitions of various angle sets for conversions.
@@ -382,6 +387,14 @@ class ChQuaternion {
 
 CH_CLASS_VERSION(ChQuaternion<double>, 0)
 
+/// Arrays of ChQuaternion objects can be archived as contiguous blocks of 4 scalars each.
+template <typename Real>
+struct ChArchivePOD<ChQuaternion<Real>, void> {
+    static const bool value = std::is_arithmetic<Real>::value;
+    static char tag() { return 'Q'; }
+    static size_t scalar_size() { return sizeof(Real); }
+};
+
 // -----------------------------------------------------------------------------
 
 /// Shortcut for faster use of typical double-precision quaternion.
@@ -898,12 +911,40 @@ inline void ChQuaternion<Real>::Sub(const ChQuaternion<Real>& A, const ChQuatern
 
 template <class Real>
 inline void ChQuaternion<Real>::Cross(const ChQuaternion<Real>& qa, const ChQuaternion<Real>& qb) {
-    data[0] = qa.data[0] * qb.data[0] - qa.data[1] * qb.data[1] - qa.data[2] * qb.data[2] - qa.data[3] * qb.data[3];
-    data[1] = qa.data[0] * qb.data[1] + qa.data[1] * qb.data[0] - qa.data[3] * qb.data[2] + qa.data[2] * qb.data[3];
-    data[2] = qa.data[0] * qb.data[2] + qa.data[2] * qb.data[0] + qa.data[3] * qb.data[1] - qa.data[1] * qb.data[3];
-    data[3] = qa.data[0] * qb.data[3] + qa.data[3] * qb.data[0] - qa.data[2] * qb.data[1] + qa.data[1] * qb.data[2];
+    // Compute in temporaries first, since qa or qb may alias this quaternion
+    Real w = qa.data[0] * qb.data[0] - qa.data[1] * qb.data[1] - qa.data[2] * qb.data[2] - qa.data[3] * qb.data[3];
+    Real x = qa.data[0] * qb.data[1] + qa.data[1] * qb.data[0] - qa.data[3] * qb.data[2] + qa.data[2] * qb.data[3];
+    Real y = qa.data[0] * qb.data[2] + qa.data[2] * qb.data[0] + qa.data[3] * qb.data[1] - qa.data[1] * qb.data[3];
+    Real z = qa.data[0] * qb.data[3] + qa.data[3] * qb.data[0] - qa.data[2] * qb.data[1] + qa.data[1] * qb.data[2];
+    data[0] = w;
+    data[1] = x;
+    data[2] = y;
+    data[3] = z;
+}
+
+#ifdef CHRONO_HAS_AVX
+
+// Quaternion product for double quaternions (AVX implementation).
+// The product is computed as qa[0]*qb + qa[1]*P1(qb) + qa[2]*P2(qb) + qa[3]*P3(qb), with Pi(qb) signed
+// permutations of qb. Note that the order of the sums differs from the scalar implementation.
+template <>
+inline void ChQuaternion<double>::Cross(const ChQuaternion<double>& qa, const ChQuaternion<double>& qb) {
+    __m256d B0 = _mm256_loadu_pd(qb.data);                 // (b0, b1, b2, b3)
+    __m256d B1 = _mm256_permute_pd(B0, 0x5);               // (b1, b0, b3, b2)
+    __m256d B2 = _mm256_permute2f128_pd(B0, B0, 0x01);     // (b2, b3, b0, b1)
+    __m256d B3 = _mm256_permute_pd(B2, 0x5);               // (b3, b2, b1, b0)
+    B1 = _mm256_xor_pd(B1, _mm256_setr_pd(-0.0, 0.0, -0.0, 0.0));
+    B2 = _mm256_xor_pd(B2, _mm256_setr_pd(-0.0, 0.0, 0.0, -0.0));
+    B3 = _mm256_xor_pd(B3, _mm256_setr_pd(-0.0, -0.0, 0.0, 0.0));
+    __m256d r = _mm256_mul_pd(_mm256_broadcast_sd(&qa.data[0]), B0);
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(&qa.data[1]), B1));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(&qa.data[2]), B2));
+    r = _mm256_add_pd(r, _mm256_mul_pd(_mm256_broadcast_sd(&qa.data[3]), B3));
+    _mm256_storeu_pd(data, r);
 }
 
+#endif
+
 template <class Real>
 inline Real ChQuaternion<Real>::Dot(const ChQuaternion<Real>& B) const {
     return (data[0] * B.data[0]) + (data[1] * B.data[1]) + (data[2] * B.data[2]) + (data[3] * B.data[3]);
@@ -15,6 +15,8 @@
 #ifndef CHSPARSEMATRIX_H
 #define CHSPARSEMATRIX_H
 
+#include <vector>
+
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChMatrix.h"
 
@@ -195,6 +197,20 @@ public:
       bool m_update_sparsity_pattern = false;	    ///< let the matrix acquire the sparsity pattern
 };
 
+/// A dummy sparse matrix that only records the column indices of the elements written into it.
+/// Used to find which variables a constraint row touches (e.g. passing it to ChConstraint::Build_Cq).
+class ChApi ChSparseColumnRecorder : public ChSparseMatrix {
+  public:
+    virtual void SetElement(int insrow, int inscol, double insval, bool overwrite = true) override {
+        columns.push_back(inscol);
+    }
+    virtual double GetElement(int row, int col) const override { return 0; }
+    virtual void Reset(int row, int col, int nonzeros = 0) override { columns.clear(); }
+    virtual bool Resize(int nrows, int ncols, int nonzeros = 0) override { return true; }
+
+    std::vector<int> columns;  ///< recorded column indices, in insertion order (may contain duplicates)
+};
+
 }  // end namespace chrono
 
 #endif
@@ -728,16 +728,14 @@ ChStreamVectorWrapper::~ChStreamVectorWrapper() {
 }
 
 void ChStreamVectorWrapper::Write(const char* data, size_t n) {
-    std::copy(data, data + n, std::back_inserter(*vbuffer));
+    vbuffer->insert(vbuffer->end(), data, data + n);
 }
 void ChStreamVectorWrapper::Read(char* data, size_t n) {
     if (pos + n > vbuffer->size())
         n = vbuffer->size() - pos;
 
-    for (int i = 0; i < n; i++) {
-        data[i] = (*vbuffer)[pos];
-        pos++;
-    }
+    std::copy(vbuffer->begin() + pos, vbuffer->begin() + pos + n, data);
+    pos += n;
 }
 bool ChStreamVectorWrapper::End_of_stream() {
     if (pos >= vbuffer->size())
@@ -341,6 +341,10 @@ class ChApi ChStreamOutBinary : public ChStreamOut, public ChBinaryArchive {
         this->Output((char*)&ogg, sizeof(T));
     }
 
+    /// Generic operator for binary streaming of a contiguous block of 'n' bytes.
+    /// WARNING!!! raw byte streaming, with no byte ordering conversion.
+    void GenericBinaryOutput(const char* data, size_t n) { this->Output(data, n); }
+
     /// Stores an object, given the pointer, into the archive.
     /// This function can be used to serialize objects from
     /// nontrivial class trees, where at load time one may wonder
@@ -457,6 +461,10 @@ class ChApi ChStreamInBinary : public ChStreamIn, public ChBinaryArchive {
         this->Input((char*)&ogg, sizeof(T));
     }
 
+    /// Generic operator for binary streaming of a contiguous block of 'n' bytes.
+    /// WARNING!!! raw byte streaming, with no byte ordering conversion.
+    void GenericBinaryInput(char* data, size_t n) { this->Input(data, n); }
+
     /// Extract an object from the archive, and assignes the pointer to it.
     /// This function can be used to load objects whose class is not
     /// known in advance (anyway, assuming the class had been registered
@@ -138,7 +138,7 @@ class ChTimer {
     std::chrono::duration<seconds_type> m_total;
 
   public:
-    ChTimer() {}
+    ChTimer() : m_total(0) {}
 
     /// Start the timer
     void start() {
@@ -221,6 +221,14 @@ class ChVector {
 
 CH_CLASS_VERSION(ChVector<double>, 0)
 
+/// Arrays of ChVector objects can be archived as contiguous blocks of 3 scalars each.
+template <typename Real>
+struct ChArchivePOD<ChVector<Real>, void> {
+    static const bool value = std::is_arithmetic<Real>::value;
+    static char tag() { return 'V'; }
+    static size_t scalar_size() { return sizeof(Real); }
+};
+
 // -----------------------------------------------------------------------------
 
 /// Shortcut for faster use of typical double-precision vectors.
@@ -21,6 +21,7 @@
 #include "chrono/core/ChStream.h"
 #include "chrono/core/ChException.h"
 #include "chrono/core/ChMatrix.h"
+#include "chrono/core/ChMatrixArena.h"
 
 namespace chrono {
 
@@ -39,15 +40,44 @@ namespace chrono {
 ///  Although this is a generic type of vector, please do not use it for 3D vectors
 /// because there is already the specific ChVector<> class that implements lot of features
 /// for 3D vectors.
+///  Vectors with up to SMALL_SIZE elements are stored in an internal buffer, without
+/// heap allocations. Larger vectors get their elements from ChMatrixArena, which can
+/// recycle the memory of temporary vectors. Resizing to a smaller size keeps the memory.
 
 template <class Real = double>
 class ChVectorDynamic : public ChMatrix<Real> {
+  public:
+    /// Maximum number of elements stored in the internal buffer.
+    /// Enough for the 6-dof and 7-coordinate vectors of a rigid body; the buffer makes each object
+    /// 64 bytes larger, so it is kept small (these objects are also used as members of bodies and links).
+    static const int SMALL_SIZE = 7;
+
   private:
     //
     // DATA
     //
 
     /// [simply use the  "Real* address" pointer of the base class
+    Real small_buffer[SMALL_SIZE];  ///< internal storage for small vectors
+    int capacity;                   ///< number of elements available at "address"
+
+    /// Set "address" to a memory block for (at least) n elements.
+    void Allocate(int n) {
+        if (n <= SMALL_SIZE) {
+            this->address = small_buffer;
+            capacity = SMALL_SIZE;
+        } else {
+            size_t bytes = n * sizeof(Real);
+            this->address = static_cast<Real*>(ChMatrixArena::Allocate(bytes));
+            capacity = (int)(bytes / sizeof(Real));
+        }
+    }
+
+    /// Release the memory block at "address", if not the internal buffer.
+    void Deallocate() {
+        if (this->address != small_buffer)
+            ChMatrixArena::Release(this->address, capacity * sizeof(Real));
+    }
 
   public:
     //
@@ -58,7 +88,7 @@ class ChVectorDynamic : public ChMatrix<Real> {
     ChVectorDynamic() {
         this->rows = 1;
         this->columns = 1;
-        this->address = new Real[1];
+        Allocate(1);
         // SetZero(1);
         this->address[0] = 0;
     }
@@ -69,7 +99,7 @@ class ChVectorDynamic : public ChMatrix<Real> {
         assert(rows >= 0);
         this->rows = rows;
         this->columns = 1;
-        this->address = new Real[rows];
+        Allocate(rows);
         // SetZero(rows);
         for (int i = 0; i < this->rows; ++i)
             this->address[i] = 0;
@@ -79,7 +109,7 @@ class ChVectorDynamic : public ChMatrix<Real> {
     ChVectorDynamic(const ChVectorDynamic<Real>& msource) {
         this->rows = msource.GetRows();
         this->columns = 1;
-        this->address = new Real[this->rows];
+        Allocate(this->rows);
         // ElementsCopy(this->address, msource.GetAddress(), this->rows);
         for (int i = 0; i < this->rows; ++i)
             this->address[i] = (Real)msource.GetAddress()[i];
@@ -92,15 +122,15 @@ class ChVectorDynamic : public ChMatrix<Real> {
         assert(msource.GetColumns() == 1);
         this->rows = msource.GetRows();
         this->columns = 1;
-        this->address = new Real[this->rows];
+        Allocate(this->rows);
         // ElementsCopy(this->address, msource.GetAddress(), this->rows);
         for (int i = 0; i < this->rows; ++i)
             this->address[i] = (Real)msource.GetAddress()[i];
     }
 
     /// Destructor
-    /// Delete allocated heap mem.
-    virtual ~ChVectorDynamic() { delete[] this->address; }
+    /// Release the allocated memory.
+    virtual ~ChVectorDynamic() { Deallocate(); }
 
     /// Return the length of the vector
     int GetLength() const { return this->rows; }
@@ -153,14 +183,17 @@ class ChVectorDynamic : public ChMatrix<Real> {
     // FUNCTIONS
     //
 
-    /// Reallocate memory for a new size.
+    /// Change the size of the vector (elements are reset to zero if the size changes).
+    /// Memory is reallocated only if the current block is too small.
     virtual void Resize(int nrows) {
         assert(nrows >= 0);
         if (nrows != this->rows) {
             this->rows = nrows;
             this->columns = 1;
-            delete[] this->address;
-            this->address = new Real[this->rows];
+            if (nrows > capacity) {
+                Deallocate();
+                Allocate(nrows);
+            }
             // SetZero(this->rows);
             for (int i = 0; i < this->rows; ++i)
                 this->address[i] = 0;
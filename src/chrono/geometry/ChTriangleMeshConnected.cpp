@@ -43,6 +43,7 @@
 #include <unordered_map>
 #include <fstream>
 #include <algorithm>
+#include <cstdint>
 
 #include "chrono/core/ChLinearAlgebra.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
@@ -940,6 +941,118 @@ void ChTriangleMeshConnected::LoadWavefrontMesh(std::string filename, bool load_
     }
 }
 
+// Identifier (and version) of the Chrono binary mesh format
+static const char BINARY_MESH_TAG[8] = {'C', 'H', 'M', 'E', 'S', 'H', '0', '2'};
+
+template <typename T>
+static void WriteBinaryArray(std::ofstream& stream, const std::vector<ChVector<T>>& data) {
+    uint64_t size = data.size();
+    stream.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    for (const auto& v : data)
+        stream.write(reinterpret_cast<const char*>(&v.x()), 3 * sizeof(T));
+}
+
+template <typename T>
+static void ReadBinaryArray(std::ifstream& stream, std::streamoff length, std::vector<ChVector<T>>& data) {
+    uint64_t size = 0;
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (!stream)
+        return;
+    // Check the size against the rest of the stream before allocating (corrupted or truncated file)
+    std::streamoff remaining = length - stream.tellg();
+    if (size > (uint64_t)remaining / (3 * sizeof(T)))
+        throw ChException("Binary mesh array larger than the remaining file");
+    data.resize(size);
+    if (sizeof(ChVector<T>) == 3 * sizeof(T) && size > 0) {
+        // Components are stored contiguously: read the whole array at once
+        stream.read(reinterpret_cast<char*>(&data[0].x()), size * sizeof(ChVector<T>));
+    } else {
+        for (auto& v : data)
+            stream.read(reinterpret_cast<char*>(&v.x()), 3 * sizeof(T));
+    }
+}
+
+// Read the header of a binary mesh file: the tag and the stamp of the source file.
+static void ReadBinaryMeshHeader(std::ifstream& stream,
+                                 const std::string& filename,
+                                 int64_t& source_time,
+                                 int64_t& source_size) {
+    if (!stream.good())
+        throw ChException("Cannot open binary mesh file " + filename);
+
+    char tag[sizeof(BINARY_MESH_TAG)];
+    stream.read(tag, sizeof(tag));
+    if (!stream || !std::equal(tag, tag + sizeof(tag), BINARY_MESH_TAG))
+        throw ChException("Not a binary mesh file: " + filename);
+
+    stream.read(reinterpret_cast<char*>(&source_time), sizeof(source_time));
+    stream.read(reinterpret_cast<char*>(&source_size), sizeof(source_size));
+    if (!stream)
+        throw ChException("Corrupted binary mesh file " + filename);
+}
+
+void ChTriangleMeshConnected::ReadBinaryMeshSource(const std::string& filename,
+                                                   int64_t& source_time,
+                                                   int64_t& source_size) {
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    ReadBinaryMeshHeader(stream, filename, source_time, source_size);
+}
+
+void ChTriangleMeshConnected::LoadBinaryMesh(const std::string& filename) {
+    std::ifstream stream(filename, std::ios::in | std::ios::binary);
+    int64_t source_time;
+    int64_t source_size;
+    ReadBinaryMeshHeader(stream, filename, source_time, source_size);
+
+    std::streamoff position = stream.tellg();
+    stream.seekg(0, std::ios::end);
+    std::streamoff length = stream.tellg();
+    stream.seekg(position);
+
+    try {
+        ReadBinaryArray(stream, length, m_vertices);
+        ReadBinaryArray(stream, length, m_normals);
+        ReadBinaryArray(stream, length, m_UV);
+        ReadBinaryArray(stream, length, m_colors);
+        ReadBinaryArray(stream, length, m_face_v_indices);
+        ReadBinaryArray(stream, length, m_face_n_indices);
+        ReadBinaryArray(stream, length, m_face_uv_indices);
+        ReadBinaryArray(stream, length, m_face_col_indices);
+    } catch (const ChException&) {
+        stream.setstate(std::ios::failbit);
+    }
+
+    if (!stream) {
+        Clear();
+        throw ChException("Corrupted binary mesh file " + filename);
+    }
+
+    m_filename = filename;
+}
+
+void ChTriangleMeshConnected::SaveBinaryMesh(const std::string& filename,
+                                             int64_t source_time,
+                                             int64_t source_size) const {
+    std::ofstream stream(filename, std::ios::out | std::ios::binary);
+    if (!stream.good())
+        throw ChException("Cannot create binary mesh file " + filename);
+
+    stream.write(BINARY_MESH_TAG, sizeof(BINARY_MESH_TAG));
+    stream.write(reinterpret_cast<const char*>(&source_time), sizeof(source_time));
+    stream.write(reinterpret_cast<const char*>(&source_size), sizeof(source_size));
+    WriteBinaryArray(stream, m_vertices);
+    WriteBinaryArray(stream, m_normals);
+    WriteBinaryArray(stream, m_UV);
+    WriteBinaryArray(stream, m_colors);
+    WriteBinaryArray(stream, m_face_v_indices);
+    WriteBinaryArray(stream, m_face_n_indices);
+    WriteBinaryArray(stream, m_face_uv_indices);
+    WriteBinaryArray(stream, m_face_col_indices);
+
+    if (!stream)
+        throw ChException("Error writing binary mesh file " + filename);
+}
+
 /*
 using namespace WAVEFRONT;
 
@@ -15,8 +15,9 @@
 #ifndef CHC_TRIANGLEMESHCONNECTED_H
 #define CHC_TRIANGLEMESHCONNECTED_H
 
-#include <cmath>
 #include <array>
+#include <cmath>
+#include <cstdint>
 #include <map>
 
 #include "chrono/geometry/ChTriangleMesh.h"
@@ -51,18 +52,41 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     virtual ChTriangleMeshConnected* Clone() const override { return new ChTriangleMeshConnected(*this); }
 
     std::vector<ChVector<double>>& getCoordsVertices() { return m_vertices; }
+    const std::vector<ChVector<double>>& getCoordsVertices() const { return m_vertices; }
     std::vector<ChVector<double>>& getCoordsNormals() { return m_normals; }
+    const std::vector<ChVector<double>>& getCoordsNormals() const { return m_normals; }
     std::vector<ChVector<double>>& getCoordsUV() { return m_UV; }
+    const std::vector<ChVector<double>>& getCoordsUV() const { return m_UV; }
     std::vector<ChVector<float>>& getCoordsColors() { return m_colors; }
+    const std::vector<ChVector<float>>& getCoordsColors() const { return m_colors; }
 
     std::vector<ChVector<int>>& getIndicesVertexes() { return m_face_v_indices; }
+    const std::vector<ChVector<int>>& getIndicesVertexes() const { return m_face_v_indices; }
     std::vector<ChVector<int>>& getIndicesNormals() { return m_face_n_indices; }
+    const std::vector<ChVector<int>>& getIndicesNormals() const { return m_face_n_indices; }
     std::vector<ChVector<int>>& getIndicesUV() { return m_face_uv_indices; }
+    const std::vector<ChVector<int>>& getIndicesUV() const { return m_face_uv_indices; }
     std::vector<ChVector<int>>& getIndicesColors() { return m_face_col_indices; }
+    const std::vector<ChVector<int>>& getIndicesColors() const { return m_face_col_indices; }
 
     /// Load a triangle mesh saved as a Wavefront .obj file
     void LoadWavefrontMesh(std::string filename, bool load_normals = true, bool load_uv = false);
 
+    /// Load a triangle mesh saved in the Chrono binary mesh format (see SaveBinaryMesh).
+    /// Loading a pre-baked binary mesh is much faster than parsing the equivalent Wavefront .obj file.
+    /// An exception is thrown if the file cannot be read or is not a binary mesh file.
+    void LoadBinaryMesh(const std::string& filename);
+
+    /// Save this triangle mesh (vertices, normals, UV coordinates, colors, and all face indices) in the
+    /// Chrono binary mesh format. Data is written in the byte order of the host machine.
+    /// The modification time and size of the file this mesh was created from, if any, can be recorded in
+    /// the file header, so that a stale binary mesh can be detected (see ReadBinaryMeshSource).
+    void SaveBinaryMesh(const std::string& filename, int64_t source_time = 0, int64_t source_size = 0) const;
+
+    /// Read the modification time and size of the source file recorded in the header of a binary mesh file.
+    /// An exception is thrown if the file cannot be read or is not a binary mesh file.
+    static void ReadBinaryMeshSource(const std::string& filename, int64_t& source_time, int64_t& source_size);
+
     /// Write the specified meshes in a Wavefront .obj file
     static void WriteWavefront(const std::string& filename, std::vector<ChTriangleMeshConnected>& meshes);
 
@@ -113,7 +137,7 @@ class ChApi ChTriangleMeshConnected : public ChTriangleMesh {
     void ComputeMassProperties(bool bodyCoords, double& mass, ChVector<>& center, ChMatrix33<>& inertia);
 
     /// Get the filename of the triangle mesh
-    std::string GetFileName() { return m_filename; }
+    std::string GetFileName() const { return m_filename; }
 
     /// Transform all vertexes, by displacing and rotating (rotation  via matrix, so also scaling if needed)
     virtual void Transform(const ChVector<> displ, const ChMatrix33<> rotscale) override;
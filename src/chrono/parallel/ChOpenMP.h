@@ -45,7 +45,8 @@ class ChApi CHOMPmutex {
 class ChApi CHOMPfunctions {
   public:
     /// Sets the number of threads in subsequent parallel
-    /// regions, unless overridden by a 'num_threads' clause
+    /// regions, unless overridden by a 'num_threads' clause.
+    /// This setting only affects the calling thread.
     static void SetNumThreads(int mth) { omp_set_num_threads(mth); }
 
     /// Returns the number of threads in the parallel region.
@@ -24,6 +24,7 @@
 #include "chrono/core/ChVector.h"
 #include "chrono/core/ChMatrix.h"
 #include "chrono/core/ChDistribution.h"
+#include "chrono/physics/ChParticlesClones.h"
 #include "chrono/physics/ChSystem.h"
 
 namespace chrono {
@@ -170,6 +171,101 @@ class ChParticleEmitter {
         }
     }
 
+    /// Function that creates random particles in a cluster of clones, with random
+    /// position, alignment and velocity each time it is called. The shape and mass
+    /// are those shared by the clones, so the particle creator and the creation
+    /// callback are not used. All particles of the timestep are appended to the
+    /// cluster in a single batch.
+    /// Typically, one calls this function once per timestep.
+    void EmitParticles(ChParticlesClones& mclones, double mdt, ChFrameMoving<> pre_transform = ChFrameMoving<>()) {
+        double done_particles_per_step = this->off_count;
+        double done_mass_per_step = this->off_mass;
+
+        double particles_per_step = mdt * particles_per_second;
+        double mass_per_step = mdt * mass_per_second;
+
+        double mass = mclones.GetMass();
+
+        std::vector<ChCoordsys<>> new_coords;
+        std::vector<ChVector<>> new_speeds;
+        std::vector<ChVector<>> new_wvels;
+
+        // Loop for creating particles at the timestep (see EmitParticles() for ChSystem)
+        while (true) {
+            if ((use_particle_reservoir) && (this->particle_reservoir <= 0))
+                break;
+
+            if ((use_mass_reservoir) && (this->mass_reservoir <= 0))
+                break;
+
+            if (this->flow_mode == FLOW_PARTICLESPERSECOND) {
+                if (done_particles_per_step > particles_per_step) {
+                    this->off_count = done_particles_per_step - particles_per_step;
+                    break;
+                }
+            }
+            if (this->flow_mode == FLOW_MASSPERSECOND) {
+                if (done_mass_per_step > mass_per_step) {
+                    this->off_mass = done_mass_per_step - mass_per_step;
+                    break;
+                }
+            }
+
+            // Random position and alignment
+            ChCoordsys<> mcoords;
+            mcoords.pos = particle_positioner->RandomPosition();
+            mcoords.rot = particle_aligner->RandomAlignment();
+
+            ChCoordsys<> mcoords_abs;
+            mcoords_abs = mcoords >> pre_transform.GetCoord();
+
+            // Random velocity and angular speed
+            ChVector<> mv_loc = particle_velocity->RandomVelocity();
+            ChVector<> mw_loc = particle_angular_velocity->RandomVelocity();
+
+            ChVector<> mv_abs;
+            ChVector<> mw_abs;
+
+            if (inherit_owner_speed) {
+                mv_abs = pre_transform.PointSpeedLocalToParent(mcoords.pos, mv_loc);
+                mw_abs = pre_transform.TransformDirectionLocalToParent(mw_loc) + pre_transform.GetWvel_par();
+            } else {
+                mv_abs = pre_transform.TransformDirectionLocalToParent(mv_loc);
+                mw_abs = pre_transform.TransformDirectionLocalToParent(mw_loc);
+            }
+
+            if (this->jitter_declustering) {
+                ChVector<> jitter = (ChRandom() * mdt) * mv_abs;
+                jitter -= (ChRandom() * mdt) * pre_transform.PointSpeedLocalToParent(mcoords.pos, VNULL);
+                mcoords_abs.pos += jitter;
+            }
+
+            new_coords.push_back(mcoords_abs);
+            new_speeds.push_back(mv_abs);
+            new_wvels.push_back(mw_abs);
+
+            this->particle_reservoir -= 1;
+            this->mass_reservoir -= mass;
+
+            this->created_particles += 1;
+            this->created_mass += mass;
+
+            done_particles_per_step += 1;
+            done_mass_per_step += mass;
+        }
+
+        if (new_coords.empty())
+            return;
+
+        unsigned int first = (unsigned int)mclones.GetNparticles();
+        mclones.AddParticles(new_coords);
+        for (unsigned int i = 0; i < new_coords.size(); i++) {
+            ChParticleBase& mparticle = mclones.GetParticle(first + i);
+            mparticle.SetPos_dt(new_speeds[i]);
+            mparticle.SetWvel_par(new_wvels[i]);
+        }
+    }
+
     /// Pass an object from a ChPostCreationCallback-inherited class if you want to
     /// set additional stuff on each created particle (ex.set some random asset, set some random material, or such)
     void RegisterAddBodyCallback(ChRandomShapeCreator::AddBodyCallback* callback) { this->creation_callback = callback; }
@@ -62,9 +62,11 @@ class ChParticleEventTriggerBox : public ChParticleEventTrigger {
     /// This function triggers the a particle event according to the fact
     /// the the particle is inside a box.
     /// If SetTriggerOutside(true), viceversa triggers event outside the box.
-    virtual bool TriggerEvent(std::shared_ptr<ChBody> mbody, ChSystem& msystem) {
-        ChVector<> particle_pos = mbody->GetPos();
+    virtual bool TriggerEvent(std::shared_ptr<ChBody> mbody, ChSystem& msystem) { return TriggerEvent(mbody->GetPos()); }
 
+    /// Same as above, for a particle given by the position of its center of gravity
+    /// (used for particles that are not bodies, e.g. in a ChParticlesClones cluster).
+    bool TriggerEvent(const ChVector<>& particle_pos) const {
         ChVector<> localpos = mbox.Pos + mbox.Rot * particle_pos;
 
         if (((fabs(localpos.x()) < mbox.Size.x()) && (fabs(localpos.y()) < mbox.Size.y()) && (fabs(localpos.z()) < mbox.Size.z())) ^
@@ -16,6 +16,7 @@
 #define CHPARTICLEREMOVER_H
 
 #include "chrono/particlefactory/ChParticleProcessor.h"
+#include "chrono/physics/ChParticlesClones.h"
 
 namespace chrono {
 namespace particlefactory {
@@ -47,6 +48,25 @@ class ChParticleRemoverBox : public ChParticleProcessor {
             throw ChException("ChParticleRemoverBox had trigger replaced to non-box type");
         }
     }
+
+    using ChParticleProcessor::ProcessParticles;
+
+    /// Remove, in a single batch, the particles of a cluster of clones that trigger
+    /// the box. Returns the number of removed particles.
+    int ProcessParticles(ChParticlesClones& mclones) {
+        auto mtrigbox = std::dynamic_pointer_cast<ChParticleEventTriggerBox>(trigger);
+        if (!mtrigbox)
+            throw ChException("ChParticleRemoverBox had trigger replaced to non-box type");
+
+        std::vector<unsigned int> to_remove;
+        for (unsigned int i = 0; i < mclones.GetNparticles(); i++) {
+            if (mtrigbox->TriggerEvent(mclones.GetParticle(i).GetPos()))
+                to_remove.push_back(i);
+        }
+        mclones.RemoveParticles(to_remove);
+
+        return (int)to_remove.size();
+    }
 };
 
 }  // end of namespace particlefactory
@@ -14,6 +14,7 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <unordered_map>
 
 #include "chrono/core/ChLinearAlgebra.h"
 #include "chrono/core/ChTransform.h"
@@ -44,7 +45,9 @@ ChAssembly::ChAssembly()
       nsysvars(0),
       nsysvars_w(0),
       nbodies_sleep(0),
-      nbodies_fixed(0) {}
+      nbodies_fixed(0),
+      parallel_update(false),
+      link_colors_valid(false) {}
 
 ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nbodies = other.nbodies;
@@ -61,6 +64,8 @@ ChAssembly::ChAssembly(const ChAssembly& other) : ChPhysicsItem(other) {
     nsysvars_w = other.nsysvars_w;
     nbodies_sleep = other.nbodies_sleep;
     nbodies_fixed = other.nbodies_fixed;
+    parallel_update = other.parallel_update;
+    link_colors_valid = false;
 
     //// RADU
     //// TODO:  deep copy of the object lists (bodylist, linklist, otherphysicslist)
@@ -92,6 +97,7 @@ void ChAssembly::Clear() {
     ncoords_w = 0;
     nbodies_sleep = 0;
     nbodies_fixed = 0;
+    InvalidateLinkColors();
 }
 
 void ChAssembly::AddBody(std::shared_ptr<ChBody> newbody) {
@@ -102,6 +108,7 @@ void ChAssembly::AddBody(std::shared_ptr<ChBody> newbody) {
     // set system and also add collision models to system
     newbody->SetSystem(this->GetSystem());
     bodylist.push_back(newbody);
+    InvalidateLinkColors();
 }
 
 void ChAssembly::RemoveBody(std::shared_ptr<ChBody> mbody) {
@@ -113,6 +120,7 @@ void ChAssembly::RemoveBody(std::shared_ptr<ChBody> mbody) {
 
     // nullify backward link to system and also remove from collision system
     mbody->SetSystem(0);
+    InvalidateLinkColors();
 }
 
 void ChAssembly::AddLink(std::shared_ptr<ChLink> newlink) {
@@ -121,6 +129,7 @@ void ChAssembly::AddLink(std::shared_ptr<ChLink> newlink) {
 
     newlink->SetSystem(this->GetSystem());
     linklist.push_back(newlink);
+    InvalidateLinkColors();
 }
 
 void ChAssembly::RemoveLink(std::shared_ptr<ChLink> mlink) {
@@ -132,6 +141,7 @@ void ChAssembly::RemoveLink(std::shared_ptr<ChLink> mlink) {
 
     // nullify backward link to system
     mlink->SetSystem(0);
+    InvalidateLinkColors();
 }
 
 void ChAssembly::AddOtherPhysicsItem(std::shared_ptr<ChPhysicsItem> newitem) {
@@ -201,6 +211,7 @@ void ChAssembly::RemoveAllBodies() {
         bodylist[ip]->SetSystem(0);
     }
     bodylist.clear();
+    InvalidateLinkColors();
 }
 
 void ChAssembly::RemoveAllLinks() {
@@ -209,6 +220,7 @@ void ChAssembly::RemoveAllLinks() {
         linklist[ip]->SetSystem(0);
     }
     linklist.clear();
+    InvalidateLinkColors();
 }
 
 void ChAssembly::RemoveAllOtherPhysicsItems() {
@@ -405,6 +417,20 @@ void ChAssembly::Setup() {
 
     
 
+    // Partition links for multithreaded processing. The partition only depends on the non-fixed bodies of each link,
+    // so it is only recomputed if links were added or removed, or if any link now connects other bodies (e.g. after
+    // it was initialized again, or after one of its bodies was fixed or released).
+    if (parallel_update) {
+        bool valid = link_colors_valid && link_colors_bodies.size() == 2 * linklist.size();
+        for (size_t ip = 0; valid && ip < linklist.size(); ++ip) {
+            ChBodyFrame* frames[2];
+            GetLinkColorBodies(linklist[ip].get(), frames);
+            valid = frames[0] == link_colors_bodies[2 * ip] && frames[1] == link_colors_bodies[2 * ip + 1];
+        }
+        if (!valid)
+            ComputeLinkColors();
+    }
+
     ndoc = ndoc_w + nbodies;          // number of constraints including quaternion constraints.
     nsysvars = ncoords + ndoc;        // total number of variables (coordinates + lagrangian multipliers)
     nsysvars_w = ncoords_w + ndoc_w;  // total number of variables (with 6 dof per body)
@@ -413,6 +439,99 @@ void ChAssembly::Setup() {
         ncoords_w - ndoc_w;  // number of degrees of freedom (approximate - does not consider constr. redundancy, etc)
 }
 
+// Bodies of a link which constrain its color: fixed bodies do not receive loads from links and can therefore be
+// shared within a color (they are returned as null).
+void ChAssembly::GetLinkColorBodies(ChLink* link, ChBodyFrame* frames[2]) {
+    frames[0] = link->GetBody1();
+    frames[1] = link->GetBody2();
+    for (int ib = 0; ib < 2; ++ib) {
+        ChBody* body = dynamic_cast<ChBody*>(frames[ib]);
+        if (body && body->GetBodyFixed())
+            frames[ib] = nullptr;
+    }
+}
+
+// Greedy coloring of the links: each link is assigned the lowest color not yet used by any of its two
+// non-fixed bodies.
+void ChAssembly::ComputeLinkColors() {
+    link_colors.clear();
+    link_colors_bodies.resize(2 * linklist.size());
+
+    std::unordered_map<ChBodyFrame*, std::vector<int>> body_colors;
+    body_colors.reserve(2 * linklist.size());
+
+    auto has_color = [](const std::vector<int>* colors, int color) {
+        return colors && std::find(colors->begin(), colors->end(), color) != colors->end();
+    };
+
+    for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+        ChLink* Lpointer = linklist[ip].get();
+
+        std::vector<int>* colors[2] = {nullptr, nullptr};
+        ChBodyFrame* frames[2];
+        GetLinkColorBodies(Lpointer, frames);
+        for (int ib = 0; ib < 2; ++ib) {
+            link_colors_bodies[2 * ip + ib] = frames[ib];
+            if (frames[ib])
+                colors[ib] = &body_colors[frames[ib]];
+        }
+        if (colors[1] == colors[0])
+            colors[1] = nullptr;
+
+        int color = 0;
+        while (has_color(colors[0], color) || has_color(colors[1], color))
+            color++;
+
+        for (int ib = 0; ib < 2; ++ib) {
+            if (colors[ib])
+                colors[ib]->push_back(color);
+        }
+
+        if (color >= (int)link_colors.size())
+            link_colors.resize(color + 1);
+        link_colors[color].push_back(ip);
+    }
+
+    link_colors_valid = true;
+}
+
+int ChAssembly::GetParallelThreads() const {
+    if (!parallel_update || !system)
+        return 1;
+    return system->GetParallelThreadNumber();
+}
+
+template <class Function>
+void ChAssembly::ForEachBody(Function func) {
+    int nthreads = GetParallelThreads();
+
+#pragma omp parallel for schedule(dynamic, 32) num_threads(nthreads) if (nthreads > 1)
+    for (int ip = 0; ip < (int)bodylist.size(); ++ip) {
+        func(bodylist[ip].get());
+    }
+}
+
+template <class Function>
+void ChAssembly::ForEachLink(Function func) {
+    int nthreads = GetParallelThreads();
+
+    // Process sequentially, in list order, if not running multithreaded or if the link list changed since
+    // the link groups were last computed (in Setup).
+    if (nthreads == 1 || link_colors.empty()) {
+        for (int ip = 0; ip < (int)linklist.size(); ++ip) {
+            func(linklist[ip].get());
+        }
+        return;
+    }
+
+    for (const auto& color : link_colors) {
+#pragma omp parallel for schedule(dynamic, 32) num_threads(nthreads)
+        for (int i = 0; i < (int)color.size(); ++i) {
+            func(linklist[color[i]].get());
+        }
+    }
+}
+
 // Update assemblies own properties first (ChTime and assets, if any).
 // Then update all contents of this assembly.
 void ChAssembly::Update(double mytime, bool update_assets) {
@@ -425,15 +544,11 @@ void ChAssembly::Update(double mytime, bool update_assets) {
 // - UPDATES ALL FORCES  (AUTOMATIC, AS CHILDREN OF BODIES)
 // - UPDATES ALL MARKERS (AUTOMATIC, AS CHILDREN OF BODIES).
 void ChAssembly::Update(bool update_assets) {
-    for (int ip = 0; ip < bodylist.size(); ++ip) {
-        bodylist[ip]->Update(ChTime, update_assets);
-    }
+    ForEachBody([&](ChBody* Bpointer) { Bpointer->Update(ChTime, update_assets); });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->Update(ChTime, update_assets);
     }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        linklist[ip]->Update(ChTime, update_assets);
-    }
+    ForEachLink([&](ChLink* Lpointer) { Lpointer->Update(ChTime, update_assets); });
 }
 
 void ChAssembly::SetNoSpeedNoAcceleration() {
@@ -456,16 +571,16 @@ void ChAssembly::IntStateGather(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
+        double T_item;  // not shared among threads
         if (Bpointer->IsActive())
-            Bpointer->IntStateGather(displ_x + Bpointer->GetOffset_x(), x, displ_v + Bpointer->GetOffset_w(), v, T);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+            Bpointer->IntStateGather(displ_x + Bpointer->GetOffset_x(), x, displ_v + Bpointer->GetOffset_w(), v, T_item);
+    });
+    ForEachLink([&](ChLink* Lpointer) {
+        double T_item;  // not shared among threads
         if (Lpointer->IsActive())
-            Lpointer->IntStateGather(displ_x + Lpointer->GetOffset_x(), x, displ_v + Lpointer->GetOffset_w(), v, T);
-    }
+            Lpointer->IntStateGather(displ_x + Lpointer->GetOffset_x(), x, displ_v + Lpointer->GetOffset_w(), v, T_item);
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntStateGather(displ_x + Ppointer->GetOffset_x(), x, displ_v + Ppointer->GetOffset_w(), v, T);
@@ -481,16 +596,14 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntStateScatter(displ_x + Bpointer->GetOffset_x(), x, displ_v + Bpointer->GetOffset_w(), v, T);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntStateScatter(displ_x + Lpointer->GetOffset_x(), x, displ_v + Lpointer->GetOffset_w(), v, T);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntStateScatter(displ_x + Ppointer->GetOffset_x(), x, displ_v + Ppointer->GetOffset_w(), v, T);
@@ -507,16 +620,14 @@ void ChAssembly::IntStateScatter(const unsigned int off_x,
 void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntStateGatherAcceleration(displ_a + Bpointer->GetOffset_w(), a);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntStateGatherAcceleration(displ_a + Lpointer->GetOffset_w(), a);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntStateGatherAcceleration(displ_a + Ppointer->GetOffset_w(), a);
@@ -527,16 +638,14 @@ void ChAssembly::IntStateGatherAcceleration(const unsigned int off_a, ChStateDel
 void ChAssembly::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
     unsigned int displ_a = off_a - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntStateScatterAcceleration(displ_a + Bpointer->GetOffset_w(), a);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntStateScatterAcceleration(displ_a + Lpointer->GetOffset_w(), a);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntStateScatterAcceleration(displ_a + Ppointer->GetOffset_w(), a);
@@ -591,19 +700,17 @@ void ChAssembly::IntStateIncrement(const unsigned int off_x,
     unsigned int displ_x = off_x - this->offset_x;
     unsigned int displ_v = off_v - this->offset_w;
 
-    for (int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntStateIncrement(displ_x + Bpointer->GetOffset_x(), x_new, x, displ_v + Bpointer->GetOffset_w(),
                                         Dv);
-    }
+    });
 
-    for (int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntStateIncrement(displ_x + Lpointer->GetOffset_x(), x_new, x, displ_v + Lpointer->GetOffset_w(),
                                         Dv);
-    }
+    });
 
     for (int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
@@ -617,16 +724,14 @@ void ChAssembly::IntLoadResidual_F(const unsigned int off,  ///< offset in R res
 {
     unsigned int displ_v = off - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntLoadResidual_F(displ_v + Bpointer->GetOffset_w(), R, c);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntLoadResidual_F(displ_v + Lpointer->GetOffset_w(), R, c);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntLoadResidual_F(displ_v + Ppointer->GetOffset_w(), R, c);
@@ -640,16 +745,14 @@ void ChAssembly::IntLoadResidual_Mv(const unsigned int off,      ///< offset in
 ) {
     unsigned int displ_v = off - this->offset_w;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntLoadResidual_Mv(displ_v + Bpointer->GetOffset_w(), R, w, c);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntLoadResidual_Mv(displ_v + Lpointer->GetOffset_w(), R, w, c);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntLoadResidual_Mv(displ_v + Ppointer->GetOffset_w(), R, w, c);
@@ -663,16 +766,14 @@ void ChAssembly::IntLoadResidual_CqL(const unsigned int off_L,    ///< offset in
 ) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntLoadResidual_CqL(displ_L + Bpointer->GetOffset_L(), R, L, c);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntLoadResidual_CqL(displ_L + Lpointer->GetOffset_L(), R, L, c);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntLoadResidual_CqL(displ_L + Ppointer->GetOffset_L(), R, L, c);
@@ -687,16 +788,14 @@ void ChAssembly::IntLoadConstraint_C(const unsigned int off_L,  ///< offset in Q
 ) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntLoadConstraint_C(displ_L + Bpointer->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntLoadConstraint_C(displ_L + Lpointer->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntLoadConstraint_C(displ_L + Ppointer->GetOffset_L(), Qc, c, do_clamp, recovery_clamp);
@@ -709,16 +808,14 @@ void ChAssembly::IntLoadConstraint_Ct(const unsigned int off_L,  ///< offset in
 ) {
     unsigned int displ_L = off_L - this->offset_L;
 
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        std::shared_ptr<ChBody> Bpointer = bodylist[ip];
+    ForEachBody([&](ChBody* Bpointer) {
         if (Bpointer->IsActive())
             Bpointer->IntLoadConstraint_Ct(displ_L + Bpointer->GetOffset_L(), Qc, c);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+    });
+    ForEachLink([&](ChLink* Lpointer) {
         if (Lpointer->IsActive())
             Lpointer->IntLoadConstraint_Ct(displ_L + Lpointer->GetOffset_L(), Qc, c);
-    }
+    });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         std::shared_ptr<ChPhysicsItem> Ppointer = otherphysicslist[ip];
         Ppointer->IntLoadConstraint_Ct(displ_L + Ppointer->GetOffset_L(), Qc, c);
@@ -806,12 +903,8 @@ void ChAssembly::VariablesFbReset() {
 }
 
 void ChAssembly::VariablesFbLoadForces(double factor) {
-    for (unsigned int ip = 0; ip < bodylist.size(); ++ip) {
-        bodylist[ip]->VariablesFbLoadForces(factor);
-    }
-    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
-        linklist[ip]->VariablesFbLoadForces(factor);
-    }
+    ForEachBody([&](ChBody* Bpointer) { Bpointer->VariablesFbLoadForces(factor); });
+    ForEachLink([&](ChLink* Lpointer) { Lpointer->VariablesFbLoadForces(factor); });
     for (unsigned int ip = 0; ip < otherphysicslist.size(); ++ip) {
         otherphysicslist[ip]->VariablesFbLoadForces(factor);
     }
@@ -115,6 +115,26 @@ class ChApi ChAssembly : public ChPhysicsItem {
     /// Search a marker by its unique ID.
     std::shared_ptr<ChMarker> SearchMarker(int markID);
 
+    //
+    // PARALLEL PROCESSING
+    //
+
+    /// Enable or disable multithreaded processing of the bodies and links of this assembly (default: false).
+    /// When enabled, the update, state gather/scatter and residual loading loops over bodies and links are
+    /// executed with the number of threads of the parent ChSystem (see ChSystem::SetParallelThreadNumber).
+    /// Bodies are processed concurrently. Links are partitioned in groups (colors) such that no two links
+    /// of a group act on the same non-fixed body; the groups are processed in sequence and the links of a
+    /// group concurrently, so that loads applied by links to shared bodies are accumulated without races.
+    /// Other physics items are always processed sequentially.
+    /// Note that this requires links to only write to their own states and to those of their two bodies.
+    void SetParallelUpdate(bool mval) { parallel_update = mval; }
+
+    /// Return true if multithreaded processing of bodies and links is enabled.
+    bool GetParallelUpdate() const { return parallel_update; }
+
+    /// Get the number of link groups used for multithreaded processing (0 if not yet computed).
+    int GetNlinkColors() const { return (int)link_colors.size(); }
+
     //
     // STATISTICS
     //
@@ -272,6 +292,31 @@ class ChApi ChAssembly : public ChPhysicsItem {
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
 
   protected:
+    /// Partition the links in groups which do not share any non-fixed body.
+    void ComputeLinkColors();
+
+    /// Get the two bodies of a link which are considered in the partition (null if fixed or missing).
+    static void GetLinkColorBodies(ChLink* link, ChBodyFrame* frames[2]);
+
+    /// Force a new partition of the links at the next Setup (called when the link or body lists change).
+    void InvalidateLinkColors() {
+        link_colors.clear();
+        link_colors_bodies.clear();
+        link_colors_valid = false;
+    }
+
+    /// Return the number of threads to be used for processing bodies and links.
+    int GetParallelThreads() const;
+
+    /// Apply the given function to all bodies, concurrently if multithreaded processing is enabled.
+    template <class Function>
+    void ForEachBody(Function func);
+
+    /// Apply the given function to all links, concurrently within each link group if multithreaded
+    /// processing is enabled.
+    template <class Function>
+    void ForEachLink(Function func);
+
     std::vector<std::shared_ptr<ChBody>> bodylist;  ///< list of rigid bodies
     std::vector<std::shared_ptr<ChLink>> linklist;  ///< list of joints (links)
     std::vector<std::shared_ptr<ChPhysicsItem>>
@@ -294,6 +339,11 @@ class ChApi ChAssembly : public ChPhysicsItem {
     int ndoc_w_D;       ///< number of scalar constraints D, when using 3 rot. dof. per body (only unilaterals)
     int nbodies_sleep;  ///< number of bodies that are sleeping
     int nbodies_fixed;  ///< number of bodies that are fixed
+
+    bool parallel_update;                          ///< multithreaded processing of bodies and links
+    std::vector<std::vector<int>> link_colors;     ///< groups of indices in linklist not sharing any non-fixed body
+    std::vector<ChBodyFrame*> link_colors_bodies;  ///< non-fixed bodies of each link when the groups were computed
+    bool link_colors_valid;                        ///< is the link partition up to date?
 };
 
 
@@ -42,6 +42,10 @@ class ChApi ChContactContainer : public ChPhysicsItem {
     /// Remove (delete) all contained contact data. To be implemented by child classes.
     virtual void RemoveAllContacts() = 0;
 
+    /// Remove (delete) the contacts that involve a contactable of the specified physics item, for
+    /// example after the item moved its contactables in memory. By default, remove all contacts.
+    virtual void RemoveContacts(ChPhysicsItem* item) { RemoveAllContacts(); }
+
     /// The collision system will call BeginAddContact() before adding
     /// all contacts (for example with AddContact() or similar). By default
     /// it deletes all previous contacts. Custom more efficient implementations
@@ -87,6 +87,43 @@ void ChContactContainerNSC::RemoveAllContacts() {
     _RemoveAllContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling);
 }
 
+// Delete the contacts that involve the given item, keeping the others (and their order).
+// Contacts before 'lastcontact' are the ones added since the last BeginAddContact().
+template <class Tcont, class Titer>
+void _RemoveContacts(std::list<Tcont*>& contactlist, Titer& lastcontact, int& n_added, ChPhysicsItem* item) {
+    bool added = true;
+    typename std::list<Tcont*>::iterator itercontact = contactlist.begin();
+    while (itercontact != contactlist.end()) {
+        if (itercontact == lastcontact)
+            added = false;
+        if ((*itercontact)->GetObjA()->GetPhysicsItem() == item ||
+            (*itercontact)->GetObjB()->GetPhysicsItem() == item) {
+            if (itercontact == lastcontact)
+                ++lastcontact;
+            if (added)
+                n_added--;
+            delete (*itercontact);
+            itercontact = contactlist.erase(itercontact);
+        } else {
+            ++itercontact;
+        }
+    }
+}
+
+void ChContactContainerNSC::RemoveContacts(ChPhysicsItem* item) {
+    _RemoveContacts(contactlist_6_6, lastcontact_6_6, n_added_6_6, item);
+    _RemoveContacts(contactlist_6_3, lastcontact_6_3, n_added_6_3, item);
+    _RemoveContacts(contactlist_3_3, lastcontact_3_3, n_added_3_3, item);
+    _RemoveContacts(contactlist_333_3, lastcontact_333_3, n_added_333_3, item);
+    _RemoveContacts(contactlist_333_6, lastcontact_333_6, n_added_333_6, item);
+    _RemoveContacts(contactlist_333_333, lastcontact_333_333, n_added_333_333, item);
+    _RemoveContacts(contactlist_666_3, lastcontact_666_3, n_added_666_3, item);
+    _RemoveContacts(contactlist_666_6, lastcontact_666_6, n_added_666_6, item);
+    _RemoveContacts(contactlist_666_333, lastcontact_666_333, n_added_666_333, item);
+    _RemoveContacts(contactlist_666_666, lastcontact_666_666, n_added_666_666, item);
+    _RemoveContacts(contactlist_6_6_rolling, lastcontact_6_6_rolling, n_added_6_6_rolling, item);
+}
+
 void ChContactContainerNSC::BeginAddContact() {
     lastcontact_6_6 = contactlist_6_6.begin();
     n_added_6_6 = 0;
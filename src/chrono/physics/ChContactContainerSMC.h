@@ -93,6 +93,9 @@ class ChApi ChContactContainerSMC : public ChContactContainer {
     /// Remove (delete) all contained contact data.
     virtual void RemoveAllContacts() override;
 
+    /// Remove (delete) the contacts that involve a contactable of the specified physics item.
+    virtual void RemoveContacts(ChPhysicsItem* item) override;
+
     /// The collision system will call BeginAddContact() before adding
     /// all contacts (for example with AddContact() or similar). Instead of
     /// simply deleting all list of the previous contacts, this optimized implementation
@@ -54,14 +54,14 @@ class ChApi ChLinkClearance : public ChLinkLock {
     double Get_clearance() { return clearance; }
     void Set_clearance(double mset) {
         clearance = mset;
-        limit_X->Set_max(clearance);
+        GetLimit_X()->Set_max(clearance);
     }
     double Get_c_friction() { return c_friction; }
     void Set_c_friction(double mset) { c_friction = mset; }
     double Get_c_restitution() { return c_restitution; }
     void Set_c_restitution(double mset) {
         c_restitution = mset;
-        limit_X->Set_maxElastic(c_restitution);
+        GetLimit_X()->Set_maxElastic(c_restitution);
     }
     double Get_c_tang_restitution() { return c_tang_restitution; }
     void Set_c_tang_restitution(double mset) { c_tang_restitution = mset; }
@@ -239,7 +239,8 @@ void ChLinkEngine::UpdateTime(double mytime) {
         deltaC.pos = VNULL;
         deltaC_dt.pos = VNULL;
         deltaC_dtdt.pos = VNULL;
-        if (!(limit_Rx->Get_active() || limit_Ry->Get_active() || limit_Rz->Get_active())) {
+        if (!((limit_Rx && limit_Rx->Get_active()) || (limit_Ry && limit_Ry->Get_active()) ||
+              (limit_Rz && limit_Rz->Get_active()))) {
             deltaC.rot = QUNIT;
             deltaC_dt.rot = QNULL;
             deltaC_dtdt.rot = QNULL;
@@ -30,9 +30,6 @@ ChLinkForce::ChLinkForce(const ChLinkForce& other) {
     R = other.R;
 
     // replace functions:
-    delete modul_iforce;
-    delete modul_K;
-    delete modul_R;
     modul_iforce = other.modul_iforce->Clone();
     modul_K = other.modul_K->Clone();
     modul_R = other.modul_R->Clone();
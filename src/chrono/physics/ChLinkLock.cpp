@@ -30,11 +30,6 @@ ChLinkLock::ChLinkLock()
       deltaC_dtdt(CSYSNULL),
       motion_axis(VECT_Z),
       angleset(AngleSet::ANGLE_AXIS) {
-    // matrices used by lock formulation
-    Cq1_temp = new ChMatrixDynamic<>(7, BODY_QDOF);
-    Cq2_temp = new ChMatrixDynamic<>(7, BODY_QDOF);
-    Qc_temp = new ChMatrixDynamic<>(7, 1);
-
     motion_X = std::make_shared<ChFunction_Const>(0);  // default: no motion
     motion_Y = std::make_shared<ChFunction_Const>(0);
     motion_Z = std::make_shared<ChFunction_Const>(0);
@@ -42,15 +37,10 @@ ChLinkLock::ChLinkLock()
     motion_ang2 = std::make_shared<ChFunction_Const>(0);
     motion_ang3 = std::make_shared<ChFunction_Const>(0);
 
-    limit_X = new ChLinkLimit;  // default: inactive limits
-    limit_Y = new ChLinkLimit;
-    limit_Z = new ChLinkLimit;
-    limit_Rx = new ChLinkLimit;
-    limit_Ry = new ChLinkLimit;
-    limit_Rz = new ChLinkLimit;
-    limit_D = new ChLinkLimit;
-    limit_Rp = new ChLinkLimit;  // the polar limit;
-    limit_Rp->Set_polar(true);
+    // default: inactive limits (allocated on first access)
+    limit_X = limit_Y = limit_Z = NULL;
+    limit_Rx = limit_Ry = limit_Rz = NULL;
+    limit_D = limit_Rp = NULL;
 
     // delete the class mask created by base constructor
     if (mask)
@@ -66,14 +56,14 @@ ChLinkLock::ChLinkLock()
 ChLinkLock::ChLinkLock(const ChLinkLock& other) : ChLinkMasked(other) {
     type = other.type;
 
-    limit_X = other.limit_X->Clone();
-    limit_Y = other.limit_Y->Clone();
-    limit_Z = other.limit_Z->Clone();
-    limit_Rx = other.limit_Rx->Clone();
-    limit_Ry = other.limit_Ry->Clone();
-    limit_Rz = other.limit_Rz->Clone();
-    limit_Rp = other.limit_Rp->Clone();
-    limit_D = other.limit_D->Clone();
+    limit_X = other.limit_X ? other.limit_X->Clone() : NULL;
+    limit_Y = other.limit_Y ? other.limit_Y->Clone() : NULL;
+    limit_Z = other.limit_Z ? other.limit_Z->Clone() : NULL;
+    limit_Rx = other.limit_Rx ? other.limit_Rx->Clone() : NULL;
+    limit_Ry = other.limit_Ry ? other.limit_Ry->Clone() : NULL;
+    limit_Rz = other.limit_Rz ? other.limit_Rz->Clone() : NULL;
+    limit_Rp = other.limit_Rp ? other.limit_Rp->Clone() : NULL;
+    limit_D = other.limit_D ? other.limit_D->Clone() : NULL;
 
     deltaC = other.deltaC;
     deltaC_dt = other.deltaC_dt;
@@ -97,29 +87,7 @@ ChLinkLock::ChLinkLock(const ChLinkLock& other) : ChLinkMasked(other) {
 }
 
 ChLinkLock::~ChLinkLock() {
-    if (Cq1_temp)
-        delete Cq1_temp;
-    if (Cq2_temp)
-        delete Cq2_temp;
-    if (Qc_temp)
-        delete Qc_temp;
-
-    if (limit_X)
-        delete limit_X;
-    if (limit_Y)
-        delete limit_Y;
-    if (limit_Z)
-        delete limit_Z;
-    if (limit_Rx)
-        delete limit_Rx;
-    if (limit_Ry)
-        delete limit_Ry;
-    if (limit_Rz)
-        delete limit_Rz;
-    if (limit_Rp)
-        delete limit_Rp;
-    if (limit_D)
-        delete limit_D;
+    DestroyLimits();
 
     // jacobians etc. are deleted by base class, which also calls
     // DestroyLinkType()
@@ -164,6 +132,7 @@ void ChLinkLock::BuildLinkType(LinkType link_type) {
             break;
         case LinkType::ALIGN:
             m_mask.SetLockMask(false, false, false, false, true, true, true);
+            break;
         case LinkType::PARALLEL:
             m_mask.SetLockMask(false, false, false, false, true, true, false);
             break;
@@ -196,32 +165,22 @@ void ChLinkLock::ChangeLinkType(LinkType new_link_type) {
     motion_axis = VECT_Z;
     angleset = AngleSet::ANGLE_AXIS;
 
-    if (limit_X)
-        delete limit_X;
-    if (limit_Y)
-        delete limit_Y;
-    if (limit_Z)
-        delete limit_Z;
-    if (limit_Rx)
-        delete limit_Rx;
-    if (limit_Ry)
-        delete limit_Ry;
-    if (limit_Rz)
-        delete limit_Rz;
-    if (limit_Rp)
-        delete limit_Rp;
-    if (limit_D)
-        delete limit_D;
-
-    limit_X = new ChLinkLimit;  // default: inactive limits
-    limit_Y = new ChLinkLimit;
-    limit_Z = new ChLinkLimit;
-    limit_Rx = new ChLinkLimit;
-    limit_Ry = new ChLinkLimit;
-    limit_Rz = new ChLinkLimit;
-    limit_D = new ChLinkLimit;
-    limit_Rp = new ChLinkLimit;  // the polar limit;
-    limit_Rp->Set_polar(true);
+    DestroyLimits();
+}
+
+void ChLinkLock::DestroyLimits() {
+    delete limit_X;
+    delete limit_Y;
+    delete limit_Z;
+    delete limit_Rx;
+    delete limit_Ry;
+    delete limit_Rz;
+    delete limit_Rp;
+    delete limit_D;
+
+    limit_X = limit_Y = limit_Z = NULL;
+    limit_Rx = limit_Ry = limit_Rz = NULL;
+    limit_D = limit_Rp = NULL;
 }
 
 // setup the functions when user changes them.
@@ -269,8 +228,9 @@ void ChLinkLock::UpdateTime(double time) {
 
     // If some limit is provided, the delta values may have been
     // changed by limits themselves, so no further modifications by motion laws..
-    if (limit_X->Get_active() || limit_Y->Get_active() || limit_Z->Get_active() || limit_Rx->Get_active() ||
-        limit_Ry->Get_active() || limit_Rz->Get_active())
+    if ((limit_X && limit_X->Get_active()) || (limit_Y && limit_Y->Get_active()) ||
+        (limit_Z && limit_Z->Get_active()) || (limit_Rx && limit_Rx->Get_active()) ||
+        (limit_Ry && limit_Ry->Get_active()) || (limit_Rz && limit_Rz->Get_active()))
         return;
 
     // Update motion position/speed/acceleration by motion laws
@@ -596,97 +556,118 @@ void ChLinkLock::UpdateState() {
 
     //------------ COMPLETE JACOBIANS Cq1_temp AND Cq2_temp AND Qc_temp VECTOR.
 
+    // Only the translational (rows 0-2) and rotational (rows 3-6) blocks which are used by at least one
+    // active constraint or limit are computed; the rows of an inactive block are never read.
+
+    ChLinkMaskLF* mmask = (ChLinkMaskLF*)this->mask;
+
+    bool transl_active = mmask->Constr_X().IsActive() || mmask->Constr_Y().IsActive() ||
+                         mmask->Constr_Z().IsActive() || (limit_X && limit_X->Get_active()) ||
+                         (limit_Y && limit_Y->Get_active()) || (limit_Z && limit_Z->Get_active());
+    bool rot_active = mmask->Constr_E0().IsActive() || mmask->Constr_E1().IsActive() ||
+                      mmask->Constr_E2().IsActive() || mmask->Constr_E3().IsActive() ||
+                      (limit_Rx && limit_Rx->Get_active()) || (limit_Ry && limit_Ry->Get_active()) ||
+                      (limit_Rz && limit_Rz->Get_active());
+
     //  JACOBIANS Cq1_temp, Cq2_temp:
 
-    mtemp1.CopyFromMatrixT(marker2->GetA());
-    CqxT.MatrMultiplyT(mtemp1, Body2->GetA());  // [CqxT]=[Aq]'[Ao2]'
+    if (transl_active) {
+        mtemp1.CopyFromMatrixT(marker2->GetA());
+        CqxT.MatrMultiplyT(mtemp1, Body2->GetA());  // [CqxT]=[Aq]'[Ao2]'
 
-    Cq1_temp->PasteMatrix(CqxT, 0, 0);  // *- -- Cq1_temp(1-3)  =[Aqo2]
+        Cq1_temp.PasteMatrix(CqxT, 0, 0);  // *- -- Cq1_temp(1-3)  =[Aqo2]
 
-    CqxT.MatrNeg();
-    Cq2_temp->PasteMatrix(CqxT, 0, 0);  // -- *- Cq2_temp(1-3)  =-[Aqo2]
+        CqxT.MatrNeg();
+        Cq2_temp.PasteMatrix(CqxT, 0, 0);  // -- *- Cq2_temp(1-3)  =-[Aqo2]
 
-    mtemp1.MatrMultiply(CqxT, Body1->GetA());
-    mtemp2.MatrMultiply(mtemp1, P1star);
+        mtemp1.MatrMultiply(CqxT, Body1->GetA());
+        mtemp2.MatrMultiply(mtemp1, P1star);
 
-    CqxR.MatrMultiply(mtemp2, body1Gl);
+        CqxR.MatrMultiply(mtemp2, body1Gl);
 
-    Cq1_temp->PasteMatrix(CqxR, 0, 3);  // -* -- Cq1_temp(4-7)
+        Cq1_temp.PasteMatrix(CqxR, 0, 3);  // -* -- Cq1_temp(4-7)
 
-    CqxT.MatrNeg();
-    mtemp1.MatrMultiply(CqxT, Body2->GetA());
-    mtemp2.MatrMultiply(mtemp1, Q2star);
-    CqxR.MatrMultiply(mtemp2, body2Gl);
-    Cq2_temp->PasteMatrix(CqxR, 0, 3);
+        CqxT.MatrNeg();
+        mtemp1.MatrMultiply(CqxT, Body2->GetA());
+        mtemp2.MatrMultiply(mtemp1, Q2star);
+        CqxR.MatrMultiply(mtemp2, body2Gl);
+        Cq2_temp.PasteMatrix(CqxR, 0, 3);
 
-    mtemp1.CopyFromMatrixT(marker2->GetA());
-    mtemp2.Set_X_matrix(Body2->GetA().MatrT_x_Vect(PQw));
-    mtemp3.MatrMultiply(mtemp1, mtemp2);
-    CqxR.MatrMultiply(mtemp3, body2Gl);
+        mtemp1.CopyFromMatrixT(marker2->GetA());
+        mtemp2.Set_X_matrix(Body2->GetA().MatrT_x_Vect(PQw));
+        mtemp3.MatrMultiply(mtemp1, mtemp2);
+        CqxR.MatrMultiply(mtemp3, body2Gl);
 
-    Cq2_temp->PasteSumMatrix(CqxR, 0, 3);  // -- -* Cq1_temp(4-7)
+        Cq2_temp.PasteSumMatrix(CqxR, 0, 3);  // -- -* Cq1_temp(4-7)
+    }
 
-    mtempQ1.Set_Xq_matrix(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
-    CqrR.Set_Xq_matrix(marker1->GetCoord().rot);
-    CqrR.MatrXq_SemiTranspose();
-    mtempQ2.MatrMultiply(mtempQ1, CqrR);
-    mtempQ1.Set_Xq_matrix(Qconjugate(deltaC.rot));
-    CqrR.MatrMultiply(mtempQ1, mtempQ2);
+    if (rot_active) {
+        mtempQ1.Set_Xq_matrix(Qcross(Qconjugate(marker2->GetCoord().rot), Qconjugate(Body2->GetCoord().rot)));
+        CqrR.Set_Xq_matrix(marker1->GetCoord().rot);
+        CqrR.MatrXq_SemiTranspose();
+        mtempQ2.MatrMultiply(mtempQ1, CqrR);
+        mtempQ1.Set_Xq_matrix(Qconjugate(deltaC.rot));
+        CqrR.MatrMultiply(mtempQ1, mtempQ2);
 
-    Cq1_temp->PasteMatrix(CqrR, 3, 3);  // =* == Cq1_temp(col 4-7, row 4-7)
+        Cq1_temp.PasteMatrix(CqrR, 3, 3);  // =* == Cq1_temp(col 4-7, row 4-7)
 
-    mtempQ1.Set_Xq_matrix(Qconjugate(marker2->GetCoord().rot));
-    CqrR.Set_Xq_matrix(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
-    CqrR.MatrXq_SemiTranspose();
-    CqrR.MatrXq_SemiNeg();
-    mtempQ2.MatrMultiply(mtempQ1, CqrR);
-    mtempQ1.Set_Xq_matrix(Qconjugate(deltaC.rot));
-    CqrR.MatrMultiply(mtempQ1, mtempQ2);
+        mtempQ1.Set_Xq_matrix(Qconjugate(marker2->GetCoord().rot));
+        CqrR.Set_Xq_matrix(Qcross(Body1->GetCoord().rot, marker1->GetCoord().rot));
+        CqrR.MatrXq_SemiTranspose();
+        CqrR.MatrXq_SemiNeg();
+        mtempQ2.MatrMultiply(mtempQ1, CqrR);
+        mtempQ1.Set_Xq_matrix(Qconjugate(deltaC.rot));
+        CqrR.MatrMultiply(mtempQ1, mtempQ2);
 
-    Cq2_temp->PasteMatrix(CqrR, 3, 3);  // == =* Cq2_temp(col 4-7, row 4-7)
+        Cq2_temp.PasteMatrix(CqrR, 3, 3);  // == =* Cq2_temp(col 4-7, row 4-7)
+    }
 
     //--------- COMPLETE Qc VECTOR
 
-    vtemp1 = Vcross(Body1->GetWvel_loc(), Vcross(Body1->GetWvel_loc(), marker1->GetCoord().pos));
-    vtemp1 = Vadd(vtemp1, marker1->GetCoord_dtdt().pos);
-    vtemp1 = Vadd(vtemp1, Vmul(Vcross(Body1->GetWvel_loc(), marker1->GetCoord_dt().pos), 2));
-    vtemp1 = Body1->GetA().Matr_x_Vect(vtemp1);
+    if (transl_active) {
+        vtemp1 = Vcross(Body1->GetWvel_loc(), Vcross(Body1->GetWvel_loc(), marker1->GetCoord().pos));
+        vtemp1 = Vadd(vtemp1, marker1->GetCoord_dtdt().pos);
+        vtemp1 = Vadd(vtemp1, Vmul(Vcross(Body1->GetWvel_loc(), marker1->GetCoord_dt().pos), 2));
+        vtemp1 = Body1->GetA().Matr_x_Vect(vtemp1);
 
-    vtemp2 = Vcross(Body2->GetWvel_loc(), Vcross(Body2->GetWvel_loc(), marker2->GetCoord().pos));
-    vtemp2 = Vadd(vtemp2, marker2->GetCoord_dtdt().pos);
-    vtemp2 = Vadd(vtemp2, Vmul(Vcross(Body2->GetWvel_loc(), marker2->GetCoord_dt().pos), 2));
-    vtemp2 = Body2->GetA().Matr_x_Vect(vtemp2);
+        vtemp2 = Vcross(Body2->GetWvel_loc(), Vcross(Body2->GetWvel_loc(), marker2->GetCoord().pos));
+        vtemp2 = Vadd(vtemp2, marker2->GetCoord_dtdt().pos);
+        vtemp2 = Vadd(vtemp2, Vmul(Vcross(Body2->GetWvel_loc(), marker2->GetCoord_dt().pos), 2));
+        vtemp2 = Body2->GetA().Matr_x_Vect(vtemp2);
 
-    vtemp1 = Vsub(vtemp1, vtemp2);
-    Qcx = CqxT.Matr_x_Vect(vtemp1);
+        vtemp1 = Vsub(vtemp1, vtemp2);
+        Qcx = CqxT.Matr_x_Vect(vtemp1);
 
-    mtemp1.Set_X_matrix(Body2->GetWvel_loc());
-    mtemp2.MatrMultiply(mtemp1, mtemp1);
-    mtemp3.MatrMultiply(Body2->GetA(), mtemp2);
-    mtemp3.MatrTranspose();
-    vtemp1 = mtemp3.Matr_x_Vect(PQw);
-    vtemp2 = marker2->GetA().MatrT_x_Vect(vtemp1);  // [Aq]'[[A2][w2][w2]]'*Qpq,w
-    Qcx = Vadd(Qcx, vtemp2);
+        mtemp1.Set_X_matrix(Body2->GetWvel_loc());
+        mtemp2.MatrMultiply(mtemp1, mtemp1);
+        mtemp3.MatrMultiply(Body2->GetA(), mtemp2);
+        mtemp3.MatrTranspose();
+        vtemp1 = mtemp3.Matr_x_Vect(PQw);
+        vtemp2 = marker2->GetA().MatrT_x_Vect(vtemp1);  // [Aq]'[[A2][w2][w2]]'*Qpq,w
+        Qcx = Vadd(Qcx, vtemp2);
 
-    Qcx = Vadd(Qcx, q_4);  // [Adtdt]'[A]'q + 2[Adt]'[Adt]'q + 2[Adt]'[A]'qdt + 2[A]'[Adt]'qdt
+        Qcx = Vadd(Qcx, q_4);  // [Adtdt]'[A]'q + 2[Adt]'[Adt]'q + 2[Adt]'[A]'qdt + 2[A]'[Adt]'qdt
 
-    Qcx = Vsub(Qcx, deltaC_dtdt.pos);  // ... - deltaC_dtdt
+        Qcx = Vsub(Qcx, deltaC_dtdt.pos);  // ... - deltaC_dtdt
 
-    Qc_temp->PasteVector(Qcx, 0, 0);  // * Qc_temp, for all translational coords
+        Qc_temp.PasteVector(Qcx, 0, 0);  // * Qc_temp, for all translational coords
+    }
 
-    Qcr = Qcross(Qconjugate(deltaC.rot), q_8);
-    Qcr = Qadd(Qcr, Qscale(Qcross(Qconjugate(deltaC_dt.rot), relM_dt.rot), 2));
-    Qcr = Qadd(Qcr, Qcross(Qconjugate(deltaC_dtdt.rot), relM.rot));  // = deltaC'*q_8 + 2*deltaC_dt'*q_dt,po +
-                                                                     // deltaC_dtdt'*q,po
+    if (rot_active) {
+        Qcr = Qcross(Qconjugate(deltaC.rot), q_8);
+        Qcr = Qadd(Qcr, Qscale(Qcross(Qconjugate(deltaC_dt.rot), relM_dt.rot), 2));
+        Qcr = Qadd(Qcr, Qcross(Qconjugate(deltaC_dtdt.rot), relM.rot));  // = deltaC'*q_8 + 2*deltaC_dt'*q_dt,po +
+                                                                         // deltaC_dtdt'*q,po
 
-    Qc_temp->PasteQuaternion(Qcr, 3, 0);  // * Qc_temp, for all rotational coords
+        Qc_temp.PasteQuaternion(Qcr, 3, 0);  // * Qc_temp, for all rotational coords
+    }
 
     // *** NOTE! The definitive  Qc must change sign, to be used in
     // lagrangian equation:    [Cq]*q_dtdt = Qc
     // because until now we have computed it as [Cq]*q_dtdt + "Qc" = 0,
     // but the most used form is the previous, so let's change sign!!
 
-    Qc_temp->MatrNeg();
+    Qc_temp.MatrNeg();
 
     // FINALLY.....
     // ---------------------
@@ -695,14 +676,12 @@ void ChLinkLock::UpdateState() {
     // ---------------------
     int index = 0;
 
-    ChLinkMaskLF* mmask = (ChLinkMaskLF*)this->mask;
-
     if (mmask->Constr_X().IsActive())  // for X constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 0, 0, 1, 7, index, 0);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 0, 0, 1, 7, index, 0);
+        Cq1->PasteClippedMatrix(Cq1_temp, 0, 0, 1, 7, index, 0);
+        Cq2->PasteClippedMatrix(Cq2_temp, 0, 0, 1, 7, index, 0);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(0, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(0, 0));
 
         C->SetElement(index, 0, relC.pos.x());
         C_dt->SetElement(index, 0, relC_dt.pos.x());
@@ -715,10 +694,10 @@ void ChLinkLock::UpdateState() {
 
     if (mmask->Constr_Y().IsActive())  // for Y constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 1, 0, 1, 7, index, 0);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 1, 0, 1, 7, index, 0);
+        Cq1->PasteClippedMatrix(Cq1_temp, 1, 0, 1, 7, index, 0);
+        Cq2->PasteClippedMatrix(Cq2_temp, 1, 0, 1, 7, index, 0);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(1, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(1, 0));
 
         C->SetElement(index, 0, relC.pos.y());
         C_dt->SetElement(index, 0, relC_dt.pos.y());
@@ -731,10 +710,10 @@ void ChLinkLock::UpdateState() {
 
     if (mmask->Constr_Z().IsActive())  // for Z constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 2, 0, 1, 7, index, 0);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 2, 0, 1, 7, index, 0);
+        Cq1->PasteClippedMatrix(Cq1_temp, 2, 0, 1, 7, index, 0);
+        Cq2->PasteClippedMatrix(Cq2_temp, 2, 0, 1, 7, index, 0);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(2, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(2, 0));
 
         C->SetElement(index, 0, relC.pos.z());
         C_dt->SetElement(index, 0, relC_dt.pos.z());
@@ -747,10 +726,10 @@ void ChLinkLock::UpdateState() {
 
     if (mmask->Constr_E0().IsActive())  // for E0 constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 3, 3, 1, 4, index, 3);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 3, 3, 1, 4, index, 3);
+        Cq1->PasteClippedMatrix(Cq1_temp, 3, 3, 1, 4, index, 3);
+        Cq2->PasteClippedMatrix(Cq2_temp, 3, 3, 1, 4, index, 3);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(3, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(3, 0));
 
         C->SetElement(index, 0, relC.rot.e0());
         C_dt->SetElement(index, 0, relC_dt.rot.e0());
@@ -763,10 +742,10 @@ void ChLinkLock::UpdateState() {
 
     if (mmask->Constr_E1().IsActive())  // for E1 constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 4, 3, 1, 4, index, 3);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 4, 3, 1, 4, index, 3);
+        Cq1->PasteClippedMatrix(Cq1_temp, 4, 3, 1, 4, index, 3);
+        Cq2->PasteClippedMatrix(Cq2_temp, 4, 3, 1, 4, index, 3);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(4, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(4, 0));
 
         C->SetElement(index, 0, relC.rot.e1());
         C_dt->SetElement(index, 0, relC_dt.rot.e1());
@@ -779,10 +758,10 @@ void ChLinkLock::UpdateState() {
 
     if (mmask->Constr_E2().IsActive())  // for E2 constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 5, 3, 1, 4, index, 3);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 5, 3, 1, 4, index, 3);
+        Cq1->PasteClippedMatrix(Cq1_temp, 5, 3, 1, 4, index, 3);
+        Cq2->PasteClippedMatrix(Cq2_temp, 5, 3, 1, 4, index, 3);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(5, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(5, 0));
 
         C->SetElement(index, 0, relC.rot.e2());
         C_dt->SetElement(index, 0, relC_dt.rot.e2());
@@ -795,10 +774,10 @@ void ChLinkLock::UpdateState() {
 
     if (mmask->Constr_E3().IsActive())  // for E3 constraint...
     {
-        Cq1->PasteClippedMatrix(*Cq1_temp, 6, 3, 1, 4, index, 3);
-        Cq2->PasteClippedMatrix(*Cq2_temp, 6, 3, 1, 4, index, 3);
+        Cq1->PasteClippedMatrix(Cq1_temp, 6, 3, 1, 4, index, 3);
+        Cq2->PasteClippedMatrix(Cq2_temp, 6, 3, 1, 4, index, 3);
 
-        Qc->SetElement(index, 0, Qc_temp->GetElement(6, 0));
+        Qc->SetElement(index, 0, Qc_temp.GetElement(6, 0));
 
         C->SetElement(index, 0, relC.rot.e3());
         C_dt->SetElement(index, 0, relC_dt.rot.e3());
@@ -825,30 +804,30 @@ void ChLinkLock::UpdateForces(double mytime) {
     ChVector<> m_force = VNULL;
     ChVector<> m_torque = VNULL;
 
-    if (limit_X->Get_active()) {
+    if (limit_X && limit_X->Get_active()) {
         m_force.x() = limit_X->GetForce(relM.pos.x(), relM_dt.pos.x());
     }
-    if (limit_Y->Get_active()) {
+    if (limit_Y && limit_Y->Get_active()) {
         m_force.y() = limit_Y->GetForce(relM.pos.y(), relM_dt.pos.y());
     }
-    if (limit_Z->Get_active()) {
+    if (limit_Z && limit_Z->Get_active()) {
         m_force.z() = limit_Z->GetForce(relM.pos.z(), relM_dt.pos.z());
     }
 
-    if (limit_D->Get_active()) {
+    if (limit_D && limit_D->Get_active()) {
         m_force = Vadd(m_force, Vmul(Vnorm(relM.pos), limit_D->GetForce(dist, dist_dt)));
     }
 
-    if (limit_Rx->Get_active()) {
+    if (limit_Rx && limit_Rx->Get_active()) {
         m_torque.x() = limit_Rx->GetForce(relRotaxis.x(), relWvel.x());
     }
-    if (limit_Ry->Get_active()) {
+    if (limit_Ry && limit_Ry->Get_active()) {
         m_torque.y() = limit_Ry->GetForce(relRotaxis.y(), relWvel.y());
     }
-    if (limit_Rz->Get_active()) {
+    if (limit_Rz && limit_Rz->Get_active()) {
         m_torque.z() = limit_Rz->GetForce(relRotaxis.z(), relWvel.z());
     }
-    if (limit_Rp->Get_active()) {
+    if (limit_Rp && limit_Rp->Get_active()) {
         ChVector<> arm_xaxis = VaxisXfromQuat(relM.rot);  // the X axis of the marker1, respect to m2.
         double zenith = VangleYZplaneNorm(arm_xaxis);     // the angle of m1 Xaxis about normal to YZ plane
         double polar = VangleRX(arm_xaxis);               // the polar angle of m1 Xaxis spinning about m2 Xaxis
@@ -1706,13 +1685,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
     if (limit_X && limit_X->Get_active()) {
         if (limit_X->constr_lower.IsActive()) {
             limit_X->constr_lower.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 0, limit_X->constr_lower.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 0, limit_X->constr_lower.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 0, limit_X->constr_lower.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 0, limit_X->constr_lower.Get_Cq_b(), 0, Body2);
         }
         if (limit_X->constr_upper.IsActive()) {
             limit_X->constr_upper.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 0, limit_X->constr_upper.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 0, limit_X->constr_upper.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 0, limit_X->constr_upper.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 0, limit_X->constr_upper.Get_Cq_b(), 0, Body2);
             limit_X->constr_upper.Get_Cq_a()->MatrNeg();
             limit_X->constr_upper.Get_Cq_b()->MatrNeg();
         }
@@ -1720,13 +1699,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
     if (limit_Y && limit_Y->Get_active()) {
         if (limit_Y->constr_lower.IsActive()) {
             limit_Y->constr_lower.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 1, limit_Y->constr_lower.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 1, limit_Y->constr_lower.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 1, limit_Y->constr_lower.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 1, limit_Y->constr_lower.Get_Cq_b(), 0, Body2);
         }
         if (limit_Y->constr_upper.IsActive()) {
             limit_Y->constr_upper.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 1, limit_Y->constr_upper.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 1, limit_Y->constr_upper.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 1, limit_Y->constr_upper.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 1, limit_Y->constr_upper.Get_Cq_b(), 0, Body2);
             limit_Y->constr_upper.Get_Cq_a()->MatrNeg();
             limit_Y->constr_upper.Get_Cq_b()->MatrNeg();
         }
@@ -1734,13 +1713,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
     if (limit_Z && limit_Z->Get_active()) {
         if (limit_Z->constr_lower.IsActive()) {
             limit_Z->constr_lower.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 2, limit_Z->constr_lower.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 2, limit_Z->constr_lower.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 2, limit_Z->constr_lower.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 2, limit_Z->constr_lower.Get_Cq_b(), 0, Body2);
         }
         if (limit_Z->constr_upper.IsActive()) {
             limit_Z->constr_upper.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 2, limit_Z->constr_upper.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 2, limit_Z->constr_upper.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 2, limit_Z->constr_upper.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 2, limit_Z->constr_upper.Get_Cq_b(), 0, Body2);
             limit_Z->constr_upper.Get_Cq_a()->MatrNeg();
             limit_Z->constr_upper.Get_Cq_b()->MatrNeg();
         }
@@ -1748,13 +1727,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
     if (limit_Rx && limit_Rx->Get_active()) {
         if (limit_Rx->constr_lower.IsActive()) {
             limit_Rx->constr_lower.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 4, limit_Rx->constr_lower.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 4, limit_Rx->constr_lower.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 4, limit_Rx->constr_lower.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 4, limit_Rx->constr_lower.Get_Cq_b(), 0, Body2);
         }
         if (limit_Rx->constr_upper.IsActive()) {
             limit_Rx->constr_upper.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 4, limit_Rx->constr_upper.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 4, limit_Rx->constr_upper.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 4, limit_Rx->constr_upper.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 4, limit_Rx->constr_upper.Get_Cq_b(), 0, Body2);
             limit_Rx->constr_upper.Get_Cq_a()->MatrNeg();
             limit_Rx->constr_upper.Get_Cq_b()->MatrNeg();
         }
@@ -1762,13 +1741,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
     if (limit_Ry && limit_Ry->Get_active()) {
         if (limit_Ry->constr_lower.IsActive()) {
             limit_Ry->constr_lower.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 5, limit_Ry->constr_lower.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 5, limit_Ry->constr_lower.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 5, limit_Ry->constr_lower.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 5, limit_Ry->constr_lower.Get_Cq_b(), 0, Body2);
         }
         if (limit_Ry->constr_upper.IsActive()) {
             limit_Ry->constr_upper.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 5, limit_Ry->constr_upper.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 5, limit_Ry->constr_upper.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 5, limit_Ry->constr_upper.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 5, limit_Ry->constr_upper.Get_Cq_b(), 0, Body2);
             limit_Ry->constr_upper.Get_Cq_a()->MatrNeg();
             limit_Ry->constr_upper.Get_Cq_b()->MatrNeg();
         }
@@ -1776,13 +1755,13 @@ void ChLinkLock::ConstraintsLoadJacobians() {
     if (limit_Rz && limit_Rz->Get_active()) {
         if (limit_Rz->constr_lower.IsActive()) {
             limit_Rz->constr_lower.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 6, limit_Rz->constr_lower.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 6, limit_Rz->constr_lower.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 6, limit_Rz->constr_lower.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 6, limit_Rz->constr_lower.Get_Cq_b(), 0, Body2);
         }
         if (limit_Rz->constr_upper.IsActive()) {
             limit_Rz->constr_upper.SetVariables(&Body1->Variables(), &Body2->Variables());
-            Transform_Cq_to_Cqw_row(Cq1_temp, 6, limit_Rz->constr_upper.Get_Cq_a(), 0, Body1);
-            Transform_Cq_to_Cqw_row(Cq2_temp, 6, limit_Rz->constr_upper.Get_Cq_b(), 0, Body2);
+            Transform_Cq_to_Cqw_row(&Cq1_temp, 6, limit_Rz->constr_upper.Get_Cq_a(), 0, Body1);
+            Transform_Cq_to_Cqw_row(&Cq2_temp, 6, limit_Rz->constr_upper.Get_Cq_b(), 0, Body2);
             limit_Rz->constr_upper.Get_Cq_a()->MatrNeg();
             limit_Rz->constr_upper.Get_Cq_b()->MatrNeg();
         }
@@ -40,10 +40,10 @@ class ChApi ChLinkLock : public ChLinkMasked {
     Coordsys deltaC_dtdt;  ///< user-imposed rel. acceleration
 
     //(only for intermediate calculus)
-    ChMatrix<>* Cq1_temp;  ///<
-    ChMatrix<>* Cq2_temp;  ///<   the temporary "lock" jacobians,
-    ChMatrix<>* Qc_temp;   ///<   i.e. the full x,y,z,r0,r1,r2,r3 joint
-    Coordsys Ct_temp;      ///<
+    ChMatrixNM<double, 7, BODY_QDOF> Cq1_temp;  ///<
+    ChMatrixNM<double, 7, BODY_QDOF> Cq2_temp;  ///<   the temporary "lock" jacobians,
+    ChMatrixNM<double, 7, 1> Qc_temp;           ///<   i.e. the full x,y,z,r0,r1,r2,r3 joint
+    Coordsys Ct_temp;                           ///<
 
     Vector PQw;  ///< for intermediate calculus (here, for speed reasons)
     Vector PQw_dt;
@@ -63,7 +63,7 @@ class ChApi ChLinkLock : public ChLinkMasked {
     Vector motion_axis;       ///< this is the axis for the user imposed rotation
     AngleSet angleset;             ///< type of rotation (3 Eul angles, angle/axis, etc.)
 
-    // limits
+    // limits (allocated on demand, a null pointer means an inactive limit)
     ChLinkLimit* limit_X;   ///< the upper/lower limits for X dof
     ChLinkLimit* limit_Y;   ///< the upper/lower limits for Y dof
     ChLinkLimit* limit_Z;   ///< the upper/lower limits for Z dof
@@ -165,15 +165,15 @@ class ChApi ChLinkLock : public ChLinkMasked {
     AngleSet Get_angleset() { return angleset; };
     void Set_angleset(AngleSet mset) { angleset = mset; }
 
-    // for the limits on free degrees
-    ChLinkLimit* GetLimit_X() { return limit_X; }
-    ChLinkLimit* GetLimit_Y() { return limit_Y; }
-    ChLinkLimit* GetLimit_Z() { return limit_Z; }
-    ChLinkLimit* GetLimit_Rx() { return limit_Rx; }
-    ChLinkLimit* GetLimit_Ry() { return limit_Ry; }
-    ChLinkLimit* GetLimit_Rz() { return limit_Rz; }
-    ChLinkLimit* GetLimit_Rp() { return limit_Rp; }
-    ChLinkLimit* GetLimit_D() { return limit_D; }
+    // for the limits on free degrees (created, inactive, at first access)
+    ChLinkLimit* GetLimit_X() { return GetLimit(limit_X); }
+    ChLinkLimit* GetLimit_Y() { return GetLimit(limit_Y); }
+    ChLinkLimit* GetLimit_Z() { return GetLimit(limit_Z); }
+    ChLinkLimit* GetLimit_Rx() { return GetLimit(limit_Rx); }
+    ChLinkLimit* GetLimit_Ry() { return GetLimit(limit_Ry); }
+    ChLinkLimit* GetLimit_Rz() { return GetLimit(limit_Rz); }
+    ChLinkLimit* GetLimit_Rp() { return GetLimit(limit_Rp, true); }
+    ChLinkLimit* GetLimit_D() { return GetLimit(limit_D); }
     void SetLimit_X(ChLinkLimit* m_limit_X) {
         if (limit_X)
             delete limit_X;
@@ -282,6 +282,18 @@ class ChApi ChLinkLock : public ChLinkMasked {
   protected:
     void ChangeLinkType(LinkType new_link_type);
 
+    // Return the given limit, creating it (inactive) if not yet allocated.
+    static ChLinkLimit* GetLimit(ChLinkLimit*& limit, bool polar = false) {
+        if (!limit) {
+            limit = new ChLinkLimit;
+            limit->Set_polar(polar);
+        }
+        return limit;
+    }
+
+    // Delete all limits.
+    void DestroyLimits();
+
   private:
     void BuildLinkType(LinkType link_type);
 };
@@ -25,14 +25,10 @@ using namespace geometry;
 CH_FACTORY_REGISTER(ChLinkMasked)
 
 ChLinkMasked::ChLinkMasked() {
-    force_D = new ChLinkForce;  // default no forces in link dof
-    force_R = new ChLinkForce;
-    force_X = new ChLinkForce;
-    force_Y = new ChLinkForce;
-    force_Z = new ChLinkForce;
-    force_Rx = new ChLinkForce;
-    force_Ry = new ChLinkForce;
-    force_Rz = new ChLinkForce;
+    // default no forces in link dof (allocated on first access)
+    force_D = force_R = NULL;
+    force_X = force_Y = force_Z = NULL;
+    force_Rx = force_Ry = force_Rz = NULL;
 
     d_restlength = 0;
 
@@ -55,17 +51,17 @@ ChLinkMasked::ChLinkMasked() {
 ChLinkMasked::ChLinkMasked(const ChLinkMasked& other) : ChLinkMarkers(other) {
     mask = other.mask->Clone();
 
-    // setup -alloc all needed matrices!!
-    ChangedLinkMask();
-
-    force_D = other.force_D->Clone();
-    force_R = other.force_R->Clone();
-    force_X = other.force_X->Clone();
-    force_Y = other.force_Y->Clone();
-    force_Z = other.force_Z->Clone();
-    force_Rx = other.force_Rx->Clone();
-    force_Ry = other.force_Ry->Clone();
-    force_Rz = other.force_Rz->Clone();
+    // setup -alloc all needed matrices!! (nothing to destroy yet)
+    BuildLink();
+
+    force_D = other.force_D ? other.force_D->Clone() : NULL;
+    force_R = other.force_R ? other.force_R->Clone() : NULL;
+    force_X = other.force_X ? other.force_X->Clone() : NULL;
+    force_Y = other.force_Y ? other.force_Y->Clone() : NULL;
+    force_Z = other.force_Z ? other.force_Z->Clone() : NULL;
+    force_Rx = other.force_Rx ? other.force_Rx->Clone() : NULL;
+    force_Ry = other.force_Ry ? other.force_Ry->Clone() : NULL;
+    force_Rz = other.force_Rz ? other.force_Rz->Clone() : NULL;
 
     d_restlength = other.d_restlength;
 }
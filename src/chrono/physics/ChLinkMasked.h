@@ -44,7 +44,7 @@ class ChApi ChLinkMasked : public ChLinkMarkers {
     int ndoc_c;  ///< number of DOC, degrees of constraint (only bilaterals)
     int ndoc_d;  ///< number of DOC, degrees of constraint (only unilaterals)
 
-    // internal forces
+    // internal forces (allocated on demand, a null pointer means an inactive force)
     ChLinkForce* force_D;   ///< the force acting on the straight line m1-m2 (distance)
     ChLinkForce* force_R;   ///< the torque acting about rotation axis
     ChLinkForce* force_X;   ///< the force acting along X dof
@@ -238,15 +238,15 @@ class ChApi ChLinkMasked : public ChLinkMarkers {
     // OTHER DATA
     //
 
-    // for the internal forces
-    ChLinkForce* GetForce_D() { return force_D; }
-    ChLinkForce* GetForce_R() { return force_R; }
-    ChLinkForce* GetForce_X() { return force_X; }
-    ChLinkForce* GetForce_Y() { return force_Y; }
-    ChLinkForce* GetForce_Z() { return force_Z; }
-    ChLinkForce* GetForce_Rx() { return force_Rx; }
-    ChLinkForce* GetForce_Ry() { return force_Ry; }
-    ChLinkForce* GetForce_Rz() { return force_Rz; }
+    // for the internal forces (created, inactive, at first access)
+    ChLinkForce* GetForce_D() { return GetForce(force_D); }
+    ChLinkForce* GetForce_R() { return GetForce(force_R); }
+    ChLinkForce* GetForce_X() { return GetForce(force_X); }
+    ChLinkForce* GetForce_Y() { return GetForce(force_Y); }
+    ChLinkForce* GetForce_Z() { return GetForce(force_Z); }
+    ChLinkForce* GetForce_Rx() { return GetForce(force_Rx); }
+    ChLinkForce* GetForce_Ry() { return GetForce(force_Ry); }
+    ChLinkForce* GetForce_Rz() { return GetForce(force_Rz); }
 
     void SetForce_D(ChLinkForce* m_for) {
         if (force_D)
@@ -311,6 +311,13 @@ class ChApi ChLinkMasked : public ChLinkMarkers {
     // body with rotations expressed as quaternions, into
     // a Nx6 jacobian matrix for a body with 'w' rotations.
     static void Transform_Cq_to_Cqw(ChMatrix<>* mCq, ChMatrix<>* mCqw, ChBodyFrame* mbody);
+
+    // Return the given internal force, creating it if not yet allocated.
+    static ChLinkForce* GetForce(ChLinkForce*& force) {
+        if (!force)
+            force = new ChLinkForce;
+        return force;
+    }
 };
 
 CH_CLASS_VERSION(ChLinkMasked,0)
@@ -68,11 +68,11 @@ void ChLinkScrew::UpdateState() {
         scr_C_dt = relC_dt.pos.z() + relC_dt.rot.e0() * coeffa;
         scr_C_dtdt = relC_dtdt.pos.z() + relC_dt.rot.e0() * coeffb + relC_dtdt.rot.e0() * coeffa;
         scr_Ct = Ct_temp.pos.z() + coeffa * Ct_temp.rot.e0();
-        scr_Qc = Qc_temp->GetElement(2, 0) + coeffa * Qc_temp->GetElement(3, 0) - relC_dt.rot.e0() * coeffb;
+        scr_Qc = Qc_temp.GetElement(2, 0) + coeffa * Qc_temp.GetElement(3, 0) - relC_dt.rot.e0() * coeffb;
         scr_Cq1.Reset();
         scr_Cq2.Reset();
-        scr_Cq1.PasteClippedMatrix(*Cq1_temp, 3, 3, 1, 4, 0, 3);
-        scr_Cq2.PasteClippedMatrix(*Cq2_temp, 3, 3, 1, 4, 0, 3);
+        scr_Cq1.PasteClippedMatrix(Cq1_temp, 3, 3, 1, 4, 0, 3);
+        scr_Cq2.PasteClippedMatrix(Cq2_temp, 3, 3, 1, 4, 0, 3);
         scr_Cq1.MatrScale(coeffa);
         scr_Cq2.MatrScale(coeffa);
     } else {
@@ -98,17 +98,17 @@ void ChLinkScrew::UpdateState() {
         scr_C_dt = relC_dt.pos.z() + relC_dt.rot.e3() * coeffa;
         scr_C_dtdt = relC_dtdt.pos.z() + relC_dt.rot.e3() * coeffb + relC_dtdt.rot.e3() * coeffa;
         scr_Ct = Ct_temp.pos.z() + coeffa * Ct_temp.rot.e3();
-        scr_Qc = Qc_temp->GetElement(2, 0) + coeffa * Qc_temp->GetElement(6, 0) - relC_dt.rot.e3() * coeffb;
+        scr_Qc = Qc_temp.GetElement(2, 0) + coeffa * Qc_temp.GetElement(6, 0) - relC_dt.rot.e3() * coeffb;
         scr_Cq1.Reset();
         scr_Cq2.Reset();
-        scr_Cq1.PasteClippedMatrix(*Cq1_temp, 6, 3, 1, 4, 0, 3);
-        scr_Cq2.PasteClippedMatrix(*Cq2_temp, 6, 3, 1, 4, 0, 3);
+        scr_Cq1.PasteClippedMatrix(Cq1_temp, 6, 3, 1, 4, 0, 3);
+        scr_Cq2.PasteClippedMatrix(Cq2_temp, 6, 3, 1, 4, 0, 3);
         scr_Cq1.MatrScale(coeffa);
         scr_Cq2.MatrScale(coeffa);
     }
 
-    Cq1->PasteClippedMatrix(*Cq1_temp, 2, 0, 1, 7, 2, 0);
-    Cq2->PasteClippedMatrix(*Cq2_temp, 2, 0, 1, 7, 2, 0);
+    Cq1->PasteClippedMatrix(Cq1_temp, 2, 0, 1, 7, 2, 0);
+    Cq2->PasteClippedMatrix(Cq2_temp, 2, 0, 1, 7, 2, 0);
     Cq1->PasteSumMatrix(scr_Cq1, 2, 0);
     Cq2->PasteSumMatrix(scr_Cq2, 2, 0);
     Qc->SetElement(2, 0, scr_Qc);
@@ -86,12 +86,20 @@ ChNodeSPH& ChNodeSPH::operator=(const ChNodeSPH& other) {
 
 void ChNodeSPH::SetKernelRadius(double mr) {
     h_rad = mr;
-    double aabb_rad = h_rad / 2;  // to avoid too many pairs: bounding boxes hemisizes will sum..  __.__--*--
-    ((ChModelBullet*)collision_model)->SetSphereRadius(coll_rad, ChMax(0.0, aabb_rad - coll_rad));
+    UpdateCollisionModel();
 }
 
 void ChNodeSPH::SetCollisionRadius(double mr) {
     coll_rad = mr;
+    UpdateCollisionModel();
+}
+
+void ChNodeSPH::UpdateCollisionModel() {
+    if (container && container->GetUseNeighborGrid()) {
+        // neighbors are found by the container: the collision model is only used for contacts
+        ((ChModelBullet*)collision_model)->SetSphereRadius(coll_rad, coll_rad);
+        return;
+    }
     double aabb_rad = h_rad / 2;  // to avoid too many pairs: bounding boxes hemisizes will sum..  __.__--*--
     ((ChModelBullet*)collision_model)->SetSphereRadius(coll_rad, ChMax(0.0, aabb_rad - coll_rad));
 }
@@ -209,12 +217,14 @@ void ChContinuumSPH::ArchiveIN(ChArchiveIn& marchive) {
 // Register into the object factory, to enable run-time dynamic creation and persistence
 CH_FACTORY_REGISTER(ChMatterSPH)
 
-ChMatterSPH::ChMatterSPH() : do_collide(false) {
+ChMatterSPH::ChMatterSPH() : do_collide(false), use_neighbor_grid(false) {
     matsurface = std::make_shared<ChMaterialSurfaceNSC>();
 }
 
 ChMatterSPH::ChMatterSPH(const ChMatterSPH& other) : ChIndexedNodes(other) {
     do_collide = other.do_collide;
+    use_neighbor_grid = other.use_neighbor_grid;
+    neighbor_grid.SetSkin(other.neighbor_grid.GetSkin());
 
     material = other.material;
     matsurface = other.matsurface;
@@ -369,6 +379,33 @@ void ChMatterSPH::IntLoadResidual_F(
     ) {
     // COMPUTE THE SPH FORCES HERE
 
+    if (!ComputeForces())
+        return;
+
+    // 5- Per-node load forces
+
+    for (unsigned int j = 0; j < nodes.size(); j++) {
+        // particle gyroscopic force:
+        // none.
+
+        // add gravity
+        ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
+        ChVector<> TotForce = nodes[j]->UserForce + Gforce;
+
+        // downcast
+        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
+        assert(mnode);
+
+        R.PasteSumVector(TotForce * c, off + 3 * j, 0);
+    }
+}
+
+bool ChMatterSPH::ComputeForces() {
+    if (use_neighbor_grid) {
+        ComputeForcesNeighborGrid();
+        return true;
+    }
+
     // First, find if any ChProximityContainerSPH object is present
     // in the system,
 
@@ -377,9 +414,9 @@ void ChMatterSPH::IntLoadResidual_F(
         if (edges = std::dynamic_pointer_cast<ChProximityContainerSPH>(otherphysics))
             break;
     }
-    assert(edges);  // If using a ChMatterSPH, you must add also a ChProximityContainerSPH.
+    assert(edges);  // If using a ChMatterSPH, you must add also a ChProximityContainerSPH (or use the neighbor grid).
     if (!edges)
-        return;
+        return false;
 
     // 1- Per-node initialization
 
@@ -412,21 +449,74 @@ void ChMatterSPH::IntLoadResidual_F(
 
     edges->AccumulateStep2();
 
-    // 5- Per-node load forces
+    return true;
+}
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        // particle gyroscopic force:
-        // none.
+// Same computations as in ChProximityContainerSPH::AccumulateStep1/2, but each node gathers the
+// contributions of its neighbors, so that nodes can be processed in parallel. Where the per-edge
+// version uses the kernel radius of an arbitrary node of the pair, here the kernels of the two
+// nodes are averaged (same result if the two nodes have the same kernel radius).
+void ChMatterSPH::ComputeForcesNeighborGrid() {
+    int nnodes = (int)nodes.size();
 
-        // add gravity
-        ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
-        ChVector<> TotForce = nodes[j]->UserForce + Gforce;
+    grid_positions.resize(nnodes);
+    double max_radius = 0;
+    for (int j = 0; j < nnodes; j++) {
+        grid_positions[j] = nodes[j]->pos;
+        max_radius = ChMax(max_radius, nodes[j]->GetKernelRadius());
+    }
+    neighbor_grid.Update(grid_positions, max_radius);
+
+    const std::vector<int>& order = neighbor_grid.GetOrder();
+    const std::vector<int>& start = neighbor_grid.GetStart();
+    const std::vector<int>& neighbors = neighbor_grid.GetNeighbors();
+
+    // 1,2,3- Per-node density, volume and pressure
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < nnodes; k++) {
+        ChNodeSPH* mnodeA = nodes[order[k]].get();
+        double density = 0;
+        for (int n = start[k]; n < start[k + 1]; n++) {
+            ChNodeSPH* mnodeB = nodes[neighbors[n]].get();
+            double dist_BA = (mnodeB->pos - mnodeA->pos).Length();
+            double W_k_poly6 =
+                0.5 * (W_poly6(dist_BA, mnodeA->GetKernelRadius()) + W_poly6(dist_BA, mnodeB->GetKernelRadius()));
+            density += mnodeB->GetMass() * W_k_poly6;
+        }
 
-        // downcast
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
-        assert(mnode);
+        mnodeA->density = density;
+        mnodeA->volume = density ? mnodeA->GetMass() / density : 0;
+        mnodeA->pressure = material.Get_pressure_stiffness() * (density - material.Get_density());
+    }
 
-        R.PasteSumVector(TotForce * c, off + 3 * j, 0);
+    // 4- Per-node pressure and viscous forces
+
+    double viscosity = material.Get_viscosity();
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < nnodes; k++) {
+        ChNodeSPH* mnodeA = nodes[order[k]].get();
+        ChVector<> force = VNULL;
+        for (int n = start[k]; n < start[k + 1]; n++) {
+            ChNodeSPH* mnodeB = nodes[neighbors[n]].get();
+
+            ChVector<> r_BA = mnodeB->pos - mnodeA->pos;
+            double dist_BA = r_BA.Length();
+
+            ChVector<> W_k_pressA;
+            ChVector<> W_k_pressB;
+            W_gr_press(W_k_pressA, r_BA, dist_BA, mnodeA->GetKernelRadius());
+            W_gr_press(W_k_pressB, r_BA, dist_BA, mnodeB->GetKernelRadius());
+            double avg_press = 0.5 * (mnodeA->pressure + mnodeB->pressure);
+            force += (W_k_pressA + W_k_pressB) * (0.5 * mnodeA->volume * avg_press * mnodeB->volume);
+
+            double W_k_visc =
+                0.5 * (W_sq_visco(dist_BA, mnodeA->GetKernelRadius()) + W_sq_visco(dist_BA, mnodeB->GetKernelRadius()));
+            ChVector<> velBA = mnodeB->pos_dt - mnodeA->pos_dt;
+            force += velBA * (mnodeA->volume * viscosity * mnodeB->volume * W_k_visc);
+        }
+        mnodeA->UserForce = force;
     }
 }
 
@@ -480,49 +570,9 @@ void ChMatterSPH::VariablesFbReset() {
 void ChMatterSPH::VariablesFbLoadForces(double factor) {
     // COMPUTE THE SPH FORCES HERE
 
-    // First, find if any ChProximityContainerSPH object is present
-    // in the system,
-
-    std::shared_ptr<ChProximityContainerSPH> edges;
-    for (auto otherphysics : GetSystem()->Get_otherphysicslist()) {
-        if (edges = std::dynamic_pointer_cast<ChProximityContainerSPH>(otherphysics))
-            break;
-    }
-    assert(edges);  // If using a ChMatterSPH, you must add also a ChProximityContainerSPH.
-    if (!edges)
+    if (!ComputeForces())
         return;
 
-    // 1- Per-node initialization
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        nodes[j]->UserForce = VNULL;
-        nodes[j]->density = 0;
-    }
-
-    // 2- Per-edge initialization and accumulation of particles's density
-
-    edges->AccumulateStep1();
-
-    // 3- Per-node volume and pressure computation
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        std::shared_ptr<ChNodeSPH> mnode(nodes[j]);
-        assert(mnode);
-
-        // node volume is v=mass/density
-        if (mnode->density)
-            mnode->volume = mnode->GetMass() / mnode->density;
-        else
-            mnode->volume = 0;
-
-        // node pressure = k(dens - dens_0);
-        mnode->pressure = material.Get_pressure_stiffness() * (mnode->density - material.Get_density());
-    }
-
-    // 4- Per-edge forces computation and accumulation
-
-    edges->AccumulateStep2();
-
     // 5- Per-node load forces
 
     for (unsigned int j = 0; j < nodes.size(); j++) {
@@ -602,6 +652,38 @@ void ChMatterSPH::Update(double mytime, bool update_assets) {
     // ClampSpeed();     // Apply limits (if in speed clamping mode) to speeds.
 }
 
+void ChMatterSPH::SetUseNeighborGrid(bool mval) {
+    use_neighbor_grid = mval;
+
+    // resize the collision models of the particles
+    for (unsigned int j = 0; j < nodes.size(); j++)
+        nodes[j]->SetCollisionRadius(nodes[j]->GetCollisionRadius());
+}
+
+// SPH kernels
+
+double ChMatterSPH::W_poly6(double r, double h) {
+    if (r < h) {
+        return (315.0 / (64.0 * CH_C_PI * pow(h, 9))) * pow((h * h - r * r), 3);
+    } else
+        return 0;
+}
+
+double ChMatterSPH::W_sq_visco(double r, double h) {
+    if (r < h) {
+        return (45.0 / (CH_C_PI * pow(h, 6))) * (h - r);
+    } else
+        return 0;
+}
+
+void ChMatterSPH::W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_length, const double h) {
+    if (r_length < h) {
+        Wresult = r;
+        Wresult *= -(45.0 / (CH_C_PI * pow(h, 6))) * pow((h - r_length), 2.0);
+    } else
+        Wresult = VNULL;
+}
+
 // collision stuff
 void ChMatterSPH::SetCollide(bool mcoll) {
     if (mcoll == do_collide)
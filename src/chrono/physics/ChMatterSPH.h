@@ -18,6 +18,7 @@
 #include <cmath>
 
 #include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/collision/ChCNeighborGrid.h"
 #include "chrono/physics/ChContinuumMaterial.h"
 #include "chrono/physics/ChIndexedNodes.h"
 #include "chrono/physics/ChNodeXYZ.h"
@@ -173,6 +174,10 @@ class ChApi ChNodeSPH : public ChNodeXYZ, public ChContactable_1vars<3> {
     double h_rad;
     double coll_rad;
     double pressure;
+
+  private:
+    /// Update the sphere of the collision model after a change of radii.
+    void UpdateCollisionModel();
 };
 
 /// Class for SPH fluid material, with basic property of incompressible fluid.
@@ -230,6 +235,9 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
     ChContinuumSPH material;                            ///< continuum material properties
     std::shared_ptr<ChMaterialSurface> matsurface;  ///< data for surface contact and impact
     bool do_collide;                                    ///< flag indicating whether or not nodes collide
+    bool use_neighbor_grid;                             ///< flag indicating whether neighbors are found with a cell list
+    collision::ChNeighborGrid neighbor_grid;            ///< neighbor search for the built-in neighbor lists
+    std::vector<ChVector<> > grid_positions;            ///< node positions passed to the neighbor search
 
   public:
     /// Build a cluster of nodes for SPH and meshless FEM.
@@ -248,6 +256,24 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
     void SetCollide(bool mcoll);
     virtual bool GetCollide() const override { return do_collide; }
 
+    /// Enable/disable the built-in neighbor search (default: false).
+    /// If disabled, the interacting pairs of particles are the proximities that the collision system
+    /// reports to a ChProximityContainerSPH, which must be added to the system; for this, the collision
+    /// model of each particle is inflated by the kernel radius.
+    /// If enabled, the neighbors are found with a cell list (see collision::ChNeighborGrid) and the SPH
+    /// forces are computed in parallel directly from its neighbor lists: no ChProximityContainerSPH is
+    /// needed, and the collision system only deals with contacts of the particles with other objects
+    /// (if collision is enabled). This scales to much larger numbers of particles.
+    /// Note that the neighbor grid only contains the particles of this container: with the neighbor grid
+    /// enabled, particles do not interact (through SPH forces) with the particles of other ChMatterSPH
+    /// containers. Use the default proximity-based path if several SPH containers must interact.
+    void SetUseNeighborGrid(bool mval);
+    bool GetUseNeighborGrid() const { return use_neighbor_grid; }
+
+    /// Access the neighbor search used when the built-in neighbor search is enabled
+    /// (for example, to set a skin distance and avoid rebuilding the neighbor lists at each step).
+    collision::ChNeighborGrid& GetNeighborGrid() { return neighbor_grid; }
+
     /// Get the number of scalar coordinates (variables), if any, in this item
     virtual int GetDOF() override { return 3 * GetNnodes(); }
 
@@ -394,10 +420,31 @@ class ChApi ChMatterSPH : public ChIndexedNodes {
     /// Update all auxiliary data of the particles
     virtual void Update(bool update_assets = true) override;
 
+    //
+    // SPH KERNELS
+    //
+
+    /// Poly6 kernel, used for density.
+    static double W_poly6(double r, double h);
+
+    /// Viscosity kernel (laplacian).
+    static double W_sq_visco(double r, double h);
+
+    /// Spiky kernel gradient, used for pressure forces.
+    static void W_gr_press(ChVector<>& Wresult, const ChVector<>& r, const double r_length, const double h);
+
     // SERIALIZATION
 
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Compute density, volume and pressure of the nodes, then the SPH forces in their UserForce.
+    /// Returns false if no neighbor information is available.
+    bool ComputeForces();
+
+    /// Same as ComputeForces, using the built-in neighbor lists.
+    void ComputeForcesNeighborGrid();
 };
 
 }  // end namespace chrono
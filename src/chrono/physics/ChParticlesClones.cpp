@@ -47,6 +47,19 @@ ChAparticle::ChAparticle(const ChAparticle& other) : ChParticleBase(other) {
     variables = other.variables;
 }
 
+ChAparticle::ChAparticle(ChAparticle&& other) noexcept : ChParticleBase(other) {
+    // take over the collision model (and its Bullet object, if already in a collision system)
+    collision_model = other.collision_model;
+    other.collision_model = NULL;
+    if (collision_model)
+        collision_model->SetContactable(this);
+
+    container = other.container;
+    UserForce = other.UserForce;
+    UserTorque = other.UserTorque;
+    variables = other.variables;
+}
+
 ChAparticle::~ChAparticle() {
     delete collision_model;
 }
@@ -70,6 +83,28 @@ ChAparticle& ChAparticle::operator=(const ChAparticle& other) {
     return *this;
 }
 
+ChAparticle& ChAparticle::operator=(ChAparticle&& other) noexcept {
+    if (&other == this)
+        return *this;
+
+    // parent class copy
+    ChParticleBase::operator=(other);
+
+    // exchange collision models, so that the one of this particle is released with 'other'
+    std::swap(collision_model, other.collision_model);
+    if (collision_model)
+        collision_model->SetContactable(this);
+    if (other.collision_model)
+        other.collision_model->SetContactable(&other);
+
+    container = other.container;
+    UserForce = other.UserForce;
+    UserTorque = other.UserTorque;
+    variables = other.variables;
+
+    return *this;
+}
+
 std::shared_ptr<ChMaterialSurface>& ChAparticle::GetMaterialSurfaceBase() {
     return container->GetMaterialSurfaceBase();
 }
@@ -260,11 +295,18 @@ ChParticlesClones::ChParticlesClones(const ChParticlesClones& other) : ChIndexed
     SetInertiaXX(other.GetInertiaXX());
     SetInertiaXY(other.GetInertiaXY());
 
-    particle_collision_model->ClearModel();
+    particle_collision_model = new ChModelBullet();
+    particle_collision_model->SetContactable(0);
+    particle_collision_model->AddCopyOfAnotherModel(other.particle_collision_model);
 
     matsurface = std::shared_ptr<ChMaterialSurface>(other.matsurface->Clone());  // deep copy
 
     ResizeNparticles((int)other.GetNparticles());
+    for (unsigned int j = 0; j < particles.size(); j++) {
+        particles[j].SetCoord(other.particles[j].GetCoord());
+        particles[j].SetCoord_dt(other.particles[j].GetCoord_dt());
+        particles[j].SetCoord_dtdt(other.particles[j].GetCoord_dtdt());
+    }
 
     max_speed = other.max_speed;
     max_wvel = other.max_wvel;
@@ -287,45 +329,87 @@ void ChParticlesClones::ResizeNparticles(int newsize) {
     bool oldcoll = GetCollide();
     SetCollide(false);  // this will remove old particle coll.models from coll.engine, if previously added
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        delete (particles[j]);
-        particles[j] = 0;
-    }
+    InvalidateContacts();
 
+    particles.clear();
     particles.resize(newsize);
 
-    for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j] = new ChAparticle;
+    for (unsigned int j = 0; j < particles.size(); j++)
+        SetupParticle(j);
 
-        particles[j]->SetContainer(this);
+    SetCollide(oldcoll);  // this will also add particle coll.models to coll.engine, if already in a ChSystem
+}
 
-        particles[j]->variables.SetSharedMass(&particle_mass);
-        particles[j]->variables.SetUserData((void*)this);  // UserData unuseful in future parallel solver?
+void ChParticlesClones::AddParticle(ChCoordsys<double> initial_state) {
+    AddParticles(std::vector<ChCoordsys<double>>(1, initial_state));
+}
+
+void ChParticlesClones::AddParticles(const std::vector<ChCoordsys<double>>& initial_states) {
+    if (initial_states.empty())
+        return;
 
-        particles[j]->collision_model->SetContactable(particles[j]);
-        // articles[j]->collision_model->ClearModel();
-        particles[j]->collision_model->AddCopyOfAnotherModel(particle_collision_model);
-        particles[j]->collision_model->BuildModel();
+    size_t first = particles.size();
+
+    // grow geometrically, so that frequent small batches (e.g. from emitters) do not reallocate every time;
+    // existing particles are then moved to a new memory block
+    size_t newsize = first + initial_states.size();
+    if (newsize > particles.capacity()) {
+        InvalidateContacts();
+        particles.reserve(std::max(newsize, 2 * particles.capacity()));
     }
+    particles.resize(newsize);
 
-    SetCollide(oldcoll);  // this will also add particle coll.models to coll.engine, if already in a ChSystem
+    for (size_t i = 0; i < initial_states.size(); i++) {
+        particles[first + i].SetCoord(initial_states[i]);
+        SetupParticle((unsigned int)(first + i));  // will also add to system, if collision is on.
+    }
 }
 
-void ChParticlesClones::AddParticle(ChCoordsys<double> initial_state) {
-    ChAparticle* newp = new ChAparticle;
-    newp->SetCoord(initial_state);
+void ChParticlesClones::RemoveParticles(const std::vector<unsigned int>& indices) {
+    if (indices.empty())
+        return;
 
-    newp->SetContainer(this);
+    std::vector<bool> removed(particles.size(), false);
+    for (auto i : indices) {
+        assert(i < particles.size());
+        removed[i] = true;
+    }
 
-    particles.push_back(newp);
+    InvalidateContacts();
 
-    newp->variables.SetSharedMass(&particle_mass);
-    newp->variables.SetUserData((void*)this);  // UserData unuseful in future parallel solver?
+    // compact the kept particles to the front; the collision models of the removed
+    // particles are exchanged towards the tail and released with it
+    unsigned int n = 0;
+    for (unsigned int j = 0; j < particles.size(); j++) {
+        if (removed[j]) {
+            if (do_collide && GetSystem())
+                GetSystem()->GetCollisionSystem()->Remove(particles[j].collision_model);
+            continue;
+        }
+        if (n != j)
+            particles[n] = std::move(particles[j]);
+        n++;
+    }
+    particles.erase(particles.begin() + n, particles.end());
+}
+
+void ChParticlesClones::SetupParticle(unsigned int i) {
+    ChAparticle& p = particles[i];
+
+    p.SetContainer(this);
+
+    p.variables.SetSharedMass(&particle_mass);
+    p.variables.SetUserData((void*)this);  // UserData unuseful in future parallel solver?
+
+    p.collision_model->SetContactable(&p);
+    // p.collision_model->ClearModel(); // wasn't already added to system, no need to remove
+    p.collision_model->AddCopyOfAnotherModel(particle_collision_model);
+    p.collision_model->BuildModel();  // will also add to system, if collision is on.
+}
 
-    newp->collision_model->SetContactable(newp);
-    // newp->collision_model->ClearModel(); // wasn't already added to system, no need to remove
-    newp->collision_model->AddCopyOfAnotherModel(particle_collision_model);
-    newp->collision_model->BuildModel();  // will also add to system, if collision is on.
+void ChParticlesClones::InvalidateContacts() {
+    if (GetSystem() && GetSystem()->GetContactContainer())
+        GetSystem()->GetContactContainer()->RemoveContacts(this);
 }
 
 // STATE BOOKKEEPING FUNCTIONS
@@ -337,9 +421,9 @@ void ChParticlesClones::IntStateGather(const unsigned int off_x,  // offset in x
                                        double& T                  // time
                                        ) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        x.PasteCoordsys(particles[j]->coord, off_x + 7 * j, 0);
-        v.PasteVector(particles[j]->coord_dt.pos, off_v + 6 * j, 0);
-        v.PasteVector(particles[j]->GetWvel_loc(), off_v + 6 * j + 3, 0);
+        x.PasteCoordsys(particles[j].coord, off_x + 7 * j, 0);
+        v.PasteVector(particles[j].coord_dt.pos, off_v + 6 * j, 0);
+        v.PasteVector(particles[j].GetWvel_loc(), off_v + 6 * j + 3, 0);
         T = GetChTime();
     }
 }
@@ -351,9 +435,9 @@ void ChParticlesClones::IntStateScatter(const unsigned int off_x,  // offset in
                                         const double T             // time
                                         ) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->SetCoord(x.ClipCoordsys(off_x + 7 * j, 0));
-        particles[j]->SetPos_dt(v.ClipVector(off_v + 6 * j, 0));
-        particles[j]->SetWvel_loc(v.ClipVector(off_v + 6 * j + 3, 0));
+        particles[j].SetCoord(x.ClipCoordsys(off_x + 7 * j, 0));
+        particles[j].SetPos_dt(v.ClipVector(off_v + 6 * j, 0));
+        particles[j].SetWvel_loc(v.ClipVector(off_v + 6 * j + 3, 0));
     }
     SetChTime(T);
     Update();
@@ -361,15 +445,15 @@ void ChParticlesClones::IntStateScatter(const unsigned int off_x,  // offset in
 
 void ChParticlesClones::IntStateGatherAcceleration(const unsigned int off_a, ChStateDelta& a) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        a.PasteVector(particles[j]->coord_dtdt.pos, off_a + 6 * j, 0);
-        a.PasteVector(particles[j]->GetWacc_loc(), off_a + 6 * j + 3, 0);
+        a.PasteVector(particles[j].coord_dtdt.pos, off_a + 6 * j, 0);
+        a.PasteVector(particles[j].GetWacc_loc(), off_a + 6 * j + 3, 0);
     }
 }
 
 void ChParticlesClones::IntStateScatterAcceleration(const unsigned int off_a, const ChStateDelta& a) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->SetPos_dtdt(a.ClipVector(off_a + 6 * j, 0));
-        particles[j]->SetWacc_loc(a.ClipVector(off_a + 6 * j + 3, 0));
+        particles[j].SetPos_dtdt(a.ClipVector(off_a + 6 * j, 0));
+        particles[j].SetWacc_loc(a.ClipVector(off_a + 6 * j + 3, 0));
     }
 }
 
@@ -388,7 +472,7 @@ void ChParticlesClones::IntStateIncrement(const unsigned int off_x,  // offset i
         // ADVANCE ROTATION: rot' = delta*rot  (use quaternion for delta rotation)
         ChQuaternion<> mdeltarot;
         ChQuaternion<> moldrot = x.ClipQuaternion(off_x + 7 * j + 3, 0);
-        ChVector<> newwel_abs = particles[j]->Amatrix * Dv.ClipVector(off_v + 6 * j + 3, 0);
+        ChVector<> newwel_abs = particles[j].Amatrix * Dv.ClipVector(off_v + 6 * j + 3, 0);
         double mangle = newwel_abs.Length();
         newwel_abs.Normalize();
         mdeltarot.Q_from_AngAxis(mangle, newwel_abs);
@@ -407,12 +491,12 @@ void ChParticlesClones::IntLoadResidual_F(const unsigned int off,  // offset in
 
     for (unsigned int j = 0; j < particles.size(); j++) {
         // particle gyroscopic force:
-        ChVector<> Wvel = particles[j]->GetWvel_loc();
+        ChVector<> Wvel = particles[j].GetWvel_loc();
         ChVector<> gyro = Vcross(Wvel, (particle_mass.GetBodyInertia().Matr_x_Vect(Wvel)));
 
         // add applied forces and torques (and also the gyroscopic torque and gravity!) to 'fb' vector
-        R.PasteSumVector((particles[j]->UserForce + Gforce) * c, off + 6 * j, 0);
-        R.PasteSumVector((particles[j]->UserTorque - gyro) * c, off + 6 * j + 3, 0);
+        R.PasteSumVector((particles[j].UserForce + Gforce) * c, off + 6 * j, 0);
+        R.PasteSumVector((particles[j].UserTorque - gyro) * c, off + 6 * j + 3, 0);
     }
 }
 
@@ -438,8 +522,8 @@ void ChParticlesClones::IntToDescriptor(const unsigned int off_v,  // offset in
                                         const ChVectorDynamic<>& L,
                                         const ChVectorDynamic<>& Qc) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.Get_qb().PasteClippedMatrix(v, off_v + 6 * j, 0, 6, 1, 0, 0);
-        particles[j]->variables.Get_fb().PasteClippedMatrix(R, off_v + 6 * j, 0, 6, 1, 0, 0);
+        particles[j].variables.Get_qb().PasteClippedMatrix(v, off_v + 6 * j, 0, 6, 1, 0, 0);
+        particles[j].variables.Get_fb().PasteClippedMatrix(R, off_v + 6 * j, 0, 6, 1, 0, 0);
     }
 }
 
@@ -448,20 +532,20 @@ void ChParticlesClones::IntFromDescriptor(const unsigned int off_v,  // offset i
                                           const unsigned int off_L,  // offset in L
                                           ChVectorDynamic<>& L) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        v.PasteMatrix(particles[j]->variables.Get_qb(), off_v + 6 * j, 0);
+        v.PasteMatrix(particles[j].variables.Get_qb(), off_v + 6 * j, 0);
     }
 }
 
 void ChParticlesClones::InjectVariables(ChSystemDescriptor& mdescriptor) {
     // variables.SetDisabled(!IsActive());
     for (unsigned int j = 0; j < particles.size(); j++) {
-        mdescriptor.InsertVariables(&(particles[j]->variables));
+        mdescriptor.InsertVariables(&(particles[j].variables));
     }
 }
 
 void ChParticlesClones::VariablesFbReset() {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.Get_fb().FillElem(0.0);
+        particles[j].variables.Get_fb().FillElem(0.0);
     }
 }
 
@@ -472,44 +556,44 @@ void ChParticlesClones::VariablesFbLoadForces(double factor) {
 
     for (unsigned int j = 0; j < particles.size(); j++) {
         // particle gyroscopic force:
-        ChVector<> Wvel = particles[j]->GetWvel_loc();
+        ChVector<> Wvel = particles[j].GetWvel_loc();
         ChVector<> gyro = Vcross(Wvel, (particle_mass.GetBodyInertia().Matr_x_Vect(Wvel)));
 
         // add applied forces and torques (and also the gyroscopic torque and gravity!) to 'fb' vector
-        particles[j]->variables.Get_fb().PasteSumVector((particles[j]->UserForce + Gforce) * factor, 0, 0);
-        particles[j]->variables.Get_fb().PasteSumVector((particles[j]->UserTorque - gyro) * factor, 3, 0);
+        particles[j].variables.Get_fb().PasteSumVector((particles[j].UserForce + Gforce) * factor, 0, 0);
+        particles[j].variables.Get_fb().PasteSumVector((particles[j].UserTorque - gyro) * factor, 3, 0);
     }
 }
 
 void ChParticlesClones::VariablesQbLoadSpeed() {
     for (unsigned int j = 0; j < particles.size(); j++) {
         // set current speed in 'qb', it can be used by the solver when working in incremental mode
-        particles[j]->variables.Get_qb().PasteVector(particles[j]->GetCoord_dt().pos, 0, 0);
-        particles[j]->variables.Get_qb().PasteVector(particles[j]->GetWvel_loc(), 3, 0);
+        particles[j].variables.Get_qb().PasteVector(particles[j].GetCoord_dt().pos, 0, 0);
+        particles[j].variables.Get_qb().PasteVector(particles[j].GetWvel_loc(), 3, 0);
     }
 }
 
 void ChParticlesClones::VariablesFbIncrementMq() {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->variables.Compute_inc_Mb_v(particles[j]->variables.Get_fb(), particles[j]->variables.Get_qb());
+        particles[j].variables.Compute_inc_Mb_v(particles[j].variables.Get_fb(), particles[j].variables.Get_qb());
     }
 }
 
 void ChParticlesClones::VariablesQbSetSpeed(double step) {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        ChCoordsys<> old_coord_dt = particles[j]->GetCoord_dt();
+        ChCoordsys<> old_coord_dt = particles[j].GetCoord_dt();
 
         // from 'qb' vector, sets body speed, and updates auxiliary data
-        particles[j]->SetPos_dt(particles[j]->variables.Get_qb().ClipVector(0, 0));
-        particles[j]->SetWvel_loc(particles[j]->variables.Get_qb().ClipVector(3, 0));
+        particles[j].SetPos_dt(particles[j].variables.Get_qb().ClipVector(0, 0));
+        particles[j].SetWvel_loc(particles[j].variables.Get_qb().ClipVector(3, 0));
 
         // apply limits (if in speed clamping mode) to speeds.
         // ClampSpeed(); NO - do only per-particle, here.. (but.. really needed here?)
 
         // Compute accel. by BDF (approximate by differentiation);
         if (step) {
-            particles[j]->SetPos_dtdt((particles[j]->GetCoord_dt().pos - old_coord_dt.pos) / step);
-            particles[j]->SetRot_dtdt((particles[j]->GetCoord_dt().rot - old_coord_dt.rot) / step);
+            particles[j].SetPos_dtdt((particles[j].GetCoord_dt().pos - old_coord_dt.pos) / step);
+            particles[j].SetRot_dtdt((particles[j].GetCoord_dt().rot - old_coord_dt.rot) / step);
         }
     }
 }
@@ -522,43 +606,43 @@ void ChParticlesClones::VariablesQbIncrementPosition(double dt_step) {
         // Updates position with incremental action of speed contained in the
         // 'qb' vector:  pos' = pos + dt * speed   , like in an Eulero step.
 
-        ChVector<> newspeed = particles[j]->variables.Get_qb().ClipVector(0, 0);
-        ChVector<> newwel = particles[j]->variables.Get_qb().ClipVector(3, 0);
+        ChVector<> newspeed = particles[j].variables.Get_qb().ClipVector(0, 0);
+        ChVector<> newwel = particles[j].variables.Get_qb().ClipVector(3, 0);
 
         // ADVANCE POSITION: pos' = pos + dt * vel
-        particles[j]->SetPos(particles[j]->GetPos() + newspeed * dt_step);
+        particles[j].SetPos(particles[j].GetPos() + newspeed * dt_step);
 
         // ADVANCE ROTATION: rot' = [dt*wwel]%rot  (use quaternion for delta rotation)
         ChQuaternion<> mdeltarot;
-        ChQuaternion<> moldrot = particles[j]->GetRot();
-        ChVector<> newwel_abs = particles[j]->GetA() * newwel;
+        ChQuaternion<> moldrot = particles[j].GetRot();
+        ChVector<> newwel_abs = particles[j].GetA() * newwel;
         double mangle = newwel_abs.Length() * dt_step;
         newwel_abs.Normalize();
         mdeltarot.Q_from_AngAxis(mangle, newwel_abs);
         ChQuaternion<> mnewrot = mdeltarot % moldrot;
-        particles[j]->SetRot(mnewrot);
+        particles[j].SetRot(mnewrot);
     }
 }
 
 void ChParticlesClones::SetNoSpeedNoAcceleration() {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->SetPos_dt(VNULL);
-        particles[j]->SetWvel_loc(VNULL);
-        particles[j]->SetPos_dtdt(VNULL);
-        particles[j]->SetRot_dtdt(QNULL);
+        particles[j].SetPos_dt(VNULL);
+        particles[j].SetWvel_loc(VNULL);
+        particles[j].SetPos_dtdt(VNULL);
+        particles[j].SetRot_dtdt(QNULL);
     }
 }
 
 void ChParticlesClones::ClampSpeed() {
     if (GetLimitSpeed()) {
         for (unsigned int j = 0; j < particles.size(); j++) {
-            double w = 2.0 * particles[j]->GetRot_dt().Length();
+            double w = 2.0 * particles[j].GetRot_dt().Length();
             if (w > max_wvel)
-                particles[j]->SetRot_dt(particles[j]->GetRot_dt() * max_wvel / w);
+                particles[j].SetRot_dt(particles[j].GetRot_dt() * max_wvel / w);
 
-            double v = particles[j]->GetPos_dt().Length();
+            double v = particles[j].GetPos_dt().Length();
             if (v > max_speed)
-                particles[j]->SetPos_dt(particles[j]->GetPos_dt() * max_speed / v);
+                particles[j].SetPos_dt(particles[j].GetPos_dt() * max_speed / v);
         }
     }
 }
@@ -621,14 +705,14 @@ void ChParticlesClones::SetCollide(bool mcoll) {
         do_collide = true;
         if (GetSystem()) {
             for (unsigned int j = 0; j < particles.size(); j++) {
-                GetSystem()->GetCollisionSystem()->Add(particles[j]->collision_model);
+                GetSystem()->GetCollisionSystem()->Add(particles[j].collision_model);
             }
         }
     } else {
         do_collide = false;
         if (GetSystem()) {
             for (unsigned int j = 0; j < particles.size(); j++) {
-                GetSystem()->GetCollisionSystem()->Remove(particles[j]->collision_model);
+                GetSystem()->GetCollisionSystem()->Remove(particles[j].collision_model);
             }
         }
     }
@@ -636,7 +720,7 @@ void ChParticlesClones::SetCollide(bool mcoll) {
 
 void ChParticlesClones::SyncCollisionModels() {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->collision_model->SyncPosition();
+        particles[j].collision_model->SyncPosition();
     }
 }
 
@@ -644,14 +728,14 @@ void ChParticlesClones::AddCollisionModelsToSystem() {
     assert(GetSystem());
     SyncCollisionModels();
     for (unsigned int j = 0; j < particles.size(); j++) {
-        GetSystem()->GetCollisionSystem()->Add(particles[j]->collision_model);
+        GetSystem()->GetCollisionSystem()->Add(particles[j].collision_model);
     }
 }
 
 void ChParticlesClones::RemoveCollisionModelsFromSystem() {
     assert(GetSystem());
     for (unsigned int j = 0; j < particles.size(); j++) {
-        GetSystem()->GetCollisionSystem()->Remove(particles[j]->collision_model);
+        GetSystem()->GetCollisionSystem()->Remove(particles[j].collision_model);
     }
 }
 
@@ -659,9 +743,9 @@ void ChParticlesClones::RemoveCollisionModelsFromSystem() {
 
 void ChParticlesClones::UpdateParticleCollisionModels() {
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->collision_model->ClearModel();
-        particles[j]->collision_model->AddCopyOfAnotherModel(particle_collision_model);
-        particles[j]->collision_model->BuildModel();
+        particles[j].collision_model->ClearModel();
+        particles[j].collision_model->AddCopyOfAnotherModel(particle_collision_model);
+        particles[j].collision_model->BuildModel();
     }
 }
 
@@ -716,7 +800,7 @@ void ChParticlesClones::ArchiveIN(ChArchiveIn& marchive) {
     marchive >> CHNVP(sleep_starttime);
 
     for (unsigned int j = 0; j < particles.size(); j++) {
-        particles[j]->SetContainer(this);
+        particles[j].SetContainer(this);
     }
     AddCollisionModelsToSystem();
 }
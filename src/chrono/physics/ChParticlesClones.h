@@ -16,6 +16,7 @@
 #define CHPARTICLESCLONES_H
 
 #include <cmath>
+#include <vector>
 
 #include "chrono/collision/ChCCollisionModel.h"
 #include "chrono/physics/ChContactable.h"
@@ -31,13 +32,18 @@ class ChParticlesClones;
 
 /// Class for a single particle clone in the ChParticlesClones cluster.
 /// It does not define mass, inertia and shape because those are _shared_ among them.
+/// Particles are stored by value in their cluster; moving a particle transfers its
+/// collision model and re-targets it to the new location, so that the cluster can
+/// grow and be compacted without allocating new collision objects.
 class ChApi ChAparticle : public ChParticleBase, public ChContactable_1vars<6> {
   public:
     ChAparticle();
     ChAparticle(const ChAparticle& other);
+    ChAparticle(ChAparticle&& other) noexcept;
     ~ChAparticle();
 
     ChAparticle& operator=(const ChAparticle& other);
+    ChAparticle& operator=(ChAparticle&& other) noexcept;
 
     // Access the variables of the node
     virtual ChVariables& Variables() override { return variables; }
@@ -166,10 +172,16 @@ class ChApi ChAparticle : public ChParticleBase, public ChContactable_1vars<6> {
 /// you can simply add three ChParticlesClones objects to the
 /// ChSystem. This would be more efficient anyway than
 /// creating all shapes as ChBody.
+/// Particles are kept in a contiguous array and all particles reference the
+/// collision shapes of the sample collision model. Use AddParticles() and
+/// RemoveParticles() to insert or delete many particles at once (as done by
+/// the particle emitters and removers in the particlefactory namespace).
+/// Note that adding or removing particles invalidates references obtained
+/// with GetParticle() and clears the contacts of the owner system.
 class ChApi ChParticlesClones : public ChIndexedParticles {
 
   private:
-    std::vector<ChAparticle*> particles;  ///< the parricles
+    std::vector<ChAparticle> particles;  ///< the particles (contiguous storage)
 
     ChSharedMassBody particle_mass;  ///< shared mass of particles
 
@@ -217,7 +229,7 @@ class ChApi ChParticlesClones : public ChIndexedParticles {
     /// Access the N-th particle
     ChParticleBase& GetParticle(unsigned int n) override {
         assert(n < particles.size());
-        return *particles[n];
+        return particles[n];
     }
 
     /// Resize the particle cluster. Also clear the state of
@@ -232,6 +244,17 @@ class ChApi ChParticlesClones : public ChIndexedParticles {
     /// before adding particles!
     void AddParticle(ChCoordsys<double> initial_state = CSYSNORM) override;
 
+    /// Add a batch of new particles to the particle cluster, one for each of the
+    /// given coordinate systems. The storage is grown at most once and the
+    /// collision models of the new particles are inserted in a single pass.
+    /// NOTE! Define the sample collision shape using GetCollisionModel()->...
+    /// before adding particles!
+    void AddParticles(const std::vector<ChCoordsys<double>>& initial_states);
+
+    /// Remove the particles with the given indices (in any order, duplicates allowed).
+    /// The remaining particles are compacted in place, preserving their relative order.
+    void RemoveParticles(const std::vector<unsigned int>& indices);
+
     /// Set the material surface for contacts
     void SetMaterialSurface(const std::shared_ptr<ChMaterialSurface>& mnewsurf) { matsurface = mnewsurf; }
 
@@ -378,6 +401,14 @@ class ChApi ChParticlesClones : public ChIndexedParticles {
 
     virtual void ArchiveOUT(ChArchiveOut& marchive) override;
     virtual void ArchiveIN(ChArchiveIn& marchive) override;
+
+  private:
+    /// Attach the i-th particle to this cluster and to the sample collision model.
+    void SetupParticle(unsigned int i);
+
+    /// Drop the contacts of the particles of this cluster (they reference particles by address).
+    /// To be called only before the particle storage is moved or compacted, while the particles still exist.
+    void InvalidateContacts();
 };
 
 CH_CLASS_VERSION(ChParticlesClones,0)
@@ -13,12 +13,16 @@
 // =============================================================================
 
 #include <algorithm>
+#include <functional>
+#include <numeric>
+#include <unordered_map>
 
 #include "chrono/collision/ChCCollisionSystemBullet.h"
 #include "chrono/collision/ChCModelBullet.h"
 #include "chrono/parallel/ChOpenMP.h"
 #include "chrono/physics/ChProximityContainer.h"
 #include "chrono/physics/ChSystem.h"
+#include "chrono/solver/ChKblockGeneric.h"
 #include "chrono/solver/ChSolverAPGD.h"
 #include "chrono/solver/ChSolverBB.h"
 #include "chrono/solver/ChSolverJacobi.h"
@@ -56,6 +60,9 @@ ChSystem::ChSystem()
       max_penetration_recovery_speed(0.6),
       use_sleeping(false),
       G_acc(ChVector<>(0, -9.8, 0)),
+      use_islands(false),
+      nislands(0),
+      deterministic(false),
       stepcount(0),
       solvecount(0),
       setupcount(0),
@@ -101,6 +108,9 @@ ChSystem::ChSystem(const ChSystem& other) : ChAssembly(other) {
     SetSolverType(GetSolverType());
     parallel_thread_number = other.parallel_thread_number;
     use_sleeping = other.use_sleeping;
+    use_islands = other.use_islands;
+    nislands = 0;
+    deterministic = other.deterministic;
 
     ncontacts = other.ncontacts;
 
@@ -480,6 +490,9 @@ bool ChSystem::ManageSleepingBodies() {
     if (!GetUseSleeping())
         return 0;
 
+    if (use_islands)
+        return ManageSleepingIslands();
+
     // STEP 1:
     // See if some body could change from no sleep-> sleep
 
@@ -611,6 +624,316 @@ bool ChSystem::ManageSleepingBodies() {
     return false;
 }
 
+// -----------------------------------------------------------------------------
+//  ISLANDS
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Union-find helpers, used to group bodies or variables in islands.
+int IslandRoot(std::vector<int>& parent, int i) {
+    while (parent[i] != i) {
+        parent[i] = parent[parent[i]];
+        i = parent[i];
+    }
+    return i;
+}
+
+void IslandJoin(std::vector<int>& parent, int i, int j) {
+    i = IslandRoot(parent, i);
+    j = IslandRoot(parent, j);
+    if (i != j)
+        parent[std::max(i, j)] = std::min(i, j);
+}
+
+}  // end anonymous namespace
+
+bool ChSystem::ManageSleepingIslands() {
+    // STEP 1:
+    // Mark the bodies that could change from no sleep -> sleep
+
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        bodylist[ip]->TrySleeping();
+    }
+
+    // STEP 2:
+    // Group the non-fixed bodies in islands, through links and contacts
+
+    std::unordered_map<ChBody*, int> body_index;
+    for (int ip = 0; ip < bodylist.size(); ++ip) {
+        if (!bodylist[ip]->GetBodyFixed())
+            body_index[bodylist[ip].get()] = ip;
+    }
+
+    std::vector<int> parent(bodylist.size());
+    std::iota(parent.begin(), parent.end(), 0);
+
+    auto join = [&](ChBody* b1, ChBody* b2) {
+        auto i1 = body_index.find(b1);
+        auto i2 = body_index.find(b2);
+        if (i1 != body_index.end() && i2 != body_index.end())
+            IslandJoin(parent, i1->second, i2->second);
+    };
+
+    for (unsigned int ip = 0; ip < linklist.size(); ++ip) {
+        std::shared_ptr<ChLink> Lpointer = linklist[ip];
+        if (Lpointer->IsActive() && Lpointer->IsRequiringWaking())
+            join(dynamic_cast<ChBody*>(Lpointer->GetBody1()), dynamic_cast<ChBody*>(Lpointer->GetBody2()));
+    }
+
+    class _island_reporter_class : public ChContactContainer::ReportContactCallback {
+      public:
+        virtual bool OnReportContact(const ChVector<>& pA,
+                                     const ChVector<>& pB,
+                                     const ChMatrix33<>& plane_coord,
+                                     const double& distance,
+                                     const double& eff_radius,
+                                     const ChVector<>& react_forces,
+                                     const ChVector<>& react_torques,
+                                     ChContactable* contactobjA,
+                                     ChContactable* contactobjB) override {
+            if (contactobjA && contactobjB)
+                (*join)(dynamic_cast<ChBody*>(contactobjA), dynamic_cast<ChBody*>(contactobjB));
+            return true;  // to continue scanning contacts
+        }
+
+        std::function<void(ChBody*, ChBody*)>* join;
+    };
+
+    std::function<void(ChBody*, ChBody*)> join_function = join;
+    _island_reporter_class my_reporter;
+    my_reporter.join = &join_function;
+    contact_container->ReportAllContacts(&my_reporter);
+
+    // STEP 3:
+    // An island goes to sleep only if all its bodies can sleep; otherwise all its bodies are awake.
+
+    std::vector<char> island_could_sleep(bodylist.size(), true);
+    for (auto& entry : body_index) {
+        ChBody* body = entry.first;
+        if (!body->GetSleeping() && !body->BFlagGet(ChBody::BodyFlag::COULDSLEEP))
+            island_could_sleep[IslandRoot(parent, entry.second)] = false;
+    }
+
+    bool need_Setup = false;
+    for (auto& entry : body_index) {
+        ChBody* body = entry.first;
+        bool could_sleep = island_could_sleep[IslandRoot(parent, entry.second)] != 0;
+        if (body->GetSleeping() != could_sleep) {
+            body->SetSleeping(could_sleep);
+            need_Setup = true;
+        }
+        body->BFlagSet(ChBody::BodyFlag::COULDSLEEP, false);
+    }
+
+    // if some body has been activated/deactivated because of sleep state changes,
+    // the offsets and DOF counts must be updated:
+    if (need_Setup) {
+        Setup();
+        return true;
+    }
+    return false;
+}
+
+std::shared_ptr<ChIterativeSolver> ChSystem::CreateIslandSolver(ChSolver::Type type) {
+    switch (type) {
+        case ChSolver::Type::SOR:
+            return std::make_shared<ChSolverSOR>();
+        case ChSolver::Type::SOR_MULTITHREAD: {
+            auto solver = std::make_shared<ChSolverSORmultithread>("islandSolver", 1);
+            solver->SetDeterministic(true);
+            return solver;
+        }
+        case ChSolver::Type::SYMMSOR:
+            return std::make_shared<ChSolverSymmSOR>();
+        case ChSolver::Type::JACOBI:
+            return std::make_shared<ChSolverJacobi>();
+        case ChSolver::Type::PMINRES:
+            return std::make_shared<ChSolverPMINRES>();
+        case ChSolver::Type::BARZILAIBORWEIN:
+            return std::make_shared<ChSolverBB>();
+        case ChSolver::Type::PCG:
+            return std::make_shared<ChSolverPCG>();
+        case ChSolver::Type::APGD:
+            return std::make_shared<ChSolverAPGD>();
+        case ChSolver::Type::MINRES:
+            return std::make_shared<ChSolverMINRES>();
+        default:
+            return nullptr;
+    }
+}
+
+bool ChSystem::SolveIslands() {
+    CH_PROFILE("SolveIslands");
+
+    auto iter_solver = std::dynamic_pointer_cast<ChIterativeSolver>(GetSolver());
+    if (!iter_solver)
+        return false;
+
+    auto& vvariables = descriptor->GetVariablesList();
+    auto& vconstraints = descriptor->GetConstraintsList();
+    auto& vstiffness = descriptor->GetKblocksList();
+
+    // Stiffness blocks other than ChKblockGeneric do not expose their variables, so the islands
+    // cannot be found: fall back to the global solve.
+    for (auto kblock : vstiffness) {
+        if (!dynamic_cast<ChKblockGeneric*>(kblock))
+            return false;
+    }
+
+    // Per-thread solvers, created once (or again if the speed solver changed type). Their settings
+    // are copied from the speed solver at each call, since these may change at any time.
+    // Each island is solved on a single thread, so SOR_MULTITHREAD maps to SOR. In deterministic mode,
+    // a single-threaded SOR_MULTITHREAD solver is used instead, so that the islands are swept by colors
+    // as the whole system would be.
+    ChSolver::Type island_type = iter_solver->GetType();
+    if (island_type == ChSolver::Type::SOR_MULTITHREAD && !deterministic)
+        island_type = ChSolver::Type::SOR;
+
+    int nthreads = std::max(1, parallel_thread_number);
+    if ((int)island_solvers.size() != nthreads || island_solvers[0]->GetType() != island_type) {
+        island_solvers.clear();
+        for (int i = 0; i < nthreads; ++i) {
+            auto solver = CreateIslandSolver(island_type);
+            if (!solver)
+                return false;
+            island_solvers.push_back(solver);
+        }
+    }
+    for (auto& solver : island_solvers) {
+        solver->SetMaxIterations(iter_solver->GetMaxIterations());
+        solver->SetTolerance(iter_solver->GetTolerance());
+        solver->SetWarmStart(iter_solver->GetWarmStart());
+        solver->SetOmega(iter_solver->GetOmega());
+        solver->SetSharpnessLambda(iter_solver->GetSharpnessLambda());
+        solver->SetRecordViolation(iter_solver->GetRecordViolation());
+        solver->SetVerbose(iter_solver->GetVerbose());
+    }
+
+    // Active variables, in order of increasing offset in the system descriptor
+    std::vector<ChVariables*> variables;
+    std::vector<int> offsets;
+    for (auto var : vvariables) {
+        if (var->IsActive()) {
+            variables.push_back(var);
+            offsets.push_back(var->GetOffset());
+        }
+    }
+
+    auto var_index = [&offsets](int offset) {
+        return (int)(std::upper_bound(offsets.begin(), offsets.end(), offset) - offsets.begin()) - 1;
+    };
+
+    // Group variables through the constraint jacobians and the stiffness blocks.
+    // Also record one variable per constraint and per stiffness block.
+    std::vector<int> parent(variables.size());
+    std::iota(parent.begin(), parent.end(), 0);
+
+    ChSparseColumnRecorder recorder;
+    std::vector<int> constraint_var(vconstraints.size(), -1);
+    for (size_t ic = 0; ic < vconstraints.size(); ++ic) {
+        if (!vconstraints[ic]->IsActive())
+            continue;
+        recorder.columns.clear();
+        vconstraints[ic]->Build_Cq(recorder, 0);
+        for (auto col : recorder.columns) {
+            int iv = var_index(col);
+            if (constraint_var[ic] < 0)
+                constraint_var[ic] = iv;
+            else
+                IslandJoin(parent, constraint_var[ic], iv);
+        }
+    }
+
+    std::vector<int> kblock_var(vstiffness.size(), -1);
+    for (size_t ik = 0; ik < vstiffness.size(); ++ik) {
+        auto kblock = static_cast<ChKblockGeneric*>(vstiffness[ik]);
+        for (unsigned int i = 0; i < kblock->GetNvars(); ++i) {
+            ChVariables* var = kblock->GetVariableN(i);
+            if (!var->IsActive())
+                continue;
+            int iv = var_index(var->GetOffset());
+            if (kblock_var[ik] < 0)
+                kblock_var[ik] = iv;
+            else
+                IslandJoin(parent, kblock_var[ik], iv);
+        }
+    }
+
+    // Number the islands which contain at least one constraint or stiffness block
+    std::vector<int> island(variables.size(), -1);
+    nislands = 0;
+    for (auto iv : constraint_var) {
+        if (iv >= 0 && island[IslandRoot(parent, iv)] < 0)
+            island[IslandRoot(parent, iv)] = nislands++;
+    }
+    for (auto iv : kblock_var) {
+        if (iv >= 0 && island[IslandRoot(parent, iv)] < 0)
+            island[IslandRoot(parent, iv)] = nislands++;
+    }
+
+    // Fill the island descriptors, preserving the order of variables and constraints
+    for (int i = (int)island_descriptors.size(); i < nislands; ++i)
+        island_descriptors.push_back(std::make_shared<ChSystemDescriptor>());
+    for (int i = 0; i < nislands; ++i) {
+        island_descriptors[i]->BeginInsertion();
+        island_descriptors[i]->SetMassFactor(descriptor->GetMassFactor());
+        island_descriptors[i]->SetNumThreads(1);
+    }
+
+    std::vector<ChVariables*> free_variables;
+    for (size_t iv = 0; iv < variables.size(); ++iv) {
+        int id = island[IslandRoot(parent, (int)iv)];
+        if (id >= 0)
+            island_descriptors[id]->InsertVariables(variables[iv]);
+        else
+            free_variables.push_back(variables[iv]);
+    }
+    for (size_t ic = 0; ic < vconstraints.size(); ++ic) {
+        if (constraint_var[ic] >= 0)
+            island_descriptors[island[IslandRoot(parent, constraint_var[ic])]]->InsertConstraint(vconstraints[ic]);
+        else if (vconstraints[ic]->IsActive())
+            vconstraints[ic]->Set_l_i(0);  // all variables inactive (fixed or sleeping): no reaction
+    }
+    for (size_t ik = 0; ik < vstiffness.size(); ++ik) {
+        if (kblock_var[ik] >= 0)
+            island_descriptors[island[IslandRoot(parent, kblock_var[ik])]]->InsertKblock(vstiffness[ik]);
+    }
+
+    // Solve the largest islands first, for better load balancing
+    std::vector<int> order(nislands);
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [this](int i, int j) {
+        return island_descriptors[i]->GetConstraintsList().size() > island_descriptors[j]->GetConstraintsList().size();
+    });
+
+    // Note: EndInsertion sets the offsets of variables and constraints local to each island;
+    // islands do not share variables or constraints, so they can be processed concurrently.
+    // The statistics of the speed solver (iterations, violation history) are the maximum over all islands.
+    iter_solver->ResetStatistics();
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(nthreads)
+    for (int i = 0; i < nislands; ++i) {
+        ChSystemDescriptor& sysd = *island_descriptors[order[i]];
+        sysd.EndInsertion();
+        auto& solver = island_solvers[CHOMPfunctions::GetThreadNum()];
+        solver->Solve(sysd);
+#pragma omp critical
+        iter_solver->MergeStatistics(*solver);
+    }
+
+    // Variables not involved in any constraint: q = M^-1 * f
+#pragma omp parallel for schedule(dynamic, 64) num_threads(nthreads)
+    for (int iv = 0; iv < (int)free_variables.size(); ++iv) {
+        free_variables[iv]->Compute_invMb_v(free_variables[iv]->Get_qb(), free_variables[iv]->Get_fb());
+    }
+
+    // Restore the offsets in the system descriptor
+    descriptor->UpdateCountsAndOffsets();
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 //  DESCRIPTOR BOOKKEEPING
 // -----------------------------------------------------------------------------
@@ -1144,7 +1467,10 @@ bool ChSystem::StateSolveCorrection(ChStateDelta& Dv,             // result: com
     // Solve the problem
     // The solution is scattered in the provided system descriptor
     timer_solver.start();
-    GetSolver()->Solve(*descriptor);
+    if (auto sor_mt = std::dynamic_pointer_cast<ChSolverSORmultithread>(GetSolver()))
+        sor_mt->SetDeterministic(deterministic);
+    if (!(use_islands && SolveIslands()))
+        GetSolver()->Solve(*descriptor);
     timer_solver.stop();
     
 
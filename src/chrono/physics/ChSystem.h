@@ -34,6 +34,7 @@
 #include "chrono/physics/ChGlobal.h"
 #include "chrono/physics/ChLinksAll.h"
 #include "chrono/physics/ChProbe.h"
+#include "chrono/solver/ChIterativeSolver.h"
 #include "chrono/solver/ChSystemDescriptor.h"
 #include "chrono/timestepper/ChAssemblyAnalysis.h"
 #include "chrono/solver/ChSolver.h"
@@ -607,6 +608,41 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// Tell if the system will put to sleep the bodies whose motion has almost come to a rest.
     bool GetUseSleeping() const { return use_sleeping; }
 
+    /// Turn on this feature to decompose the system in islands, i.e. groups of variables coupled by
+    /// constraints (links, contacts) or stiffness blocks. Each island is then solved separately, with
+    /// its own system descriptor and its own convergence, and the islands are solved concurrently using
+    /// the number of threads set with SetParallelThreadNumber. Bodies not involved in any constraint
+    /// are updated directly. Also, if sleeping is enabled, bodies are put to sleep (or woken up) one
+    /// island at a time, where islands are formed by bodies connected through links and contacts.
+    /// Only the iterative solvers (SOR, SYMMSOR, JACOBI, SOR_MULTITHREAD, BARZILAIBORWEIN, APGD,
+    /// PMINRES, PCG, MINRES) support this mode; with other solvers the whole system is solved at once.
+    /// The whole system is also solved at once if it contains stiffness blocks other than ChKblockGeneric,
+    /// since these do not tell which variables they couple.
+    /// The statistics of the speed solver (GetTotalIterations, GetViolationHistory) report the maximum
+    /// over all islands.
+    void SetUseIslands(bool mval) { use_islands = mval; }
+
+    /// Tell if the system is decomposed in islands.
+    bool GetUseIslands() const { return use_islands; }
+
+    /// Return the number of islands solved separately in the last solver call (0 if not using islands).
+    /// Bodies not involved in any constraint are not counted.
+    int GetNislands() const { return nislands; }
+
+    /// Turn on this feature to obtain bitwise reproducible results from multithreaded runs.
+    /// In deterministic mode, parallel loops which accumulate into shared data (the projected SOR
+    /// iterations of SOR_MULTITHREAD, the assembly of internal forces in FEA meshes) do not rely
+    /// on atomics or locks; instead, the work items are grouped in colors such that items of the
+    /// same color do not share any variable, and the colors are processed in a fixed order.
+    /// Results then do not depend on thread scheduling nor on the number of threads, at the price
+    /// of some parallel efficiency. The default is false.
+    /// This also applies when solving islands (see SetUseIslands): with the SOR_MULTITHREAD solver, each
+    /// island is then solved with the same colored sweeps, on a single thread.
+    void SetDeterministic(bool mval) { deterministic = mval; }
+
+    /// Tell if the system runs in deterministic mode.
+    bool GetDeterministic() const { return deterministic; }
+
   private:
     /// Put bodies to sleep if possible. Also awakens sleeping bodies, if needed.
     /// Returns true if some body changed from sleep to no sleep or viceversa,
@@ -614,6 +650,18 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
     /// because the sleeping policy changed the totalDOFs and offsets.
     bool ManageSleepingBodies();
 
+    /// Same as ManageSleepingBodies, but bodies connected through links and contacts
+    /// are put to sleep, or woken up, all together.
+    bool ManageSleepingIslands();
+
+    /// Solve the problem in the system descriptor one island at a time.
+    /// Returns false (without solving) if the current solver does not support islands.
+    bool SolveIslands();
+
+    /// Create a single-threaded iterative solver of the given type, for solving islands.
+    /// Returns nullptr if the type is not supported for solving islands.
+    static std::shared_ptr<ChIterativeSolver> CreateIslandSolver(ChSolver::Type type);
+
     /// Performs a single dynamical simulation step, according to
     /// current values of:  Y, time, step  (and other minor settings)
     /// Depending on the integration type, it switches to one of the following:
@@ -803,6 +851,13 @@ class ChApi ChSystem : public ChAssembly, public ChIntegrableIIorder {
 
     bool use_sleeping;  ///< if true, put to sleep objects that come to rest
 
+    bool use_islands;  ///< if true, solve independent islands separately (and put them to sleep as a whole)
+    int nislands;      ///< number of islands in the last solve
+    std::vector<std::shared_ptr<ChSystemDescriptor>> island_descriptors;  ///< descriptors of the islands
+    std::vector<std::shared_ptr<ChIterativeSolver>> island_solvers;       ///< per-thread solvers for the islands
+
+    bool deterministic;  ///< if true, multithreaded computations give reproducible results
+
     std::shared_ptr<ChSystemDescriptor> descriptor;  ///< the system descriptor
     std::shared_ptr<ChSolver> solver_speed;          ///< the solver for speed problem
     std::shared_ptr<ChSolver> solver_stab;           ///< the solver for position (stabilization) problem, if any
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Driver for an ensemble of independent simulations advanced concurrently on a
+// pool of worker threads.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "chrono/parallel/ChOpenMP.h"
+#include "chrono/physics/ChSystemEnsemble.h"
+
+namespace chrono {
+
+ChSystemEnsemble::ChSystemEnsemble(int num_threads)
+    : m_threads_per_member(1), m_step(1e-3), m_end_time(1), m_next(0), m_num_completed(0), m_abort(false) {
+    SetNumThreads(num_threads);
+}
+
+void ChSystemEnsemble::SetNumThreads(int num_threads) {
+    if (num_threads < 1)
+        num_threads = CHOMPfunctions::GetNumProcs();
+    m_num_threads = std::max(num_threads, 1);
+}
+
+void ChSystemEnsemble::Run(int num_members, MemberCallback* callback) {
+    m_next = 0;
+    m_num_completed = 0;
+    m_abort = false;
+    m_exception = nullptr;
+    m_collision_defaults = collision::ChCollisionDefaults();
+
+    int num_workers = std::min(m_num_threads, num_members);
+    std::vector<std::thread> workers;
+    workers.reserve(num_workers);
+    for (int i = 0; i < num_workers; i++)
+        workers.push_back(std::thread(&ChSystemEnsemble::WorkerLoop, this, num_members, callback));
+    for (auto& worker : workers)
+        worker.join();
+
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+}
+
+void ChSystemEnsemble::WorkerLoop(int num_members, MemberCallback* callback) {
+    // The OpenMP thread count is a per-thread setting; this only affects the parallel regions
+    // (without an explicit num_threads clause) encountered by the members run on this thread.
+    CHOMPfunctions::SetNumThreads(m_threads_per_member);
+
+    while (!m_abort) {
+        int member = m_next++;
+        if (member >= num_members)
+            return;
+
+        try {
+            RunMember(member, callback);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+                m_exception = std::current_exception();
+            m_abort = true;
+        }
+    }
+}
+
+void ChSystemEnsemble::RunMember(int member, MemberCallback* callback) {
+    collision::ChCollisionDefaults defaults = m_collision_defaults;
+    collision::ChCollisionDefaults::Scope scope(defaults);
+
+    std::shared_ptr<ChSystem> system = callback->CreateSystem(member);
+    system->SetParallelThreadNumber(m_threads_per_member);
+
+    // Take a last, shorter step if needed to stop exactly at the end time.
+    while (!m_abort) {
+        double step = std::min(m_step, m_end_time - system->GetChTime());
+        if (step < 1e-6 * m_step)
+            break;
+        system->DoStepDynamics(step);
+        if (!callback->OnStep(member, *system))
+            break;
+    }
+
+    callback->OnComplete(member, *system);
+    m_num_completed++;
+}
+
+}  // end namespace chrono
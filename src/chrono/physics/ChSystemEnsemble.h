@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Driver for an ensemble of independent simulations advanced concurrently on a
+// pool of worker threads.
+//
+// =============================================================================
+
+#ifndef CH_SYSTEM_ENSEMBLE_H
+#define CH_SYSTEM_ENSEMBLE_H
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+
+/// Driver for an ensemble of independent simulations (e.g. a parameter sweep) advanced concurrently.
+/// Each member of the ensemble is a separate ChSystem which is created by a user-supplied callback on one of the
+/// worker threads, advanced to the end time, reported through the same callback, and then released. Members are
+/// handed out one at a time from a shared counter, so that a thread which finished a short simulation immediately
+/// picks up the next pending member. Only as many systems as there are worker threads exist at any time.
+///
+/// Each worker thread sets its OpenMP thread count, and each member system its parallel thread number, to the value
+/// specified with SetThreadsPerMember (1 by default), so that the ensemble does not oversubscribe the cores.
+/// The callback functions are invoked concurrently from all worker threads; any data shared between members must be
+/// protected by the user.
+///
+/// Each member is given its own copy of the collision defaults (see collision::ChCollisionDefaults), taken from the
+/// defaults in effect when Run is called. While the member is created and simulated, the default collision envelope,
+/// margin, and effective curvature radius set or read on its worker thread (including the values set by the ChSystem
+/// constructors) refer to this copy, so they can be changed inside CreateSystem without affecting other members or
+/// the process-wide defaults. The Bullet statistics counters are stored per thread.
+/// The Bullet contact breaking threshold (ChCollisionSystemBullet::SetContactBreakingThreshold) is shared by all
+/// threads: it must be set before Run and is not supported inside CreateSystem.
+class ChApi ChSystemEnsemble {
+  public:
+    /// Class to be used as a callback interface for creating the members of the ensemble and collecting results.
+    class ChApi MemberCallback {
+      public:
+        virtual ~MemberCallback() {}
+
+        /// Create and initialize the system for the specified ensemble member.
+        /// Called from a worker thread, so that model construction also runs concurrently.
+        virtual std::shared_ptr<ChSystem> CreateSystem(int member) = 0;
+
+        /// Called after each integration step of the specified member.
+        /// Return false to terminate the simulation of this member before the end time.
+        virtual bool OnStep(int member, ChSystem& system) { return true; }
+
+        /// Called once the specified member reached the end time (or was terminated).
+        /// The system is released after this function returns.
+        virtual void OnComplete(int member, ChSystem& system) {}
+    };
+
+    /// Construct an ensemble driver using the specified number of worker threads.
+    /// If num_threads is not positive, the number of available processors is used.
+    ChSystemEnsemble(int num_threads = 0);
+
+    /// Set the number of worker threads.
+    void SetNumThreads(int num_threads);
+
+    /// Get the number of worker threads.
+    int GetNumThreads() const { return m_num_threads; }
+
+    /// Set the number of threads used by each member system (default: 1).
+    void SetThreadsPerMember(int num_threads) { m_threads_per_member = std::max(num_threads, 1); }
+
+    /// Get the number of threads used by each member system.
+    int GetThreadsPerMember() const { return m_threads_per_member; }
+
+    /// Set the integration step size (default: 1e-3).
+    void SetStepSize(double step) { m_step = step; }
+
+    /// Set the simulation end time of all members (default: 1).
+    void SetEndTime(double end_time) { m_end_time = end_time; }
+
+    /// Simulate the specified number of members and return when all are completed.
+    /// If the callback or a simulation throws an exception, no new members are started and the first exception is
+    /// rethrown once all worker threads finished.
+    void Run(int num_members, MemberCallback* callback);
+
+    /// Get the number of members completed during the last (or current) call to Run.
+    int GetNumCompleted() const { return m_num_completed; }
+
+  private:
+    /// Loop executed by each worker thread.
+    void WorkerLoop(int num_members, MemberCallback* callback);
+
+    /// Create, simulate, and report the specified member.
+    void RunMember(int member, MemberCallback* callback);
+
+    collision::ChCollisionDefaults m_collision_defaults;  ///< collision defaults copied to each member
+
+    int m_num_threads;         ///< number of worker threads
+    int m_threads_per_member;  ///< number of threads used by each member system
+    double m_step;             ///< integration step size
+    double m_end_time;         ///< simulation end time
+
+    std::atomic<int> m_next;           ///< index of the next member to be simulated
+    std::atomic<int> m_num_completed;  ///< number of completed members
+    std::atomic<bool> m_abort;         ///< an exception was thrown; do not start new members
+    std::mutex m_mutex;                ///< mutex protecting the exception pointer
+    std::exception_ptr m_exception;    ///< first exception thrown by a worker thread
+};
+
+}  // end namespace chrono
+
+#endif
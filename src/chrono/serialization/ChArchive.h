@@ -21,6 +21,7 @@
 #include <unordered_set>
 #include <memory>
 #include <algorithm>
+#include <type_traits>
 
 #include "chrono/core/ChApiCE.h"
 #include "chrono/core/ChStream.h"
@@ -749,6 +750,35 @@ private:
 };
 
 
+//
+// Traits for types that archives may store as contiguous raw blocks
+//
+
+/// Traits class telling if arrays of type T can be serialized as a single contiguous
+/// block of bytes (see ChArchiveOut::out_array_pod). Specializations must set 'value'
+/// to true, provide a type tag that identifies the kind of element (the element size is
+/// stored separately), and the size of the scalar components (used for byte-swapping).
+template <class T, class Enable = void>
+struct ChArchivePOD {
+    static const bool value = false;
+    static char tag() { return 0; }
+    static size_t scalar_size() { return sizeof(T); }
+};
+
+/// Specialization for arithmetic types (except bool, since std::vector<bool> is not contiguous).
+template <class T>
+struct ChArchivePOD<T, typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, bool>::value>::type> {
+    static const bool value = true;
+    static char tag() { return std::is_floating_point<T>::value ? 'f' : (std::is_signed<T>::value ? 'i' : 'u'); }
+    static size_t scalar_size() { return sizeof(T); }
+};
+
+// Access to the contiguous storage of a std::vector (std::vector<bool> has none).
+template <class T>
+inline char* _array_pod_data(std::vector<T>& vec) { return (char*)vec.data(); }
+inline char* _array_pod_data(std::vector<bool>& vec) { return nullptr; }
+
+
 ///
 /// This is a base class for archives with pointers to shared objects 
 ///
@@ -896,6 +926,11 @@ class  ChArchiveOut : public ChArchive {
       virtual void out_array_between (ChValue& bVal, size_t msize) = 0;
       virtual void out_array_end (ChValue& bVal, size_t msize) = 0;
 
+        // for contiguous arrays of plain-old-data (see ChArchivePOD): archives that can store
+        // them as a single block do so and return true; by default return false, in which case
+        // the caller serializes the array element by element.
+      virtual bool out_array_pod (ChValue& bVal, const char* data, size_t msize, char type_tag, size_t elem_size, size_t scalar_size) { return false; }
+
 
       //---------------------------------------------------
 
@@ -911,6 +946,9 @@ class  ChArchiveOut : public ChArchive {
       void out     (ChNameValue<T[N]> bVal) {
           size_t arraysize = sizeof(bVal.value())/sizeof(T);
           ChValueSpecific<T[N]> specVal(bVal.value(), bVal.name(), bVal.flags());
+          if (ChArchivePOD<T>::value &&
+              this->out_array_pod(specVal, (const char*)bVal.value(), arraysize, ChArchivePOD<T>::tag(), sizeof(T), ChArchivePOD<T>::scalar_size()))
+              return;
           this->out_array_pre( specVal, arraysize);
           for (size_t i = 0; i<arraysize; ++i)
           {
@@ -927,6 +965,9 @@ class  ChArchiveOut : public ChArchive {
       template<class T>
       void out     (ChNameValue< std::vector<T> > bVal) {
           ChValueSpecific< std::vector<T> > specVal(bVal.value(), bVal.name(), bVal.flags());
+          if (ChArchivePOD<T>::value &&
+              this->out_array_pod(specVal, _array_pod_data(bVal.value()), bVal.value().size(), ChArchivePOD<T>::tag(), sizeof(T), ChArchivePOD<T>::scalar_size()))
+              return;
           this->out_array_pre( specVal, bVal.value().size());
           for (size_t i = 0; i<bVal.value().size(); ++i)
           {
@@ -1207,6 +1248,12 @@ class  ChArchiveIn : public ChArchive {
       virtual void in_array_between (const char* name) = 0;
       virtual void in_array_end (const char* name) = 0;
 
+        // for contiguous arrays of plain-old-data (see ChArchivePOD): archives that stored the
+        // array as a single block return true and the number of elements, after which the data
+        // is read with in_array_pod; by default return false (array stored element by element).
+      virtual bool in_array_pod_pre (const char* name, char type_tag, size_t elem_size, size_t& msize) { return false; }
+      virtual void in_array_pod (const char* name, char* data, size_t msize, size_t elem_size, size_t scalar_size) {}
+
       //---------------------------------------------------
 
            // trick to wrap enum mappers:
@@ -1220,6 +1267,11 @@ class  ChArchiveIn : public ChArchive {
       template<class T, size_t N>
       void in     (ChNameValue<T[N]> bVal) {
           size_t arraysize;
+          if (ChArchivePOD<T>::value && this->in_array_pod_pre(bVal.name(), ChArchivePOD<T>::tag(), sizeof(T), arraysize)) {
+              if (arraysize != sizeof(bVal.value())/sizeof(T) ) {throw (ChExceptionArchive( "Size of [] saved array does not match size of receiver array " + std::string(bVal.name()) + "."));}
+              this->in_array_pod(bVal.name(), (char*)bVal.value(), arraysize, sizeof(T), ChArchivePOD<T>::scalar_size());
+              return;
+          }
           this->in_array_pre(bVal.name(), arraysize);
           if (arraysize != sizeof(bVal.value())/sizeof(T) ) {throw (ChExceptionArchive( "Size of [] saved array does not match size of receiver array " + std::string(bVal.name()) + "."));}
           for (size_t i = 0; i<arraysize; ++i)
@@ -1240,6 +1292,11 @@ class  ChArchiveIn : public ChArchive {
       void in     (ChNameValue< std::vector<T> > bVal) {
           bVal.value().clear();
           size_t arraysize;
+          if (ChArchivePOD<T>::value && this->in_array_pod_pre(bVal.name(), ChArchivePOD<T>::tag(), sizeof(T), arraysize)) {
+              bVal.value().resize(arraysize);
+              this->in_array_pod(bVal.name(), _array_pod_data(bVal.value()), arraysize, sizeof(T), ChArchivePOD<T>::scalar_size());
+              return;
+          }
           this->in_array_pre(bVal.name(), arraysize);
           bVal.value().resize(arraysize);
           for (size_t i = 0; i<arraysize; ++i)
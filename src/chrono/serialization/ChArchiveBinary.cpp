@@ -0,0 +1,174 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+#include "chrono/serialization/ChArchiveBinary.h"
+
+namespace chrono {
+
+// -----------------------------------------------------------------------------
+// Byte shuffling: group the i-th bytes of all scalars together, so that the
+// (slowly varying) sign/exponent bytes of floating point data form long runs.
+// -----------------------------------------------------------------------------
+
+void ChArchiveBinaryCodec::Shuffle(const char* src, size_t nbytes, size_t scalar_size, char* dst) {
+    if (scalar_size < 2 || nbytes % scalar_size != 0) {
+        std::memcpy(dst, src, nbytes);
+        return;
+    }
+    size_t n = nbytes / scalar_size;
+    for (size_t i = 0; i < n; i++)
+        for (size_t b = 0; b < scalar_size; b++)
+            dst[b * n + i] = src[i * scalar_size + b];
+}
+
+void ChArchiveBinaryCodec::Unshuffle(const char* src, size_t nbytes, size_t scalar_size, char* dst) {
+    if (scalar_size < 2 || nbytes % scalar_size != 0) {
+        std::memcpy(dst, src, nbytes);
+        return;
+    }
+    size_t n = nbytes / scalar_size;
+    for (size_t b = 0; b < scalar_size; b++)
+        for (size_t i = 0; i < n; i++)
+            dst[i * scalar_size + b] = src[b * n + i];
+}
+
+// -----------------------------------------------------------------------------
+// LZ77 block codec, with the same sequence layout as the LZ4 block format:
+//    token (4 bits literal length, 4 bits match length - 4)
+//    [extra literal length bytes] literals
+//    2-byte little-endian match offset [extra match length bytes]
+// The last sequence only contains literals.
+// -----------------------------------------------------------------------------
+
+static const size_t lz_min_match = 4;
+static const size_t lz_max_offset = 65535;
+static const int lz_hash_log = 14;
+
+static inline uint32_t LZRead32(const char* p) {
+    uint32_t val;
+    std::memcpy(&val, p, sizeof(val));
+    return val;
+}
+
+static inline void LZWriteLength(std::vector<char>& dst, size_t len) {
+    while (len >= 255) {
+        dst.push_back((char)255);
+        len -= 255;
+    }
+    dst.push_back((char)len);
+}
+
+static void LZWriteSequence(std::vector<char>& dst,
+                            const char* literals,
+                            size_t num_literals,
+                            size_t offset,
+                            size_t match_len) {
+    size_t ml = match_len ? match_len - lz_min_match : 0;
+    unsigned char token = (unsigned char)((std::min<size_t>(num_literals, 15) << 4) | std::min<size_t>(ml, 15));
+    dst.push_back((char)token);
+    if (num_literals >= 15)
+        LZWriteLength(dst, num_literals - 15);
+    dst.insert(dst.end(), literals, literals + num_literals);
+    if (!match_len)
+        return;
+    dst.push_back((char)(offset & 0xFF));
+    dst.push_back((char)(offset >> 8));
+    if (ml >= 15)
+        LZWriteLength(dst, ml - 15);
+}
+
+void ChArchiveBinaryCodec::Compress(const char* src, size_t nbytes, std::vector<char>& dst) {
+    dst.clear();
+    dst.reserve(nbytes / 2 + 16);
+
+    std::vector<size_t> table((size_t)1 << lz_hash_log, (size_t)-1);
+
+    size_t ip = 0;
+    size_t anchor = 0;
+    while (ip + lz_min_match <= nbytes) {
+        uint32_t seq = LZRead32(src + ip);
+        uint32_t h = (seq * 2654435761u) >> (32 - lz_hash_log);
+        size_t ref = table[h];
+        table[h] = ip;
+
+        if (ref == (size_t)-1 || ip - ref > lz_max_offset || LZRead32(src + ref) != seq) {
+            ip++;
+            continue;
+        }
+
+        size_t len = lz_min_match;
+        while (ip + len < nbytes && src[ref + len] == src[ip + len])
+            len++;
+
+        LZWriteSequence(dst, src + anchor, ip - anchor, ip - ref, len);
+        ip += len;
+        anchor = ip;
+    }
+
+    LZWriteSequence(dst, src + anchor, nbytes - anchor, 0, 0);
+}
+
+static inline bool LZReadLength(const unsigned char* src, size_t nsrc, size_t& ip, size_t& len) {
+    unsigned char b;
+    do {
+        if (ip >= nsrc)
+            return false;
+        b = src[ip++];
+        len += b;
+    } while (b == 255);
+    return true;
+}
+
+bool ChArchiveBinaryCodec::Decompress(const char* src, size_t nsrc, char* dst, size_t nbytes) {
+    const unsigned char* in = (const unsigned char*)src;
+    size_t ip = 0;
+    size_t op = 0;
+
+    while (ip < nsrc) {
+        unsigned char token = in[ip++];
+
+        size_t num_literals = token >> 4;
+        if (num_literals == 15 && !LZReadLength(in, nsrc, ip, num_literals))
+            return false;
+        if (ip + num_literals > nsrc || op + num_literals > nbytes)
+            return false;
+        std::memcpy(dst + op, src + ip, num_literals);
+        ip += num_literals;
+        op += num_literals;
+
+        if (ip == nsrc)
+            break;
+
+        if (ip + 2 > nsrc)
+            return false;
+        size_t offset = (size_t)in[ip] | ((size_t)in[ip + 1] << 8);
+        ip += 2;
+        size_t match_len = token & 0x0F;
+        if (match_len == 15 && !LZReadLength(in, nsrc, ip, match_len))
+            return false;
+        match_len += lz_min_match;
+        if (offset == 0 || offset > op || op + match_len > nbytes)
+            return false;
+
+        // Byte-wise copy, since the match may overlap the output.
+        for (size_t i = 0; i < match_len; i++, op++)
+            dst[op] = dst[op - offset];
+    }
+
+    return op == nbytes;
+}
+
+}  // end namespace chrono
@@ -13,11 +13,50 @@
 #ifndef CHARCHIVEBINARY_H
 #define CHARCHIVEBINARY_H
 
+#include <algorithm>
+#include <string>
+#include <vector>
+
 #include "chrono/serialization/ChArchive.h"
 #include "chrono/core/ChLog.h"
 
 namespace chrono {
 
+///
+/// Codec used by binary archives to compress contiguous arrays of plain-old-data.
+/// Data is byte-shuffled (grouping the i-th bytes of all scalars) and then compressed
+/// with a fast LZ77 block codec using the sequence layout of the LZ4 block format.
+///
+
+class ChApi ChArchiveBinaryCodec {
+  public:
+    /// Byte-shuffle 'nbytes' bytes of data made of scalars of size 'scalar_size'.
+    static void Shuffle(const char* src, size_t nbytes, size_t scalar_size, char* dst);
+
+    /// Invert the byte shuffling performed by Shuffle().
+    static void Unshuffle(const char* src, size_t nbytes, size_t scalar_size, char* dst);
+
+    /// Compress 'nbytes' bytes of data into the given buffer.
+    static void Compress(const char* src, size_t nbytes, std::vector<char>& dst);
+
+    /// Decompress 'nsrc' bytes into exactly 'nbytes' bytes of data.
+    /// Returns false if the compressed data is corrupted.
+    static bool Decompress(const char* src, size_t nsrc, char* dst, size_t nbytes);
+};
+
+
+// Binary archives start with this 8-byte signature, followed by the format version (int).
+// Version 1 was the unversioned format (no header, arrays always stored element by element);
+// version 2 added the single-block storage of contiguous arrays of plain-old-data.
+static const char CH_ARCHIVE_BINARY_MAGIC[8] = {'C', 'H', 'B', 'I', 'N', 'A', 'R', 'C'};
+static const int CH_ARCHIVE_BINARY_VERSION = 2;
+
+// Reverse the byte ordering of each scalar of size 'scalar_size' in the given data.
+inline void SwapScalars(char* data, size_t nbytes, size_t scalar_size) {
+    for (size_t i = 0; i + scalar_size <= nbytes; i += scalar_size)
+        std::reverse(data + i, data + i + scalar_size);
+}
+
 ///
 /// This is a class for serializing to binary archives
 ///
@@ -27,10 +66,18 @@ class  ChArchiveOutBinary : public ChArchiveOut {
 
       ChArchiveOutBinary( ChStreamOutBinary& mostream) {
           ostream = &mostream;
+          compression = false;
+          ostream->GenericBinaryOutput(CH_ARCHIVE_BINARY_MAGIC, sizeof(CH_ARCHIVE_BINARY_MAGIC));
+          (*ostream) << CH_ARCHIVE_BINARY_VERSION;
       };
 
       virtual ~ChArchiveOutBinary() {};
 
+      /// Enable compression of contiguous arrays of plain-old-data (default: false).
+      /// Blocks that do not compress are stored uncompressed. Archives can be read
+      /// back by ChArchiveInBinary regardless of this setting.
+      void SetCompression(bool mval) { compression = mval; }
+
       virtual void out     (ChNameValue<bool> bVal) {
             (*ostream) << bVal.value();
       }
@@ -71,6 +118,38 @@ class  ChArchiveOutBinary : public ChArchiveOut {
       virtual void out_array_between (ChValue& bVal, size_t msize) {}
       virtual void out_array_end (ChValue& bVal, size_t msize) {}
 
+        // contiguous arrays of plain-old-data are stored as a single block:
+        // size, type tag, element size, compression flag, [compressed size], data
+      virtual bool out_array_pod (ChValue& bVal, const char* data, size_t msize, char type_tag, size_t elem_size, size_t scalar_size) {
+            (*ostream) << msize;
+            (*ostream) << type_tag;
+            (*ostream) << (unsigned int)elem_size;
+
+            size_t nbytes = msize * elem_size;
+            if (ostream->IsBigEndianMachine()) {
+                // blocks are always stored with little-endian byte ordering
+                swapped.assign(data, data + nbytes);
+                SwapScalars(swapped.data(), nbytes, scalar_size);
+                data = swapped.data();
+            }
+
+            if (compression && nbytes > 0) {
+                shuffled.resize(nbytes);
+                ChArchiveBinaryCodec::Shuffle(data, nbytes, scalar_size, shuffled.data());
+                ChArchiveBinaryCodec::Compress(shuffled.data(), nbytes, packed);
+                if (packed.size() < nbytes) {
+                    (*ostream) << (char)1;
+                    (*ostream) << packed.size();
+                    ostream->GenericBinaryOutput(packed.data(), packed.size());
+                    return true;
+                }
+            }
+
+            (*ostream) << (char)0;
+            ostream->GenericBinaryOutput(data, nbytes);
+            return true;
+      }
+
 
         // for custom c++ objects:
       virtual void out     (ChValue& bVal, bool tracked, size_t obj_ID) {
@@ -105,6 +184,10 @@ class  ChArchiveOutBinary : public ChArchiveOut {
 
   protected:
       ChStreamOutBinary* ostream;
+      bool compression;
+      std::vector<char> swapped;
+      std::vector<char> shuffled;
+      std::vector<char> packed;
 };
 
 
@@ -118,12 +201,31 @@ class  ChArchiveOutBinary : public ChArchiveOut {
 class  ChArchiveInBinary : public ChArchiveIn {
   public:
 
-      ChArchiveInBinary( ChStreamInBinary& mistream) {
+      /// Construct the archive, reading the signature and format version from the stream.
+      /// Throws if the stream does not start with a binary archive signature (e.g. archives written
+      /// before the format was versioned) or if it was written with a newer, unknown format version.
+      /// Archives written before the format was versioned (version 1, no signature) can still be read
+      /// by setting 'unversioned' to true; the stream is then read with the version 1 layout.
+      ChArchiveInBinary( ChStreamInBinary& mistream, bool unversioned = false) {
           istream = &mistream;
+          if (unversioned) {
+              version = 1;
+              return;
+          }
+          char magic[sizeof(CH_ARCHIVE_BINARY_MAGIC)];
+          istream->GenericBinaryInput(magic, sizeof(magic));
+          if (!std::equal(magic, magic + sizeof(magic), CH_ARCHIVE_BINARY_MAGIC))
+              throw (ChExceptionArchive("Not a binary archive, or an archive written with an unversioned (older) format."));
+          (*istream) >> version;
+          if (version < 2 || version > CH_ARCHIVE_BINARY_VERSION)
+              throw (ChExceptionArchive("Unsupported binary archive version " + std::to_string(version) + "."));
       };
 
       virtual ~ChArchiveInBinary() {};
 
+      /// Get the format version of the archive being read.
+      int GetVersion() const { return version; }
+
       virtual void in     (ChNameValue<bool> bVal) {
             (*istream) >> bVal.value();
       }
@@ -163,6 +265,39 @@ class  ChArchiveInBinary : public ChArchiveIn {
       virtual void in_array_between (const char* name) {}
       virtual void in_array_end (const char* name) {}
 
+        // contiguous arrays of plain-old-data, stored as a single block
+      virtual bool in_array_pod_pre (const char* name, char type_tag, size_t elem_size, size_t& msize) {
+            if (version < 2)
+                return false;  // version 1 stored all arrays element by element
+            char tag;
+            unsigned int size;
+            (*istream) >> msize;
+            (*istream) >> tag;
+            (*istream) >> size;
+            if (tag != type_tag || size != elem_size)
+                throw (ChExceptionArchive( "Type of saved array '" + std::string(name) + "' does not match type of receiver array."));
+            return true;
+      }
+      virtual void in_array_pod (const char* name, char* data, size_t msize, size_t elem_size, size_t scalar_size) {
+            size_t nbytes = msize * elem_size;
+            char mode;
+            (*istream) >> mode;
+            if (mode == 1) {
+                size_t npacked;
+                (*istream) >> npacked;
+                packed.resize(npacked);
+                shuffled.resize(nbytes);
+                istream->GenericBinaryInput(packed.data(), npacked);
+                if (!ChArchiveBinaryCodec::Decompress(packed.data(), npacked, shuffled.data(), nbytes))
+                    throw (ChExceptionArchive( "Corrupted compressed data in array '" + std::string(name) + "'."));
+                ChArchiveBinaryCodec::Unshuffle(shuffled.data(), nbytes, scalar_size, data);
+            } else {
+                istream->GenericBinaryInput(data, nbytes);
+            }
+            if (istream->IsBigEndianMachine())
+                SwapScalars(data, nbytes, scalar_size);
+      }
+
         //  for custom c++ objects:
       virtual void in     (ChNameValue<ChFunctorArchiveIn> bVal) {
           if (bVal.flags() & NVP_TRACK_OBJECT){
@@ -220,6 +355,9 @@ class  ChArchiveInBinary : public ChArchiveIn {
 
   protected:
       ChStreamInBinary* istream;
+      int version;
+      std::vector<char> shuffled;
+      std::vector<char> packed;
 };
 
 }  // end namespace chrono
@@ -15,6 +15,9 @@
 #ifndef CHITERATIVESOLVER_H
 #define CHITERATIVESOLVER_H
 
+#include <algorithm>
+#include <vector>
+
 #include "chrono/solver/ChSolver.h"
 
 namespace chrono {
@@ -135,6 +138,28 @@ class ChApi ChIterativeSolver : public ChSolver {
     /// Note that collection of constraint violations must be enabled through SetRecordViolation.
     const std::vector<double>& GetDeltalambdaHistory() const { return dlambda_history; };
 
+    /// Clear the number of iterations and the recorded histories of the last solve.
+    void ResetStatistics() {
+        tot_iterations = 0;
+        violation_history.clear();
+        dlambda_history.clear();
+    }
+
+    /// Merge the statistics of another solver, which solved a separate part of the same problem
+    /// (as done when solving islands, see ChSystem::SetUseIslands), into the statistics of this one.
+    /// The number of iterations, and each entry of the recorded histories, take the maximum of both.
+    void MergeStatistics(const ChIterativeSolver& other) {
+        tot_iterations = std::max(tot_iterations, other.tot_iterations);
+        if (violation_history.size() < other.violation_history.size())
+            violation_history.resize(other.violation_history.size(), 0.0);
+        for (size_t i = 0; i < other.violation_history.size(); i++)
+            violation_history[i] = std::max(violation_history[i], other.violation_history[i]);
+        if (dlambda_history.size() < other.dlambda_history.size())
+            dlambda_history.resize(other.dlambda_history.size(), 0.0);
+        for (size_t i = 0; i < other.dlambda_history.size(); i++)
+            dlambda_history[i] = std::max(dlambda_history[i], other.dlambda_history[i]);
+    }
+
   protected:
     /// This method MUST be called by all iterative methods INSIDE their iteration loops
     /// (at the end). If history recording is enabled, this function will store the
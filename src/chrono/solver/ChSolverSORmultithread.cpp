@@ -12,8 +12,10 @@
 // Authors: Alessandro Tasora, Radu Serban
 // =============================================================================
 
+#include <algorithm>
 #include <cstdio>
 
+#include "chrono/core/ChSparseMatrix.h"
 #include "chrono/parallel/ChThreadsSync.h"
 #include "chrono/solver/ChConstraintTwoTuplesFrictionT.h"
 #include "chrono/solver/ChConstraintTwoTuplesRollingN.h"
@@ -31,7 +33,13 @@ struct thread_data {
     ChSolverSORmultithread* solver;  // reference to solver
     ChMutexSpinlock* mutex;          // this will be used to avoid race condition when writing to shared memory.
 
-    enum solver_stage { STAGE1_PREPARE = 0, STAGE2_ADDFORCES, STAGE3_LOOPCONSTRAINTS };
+    enum solver_stage {
+        STAGE1_PREPARE = 0,
+        STAGE2_ADDFORCES,
+        STAGE3_LOOPCONSTRAINTS,
+        STAGE4_WARMSTART_BLOCKS,
+        STAGE5_SWEEP_BLOCKS
+    };
 
     solver_stage stage;
 
@@ -45,6 +53,14 @@ struct thread_data {
 
     std::vector<ChConstraint*>* mconstraints;
     std::vector<ChVariables*>* mvariables;
+
+    // the range of scanned blocks of constraints of one color (deterministic mode only)
+    unsigned int block_from;
+    unsigned int block_to;
+
+    const std::vector<int>* mblocks;                // blocks of the current color
+    const std::vector<unsigned int>* mblock_start;  // first constraint of each block
+    std::vector<double>* mblock_violation;          // max violation in each block, after the last sweep
 };
 
 // Don't create local store memory, just return 0
@@ -53,14 +69,157 @@ void* SolverMemoryFunc() {
     return 0;
 }
 
+// Update auxiliary data of the constraints in the range [constr_from, constr_to).
+// The range must not split the multipliers of a contact.
+
+static void PrepareConstraints(std::vector<ChConstraint*>& mconstraints,
+                               unsigned int constr_from,
+                               unsigned int constr_to) {
+    //    Update auxiliary data in all constraints before starting,
+    //    that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
+    //
+    for (unsigned int ic = constr_from; ic < constr_to; ic++)
+        mconstraints[ic]->Update_auxiliary();
+
+    //    Average all g_i for the triplet of contact constraints n,u,v.
+    //
+    int j_friction_comp = 0;
+    double gi_values[3];
+    for (unsigned int ic = constr_from; ic < constr_to; ic++) {
+        if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+            gi_values[j_friction_comp] = mconstraints[ic]->Get_g_i();
+            j_friction_comp++;
+            if (j_friction_comp == 3) {
+                double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
+                mconstraints[ic - 2]->Set_g_i(average_g_i);
+                mconstraints[ic - 1]->Set_g_i(average_g_i);
+                mconstraints[ic - 0]->Set_g_i(average_g_i);
+                j_friction_comp = 0;
+            }
+        }
+    }
+}
+
+// Perform one projected SOR sweep on the constraints in the range [constr_from, constr_to).
+// The range must not split the multipliers of a contact. If a mutex is provided, it is locked
+// when updating the speeds of the variables of non-contact constraints.
+// Returns the maximum constraint violation in the range.
+
+static double SweepConstraints(ChSolverSORmultithread* solver,
+                               std::vector<ChConstraint*>& mconstraints,
+                               unsigned int constr_from,
+                               unsigned int constr_to,
+                               ChMutexSpinlock* mutex) {
+    double maxviolation = 0.;
+    int i_friction_comp = 0;
+    double old_lambda_friction[3];
+
+    for (unsigned int ic = constr_from; ic < constr_to; ic++) {
+        // skip computations if constraint not active.
+        if (mconstraints[ic]->IsActive()) {
+            // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
+            double mresidual = mconstraints[ic]->Compute_Cq_q() + mconstraints[ic]->Get_b_i() +
+                               mconstraints[ic]->Get_cfm_i() * mconstraints[ic]->Get_l_i();
+
+            // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
+            double candidate_violation = fabs(mconstraints[ic]->Violation(mresidual));
+
+            // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
+            double deltal = (solver->GetOmega() / mconstraints[ic]->Get_g_i()) * (-mresidual);
+
+            if (mconstraints[ic]->GetMode() == CONSTRAINT_FRIC) {
+                candidate_violation = 0;
+                
+                // update:   lambda += delta_lambda;
+                old_lambda_friction[i_friction_comp] = mconstraints[ic]->Get_l_i();
+                mconstraints[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
+                i_friction_comp++;
+
+                if (i_friction_comp == 1)
+                    candidate_violation = fabs(ChMin(0.0, mresidual));
+
+                if (i_friction_comp == 3) {
+                    mconstraints[ic - 2]->Project();  // the N normal component will take care of N,U,V
+                    double new_lambda_0 = mconstraints[ic - 2]->Get_l_i();
+                    double new_lambda_1 = mconstraints[ic - 1]->Get_l_i();
+                    double new_lambda_2 = mconstraints[ic - 0]->Get_l_i();
+                    // Apply the smoothing: lambda= sharpness*lambda_new_projected +
+                    // (1-sharpness)*lambda_old
+                    if (solver->GetSharpnessLambda() != 1.0) {
+                        double shlambda = solver->GetSharpnessLambda();
+                        new_lambda_0 = shlambda * new_lambda_0 + (1.0 - shlambda) * old_lambda_friction[0];
+                        new_lambda_1 = shlambda * new_lambda_1 + (1.0 - shlambda) * old_lambda_friction[1];
+                        new_lambda_2 = shlambda * new_lambda_2 + (1.0 - shlambda) * old_lambda_friction[2];
+                        mconstraints[ic - 2]->Set_l_i(new_lambda_0);
+                        mconstraints[ic - 1]->Set_l_i(new_lambda_1);
+                        mconstraints[ic - 0]->Set_l_i(new_lambda_2);
+                    }
+                    double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
+                    double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
+                    double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
+                    //	mutex->Lock();   // this avoids double writing on shared q vector
+                    mconstraints[ic - 2]->Increment_q(true_delta_0);
+                    mconstraints[ic - 1]->Increment_q(true_delta_1);
+                    mconstraints[ic - 0]->Increment_q(true_delta_2);
+                    //	mutex->Unlock(); // end critical section
+                    /*
+								if (this->record_violation_history)
+								{
+									maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
+									maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
+									maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
+								}
+								*/  //***TO DO***
+                    i_friction_comp = 0;
+                }
+            } else {
+                // update:   lambda += delta_lambda;
+                double old_lambda = mconstraints[ic]->Get_l_i();
+                mconstraints[ic]->Set_l_i(old_lambda + deltal);
+
+                // If new lagrangian multiplier does not satisfy inequalities, project
+                // it into an admissible orthant (or, in general, onto an admissible set)
+                mconstraints[ic]->Project();
+
+                // After projection, the lambda may have changed a bit..
+                double new_lambda = mconstraints[ic]->Get_l_i();
+
+                // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
+                if (solver->GetSharpnessLambda() != 1.0) {
+                    double shlambda = solver->GetSharpnessLambda();
+                    new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda;
+                    mconstraints[ic]->Set_l_i(new_lambda);
+                }
+
+                double true_delta = new_lambda - old_lambda;
+
+                // For all items with variables, add the effect of incremented
+                // (and projected) lagrangian reactions:
+                if (mutex)
+                    mutex->Lock();  // this avoids double writing on shared q vector
+                mconstraints[ic]->Increment_q(true_delta);
+                if (mutex)
+                    mutex->Unlock();  // end critical section
+                /*
+							if (this->record_violation_history)
+								maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta)); 
+							*/                       //***TO DO***
+            }
+
+            maxviolation = ChMax(maxviolation, fabs(candidate_violation));
+
+        }  // end IsActive()
+
+    }  // end loop on constraints
+
+    return maxviolation;
+}
+
 // The following is the function which will be executed by
 // each thread, when threads are launched at each Solve()
 
 void SolverThreadFunc(void* userPtr, void* lsMemory) {
     double maxviolation = 0.;
-    double maxdeltalambda = 0.;
-    int i_friction_comp = 0;
-    double old_lambda_friction[3];
 
     thread_data* tdata = (thread_data*)userPtr;
 
@@ -69,29 +228,7 @@ void SolverThreadFunc(void* userPtr, void* lsMemory) {
 
     switch (tdata->stage) {
         case thread_data::STAGE1_PREPARE: {
-            //    Update auxiliary data in all constraints before starting,
-            //    that is: g_i=[Cq_i]*[invM_i]*[Cq_i]' and  [Eq_i]=[invM_i]*[Cq_i]'
-            //
-            for (unsigned int ic = tdata->constr_from; ic < tdata->constr_to; ic++)
-                (*mconstraints)[ic]->Update_auxiliary();
-
-            //    Average all g_i for the triplet of contact constraints n,u,v.
-            //
-            int j_friction_comp = 0;
-            double gi_values[3];
-            for (unsigned int ic = tdata->constr_from; ic < tdata->constr_to; ic++) {
-                if ((*mconstraints)[ic]->GetMode() == CONSTRAINT_FRIC) {
-                    gi_values[j_friction_comp] = (*mconstraints)[ic]->Get_g_i();
-                    j_friction_comp++;
-                    if (j_friction_comp == 3) {
-                        double average_g_i = (gi_values[0] + gi_values[1] + gi_values[2]) / 3.0;
-                        (*mconstraints)[ic - 2]->Set_g_i(average_g_i);
-                        (*mconstraints)[ic - 1]->Set_g_i(average_g_i);
-                        (*mconstraints)[ic - 0]->Set_g_i(average_g_i);
-                        j_friction_comp = 0;
-                    }
-                }
-            }
+            PrepareConstraints(*mconstraints, tdata->constr_from, tdata->constr_to);
 
             break;  // end stage
         }
@@ -131,105 +268,8 @@ void SolverThreadFunc(void* userPtr, void* lsMemory) {
                 // The iteration on all constraints
                 //
 
-                maxviolation = 0;
-                maxdeltalambda = 0;
-                i_friction_comp = 0;
-
-                for (unsigned int ic = tdata->constr_from; ic < tdata->constr_to; ic++) {
-                    // skip computations if constraint not active.
-                    if ((*mconstraints)[ic]->IsActive()) {
-                        // compute residual  c_i = [Cq_i]*q + b_i + cfm_i*l_i
-                        double mresidual = (*mconstraints)[ic]->Compute_Cq_q() + (*mconstraints)[ic]->Get_b_i() +
-                                           (*mconstraints)[ic]->Get_cfm_i() * (*mconstraints)[ic]->Get_l_i();
-
-                        // true constraint violation may be different from 'mresidual' (ex:clamped if unilateral)
-                        double candidate_violation = fabs((*mconstraints)[ic]->Violation(mresidual));
-
-                        // compute:  delta_lambda = -(omega/g_i) * ([Cq_i]*q + b_i + cfm_i*l_i )
-                        double deltal = (tdata->solver->GetOmega() / (*mconstraints)[ic]->Get_g_i()) * (-mresidual);
-
-                        if ((*mconstraints)[ic]->GetMode() == CONSTRAINT_FRIC) {
-                            candidate_violation = 0;
-                            
-                            // update:   lambda += delta_lambda;
-                            old_lambda_friction[i_friction_comp] = (*mconstraints)[ic]->Get_l_i();
-                            (*mconstraints)[ic]->Set_l_i(old_lambda_friction[i_friction_comp] + deltal);
-                            i_friction_comp++;
-
-                            if (i_friction_comp == 1)
-                                candidate_violation = fabs(ChMin(0.0, mresidual));
-
-                            if (i_friction_comp == 3) {
-                                (*mconstraints)[ic - 2]->Project();  // the N normal component will take care of N,U,V
-                                double new_lambda_0 = (*mconstraints)[ic - 2]->Get_l_i();
-                                double new_lambda_1 = (*mconstraints)[ic - 1]->Get_l_i();
-                                double new_lambda_2 = (*mconstraints)[ic - 0]->Get_l_i();
-                                // Apply the smoothing: lambda= sharpness*lambda_new_projected +
-                                // (1-sharpness)*lambda_old
-                                if (tdata->solver->GetSharpnessLambda() != 1.0) {
-                                    double shlambda = tdata->solver->GetSharpnessLambda();
-                                    new_lambda_0 = shlambda * new_lambda_0 + (1.0 - shlambda) * old_lambda_friction[0];
-                                    new_lambda_1 = shlambda * new_lambda_1 + (1.0 - shlambda) * old_lambda_friction[1];
-                                    new_lambda_2 = shlambda * new_lambda_2 + (1.0 - shlambda) * old_lambda_friction[2];
-                                    (*mconstraints)[ic - 2]->Set_l_i(new_lambda_0);
-                                    (*mconstraints)[ic - 1]->Set_l_i(new_lambda_1);
-                                    (*mconstraints)[ic - 0]->Set_l_i(new_lambda_2);
-                                }
-                                double true_delta_0 = new_lambda_0 - old_lambda_friction[0];
-                                double true_delta_1 = new_lambda_1 - old_lambda_friction[1];
-                                double true_delta_2 = new_lambda_2 - old_lambda_friction[2];
-                                //	tdata->mutex->Lock();   // this avoids double writing on shared q vector
-                                (*mconstraints)[ic - 2]->Increment_q(true_delta_0);
-                                (*mconstraints)[ic - 1]->Increment_q(true_delta_1);
-                                (*mconstraints)[ic - 0]->Increment_q(true_delta_2);
-                                //	tdata->mutex->Unlock(); // end critical section
-                                /*
-								if (this->record_violation_history)
-								{
-									maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_0));
-									maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_1));
-									maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta_2));
-								}
-								*/  //***TO DO***
-                                i_friction_comp = 0;
-                            }
-                        } else {
-                            // update:   lambda += delta_lambda;
-                            double old_lambda = (*mconstraints)[ic]->Get_l_i();
-                            (*mconstraints)[ic]->Set_l_i(old_lambda + deltal);
-
-                            // If new lagrangian multiplier does not satisfy inequalities, project
-                            // it into an admissible orthant (or, in general, onto an admissible set)
-                            (*mconstraints)[ic]->Project();
-
-                            // After projection, the lambda may have changed a bit..
-                            double new_lambda = (*mconstraints)[ic]->Get_l_i();
-
-                            // Apply the smoothing: lambda= sharpness*lambda_new_projected + (1-sharpness)*lambda_old
-                            if (tdata->solver->GetSharpnessLambda() != 1.0) {
-                                double shlambda = tdata->solver->GetSharpnessLambda();
-                                new_lambda = shlambda * new_lambda + (1.0 - shlambda) * old_lambda;
-                                (*mconstraints)[ic]->Set_l_i(new_lambda);
-                            }
-
-                            double true_delta = new_lambda - old_lambda;
-
-                            // For all items with variables, add the effect of incremented
-                            // (and projected) lagrangian reactions:
-                            tdata->mutex->Lock();  // this avoids double writing on shared q vector
-                            (*mconstraints)[ic]->Increment_q(true_delta);
-                            tdata->mutex->Unlock();  // end critical section
-                            /*
-							if (this->record_violation_history)
-								maxdeltalambda = ChMax(maxdeltalambda, fabs(true_delta)); 
-							*/                       //***TO DO***
-                        }
-
-                        maxviolation = ChMax(maxviolation, fabs(candidate_violation));
-
-                    }  // end IsActive()
-
-                }  // end loop on constraints
+                maxviolation = SweepConstraints(tdata->solver, *mconstraints, tdata->constr_from, tdata->constr_to,
+                                                tdata->mutex);
 
                 // For recording into violation history, if debugging
                 // if (this->record_violation_history)
@@ -244,6 +284,30 @@ void SolverThreadFunc(void* userPtr, void* lsMemory) {
             break;
         }  // end stage
 
+        case thread_data::STAGE4_WARMSTART_BLOCKS: {
+            for (unsigned int i = tdata->block_from; i < tdata->block_to; i++) {
+                int ib = (*tdata->mblocks)[i];
+                for (unsigned int ic = (*tdata->mblock_start)[ib]; ic < (*tdata->mblock_start)[ib + 1]; ic++) {
+                    if (!tdata->solver->GetWarmStart())
+                        (*mconstraints)[ic]->Set_l_i(0.);
+                    else if ((*mconstraints)[ic]->IsActive())
+                        (*mconstraints)[ic]->Increment_q((*mconstraints)[ic]->Get_l_i());
+                }
+            }
+
+            break;  // end stage
+        }
+
+        case thread_data::STAGE5_SWEEP_BLOCKS: {
+            for (unsigned int i = tdata->block_from; i < tdata->block_to; i++) {
+                int ib = (*tdata->mblocks)[i];
+                (*tdata->mblock_violation)[ib] = SweepConstraints(
+                    tdata->solver, *mconstraints, (*tdata->mblock_start)[ib], (*tdata->mblock_start)[ib + 1], nullptr);
+            }
+
+            break;  // end stage
+        }
+
         default: { break; }
     }  // end stage  switching
 }
@@ -257,7 +321,7 @@ ChSolverSORmultithread::ChSolverSORmultithread(const char* uniquename,
                                                bool mwarm_start,
                                                double mtolerance,
                                                double momega)
-    : ChIterativeSolver(mmax_iters, mwarm_start, mtolerance, momega) {
+    : ChIterativeSolver(mmax_iters, mwarm_start, mtolerance, momega), deterministic(false) {
     ChThreadConstructionInfo create_args(uniquename, SolverThreadFunc, SolverMemoryFunc, nthreads);
 
     solver_threads = new ChThreads(create_args);
@@ -280,6 +344,9 @@ ChSolverSORmultithread::~ChSolverSORmultithread() {
 double ChSolverSORmultithread::Solve(
     ChSystemDescriptor& sysd  ///< system description with constraints and variables
     ) {
+    if (deterministic)
+        return SolveDeterministic(sysd);
+
     std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
     std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
 
@@ -365,6 +432,213 @@ double ChSolverSORmultithread::Solve(
     return 0;
 }
 
+// In deterministic mode, the constraints are split in blocks (a block never splits the multipliers
+// of a contact, and consecutive constraints acting on the same variables are merged, as for the
+// rows of a joint). Blocks are then greedily colored so that blocks with the same color do not
+// share any active variable: within a color, blocks can be swept in parallel without locks, and
+// the colors are always swept in the same order.
+// The blocks and colors are kept from one call to the next, as long as each constraint acts on
+// the same variables: contacts and joints are usually the same from one step to the next, and
+// checking this is much cheaper than the coloring itself.
+
+void ChSolverSORmultithread::UpdateBlocks(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    int nconstr = (int)mconstraints.size();
+    int nvars = (int)mvariables.size();
+
+    // Offsets of the active variables, in increasing order, and their index in the variables list
+    std::vector<int> var_offsets;
+    std::vector<int> var_index;
+    for (int iv = 0; iv < nvars; iv++) {
+        if (mvariables[iv]->IsActive()) {
+            var_offsets.push_back(mvariables[iv]->GetOffset());
+            var_index.push_back(iv);
+        }
+    }
+
+    // Signature of the problem structure: for each constraint, whether it continues a contact,
+    // the number of variables it acts on, and their indices.
+    std::vector<int> signature;
+    signature.reserve(det_signature.size());
+    signature.push_back(nvars);
+    ChSparseColumnRecorder recorder;
+    std::vector<int> vars;
+    for (int ic = 0; ic < nconstr; ic++) {
+        vars.clear();
+        if (mconstraints[ic]->IsActive()) {
+            recorder.columns.clear();
+            mconstraints[ic]->Build_Cq(recorder, 0);
+            for (auto col : recorder.columns) {
+                auto pos = std::upper_bound(var_offsets.begin(), var_offsets.end(), col) - var_offsets.begin() - 1;
+                vars.push_back(var_index[pos]);
+            }
+            std::sort(vars.begin(), vars.end());
+            vars.erase(std::unique(vars.begin(), vars.end()), vars.end());
+        }
+
+        bool continuation = dynamic_cast<ChConstraintTwoTuplesFrictionTall*>(mconstraints[ic]) ||
+                            dynamic_cast<ChConstraintTwoTuplesRollingNall*>(mconstraints[ic]) ||
+                            dynamic_cast<ChConstraintTwoTuplesRollingTall*>(mconstraints[ic]);
+
+        signature.push_back(continuation ? 1 : 0);
+        signature.push_back((int)vars.size());
+        signature.insert(signature.end(), vars.begin(), vars.end());
+    }
+
+    if (signature == det_signature)
+        return;
+
+    det_signature.swap(signature);
+
+    // Form the blocks
+    std::vector<std::vector<int>> block_vars;
+    det_block_start.clear();
+    size_t pos = 1;
+    for (int ic = 0; ic < nconstr; ic++) {
+        bool continuation = det_signature[pos] != 0;
+        auto vars_begin = det_signature.begin() + pos + 2;
+        auto vars_end = vars_begin + det_signature[pos + 1];
+        pos += 2 + det_signature[pos + 1];
+
+        if (det_block_start.empty() ||
+            (!continuation && vars_begin != vars_end && !std::equal(vars_begin, vars_end, block_vars.back().begin(),
+                                                                    block_vars.back().end()))) {
+            det_block_start.push_back(ic);
+            block_vars.push_back(std::vector<int>(vars_begin, vars_end));
+        } else {
+            auto& bvars = block_vars.back();
+            bvars.insert(bvars.end(), vars_begin, vars_end);
+            std::sort(bvars.begin(), bvars.end());
+            bvars.erase(std::unique(bvars.begin(), bvars.end()), bvars.end());
+        }
+    }
+    int nblocks = (int)det_block_start.size();
+    det_block_start.push_back(nconstr);
+
+    // Color the blocks
+    std::vector<std::vector<int>> var_colors(nvars);
+    det_colors.clear();
+
+    auto has_color = [](const std::vector<int>& colors, int color) {
+        return std::find(colors.begin(), colors.end(), color) != colors.end();
+    };
+
+    for (int ib = 0; ib < nblocks; ib++) {
+        int color = 0;
+        while (std::any_of(block_vars[ib].begin(), block_vars[ib].end(),
+                           [&](int iv) { return has_color(var_colors[iv], color); }))
+            color++;
+
+        for (auto iv : block_vars[ib])
+            var_colors[iv].push_back(color);
+
+        if (color >= (int)det_colors.size())
+            det_colors.resize(color + 1);
+        det_colors[color].push_back(ib);
+    }
+
+    det_block_violation.assign(nblocks, 0.0);
+}
+
+// Run one stage on all threads, and wait for its completion. With a single thread, the stage is
+// run directly on the calling thread.
+
+void ChSolverSORmultithread::RunStage(std::vector<thread_data>& mdataN) {
+    if (mdataN.size() == 1) {
+        SolverThreadFunc(&mdataN[0], 0);
+        return;
+    }
+    for (unsigned int nth = 0; nth < mdataN.size(); nth++)
+        solver_threads->sendRequest(1, &mdataN[nth], nth);
+    solver_threads->flush();
+}
+
+double ChSolverSORmultithread::SolveDeterministic(ChSystemDescriptor& sysd) {
+    std::vector<ChConstraint*>& mconstraints = sysd.GetConstraintsList();
+    std::vector<ChVariables*>& mvariables = sysd.GetVariablesList();
+
+    tot_iterations = 0;
+
+    // --0--  preparation:
+    //        form (or reuse) the blocks of constraints and their colors, and split the blocks and
+    //        the variables among the threads.
+
+    UpdateBlocks(sysd);
+
+    unsigned int numthreads = (unsigned int)solver_threads->getNumberOfThreads();
+    unsigned int nblocks = (unsigned int)det_block_violation.size();
+    unsigned int nvars = (unsigned int)mvariables.size();
+
+    std::vector<thread_data> mdataN(numthreads);
+    for (unsigned int nth = 0; nth < numthreads; nth++) {
+        mdataN[nth].solver = this;
+        mdataN[nth].mutex = nullptr;
+        mdataN[nth].var_from = (nvars * nth) / numthreads;
+        mdataN[nth].var_to = (nvars * (nth + 1)) / numthreads;
+        mdataN[nth].constr_from = det_block_start[(nblocks * nth) / numthreads];
+        mdataN[nth].constr_to = det_block_start[(nblocks * (nth + 1)) / numthreads];
+        mdataN[nth].mconstraints = &mconstraints;
+        mdataN[nth].mvariables = &mvariables;
+        mdataN[nth].mblock_start = &det_block_start;
+        mdataN[nth].mblock_violation = &det_block_violation;
+    }
+
+    // Set the blocks of one color to be processed by each thread
+    auto set_color = [&](const std::vector<int>& color, thread_data::solver_stage stage) {
+        unsigned int ncolor = (unsigned int)color.size();
+        for (unsigned int nth = 0; nth < numthreads; nth++) {
+            mdataN[nth].stage = stage;
+            mdataN[nth].mblocks = &color;
+            mdataN[nth].block_from = (ncolor * nth) / numthreads;
+            mdataN[nth].block_to = (ncolor * (nth + 1)) / numthreads;
+        }
+    };
+
+    // --1--  stage:
+    //        precompute aux variables in constraints (the slices do not split any block).
+    for (auto& data : mdataN)
+        data.stage = thread_data::STAGE1_PREPARE;
+    RunStage(mdataN);
+
+    // --2--  stage:
+    //        add external forces and mass effects, on variables.
+    for (auto& data : mdataN)
+        data.stage = thread_data::STAGE2_ADDFORCES;
+    RunStage(mdataN);
+
+    // --3--  stage:
+    //        loop on constraints, one color at a time.
+    for (auto& color : det_colors) {
+        set_color(color, thread_data::STAGE4_WARMSTART_BLOCKS);
+        RunStage(mdataN);
+    }
+
+    double maxviolation = 0.;
+
+    for (int iter = 0; iter < max_iterations; iter++) {
+        for (auto& color : det_colors) {
+            set_color(color, thread_data::STAGE5_SWEEP_BLOCKS);
+            RunStage(mdataN);
+        }
+
+        maxviolation = 0.;
+        for (auto violation : det_block_violation)
+            maxviolation = ChMax(maxviolation, violation);
+
+        if (record_violation_history)
+            AtIterationEnd(maxviolation, 0, iter);
+
+        tot_iterations++;
+        // Terminate the loop if violation in constraints has been successfully limited.
+        if (maxviolation < tolerance)
+            break;
+    }
+
+    return maxviolation;
+}
+
 void ChSolverSORmultithread::ChangeNumberOfThreads(int mthreads) {
     if (mthreads < 1)
         mthreads = 1;
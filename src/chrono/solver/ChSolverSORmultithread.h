@@ -19,6 +19,9 @@
 #include "chrono/parallel/ChThreads.h"
 
 namespace chrono {
+
+struct thread_data;
+
 /// An iterative solver based on projective fixed point method, with overrelaxation
 /// and immediate variable update as in SOR methods. Multi-threaded.\n
 /// See ChSystemDescriptor for more information about the problem formulation and the data structures
@@ -28,6 +31,7 @@ class ChApi ChSolverSORmultithread : public ChIterativeSolver {
 
   protected:
     ChThreads* solver_threads;
+    bool deterministic;
 
   public:
     ChSolverSORmultithread(const char* uniquename = "solver",  ///< this name must be unique.
@@ -50,6 +54,33 @@ class ChApi ChSolverSORmultithread : public ChIterativeSolver {
 
     /// Changes the number of threads which run in parallel (should be > 1 )
     void ChangeNumberOfThreads(int mthreads = 2);
+
+    /// Turn on the deterministic mode (default: false).
+    /// In the default mode, the constraints are split in as many slices as threads, and the threads
+    /// update the shared speed vector concurrently, so results depend on thread scheduling.
+    /// In deterministic mode, the constraints are grouped in colors such that constraints of the same
+    /// color do not act on the same variables; each color is processed in parallel, and the colors
+    /// are processed in a fixed order (a colored Gauss-Seidel). Results are then bitwise reproducible,
+    /// independently of the number of threads.
+    void SetDeterministic(bool mval) { deterministic = mval; }
+
+    /// Tell if the solver runs in deterministic mode.
+    bool GetDeterministic() const { return deterministic; }
+
+  private:
+    double SolveDeterministic(ChSystemDescriptor& sysd);
+
+    /// Form the blocks of constraints and their colors for the deterministic mode,
+    /// unless the variables of all constraints are the same as in the last call.
+    void UpdateBlocks(ChSystemDescriptor& sysd);
+
+    /// Run one stage of the deterministic mode on all threads.
+    void RunStage(std::vector<thread_data>& mdataN);
+
+    std::vector<int> det_signature;             ///< variables of each constraint, as of the last coloring
+    std::vector<unsigned int> det_block_start;  ///< first constraint of each block (plus the number of constraints)
+    std::vector<std::vector<int>> det_colors;   ///< blocks of each color
+    std::vector<double> det_block_violation;    ///< max violation in each block, after the last sweep
 };
 
 }  // end namespace chrono
@@ -43,7 +43,8 @@ namespace utils {
 
 #ifndef CH_NO_PROFILE
 
-static ChTimer<double> gProfileClock;
+// Profiling clock, restarted by ChProfileManager::Reset() on each thread
+static thread_local ChTimer<double> gProfileClock;
 
 #define mymin(a,b) (a > b ? a : b)
 
@@ -230,10 +231,32 @@ void	ChProfileIterator::Enter_Parent( void )
 **
 ***************************************************************************************************/
 
-ChProfileNode	ChProfileManager::Root( "Root", NULL );
-ChProfileNode *	ChProfileManager::CurrentNode = &ChProfileManager::Root;
-int				ChProfileManager::FrameCounter = 0;
-unsigned long int			ChProfileManager::ResetTime = 0;
+// Profiling state of one thread
+struct ChProfileState {
+	ChProfileState() : Root( "Root", NULL ), CurrentNode( &Root ), FrameCounter( 0 ), ResetTime( 0 ) {}
+
+	ChProfileNode			Root;
+	ChProfileNode *			CurrentNode;
+	int						FrameCounter;
+	unsigned long int		ResetTime;
+};
+
+static thread_local ChProfileState gProfileState;
+
+void	ChProfileManager::CleanupMemory(void)
+{
+	gProfileState.Root.CleanupMemory();
+}
+
+int		ChProfileManager::Get_Frame_Count_Since_Reset( void )
+{
+	return gProfileState.FrameCounter;
+}
+
+ChProfileIterator *	ChProfileManager::Get_Iterator( void )
+{
+	return new ChProfileIterator( &gProfileState.Root );
+}
 
 
 /***********************************************************************************************
@@ -251,11 +274,11 @@ unsigned long int			ChProfileManager::ResetTime = 0;
  *=============================================================================================*/
 void	ChProfileManager::Start_Profile( const char * name )
 {
-	if (name != CurrentNode->Get_Name()) {
-		CurrentNode = CurrentNode->Get_Sub_Node( name );
+	if (name != gProfileState.CurrentNode->Get_Name()) {
+		gProfileState.CurrentNode = gProfileState.CurrentNode->Get_Sub_Node( name );
 	} 
 	
-	CurrentNode->Call();
+	gProfileState.CurrentNode->Call();
 }
 
 
@@ -266,8 +289,8 @@ void	ChProfileManager::Stop_Profile( void )
 {
 	// Return will indicate whether we should back up to our parent (we may
 	// be profiling a recursive function)
-	if (CurrentNode->Return()) {
-		CurrentNode = CurrentNode->Get_Parent();
+	if (gProfileState.CurrentNode->Return()) {
+		gProfileState.CurrentNode = gProfileState.CurrentNode->Get_Parent();
 	}
 }
 
@@ -281,10 +304,10 @@ void	ChProfileManager::Reset( void )
 { 
 	gProfileClock.reset();
     gProfileClock.start();
-	Root.Reset();
-    Root.Call();
-	FrameCounter = 0;
-	Profile_Get_Ticks(&ResetTime);
+	gProfileState.Root.Reset();
+    gProfileState.Root.Call();
+	gProfileState.FrameCounter = 0;
+	Profile_Get_Ticks(&gProfileState.ResetTime);
 }
 
 
@@ -293,7 +316,7 @@ void	ChProfileManager::Reset( void )
  *=============================================================================================*/
 void ChProfileManager::Increment_Frame_Counter( void )
 {
-	FrameCounter++;
+	gProfileState.FrameCounter++;
 }
 
 
@@ -304,7 +327,7 @@ float ChProfileManager::Get_Time_Since_Reset( void )
 {
 	unsigned long int time;
 	Profile_Get_Ticks(&time);
-	time -= ResetTime;
+	time -= gProfileState.ResetTime;
 	return (float)time / Profile_Get_Tick_Rate();
 }
 
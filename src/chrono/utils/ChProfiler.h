@@ -121,38 +121,28 @@ protected:
 };
 
 
-///The Manager for the Profile system
+///The Manager for the Profile system.
+///The profile tree, the frame counter and the reset time are kept per thread, so that
+///systems advanced concurrently on different threads do not interfere with each other.
+///Each thread only sees (and resets) the profile data collected on that thread.
 class  ChApi ChProfileManager {
 public:
 	static	void						Start_Profile( const char * name );
 	static	void						Stop_Profile( void );
 
-	static	void						CleanupMemory(void)
-	{
-		Root.CleanupMemory();
-	}
+	static	void						CleanupMemory(void);
 
 	static	void						Reset( void );
 	static	void						Increment_Frame_Counter( void );
-	static	int						Get_Frame_Count_Since_Reset( void )		{ return FrameCounter; }
+	static	int						Get_Frame_Count_Since_Reset( void );
 	static	float						Get_Time_Since_Reset( void );
 
-	static	ChProfileIterator *	Get_Iterator( void )	
-	{ 
-		
-		return new ChProfileIterator( &Root ); 
-	}
+	static	ChProfileIterator *	Get_Iterator( void );
 	static	void						Release_Iterator( ChProfileIterator * iterator ) { delete ( iterator); }
 
 	static void	dumpRecursive(ChProfileIterator* profileIterator, int spacing);
 
 	static void	dumpAll();
-
-private:
-	static	ChProfileNode			Root;
-	static	ChProfileNode *			CurrentNode;
-	static	int						FrameCounter;
-	static	unsigned long int					ResetTime;
 };
 
 
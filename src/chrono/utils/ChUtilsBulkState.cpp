@@ -0,0 +1,154 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+
+#include "chrono/physics/ChContactContainer.h"
+#include "chrono/utils/ChUtilsBulkState.h"
+
+namespace chrono {
+namespace utils {
+
+// Resize the output matrix only if its dimensions change (preserve the buffer otherwise).
+static void ResizeOutput(ChMatrixDynamic<>& mat, int rows, int cols) {
+    if (mat.GetRows() != rows || mat.GetColumns() != cols)
+        mat.Resize(rows, cols);
+}
+
+// Check the dimensions of an input matrix.
+static void CheckInput(const char* func, ChSystem* system, const ChMatrixDynamic<>& mat, int cols) {
+    if (mat.GetRows() != (int)system->Get_bodylist().size() || mat.GetColumns() != cols)
+        throw ChException(std::string(func) + ": input matrix must be (number of bodies) x " + std::to_string(cols));
+}
+
+// -----------------------------------------------------------------------------
+
+void GetBodyPositions(ChSystem* system, ChMatrixDynamic<>& pos) {
+    const auto& bodies = system->Get_bodylist();
+    ResizeOutput(pos, (int)bodies.size(), 3);
+    double* data = pos.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const ChVector<>& p = bodies[i]->GetPos();
+        data[3 * i + 0] = p.x();
+        data[3 * i + 1] = p.y();
+        data[3 * i + 2] = p.z();
+    }
+}
+
+void GetBodyRotations(ChSystem* system, ChMatrixDynamic<>& rot) {
+    const auto& bodies = system->Get_bodylist();
+    ResizeOutput(rot, (int)bodies.size(), 4);
+    double* data = rot.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const ChQuaternion<>& q = bodies[i]->GetRot();
+        data[4 * i + 0] = q.e0();
+        data[4 * i + 1] = q.e1();
+        data[4 * i + 2] = q.e2();
+        data[4 * i + 3] = q.e3();
+    }
+}
+
+void GetBodyVelocities(ChSystem* system, ChMatrixDynamic<>& vel) {
+    const auto& bodies = system->Get_bodylist();
+    ResizeOutput(vel, (int)bodies.size(), 6);
+    double* data = vel.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const ChVector<>& v = bodies[i]->GetPos_dt();
+        ChVector<> w = bodies[i]->GetWvel_par();
+        data[6 * i + 0] = v.x();
+        data[6 * i + 1] = v.y();
+        data[6 * i + 2] = v.z();
+        data[6 * i + 3] = w.x();
+        data[6 * i + 4] = w.y();
+        data[6 * i + 5] = w.z();
+    }
+}
+
+void GetBodyContactForces(ChSystem* system, ChMatrixDynamic<>& frc) {
+    const auto& bodies = system->Get_bodylist();
+    auto container = system->GetContactContainer();
+    ResizeOutput(frc, (int)bodies.size(), 6);
+    double* data = frc.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        ChVector<> f = container->GetContactableForce(bodies[i].get());
+        ChVector<> t = container->GetContactableTorque(bodies[i].get());
+        data[6 * i + 0] = f.x();
+        data[6 * i + 1] = f.y();
+        data[6 * i + 2] = f.z();
+        data[6 * i + 3] = t.x();
+        data[6 * i + 4] = t.y();
+        data[6 * i + 5] = t.z();
+    }
+}
+
+void SetBodyPositions(ChSystem* system, const ChMatrixDynamic<>& pos) {
+    CheckInput("SetBodyPositions", system, pos, 3);
+    const auto& bodies = system->Get_bodylist();
+    const double* data = pos.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++)
+        bodies[i]->SetPos(ChVector<>(data[3 * i + 0], data[3 * i + 1], data[3 * i + 2]));
+}
+
+void SetBodyRotations(ChSystem* system, const ChMatrixDynamic<>& rot) {
+    CheckInput("SetBodyRotations", system, rot, 4);
+    const auto& bodies = system->Get_bodylist();
+    const double* data = rot.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++)
+        bodies[i]->SetRot(ChQuaternion<>(data[4 * i + 0], data[4 * i + 1], data[4 * i + 2], data[4 * i + 3]));
+}
+
+void SetBodyVelocities(ChSystem* system, const ChMatrixDynamic<>& vel) {
+    CheckInput("SetBodyVelocities", system, vel, 6);
+    const auto& bodies = system->Get_bodylist();
+    const double* data = vel.GetAddress();
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        bodies[i]->SetPos_dt(ChVector<>(data[6 * i + 0], data[6 * i + 1], data[6 * i + 2]));
+        bodies[i]->SetWvel_par(ChVector<>(data[6 * i + 3], data[6 * i + 4], data[6 * i + 5]));
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+double GetSystemState(ChSystem* system, ChVectorDynamic<>& x, ChVectorDynamic<>& v) {
+    system->Setup();
+
+    ChState state_x(system->GetNcoords_x(), system);
+    ChStateDelta state_v(system->GetNcoords_v(), system);
+    double time;
+    system->StateGather(state_x, state_v, time);
+
+    x = state_x;
+    v = state_v;
+
+    return time;
+}
+
+void SetSystemState(ChSystem* system, const ChVectorDynamic<>& x, const ChVectorDynamic<>& v, double time) {
+    system->Setup();
+
+    if (x.GetRows() != system->GetNcoords_x() || v.GetRows() != system->GetNcoords_v())
+        throw ChException("SetSystemState: state vectors do not match the system size");
+
+    ChState state_x(x, system);
+    ChStateDelta state_v(v, system);
+    system->StateScatter(state_x, state_v, time);
+}
+
+}  // end namespace utils
+}  // end namespace chrono
@@ -0,0 +1,77 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Utility functions for gathering (and scattering) quantities of all bodies in
+// a system, or the complete system state, in a single call.
+//
+// All quantities are stored in contiguous, row-major matrices with one row per
+// body, in the order of the system body list. The output matrices are resized
+// only if needed, so they can be reused across calls without reallocation.
+// These functions are mostly meant for scripting interfaces (see the Python
+// module, where the resulting matrices can be viewed as NumPy arrays without
+// copying), which would otherwise need one call per body and quantity.
+//
+// =============================================================================
+
+#ifndef CH_UTILS_BULK_STATE_H
+#define CH_UTILS_BULK_STATE_H
+
+#include "chrono/core/ChApiCE.h"
+#include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/core/ChVectorDynamic.h"
+#include "chrono/physics/ChSystem.h"
+
+namespace chrono {
+namespace utils {
+
+// -----------------------------------------------------------------------------
+// Bodies
+// -----------------------------------------------------------------------------
+
+/// Get the positions of all bodies (n x 3: x, y, z).
+ChApi void GetBodyPositions(ChSystem* system, ChMatrixDynamic<>& pos);
+
+/// Get the orientations of all bodies (n x 4: e0, e1, e2, e3).
+ChApi void GetBodyRotations(ChSystem* system, ChMatrixDynamic<>& rot);
+
+/// Get the velocities of all bodies (n x 6: linear velocity, angular velocity, both in the absolute frame).
+ChApi void GetBodyVelocities(ChSystem* system, ChMatrixDynamic<>& vel);
+
+/// Get the resultant contact force and torque on all bodies (n x 6: force, torque, both in the absolute frame).
+ChApi void GetBodyContactForces(ChSystem* system, ChMatrixDynamic<>& frc);
+
+/// Set the positions of all bodies (n x 3).
+ChApi void SetBodyPositions(ChSystem* system, const ChMatrixDynamic<>& pos);
+
+/// Set the orientations of all bodies (n x 4).
+ChApi void SetBodyRotations(ChSystem* system, const ChMatrixDynamic<>& rot);
+
+/// Set the velocities of all bodies (n x 6).
+ChApi void SetBodyVelocities(ChSystem* system, const ChMatrixDynamic<>& vel);
+
+// -----------------------------------------------------------------------------
+// System state
+// -----------------------------------------------------------------------------
+
+/// Get the state of the system: generalized positions and velocities (see ChSystem::StateGather).
+/// Returns the time of the state.
+ChApi double GetSystemState(ChSystem* system, ChVectorDynamic<>& x, ChVectorDynamic<>& v);
+
+/// Set the state of the system and update all items (see ChSystem::StateScatter).
+ChApi void SetSystemState(ChSystem* system, const ChVectorDynamic<>& x, const ChVectorDynamic<>& v, double time);
+
+}  // end namespace utils
+}  // end namespace chrono
+
+#endif
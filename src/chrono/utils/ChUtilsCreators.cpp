@@ -755,7 +755,8 @@ void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
                              ChConvexDecompositionHACDv2& convex_shape,
                              const ChVector<>& pos,
                              const ChQuaternion<>& rot,
-                             bool use_original_asset) {
+                             bool use_original_asset,
+                             collision::ChCollisionShapeLibrary* library) {
     ChConvexDecomposition* used_decomposition = &convex_shape;
 
     int hull_count = used_decomposition->GetHullCount();
@@ -764,7 +765,10 @@ void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
         std::vector<ChVector<double> > convexhull;
         used_decomposition->GetConvexHullResult(c, convexhull);
 
-        body->GetCollisionModel()->AddConvexHull(convexhull, pos, rot);
+        if (library)
+            library->AddConvexHull(body->GetCollisionModel().get(), convexhull, pos, rot);
+        else
+            body->GetCollisionModel()->AddConvexHull(convexhull, pos, rot);
         // Add each convex chunk as a new asset
         if (!use_original_asset) {
             std::stringstream ss;
@@ -773,7 +777,10 @@ void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
             used_decomposition->GetConvexHullResult(c, trimesh_convex);
 
             auto trimesh_shape = std::make_shared<ChTriangleMeshShape>();
-            trimesh_shape->SetMesh(trimesh_convex);
+            if (library)
+                trimesh_shape->SetMesh(library->GetMesh(trimesh_convex));
+            else
+                trimesh_shape->SetMesh(trimesh_convex);
             trimesh_shape->SetName(ss.str());
             trimesh_shape->Pos = pos;
             trimesh_shape->Rot = rot;
@@ -783,7 +790,10 @@ void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
     // Add the original triangle mesh as asset
     if (use_original_asset) {
         auto trimesh_shape = std::make_shared<ChTriangleMeshShape>();
-        trimesh_shape->SetMesh(convex_mesh);
+        if (library)
+            trimesh_shape->SetMesh(library->GetMesh(convex_mesh));
+        else
+            trimesh_shape->SetMesh(convex_mesh);
         trimesh_shape->SetName(convex_mesh.GetFileName());
         trimesh_shape->Pos = VNULL;
         trimesh_shape->Rot = QUNIT;
@@ -797,13 +807,20 @@ void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
                              ChTriangleMeshConnected& convex_mesh,
                              std::vector<std::vector<ChVector<double> > >& convex_hulls,
                              const ChVector<>& pos,
-                             const ChQuaternion<>& rot) {
+                             const ChQuaternion<>& rot,
+                             collision::ChCollisionShapeLibrary* library) {
     for (int c = 0; c < convex_hulls.size(); c++) {
-        body->GetCollisionModel()->AddConvexHull(convex_hulls[c], pos, rot);
+        if (library)
+            library->AddConvexHull(body->GetCollisionModel().get(), convex_hulls[c], pos, rot);
+        else
+            body->GetCollisionModel()->AddConvexHull(convex_hulls[c], pos, rot);
     }
     // Add the original triangle mesh as asset
     auto trimesh_shape = std::make_shared<ChTriangleMeshShape>();
-    trimesh_shape->SetMesh(convex_mesh);
+    if (library)
+        trimesh_shape->SetMesh(library->GetMesh(convex_mesh));
+    else
+        trimesh_shape->SetMesh(convex_mesh);
     trimesh_shape->SetName(convex_mesh.GetFileName());
     trimesh_shape->Pos = pos;
     trimesh_shape->Rot = rot;
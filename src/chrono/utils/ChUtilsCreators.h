@@ -47,6 +47,7 @@
 #include "chrono/assets/ChSphereShape.h"
 #include "chrono/assets/ChTriangleMeshShape.h"
 
+#include "chrono/collision/ChCCollisionShapeLibrary.h"
 #include "chrono/collision/ChCConvexDecomposition.h"
 #include "chrono/collision/ChCModelBullet.h"
 
@@ -269,12 +270,15 @@ ChApi void LoadConvexHulls(const std::string& file_name,
 // Given a convex mesh and it's decomposition add it to a ChBody
 // use_original_asset can be used to specify if the mesh or the convex decomp
 // should be used for visualization
+// If a shape library is provided, the collision shapes and visualization meshes
+// are shared with all other bodies created from the same geometry
 ChApi void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
                                    geometry::ChTriangleMeshConnected& convex_mesh,
                                    collision::ChConvexDecompositionHACDv2& convex_shape,
                                    const ChVector<>& pos = ChVector<>(0, 0, 0),
                                    const ChQuaternion<>& rot = ChQuaternion<>(1, 0, 0, 0),
-                                   bool use_original_asset = true);
+                                   bool use_original_asset = true,
+                                   collision::ChCollisionShapeLibrary* library = nullptr);
 // Add a convex mesh to an object based on a set of points,
 // unlike the previous version, this version will use the
 // triangle mesh to set the visualization geometry
@@ -282,7 +286,8 @@ ChApi void AddConvexCollisionModel(std::shared_ptr<ChBody> body,
                                    geometry::ChTriangleMeshConnected& convex_mesh,
                                    std::vector<std::vector<ChVector<double> > >& convex_hulls,
                                    const ChVector<>& pos = ChVector<>(0, 0, 0),
-                                   const ChQuaternion<>& rot = ChQuaternion<>(1, 0, 0, 0));
+                                   const ChQuaternion<>& rot = ChQuaternion<>(1, 0, 0, 0),
+                                   collision::ChCollisionShapeLibrary* library = nullptr);
 }  // end namespace utils
 }  // end namespace chrono
 
@@ -14,6 +14,18 @@
 //
 // =============================================================================
 
+#include <cstdint>
+#include <cstring>
+#include <unordered_map>
+#include <vector>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/geometry/ChLineBezier.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
@@ -291,6 +303,355 @@ void ReadCheckpoint(ChSystem* system, const std::string& filename) {
     }
 }
 
+// -----------------------------------------------------------------------------
+// WriteCheckpointBinary / ReadCheckpointBinary
+//
+// Binary checkpoint file layout (all sections 8-byte aligned):
+//    header
+//    body table       (num_bodies x CheckpointBody)
+//    material table   (num_materials x CheckpointMaterial)
+//    x                (num_x doubles)
+//    v                (num_v doubles)
+//    a                (num_v doubles)
+//    L                (num_L doubles, non-contact constraints only)
+// -----------------------------------------------------------------------------
+namespace {
+
+const char checkpoint_magic[8] = {'C', 'H', 'C', 'K', 'P', 'T', 'B', '\0'};
+const uint32_t checkpoint_version = 1;
+
+enum CheckpointBodyFlags { CKPT_FIXED = 1 << 0, CKPT_COLLIDE = 1 << 1, CKPT_SLEEPING = 1 << 2 };
+
+struct CheckpointHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t num_bodies;
+    uint32_t num_links;
+    uint32_t num_materials;
+    uint64_t num_x;
+    uint64_t num_v;
+    uint64_t num_L;
+    double time;
+};
+
+struct CheckpointBody {
+    int32_t identifier;
+    int32_t material;
+    uint16_t flags;
+    int16_t family_group;
+    int16_t family_mask;
+    int16_t padding;
+    double mass;
+    double inertiaXX[3];
+    double inertiaXY[3];
+    double pos[3];
+    double rot[4];
+    double pos_dt[3];
+    double wvel_loc[3];
+};
+
+struct CheckpointMaterial {
+    int32_t method;
+    float props[11];
+};
+
+void PackMaterial(const std::shared_ptr<ChMaterialSurface>& mat, CheckpointMaterial& rec) {
+    rec.method = mat->GetContactMethod();
+    float* p = rec.props;
+    if (auto matNSC = std::dynamic_pointer_cast<ChMaterialSurfaceNSC>(mat)) {
+        float vals[11] = {matNSC->static_friction, matNSC->sliding_friction, matNSC->rolling_friction,
+                          matNSC->spinning_friction, matNSC->restitution, matNSC->cohesion,
+                          matNSC->dampingf, matNSC->compliance, matNSC->complianceT,
+                          matNSC->complianceRoll, matNSC->complianceSpin};
+        std::memcpy(p, vals, sizeof(vals));
+    } else if (auto matSMC = std::dynamic_pointer_cast<ChMaterialSurfaceSMC>(mat)) {
+        float vals[11] = {matSMC->young_modulus, matSMC->poisson_ratio, matSMC->static_friction,
+                          matSMC->sliding_friction, matSMC->restitution, matSMC->constant_adhesion,
+                          matSMC->adhesionMultDMT, matSMC->kn, matSMC->gn, matSMC->kt, matSMC->gt};
+        std::memcpy(p, vals, sizeof(vals));
+    }
+}
+
+std::shared_ptr<ChMaterialSurface> UnpackMaterial(const CheckpointMaterial& rec) {
+    const float* p = rec.props;
+    if (rec.method == ChMaterialSurface::NSC) {
+        auto mat = std::make_shared<ChMaterialSurfaceNSC>();
+        mat->static_friction = p[0];
+        mat->sliding_friction = p[1];
+        mat->rolling_friction = p[2];
+        mat->spinning_friction = p[3];
+        mat->restitution = p[4];
+        mat->cohesion = p[5];
+        mat->dampingf = p[6];
+        mat->compliance = p[7];
+        mat->complianceT = p[8];
+        mat->complianceRoll = p[9];
+        mat->complianceSpin = p[10];
+        return mat;
+    }
+    auto mat = std::make_shared<ChMaterialSurfaceSMC>();
+    mat->young_modulus = p[0];
+    mat->poisson_ratio = p[1];
+    mat->static_friction = p[2];
+    mat->sliding_friction = p[3];
+    mat->restitution = p[4];
+    mat->constant_adhesion = p[5];
+    mat->adhesionMultDMT = p[6];
+    mat->kn = p[7];
+    mat->gn = p[8];
+    mat->kt = p[9];
+    mat->gt = p[10];
+    return mat;
+}
+
+// Read-only view of a checkpoint file. The file is memory-mapped on POSIX
+// platforms and read in a single block otherwise.
+class CheckpointFile {
+  public:
+    CheckpointFile() : m_data(nullptr), m_size(0) {}
+    ~CheckpointFile() {
+#ifndef _WIN32
+        if (m_data)
+            munmap((void*)m_data, m_size);
+#endif
+    }
+
+    bool Open(const std::string& filename) {
+#ifdef _WIN32
+        std::ifstream ifile(filename.c_str(), std::ios::binary | std::ios::ate);
+        if (!ifile)
+            return false;
+        m_buffer.resize((size_t)ifile.tellg());
+        ifile.seekg(0);
+        if (!ifile.read(m_buffer.data(), m_buffer.size()))
+            return false;
+        m_data = m_buffer.data();
+        m_size = m_buffer.size();
+        return true;
+#else
+        int fd = open(filename.c_str(), O_RDONLY);
+        if (fd < 0)
+            return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0 || st.st_size == 0) {
+            close(fd);
+            return false;
+        }
+        void* addr = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+        if (addr == MAP_FAILED)
+            return false;
+        m_data = (const char*)addr;
+        m_size = (size_t)st.st_size;
+        return true;
+#endif
+    }
+
+    const char* GetData() const { return m_data; }
+    size_t GetSize() const { return m_size; }
+
+  private:
+    const char* m_data;
+    size_t m_size;
+#ifdef _WIN32
+    std::vector<char> m_buffer;
+#endif
+};
+
+}  // end anonymous namespace
+
+bool WriteCheckpointBinary(ChSystem* system, const std::string& filename) {
+    // Make sure the state offsets reflect the current system configuration.
+    system->Setup();
+
+    const auto& bodies = system->Get_bodylist();
+
+    // Body table, with indices into a table of unique contact materials.
+    std::vector<CheckpointBody> body_table(bodies.size());
+    std::vector<CheckpointMaterial> mat_table;
+    std::unordered_map<ChMaterialSurface*, int32_t> mat_index;
+
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const auto& body = bodies[i];
+        CheckpointBody& rec = body_table[i];
+        std::memset(&rec, 0, sizeof(rec));
+
+        auto& mat = body->GetMaterialSurfaceBase();
+        auto found = mat_index.find(mat.get());
+        if (found == mat_index.end()) {
+            found = mat_index.insert(std::make_pair(mat.get(), (int32_t)mat_table.size())).first;
+            mat_table.push_back(CheckpointMaterial());
+            PackMaterial(mat, mat_table.back());
+        }
+
+        rec.identifier = body->GetIdentifier();
+        rec.material = found->second;
+        rec.flags = (body->GetBodyFixed() ? CKPT_FIXED : 0) | (body->GetCollide() ? CKPT_COLLIDE : 0) |
+                    (body->GetSleeping() ? CKPT_SLEEPING : 0);
+        rec.family_group = body->GetCollisionModel()->GetFamilyGroup();
+        rec.family_mask = body->GetCollisionModel()->GetFamilyMask();
+        rec.mass = body->GetMass();
+        ChVector<> iXX = body->GetInertiaXX();
+        ChVector<> iXY = body->GetInertiaXY();
+        const ChVector<>& pos = body->GetPos();
+        const ChQuaternion<>& rot = body->GetRot();
+        const ChVector<>& pos_dt = body->GetPos_dt();
+        const ChVector<>& wvel = body->GetWvel_loc();
+        for (int k = 0; k < 3; k++) {
+            rec.inertiaXX[k] = iXX[k];
+            rec.inertiaXY[k] = iXY[k];
+            rec.pos[k] = pos[k];
+            rec.pos_dt[k] = pos_dt[k];
+            rec.wvel_loc[k] = wvel[k];
+        }
+        for (int k = 0; k < 4; k++)
+            rec.rot[k] = rot[k];
+    }
+
+    // Gather the system states and reactions.
+    ChState x(system->GetNcoords_x(), system);
+    ChStateDelta v(system->GetNcoords_w(), system);
+    ChStateDelta a(system->GetNcoords_w(), system);
+    ChVectorDynamic<> L(system->GetNconstr());
+    double T;
+    system->StateGather(x, v, T);
+    system->StateGatherAcceleration(a);
+    system->StateGatherReactions(L);
+
+    // Contact reactions are placed last; only save the reactions of all other constraints.
+    int num_L = system->GetNconstr() - system->GetContactContainer()->GetDOC();
+
+    CheckpointHeader header;
+    std::memset(&header, 0, sizeof(header));
+    std::memcpy(header.magic, checkpoint_magic, sizeof(header.magic));
+    header.version = checkpoint_version;
+    header.num_bodies = (uint32_t)bodies.size();
+    header.num_links = (uint32_t)system->Get_linklist().size();
+    header.num_materials = (uint32_t)mat_table.size();
+    header.num_x = (uint64_t)x.GetRows();
+    header.num_v = (uint64_t)v.GetRows();
+    header.num_L = (uint64_t)num_L;
+    header.time = T;
+
+    std::ofstream ofile(filename.c_str(), std::ios::binary | std::ios::trunc);
+    if (!ofile)
+        return false;
+
+    ofile.write((const char*)&header, sizeof(header));
+    ofile.write((const char*)body_table.data(), body_table.size() * sizeof(CheckpointBody));
+    ofile.write((const char*)mat_table.data(), mat_table.size() * sizeof(CheckpointMaterial));
+    ofile.write((const char*)x.GetAddress(), header.num_x * sizeof(double));
+    ofile.write((const char*)v.GetAddress(), header.num_v * sizeof(double));
+    ofile.write((const char*)a.GetAddress(), header.num_v * sizeof(double));
+    ofile.write((const char*)L.GetAddress(), header.num_L * sizeof(double));
+
+    return ofile.good();
+}
+
+bool ReadCheckpointBinary(ChSystem* system, const std::string& filename) {
+    CheckpointFile file;
+    if (!file.Open(filename))
+        return false;
+
+    // Validate the header against the given system.
+    if (file.GetSize() < sizeof(CheckpointHeader))
+        return false;
+    CheckpointHeader header;
+    std::memcpy(&header, file.GetData(), sizeof(header));
+    if (std::memcmp(header.magic, checkpoint_magic, sizeof(header.magic)) != 0 ||
+        header.version != checkpoint_version)
+        return false;
+
+    const auto& bodies = system->Get_bodylist();
+    if (header.num_bodies != bodies.size() || header.num_links != system->Get_linklist().size())
+        return false;
+
+    size_t size = sizeof(CheckpointHeader) + header.num_bodies * sizeof(CheckpointBody) +
+                  header.num_materials * sizeof(CheckpointMaterial) +
+                  (header.num_x + 2 * header.num_v + header.num_L) * sizeof(double);
+    if (file.GetSize() != size)
+        return false;
+
+    const char* data = file.GetData() + sizeof(CheckpointHeader);
+    const CheckpointBody* body_table = (const CheckpointBody*)data;
+    data += header.num_bodies * sizeof(CheckpointBody);
+    const CheckpointMaterial* mat_table = (const CheckpointMaterial*)data;
+    data += header.num_materials * sizeof(CheckpointMaterial);
+    const double* x_data = (const double*)data;
+    const double* v_data = x_data + header.num_x;
+    const double* a_data = v_data + header.num_v;
+    const double* L_data = a_data + header.num_v;
+
+    for (uint32_t i = 0; i < header.num_bodies; i++) {
+        if (body_table[i].identifier != bodies[i]->GetIdentifier() ||
+            body_table[i].material < 0 || body_table[i].material >= (int32_t)header.num_materials)
+            return false;
+    }
+
+    // The state layout depends on the fixed and sleeping flags: apply them first and check that the layout
+    // matches the checkpoint, so that a mismatched checkpoint leaves the system unchanged.
+    std::vector<std::pair<bool, bool>> old_flags(header.num_bodies);
+    for (uint32_t i = 0; i < header.num_bodies; i++) {
+        old_flags[i] = {bodies[i]->GetBodyFixed(), bodies[i]->GetSleeping()};
+        bodies[i]->SetBodyFixed((body_table[i].flags & CKPT_FIXED) != 0);
+        bodies[i]->SetSleeping((body_table[i].flags & CKPT_SLEEPING) != 0);
+    }
+
+    system->Setup();
+    int num_L = system->GetNconstr() - system->GetContactContainer()->GetDOC();
+    if (header.num_x != (uint64_t)system->GetNcoords_x() || header.num_v != (uint64_t)system->GetNcoords_w() ||
+        header.num_L != (uint64_t)num_L) {
+        for (uint32_t i = 0; i < header.num_bodies; i++) {
+            bodies[i]->SetBodyFixed(old_flags[i].first);
+            bodies[i]->SetSleeping(old_flags[i].second);
+        }
+        system->Setup();
+        return false;
+    }
+
+    // Recreate the contact materials, preserving their sharing among bodies.
+    std::vector<std::shared_ptr<ChMaterialSurface>> materials(header.num_materials);
+    for (uint32_t i = 0; i < header.num_materials; i++)
+        materials[i] = UnpackMaterial(mat_table[i]);
+
+    // Restore the other body properties. The body frames are needed for fixed and
+    // sleeping bodies, which do not contribute to the system state vectors.
+    for (uint32_t i = 0; i < header.num_bodies; i++) {
+        const CheckpointBody& rec = body_table[i];
+        const auto& body = bodies[i];
+
+        body->SetCollide((rec.flags & CKPT_COLLIDE) != 0);
+        body->GetCollisionModel()->SetFamilyGroup(rec.family_group);
+        body->GetCollisionModel()->SetFamilyMask(rec.family_mask);
+        body->SetMaterialSurface(materials[rec.material]);
+
+        body->SetMass(rec.mass);
+        body->SetInertiaXX(ChVector<>(rec.inertiaXX[0], rec.inertiaXX[1], rec.inertiaXX[2]));
+        body->SetInertiaXY(ChVector<>(rec.inertiaXY[0], rec.inertiaXY[1], rec.inertiaXY[2]));
+        body->SetPos(ChVector<>(rec.pos[0], rec.pos[1], rec.pos[2]));
+        body->SetRot(ChQuaternion<>(rec.rot[0], rec.rot[1], rec.rot[2], rec.rot[3]));
+        body->SetPos_dt(ChVector<>(rec.pos_dt[0], rec.pos_dt[1], rec.pos_dt[2]));
+        body->SetWvel_loc(ChVector<>(rec.wvel_loc[0], rec.wvel_loc[1], rec.wvel_loc[2]));
+    }
+
+    ChState x(system->GetNcoords_x(), system);
+    ChStateDelta v(system->GetNcoords_w(), system);
+    ChStateDelta a(system->GetNcoords_w(), system);
+    ChVectorDynamic<> L(system->GetNconstr());
+    std::memcpy(x.GetAddress(), x_data, header.num_x * sizeof(double));
+    std::memcpy(v.GetAddress(), v_data, header.num_v * sizeof(double));
+    std::memcpy(a.GetAddress(), a_data, header.num_v * sizeof(double));
+    std::memcpy(L.GetAddress(), L_data, header.num_L * sizeof(double));
+
+    system->SetChTime(header.time);
+    system->StateScatter(x, v, header.time);
+    system->StateScatterAcceleration(a);
+    // Skip the contact container (its reactions are not part of the checkpoint).
+    system->ChAssembly::IntStateScatterReactions(0, L);
+
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 // WriteShapesPovray
 //
@@ -25,6 +25,13 @@
 //      contact geometry.
 //    - only a subset of contact shapes are currently supported
 //
+// WriteCheckpointBinary and ReadCheckpointBinary
+//  these functions write and read, respectively, a binary checkpoint of the
+//  complete state of an existing system (all states, accelerations, and link
+//  reactions, as well as body properties and contact materials). The checkpoint
+//  is restored in bulk into an already-constructed system with identical
+//  topology (same bodies, links, and other physics items, in the same order).
+//
 // WriteShapesPovray
 //  this function writes a CSV file appropriate for processing with a POV-Ray
 //  script.
@@ -143,6 +150,24 @@ bool WriteCheckpoint(ChSystem* system, const std::string& filename);
 ChApi
 void ReadCheckpoint(ChSystem* system, const std::string& filename);
 
+// Write a binary checkpoint file with the current state of the given system.
+// The file consists of a header followed by contiguous arrays with the body
+// table, the contact material table, the system state vectors (positions,
+// velocities, accelerations), and the reactions of all non-contact constraints.
+// Contact reactions are not saved (contacts are regenerated at the next step).
+ChApi
+bool WriteCheckpointBinary(ChSystem* system, const std::string& filename);
+
+// Restore the state of the given system from a binary checkpoint file.
+// The system must have been constructed with the same topology as the one used
+// to create the checkpoint; the file is memory-mapped (where supported) and the
+// state arrays are scattered directly to the system. Body flags, mass
+// properties, collision families, and contact materials (including their
+// sharing between bodies) are also restored. Returns false if the file cannot
+// be read or does not match the given system.
+ChApi
+bool ReadCheckpointBinary(ChSystem* system, const std::string& filename);
+
 // Write CSV output file for PovRay.
 // Each line contains information about one visualization asset shape, as
 // follows:
@@ -248,14 +248,16 @@ void ChCommDistributed::Exchange() {
 
     // Saves a reference copy for consistency in the threads.
     ddm->curr_status = ddm->comm_status;
-    std::vector<BodyExchange> exchange_up_buf;
-    std::vector<BodyExchange> exchange_down_buf;
-    std::vector<BodyUpdate> update_up_buf;
-    std::vector<BodyUpdate> update_down_buf;
-    std::vector<Shape> shapes_up;
-    std::vector<Shape> shapes_down;
-    std::vector<uint> update_take_up;
-    std::vector<uint> update_take_down;
+
+    // Send buffers are kept between steps to avoid reallocation
+    exchange_up_buf.clear();
+    exchange_down_buf.clear();
+    update_up_buf.clear();
+    update_down_buf.clear();
+    shapes_up.clear();
+    shapes_down.clear();
+    update_take_up.clear();
+    update_take_down.clear();
 
     // Send Counts
     int num_exchange_up = 0;
@@ -515,14 +517,16 @@ void ChCommDistributed::Exchange() {
             if (my_rank != 0) {
                 MPI_Probe(my_rank - 1, 1, my_sys->world, &recv_status_exchange_down);
                 MPI_Get_count(&recv_status_exchange_down, BodyExchangeType, &num_recv_exchange_down);
-                recv_exchange_down = new BodyExchange[num_recv_exchange_down];
+                recv_exchange_down_buf.resize(num_recv_exchange_down);
+                recv_exchange_down = recv_exchange_down_buf.data();
                 MPI_Recv(recv_exchange_down, num_recv_exchange_down, BodyExchangeType, my_rank - 1, 1, my_sys->world,
                          &recv_status_exchange_down);
             }
             if (my_rank != num_ranks - 1) {
                 MPI_Probe(my_rank + 1, 2, my_sys->world, &recv_status_exchange_up);
                 MPI_Get_count(&recv_status_exchange_up, BodyExchangeType, &num_recv_exchange_up);
-                recv_exchange_up = new BodyExchange[num_recv_exchange_up];
+                recv_exchange_up_buf.resize(num_recv_exchange_up);
+                recv_exchange_up = recv_exchange_up_buf.data();
                 MPI_Recv(recv_exchange_up, num_recv_exchange_up, BodyExchangeType, my_rank + 1, 2, my_sys->world,
                          &recv_status_exchange_up);
             }
@@ -541,14 +545,16 @@ void ChCommDistributed::Exchange() {
             if (my_rank != 0) {
                 MPI_Probe(my_rank - 1, 3, my_sys->world, &recv_status_update_down);
                 MPI_Get_count(&recv_status_update_down, BodyUpdateType, &num_recv_update_down);
-                recv_update_down = new BodyUpdate[num_recv_update_down];
+                recv_update_down_buf.resize(num_recv_update_down);
+                recv_update_down = recv_update_down_buf.data();
                 MPI_Recv(recv_update_down, num_recv_update_down, BodyUpdateType, my_rank - 1, 3, my_sys->world,
                          &recv_status_update_down);
             }
             if (my_rank != num_ranks - 1) {
                 MPI_Probe(my_rank + 1, 4, my_sys->world, &recv_status_update_up);
                 MPI_Get_count(&recv_status_update_up, BodyUpdateType, &num_recv_update_up);
-                recv_update_up = new BodyUpdate[num_recv_update_up];
+                recv_update_up_buf.resize(num_recv_update_up);
+                recv_update_up = recv_update_up_buf.data();
                 MPI_Recv(recv_update_up, num_recv_update_up, BodyUpdateType, my_rank + 1, 4, my_sys->world,
                          &recv_status_update_up);
             }
@@ -566,14 +572,16 @@ void ChCommDistributed::Exchange() {
             if (my_rank != 0) {
                 MPI_Probe(my_rank - 1, 5, my_sys->world, &recv_status_take_down);
                 MPI_Get_count(&recv_status_take_down, MPI_UNSIGNED, &num_recv_take_down);
-                recv_take_down = new uint[num_recv_take_down];
+                recv_take_down_buf.resize(num_recv_take_down);
+                recv_take_down = recv_take_down_buf.data();
                 MPI_Recv(recv_take_down, num_recv_take_down, MPI_UNSIGNED, my_rank - 1, 5, my_sys->world,
                          &recv_status_take_down);
             }
             if (my_rank != num_ranks - 1) {
                 MPI_Probe(my_rank + 1, 6, my_sys->world, &recv_status_take_up);
                 MPI_Get_count(&recv_status_take_up, MPI_UNSIGNED, &num_recv_take_up);
-                recv_take_up = new uint[num_recv_take_up];
+                recv_take_up_buf.resize(num_recv_take_up);
+                recv_take_up = recv_take_up_buf.data();
                 MPI_Recv(recv_take_up, num_recv_take_up, MPI_UNSIGNED, my_rank + 1, 6, my_sys->world,
                          &recv_status_take_up);
             }
@@ -648,7 +656,8 @@ void ChCommDistributed::Exchange() {
     if (my_rank != 0) {
         MPI_Probe(my_rank - 1, 7, my_sys->world, &recv_status_shapes_down);
         MPI_Get_count(&recv_status_shapes_down, ShapeType, &num_recv_shapes_down);
-        recv_shapes_down = new Shape[num_recv_shapes_down];
+        recv_shapes_down_buf.resize(num_recv_shapes_down);
+        recv_shapes_down = recv_shapes_down_buf.data();
         MPI_Recv(recv_shapes_down, num_recv_shapes_down, ShapeType, my_rank - 1, 7, my_sys->world,
                  &recv_status_shapes_down);
     }
@@ -656,7 +665,8 @@ void ChCommDistributed::Exchange() {
         MPI_Probe(my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
         MPI_Get_count(&recv_status_shapes_up, ShapeType, &num_recv_shapes_up);
         ////GetLog() << "num_recv_shapes_up" << num_recv_shapes_up << "\n";
-        recv_shapes_up = new Shape[num_recv_shapes_up];
+        recv_shapes_up_buf.resize(num_recv_shapes_up);
+        recv_shapes_up = recv_shapes_up_buf.data();
         MPI_Recv(recv_shapes_up, num_recv_shapes_up, ShapeType, my_rank + 1, 8, my_sys->world, &recv_status_shapes_up);
     }
 
@@ -672,16 +682,6 @@ void ChCommDistributed::Exchange() {
         MPI_Wait(&rq_shapes_down, MPI_STATUS_IGNORE);
     }
 
-    // Free all dynamic memory used for recving
-    delete[] recv_exchange_down;
-    delete[] recv_exchange_up;
-    delete[] recv_update_down;
-    delete[] recv_update_up;
-    delete[] recv_take_down;
-    delete[] recv_take_up;
-    delete[] recv_shapes_down;
-    delete[] recv_shapes_up;
-
     MPI_Barrier(my_sys->world);
 }
 
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/physics/ChBody.h"
 
@@ -105,6 +106,26 @@ class CH_DISTR_API ChCommDistributed {
     ChDistributedDataManager* ddm;
 
   private:
+    // Send buffers (kept between steps to avoid reallocation)
+    std::vector<BodyExchange> exchange_up_buf;
+    std::vector<BodyExchange> exchange_down_buf;
+    std::vector<BodyUpdate> update_up_buf;
+    std::vector<BodyUpdate> update_down_buf;
+    std::vector<Shape> shapes_up;
+    std::vector<Shape> shapes_down;
+    std::vector<uint> update_take_up;
+    std::vector<uint> update_take_down;
+
+    // Receive buffers (kept between steps to avoid reallocation)
+    std::vector<BodyExchange> recv_exchange_up_buf;
+    std::vector<BodyExchange> recv_exchange_down_buf;
+    std::vector<BodyUpdate> recv_update_up_buf;
+    std::vector<BodyUpdate> recv_update_down_buf;
+    std::vector<uint> recv_take_up_buf;
+    std::vector<uint> recv_take_down_buf;
+    std::vector<Shape> recv_shapes_up_buf;
+    std::vector<Shape> recv_shapes_down_buf;
+
     /// Helper function for processing incoming exchange messages.
     void ProcessExchanges(int num_recv, BodyExchange* buf, int updown);
 
@@ -23,8 +23,10 @@
 
 #include <mpi.h>
 #include <stdlib.h>
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <numeric>
 
 using namespace chrono;
 
@@ -70,26 +72,85 @@ void ChDomainDistributed::SetSimDomain(double xlo, double xhi, double ylo, doubl
 }
 
 void ChDomainDistributed::SplitDomain() {
-    // Length of this subdomain along the long axis
-    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / my_sys->num_ranks;
+    // Length of each subdomain along the long axis
+    int num_ranks = my_sys->num_ranks;
+    double sub_len = (boxhi[split_axis] - boxlo[split_axis]) / num_ranks;
+
+    split_bounds.resize(num_ranks + 1);
+    for (int i = 0; i < num_ranks; i++) {
+        split_bounds[i] = boxlo[split_axis] + i * sub_len;
+    }
+    split_bounds[num_ranks] = boxhi[split_axis];
+
+    SetSubDomain();
+    split = true;
+}
 
+void ChDomainDistributed::SetSubDomain() {
     for (int i = 0; i < 3; i++) {
         if (split_axis == i) {
-            sublo[i] = boxlo[i] + my_sys->my_rank * sub_len;
-            subhi[i] = sublo[i] + sub_len;
+            sublo[i] = split_bounds[my_sys->my_rank];
+            subhi[i] = split_bounds[my_sys->my_rank + 1];
         } else {
             sublo[i] = boxlo[i];
             subhi[i] = boxhi[i];
         }
     }
-    split = true;
 }
 
-int ChDomainDistributed::GetRank(ChVector<double> pos) {
-    double sub_len = subhi[split_axis] - sublo[split_axis];
-    double pt = pos[split_axis] - boxlo[split_axis];
+bool ChDomainDistributed::Rebalance(double load) {
+    assert(split);
+    int num_ranks = my_sys->num_ranks;
+    if (num_ranks == 1)
+        return false;
+
+    // Collect the loads of all ranks. All ranks compute the same new boundaries from these values.
+    std::vector<double> loads(num_ranks);
+    MPI_Allgather(&load, 1, MPI_DOUBLE, loads.data(), 1, MPI_DOUBLE, my_sys->world);
+    double total = std::accumulate(loads.begin(), loads.end(), 0.0);
+    if (total <= 0)
+        return false;
+
+    // Find the locations splitting the (piecewise uniform) load distribution in equal parts.
+    std::vector<double> new_bounds(split_bounds);
+    int k = 0;
+    double cum = 0;
+    for (int i = 1; i < num_ranks; i++) {
+        double target = i * total / num_ranks;
+        while (k < num_ranks - 1 && cum + loads[k] < target) {
+            cum += loads[k];
+            k++;
+        }
+        double frac = (loads[k] > 0) ? (target - cum) / loads[k] : 0;
+        frac = std::min(std::max(frac, 0.0), 1.0);
+        new_bounds[i] = split_bounds[k] + frac * (split_bounds[k + 1] - split_bounds[k]);
+    }
+
+    // Limit the boundary displacements and enforce a minimum sub-domain width.
+    double ghost_layer = my_sys->GetGhostLayer();
+    double max_shift = 0.5 * ghost_layer;
+    double min_width = std::min(2 * ghost_layer, (boxhi[split_axis] - boxlo[split_axis]) / num_ranks);
+    for (int i = 1; i < num_ranks; i++) {
+        new_bounds[i] = std::min(std::max(new_bounds[i], split_bounds[i] - max_shift), split_bounds[i] + max_shift);
+    }
+    // Clamp the boundaries of slabs which would become too narrow, instead of discarding the whole rebalance.
+    // After the backward pass every slab is at least min_width wide (the box is at least num_ranks * min_width wide).
+    // If the current slabs satisfy the minimum width, neither pass moves a boundary outside its allowed shift.
+    for (int i = 1; i < num_ranks; i++)
+        new_bounds[i] = std::max(new_bounds[i], new_bounds[i - 1] + min_width);
+    for (int i = num_ranks - 1; i > 0; i--)
+        new_bounds[i] = std::min(new_bounds[i], new_bounds[i + 1] - min_width);
+
+    bool moved = (new_bounds != split_bounds);
+    split_bounds = new_bounds;
+    SetSubDomain();
+
+    return moved;
+}
 
-    return (int)(pt / sub_len);
+int ChDomainDistributed::GetRank(ChVector<double> pos) {
+    auto itr = std::upper_bound(split_bounds.begin() + 1, split_bounds.end() - 1, pos[split_axis]);
+    return (int)(itr - split_bounds.begin()) - 1;
 }
 
 distributed::COMM_STATUS ChDomainDistributed::GetRegion(double pos) {
@@ -15,6 +15,7 @@
 #pragma once
 
 #include <memory>
+#include <vector>
 
 #include "chrono/core/ChVector.h"
 #include "chrono/physics/ChBody.h"
@@ -28,7 +29,8 @@ namespace chrono {
 class ChSystemDistributed;
 
 /// This class maps sub-domains of the global simulation domain to each MPI rank.
-/// The global domain is split along the longest axis.
+/// The global domain is split into slabs along the longest axis. The slabs initially have equal widths; their
+/// boundaries can be moved during the simulation to balance the computational load across ranks (see Rebalance).
 /// Within each sub-domain, there are layers of ownership:
 ///
 ///
@@ -137,6 +139,20 @@ class CH_DISTR_API ChDomainDistributed {
     /// Returns the rank which has ownership of a body with the given position
     int GetRank(ChVector<double> pos);
 
+    /// Return the current locations of the sub-domain boundaries along the split axis.
+    /// Rank i owns the slab between entries i and i+1.
+    const std::vector<double>& GetSplitBounds() const { return split_bounds; }
+
+    /// Move the sub-domain boundaries along the split axis so as to balance the load across ranks.
+    /// This only supports the one-dimensional (slab) decomposition; there is no recursive bisection over other axes.
+    /// Must be called on all ranks, with the load (e.g., a weighted count of bodies and contacts) of the calling rank.
+    /// Each rank's load is assumed uniformly distributed over its sub-domain; the new boundaries split the total load
+    /// in equal parts. To let bodies migrate through the shared and ghost regions as if they had moved, a boundary
+    /// is displaced by at most half the ghost layer per call. Sub-domains are kept at least two ghost layers wide (or
+    /// an equal share of the domain, if smaller): boundaries which would make a sub-domain narrower are clamped.
+    /// Returns true if any boundary was moved.
+    virtual bool Rebalance(double load);
+
     /// Returns true if the domain has been set.
     bool IsSplit() { return split; }
 
@@ -160,6 +176,11 @@ class CH_DISTR_API ChDomainDistributed {
     bool split;     ///< Flag indicating that the domain has been divided into sub-domains.
     bool axis_set;  ///< Flag indicating that the splitting axis has been set.
 
+    std::vector<double> split_bounds;  ///< Sub-domain boundaries along the split axis (num_ranks + 1 values)
+
+    /// Set the bounds of this rank's sub-domain from the current split boundaries.
+    void SetSubDomain();
+
   private:
     /// Helper function that is called by the public GetRegion methods to get
     /// the region classification for a body based on the center position.
@@ -57,7 +57,12 @@ static void PrintNode(LocalShapeNode* node) {
 }
 
 ChSystemDistributed::ChSystemDistributed(MPI_Comm communicator, double ghostlayer, unsigned int maxobjects)
-    : ghost_layer(ghostlayer), master_rank(0), num_bodies_global(0) {
+    : ghost_layer(ghostlayer),
+      master_rank(0),
+      num_bodies_global(0),
+      balance_interval(0),
+      balance_contact_weight(1),
+      balance_steps(0) {
     MPI_Comm_dup(communicator, &world);
     MPI_Comm_size(world, &num_ranks);
     MPI_Comm_rank(world, &my_rank);
@@ -139,6 +144,11 @@ bool ChSystemDistributed::Integrate_Y() {
         data_manager->system_timer.start("Exchange");
         comm->Exchange();
         data_manager->system_timer.stop("Exchange");
+
+        if (balance_interval > 0 && ++balance_steps >= balance_interval) {
+            BalanceLoad();
+            balance_steps = 0;
+        }
     }
 #ifdef DistrProfile
     PrintEfficiency();
@@ -146,6 +156,19 @@ bool ChSystemDistributed::Integrate_Y() {
     return ret;
 }
 
+void ChSystemDistributed::BalanceLoad() {
+    // Bodies simulated on this rank (ghosts are advanced by their owner rank)
+    int num_bodies = 0;
+    for (int i = 0; i < data_manager->num_rigid_bodies; i++) {
+        distributed::COMM_STATUS status = ddm->comm_status[i];
+        if (status == distributed::OWNED || status == distributed::SHARED_UP || status == distributed::SHARED_DOWN)
+            num_bodies++;
+    }
+    double load = num_bodies + balance_contact_weight * data_manager->num_rigid_contacts;
+
+    domain->Rebalance(load);
+}
+
 void ChSystemDistributed::UpdateRigidBodies() {
     this->ChSystemParallel::UpdateRigidBodies();
 
@@ -74,6 +74,19 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Return the distance into the neighboring sub-domain that is considered shared.
     double GetGhostLayer() const { return ghost_layer; }
 
+    /// Enable periodic load balancing across ranks (disabled by default).
+    /// Every 'interval' steps, the sub-domain boundaries are moved to balance the load of the ranks, measured as the
+    /// number of bodies simulated on a rank plus 'contact_weight' times its number of contacts. Bodies migrate to
+    /// their new owner rank through the regular exchange. Set interval = 0 to disable load balancing.
+    /// Only the slab boundaries along the split axis are moved: the decomposition stays one-dimensional, so the load
+    /// can only be balanced if it varies along that axis.
+    /// NOTE: fixed bodies added with AddBody are only kept on the ranks whose initial sub-domain they overlap;
+    /// use AddBodyAllRanks for fixed boundaries when load balancing is enabled.
+    void SetLoadBalancing(int interval, double contact_weight = 1) {
+        balance_interval = interval;
+        balance_contact_weight = contact_weight;
+    }
+
     /// Return the current global number of bodies in the system.
     unsigned int GetNumBodiesGlobal() const { return num_bodies_global; }
 
@@ -223,6 +236,18 @@ class CH_DISTR_API ChSystemDistributed : public ChSystemParallelSMC {
     /// Length into the neighboring sub-domain which is considered shared.
     double ghost_layer;
 
+    /// Number of steps between load balancing operations (0 if disabled).
+    int balance_interval;
+
+    /// Weight of contacts, relative to bodies, in the load of a rank.
+    double balance_contact_weight;
+
+    /// Number of steps since the last load balancing operation.
+    int balance_steps;
+
+    /// Move the sub-domain boundaries to balance the load across ranks.
+    void BalanceLoad();
+
     /// Number of bodies in the whole global simulation. Important for maintaining
     /// unique global IDs
     unsigned int num_bodies_global;
@@ -101,12 +101,20 @@ ChNodeMeshless& ChNodeMeshless::operator=(const ChNodeMeshless& other) {
 
 void ChNodeMeshless::SetKernelRadius(double mr) {
     h_rad = mr;
-    double aabb_rad = h_rad / 2;  // to avoid too many pairs: bounding boxes hemisizes will sum..  __.__--*--
-    ((ChModelBullet*)collision_model)->SetSphereRadius(coll_rad, ChMax(0.0, aabb_rad - coll_rad));
+    UpdateCollisionModel();
 }
 
 void ChNodeMeshless::SetCollisionRadius(double mr) {
     coll_rad = mr;
+    UpdateCollisionModel();
+}
+
+void ChNodeMeshless::UpdateCollisionModel() {
+    if (container && container->GetUseNeighborGrid()) {
+        // neighbors are found by the container: the collision model is only used for contacts
+        ((ChModelBullet*)collision_model)->SetSphereRadius(coll_rad, coll_rad);
+        return;
+    }
     double aabb_rad = h_rad / 2;  // to avoid too many pairs: bounding boxes hemisizes will sum..  __.__--*--
     ((ChModelBullet*)collision_model)->SetSphereRadius(coll_rad, ChMax(0.0, aabb_rad - coll_rad));
 }
@@ -146,7 +154,7 @@ ChPhysicsItem* ChNodeMeshless::GetPhysicsItem() {
 
 /// CLASS FOR Meshless NODE CLUSTER
 
-ChMatterMeshless::ChMatterMeshless() : do_collide(false), viscosity(0) {
+ChMatterMeshless::ChMatterMeshless() : do_collide(false), use_neighbor_grid(false), viscosity(0) {
     // Default: VonMises material
     material = std::make_shared<ChContinuumPlasticVonMises>();
 
@@ -156,6 +164,8 @@ ChMatterMeshless::ChMatterMeshless() : do_collide(false), viscosity(0) {
 
 ChMatterMeshless::ChMatterMeshless(const ChMatterMeshless& other) : ChIndexedNodes(other) {
     do_collide = other.do_collide;
+    use_neighbor_grid = other.use_neighbor_grid;
+    neighbor_grid.SetSkin(other.neighbor_grid.GetSkin());
 
     matsurface = other.matsurface;
 
@@ -313,15 +323,38 @@ void ChMatterMeshless::IntLoadResidual_F(
     ) {
     // COMPUTE THE MESHLESS FORCES HERE
 
+    if (!ComputeForces())
+        return;
+
+    // 5- Per-node load force
+
+    for (unsigned int j = 0; j < nodes.size(); j++) {
+        // particle gyroscopic force:
+        // none.
+
+        // add gravity
+        ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
+        ChVector<> TotForce = nodes[j]->UserForce + Gforce;
+
+        std::shared_ptr<ChNodeMeshless> mnode(nodes[j]);
+        assert(mnode);
+
+        R.PasteSumVector(TotForce * c, off + 3 * j, 0);
+    }
+}
+
+bool ChMatterMeshless::ComputeForces() {
     // First, find if any ChProximityContainerMeshless object is present
-    // in the system,
+    // in the system (not needed if using the built-in neighbor lists),
 
     std::shared_ptr<ChProximityContainerMeshless> edges;
     for (auto otherphysics : GetSystem()->Get_otherphysicslist()) {
         if (edges = std::dynamic_pointer_cast<ChProximityContainerMeshless>(otherphysics))
             break;
     }
-    assert(edges);  // If using a ChMatterMeshless, you must add also a ChProximityContainerMeshless.
+    assert(edges || use_neighbor_grid);  // If using a ChMatterMeshless, you must add also a ChProximityContainerMeshless.
+    if (!edges && !use_neighbor_grid)
+        return false;
 
     // 1- Per-node initialization
 
@@ -336,7 +369,10 @@ void ChMatterMeshless::IntLoadResidual_F(
 
     // 2- Per-edge initialization and accumulation of values in particles's J, Amoment, m_v, density
 
-    edges->AccumulateStep1();
+    if (use_neighbor_grid)
+        GatherNeighborsStep1();
+    else
+        edges->AccumulateStep1();
 
     // 3- Per-node inversion of A and computation of strain stress
 
@@ -403,22 +439,100 @@ void ChMatterMeshless::IntLoadResidual_F(
 
     // 4- Per-edge force transfer from stress, and add also viscous forces
 
-    edges->AccumulateStep2();
+    if (use_neighbor_grid)
+        GatherNeighborsStep2();
+    else
+        edges->AccumulateStep2();
 
-    // 5- Per-node load force
+    return true;
+}
 
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        // particle gyroscopic force:
-        // none.
+// Same computations as in ChProximityContainerMeshless::AccumulateStep1/2, but each node gathers the
+// contributions of its neighbors, so that nodes can be processed in parallel. For the viscous forces,
+// where the per-edge version uses the kernel radius of an arbitrary node of the pair, here the kernels
+// of the two nodes are averaged (same result if the two nodes have the same kernel radius).
+void ChMatterMeshless::GatherNeighborsStep1() {
+    int nnodes = (int)nodes.size();
 
-        // add gravity
-        ChVector<> Gforce = GetSystem()->Get_G_acc() * nodes[j]->GetMass();
-        ChVector<> TotForce = nodes[j]->UserForce + Gforce;
+    grid_positions.resize(nnodes);
+    double max_radius = 0;
+    for (int j = 0; j < nnodes; j++) {
+        grid_positions[j] = nodes[j]->GetPos();
+        max_radius = ChMax(max_radius, nodes[j]->GetKernelRadius());
+    }
+    neighbor_grid.Update(grid_positions, max_radius);
+
+    const std::vector<int>& order = neighbor_grid.GetOrder();
+    const std::vector<int>& start = neighbor_grid.GetStart();
+    const std::vector<int>& neighbors = neighbor_grid.GetNeighbors();
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < nnodes; k++) {
+        ChNodeMeshless* mnodeA = nodes[order[k]].get();
+        ChVector<> x_Aref = mnodeA->GetPosReference();
+        ChVector<> u_A = mnodeA->GetPos() - x_Aref;
+        double h_A = mnodeA->GetKernelRadius();
+
+        for (int n = start[k]; n < start[k + 1]; n++) {
+            ChNodeMeshless* mnodeB = nodes[neighbors[n]].get();
+            ChVector<> x_Bref = mnodeB->GetPosReference();
+            ChVector<> u_B = mnodeB->GetPos() - x_Bref;
+
+            ChVector<> d_BA = x_Bref - x_Aref;
+            ChVector<> g_BA = u_B - u_A;
+            double W_BA = W_sph(d_BA.Length(), h_A);
+
+            mnodeA->density += mnodeB->GetMass() * W_BA;
+
+            // increment the moment matrix: Aa += d_BA*d_BA'*W_BA
+            for (int r = 0; r < 3; r++)
+                for (int c = 0; c < 3; c++)
+                    mnodeA->Amoment(r, c) += d_BA[r] * d_BA[c] * W_BA;
+
+            // increment the J matrix
+            ChVector<> m_inc_BA = d_BA * W_BA;
+            mnodeA->J.PasteSumVector(m_inc_BA * g_BA.x(), 0, 0);
+            mnodeA->J.PasteSumVector(m_inc_BA * g_BA.y(), 0, 1);
+            mnodeA->J.PasteSumVector(m_inc_BA * g_BA.z(), 0, 2);
+        }
+    }
+}
 
-        std::shared_ptr<ChNodeMeshless> mnode(nodes[j]);
-        assert(mnode);
+void ChMatterMeshless::GatherNeighborsStep2() {
+    int nnodes = (int)nodes.size();
 
-        R.PasteSumVector(TotForce * c, off + 3 * j, 0);
+    const std::vector<int>& order = neighbor_grid.GetOrder();
+    const std::vector<int>& start = neighbor_grid.GetStart();
+    const std::vector<int>& neighbors = neighbor_grid.GetNeighbors();
+
+#pragma omp parallel for schedule(dynamic, 256)
+    for (int k = 0; k < nnodes; k++) {
+        ChNodeMeshless* mnodeA = nodes[order[k]].get();
+        ChVector<> x_Aref = mnodeA->GetPosReference();
+        double h_A = mnodeA->GetKernelRadius();
+        ChVector<> force = VNULL;
+
+        for (int n = start[k]; n < start[k + 1]; n++) {
+            ChNodeMeshless* mnodeB = nodes[neighbors[n]].get();
+            double h_B = mnodeB->GetKernelRadius();
+
+            ChVector<> d_BA = mnodeB->GetPosReference() - x_Aref;
+            double dist_BA = d_BA.Length();
+
+            // elastoplastic forces
+            force += mnodeA->FA * (d_BA * W_sph(dist_BA, h_A));
+            force += mnodeB->FA * (d_BA * W_sph(dist_BA, h_B));
+
+            // viscous forces
+            ChVector<> r_BA = mnodeB->GetPos() - mnodeA->GetPos();
+            double r_length = r_BA.Length();
+            double W_BA_visc = 0.5 * (W_sq_visco(r_length, h_A) + W_sq_visco(r_length, h_B));
+            ChVector<> velBA = mnodeB->GetPos_dt() - mnodeA->GetPos_dt();
+            double avg_viscosity =
+                0.5 * (mnodeA->GetMatterContainer()->GetViscosity() + mnodeB->GetMatterContainer()->GetViscosity());
+            force += velBA * (mnodeA->volume * avg_viscosity * mnodeB->volume * W_BA_visc);
+        }
+        mnodeA->UserForce = force;
     }
 }
 
@@ -471,97 +585,8 @@ void ChMatterMeshless::VariablesFbReset() {
 void ChMatterMeshless::VariablesFbLoadForces(double factor) {
     // COMPUTE THE MESHLESS FORCES HERE
 
-    // First, find if any ChProximityContainerMeshless object is present
-    // in the system,
-
-    std::shared_ptr<ChProximityContainerMeshless> edges;
-    for (auto otherphysics : GetSystem()->Get_otherphysicslist()) {
-        if (edges = std::dynamic_pointer_cast<ChProximityContainerMeshless>(otherphysics))
-            break;
-    }
-    assert(edges);  // If using a ChMatterMeshless, you must add also a ChProximityContainerMeshless.
-
-    // 1- Per-node initialization
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        nodes[j]->J.FillElem(0.0);
-        nodes[j]->Amoment.FillElem(0.0);
-        nodes[j]->t_strain.FillElem(0.0);
-        nodes[j]->e_stress.FillElem(0.0);
-        nodes[j]->UserForce = VNULL;
-        nodes[j]->density = 0;
-    }
-
-    // 2- Per-edge initialization and accumulation of values in particles's J, Amoment, m_v, density
-
-    edges->AccumulateStep1();
-
-    // 3- Per-node inversion of A and computation of strain stress
-
-    for (unsigned int j = 0; j < nodes.size(); j++) {
-        std::shared_ptr<ChNodeMeshless> mnode(nodes[j]);
-        assert(mnode);
-
-        // node volume is v=mass/density
-        if (mnode->density > 0)
-            mnode->volume = mnode->GetMass() / mnode->density;
-        else
-            mnode->volume = 0;
-
-        // Compute A inverse
-        ChMatrix33<> M_tmp = mnode->Amoment;
-        double det = M_tmp.FastInvert(mnode->Amoment);
-        if (fabs(det) < 0.00003) {
-            mnode->Amoment.FillElem(0);     // deactivate if not possible to invert
-            mnode->e_strain.FillElem(0.0);  // detach
-        } else {
-            // Compute J = ( A^-1 * [dwg | dwg | dwg] )' + I
-            M_tmp.MatrMultiply(mnode->Amoment, mnode->J);
-            M_tmp.Element(0, 0) += 1;
-            M_tmp.Element(1, 1) += 1;
-            M_tmp.Element(2, 2) += 1;
-            mnode->J.CopyFromMatrixT(M_tmp);
-
-            // Compute step strain tensor  de = J'*J - I
-            ChMatrix33<> mtensor;
-            mtensor.MatrMultiply(M_tmp, mnode->J);
-            mtensor.Element(0, 0) -= 1;
-            mtensor.Element(1, 1) -= 1;
-            mtensor.Element(2, 2) -= 1;
-
-            mnode->t_strain.ConvertFromMatrix(mtensor);  // store 'step strain' de, change in total strain
-
-            ChStrainTensor<> strainplasticflow;
-            material->ComputeReturnMapping(strainplasticflow,   // dEp, flow of elastic strain (correction)
-                                           nodes[j]->t_strain,  // increment of total strain
-                                           nodes[j]->e_strain,  // last elastic strain
-                                           nodes[j]->p_strain   // last plastic strain
-                                           );
-            ChStrainTensor<> proj_e_strain;
-            proj_e_strain.MatrSub(nodes[j]->e_strain, strainplasticflow);
-            proj_e_strain.MatrInc(nodes[j]->t_strain);
-            GetMaterial()->ComputeElasticStress(mnode->e_stress, proj_e_strain);
-            mnode->e_stress.ConvertToMatrix(mtensor);
-
-            /*
-            // Compute elastic stress tensor  sigma= C*epsilon
-            //   NOTE: it should be better to perform stress computation on corrected e_strain, _after_ the
-            //   return mapping (see later), but for small timestep it could be the same.
-            ChStrainTensor<> guesstot_e_strain; // anticipate the computation of total strain for anticipating strains
-            guesstot_e_strain.MatrAdd(mnode->e_strain, mnode->t_strain);
-            GetMaterial()->ComputeElasticStress(mnode->e_stress, guesstot_e_strain);
-            mnode->e_stress.ConvertToMatrix(mtensor);
-            */
-
-            // Precompute 2*v*J*sigma*A^-1
-            mnode->FA = mnode->J * (mtensor * (mnode->Amoment));
-            mnode->FA.MatrScale(2 * mnode->volume);
-        }
-    }
-
-    // 4- Per-edge force transfer from stress, and add also viscous forces
-
-    edges->AccumulateStep2();
+    if (!ComputeForces())
+        return;
 
     // 5- Per-node load force
 
@@ -666,6 +691,30 @@ void ChMatterMeshless::Update(double mytime, bool update_assets) {
 }
 
 // collision stuff
+void ChMatterMeshless::SetUseNeighborGrid(bool mval) {
+    use_neighbor_grid = mval;
+
+    // resize the collision models of the particles
+    for (unsigned int j = 0; j < nodes.size(); j++)
+        nodes[j]->SetCollisionRadius(nodes[j]->GetCollisionRadius());
+}
+
+// Kernels
+
+double ChMatterMeshless::W_sph(double r, double h) {
+    if (r < h) {
+        return (315.0 / (64.0 * CH_C_PI * pow(h, 9))) * pow((h * h - r * r), 3);
+    } else
+        return 0;
+}
+
+double ChMatterMeshless::W_sq_visco(double r, double h) {
+    if (r < h) {
+        return (45.0 / (CH_C_PI * pow(h, 6))) * (h - r);
+    } else
+        return 0;
+}
+
 void ChMatterMeshless::SetCollide(bool mcoll) {
     if (mcoll == do_collide)
         return;
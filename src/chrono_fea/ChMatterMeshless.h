@@ -18,6 +18,7 @@
 #include <cmath>
 
 #include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/collision/ChCNeighborGrid.h"
 #include "chrono/physics/ChContinuumMaterial.h"
 #include "chrono/physics/ChIndexedNodes.h"
 #include "chrono/physics/ChNodeXYZ.h"
@@ -190,6 +191,10 @@ class ChApiFea ChNodeMeshless : public ChNodeXYZ, public ChContactable_1vars<3>
     double h_rad;
     double coll_rad;
     double hardening;
+
+  private:
+    /// Update the sphere of the collision model after a change of radii.
+    void UpdateCollisionModel();
 };
 
 /// Class for clusters of nodes that can simulate a visco-elasto-plastic deformable
@@ -203,6 +208,9 @@ class ChApiFea ChMatterMeshless : public ChIndexedNodes {
     double viscosity;                                     ///< viscosity
     bool do_collide;                                      ///< flag indicating whether or not nodes collide
     std::shared_ptr<ChMaterialSurface> matsurface;        ///< data for surface contact and impact
+    bool use_neighbor_grid;                               ///< flag indicating whether neighbors are found with a cell list
+    collision::ChNeighborGrid neighbor_grid;              ///< neighbor search for the built-in neighbor lists
+    std::vector<ChVector<> > grid_positions;              ///< node positions passed to the neighbor search
 
   public:
     /// Build a cluster of nodes for Meshless and meshless FEA.
@@ -221,6 +229,21 @@ class ChApiFea ChMatterMeshless : public ChIndexedNodes {
     void SetCollide(bool mcoll);
     virtual bool GetCollide() const override { return do_collide; }
 
+    /// Enable/disable the built-in neighbor search (default: false).
+    /// If disabled, the interacting pairs of nodes are the proximities that the collision system
+    /// reports to a ChProximityContainerMeshless, which must be added to the system.
+    /// If enabled, the neighbors are found with a cell list (see collision::ChNeighborGrid) and the
+    /// forces are computed in parallel directly from its neighbor lists; no proximity container is needed.
+    /// Note that the neighbor grid only contains the nodes of this container: with the neighbor grid enabled,
+    /// nodes do not interact with the nodes of other ChMatterMeshless containers. Use the default
+    /// proximity-based path if several meshless containers must interact.
+    void SetUseNeighborGrid(bool mval);
+    bool GetUseNeighborGrid() const { return use_neighbor_grid; }
+
+    /// Access the neighbor search used when the built-in neighbor search is enabled
+    /// (for example, to set a skin distance and avoid rebuilding the neighbor lists at each step).
+    collision::ChNeighborGrid& GetNeighborGrid() { return neighbor_grid; }
+
     /// Get the number of scalar coordinates (variables), if any, in this item.
     virtual int GetDOF() override { return 3 * GetNnodes(); }
 
@@ -352,6 +375,27 @@ class ChApiFea ChMatterMeshless : public ChIndexedNodes {
 
     /// Method to allow de serialization of transient data from archives.
     virtual void ArchiveIN(ChArchiveIn& marchive);
+
+    //
+    // KERNELS
+    //
+
+    /// Smoothing kernel, used for density, moment matrix and elastic forces.
+    static double W_sph(double r, double h);
+
+    /// Viscosity kernel (laplacian).
+    static double W_sq_visco(double r, double h);
+
+  private:
+    /// Compute density, strain and stress of the nodes, then the forces in their UserForce.
+    /// Returns false if no neighbor information is available.
+    bool ComputeForces();
+
+    /// Per-node accumulation of density, moment matrix and J, using the built-in neighbor lists.
+    void GatherNeighborsStep1();
+
+    /// Per-node accumulation of elastoplastic and viscous forces, using the built-in neighbor lists.
+    void GatherNeighborsStep2();
 };
 
 }  // end namespace fea
@@ -18,6 +18,7 @@
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 
 #include "chrono/core/ChMath.h"
 #include "chrono/physics/ChLoad.h"
@@ -89,15 +90,18 @@ void ChMesh::AddNode(std::shared_ptr<ChNodeFEAbase> m_node) {
 
 void ChMesh::AddElement(std::shared_ptr<ChElementBase> m_elem) {
     velements.push_back(m_elem);
+    element_colors.clear();
 }
 
 void ChMesh::ClearElements() {
     velements.clear();
+    element_colors.clear();
     vcontactsurfaces.clear();
 }
 
 void ChMesh::ClearNodes() {
     velements.clear();
+    element_colors.clear();
     vnodes.clear();
     vcontactsurfaces.clear();
 }
@@ -134,6 +138,34 @@ void ChMesh::Setup() {
     }
 }
 
+// Greedy coloring of the elements: each element is assigned the lowest color not yet used by any of its nodes.
+void ChMesh::ComputeElementColors() {
+    element_colors.clear();
+
+    std::unordered_map<ChNodeFEAbase*, std::vector<int>> node_colors;
+    node_colors.reserve(vnodes.size());
+
+    std::vector<std::vector<int>*> colors;
+    for (int ie = 0; ie < (int)velements.size(); ++ie) {
+        colors.clear();
+        for (int in = 0; in < velements[ie]->GetNnodes(); ++in)
+            colors.push_back(&node_colors[velements[ie]->GetNodeN(in).get()]);
+
+        int color = 0;
+        while (std::any_of(colors.begin(), colors.end(), [color](const std::vector<int>* node_color) {
+            return std::find(node_color->begin(), node_color->end(), color) != node_color->end();
+        }))
+            color++;
+
+        for (auto node_color : colors)
+            node_color->push_back(color);
+
+        if (color >= (int)element_colors.size())
+            element_colors.resize(color + 1);
+        element_colors[color].push_back(ie);
+    }
+}
+
 // Updates all time-dependant variables, if any...
 // Ex: maybe the elasticity can increase in time, etc.
 void ChMesh::Update(double m_time, bool update_assets) {
@@ -262,9 +294,22 @@ void ChMesh::IntLoadResidual_F(const unsigned int off,
 
     // internal forces
     timer_internal_forces.start();
+    if (GetSystem() && GetSystem()->GetDeterministic()) {
+        if (element_colors.empty())
+            ComputeElementColors();
+        // Deterministic mode: the elements of a color do not share nodes, and colors are processed in order,
+        // so each entry of R receives its contributions always in the same order.
+        for (auto& color : element_colors) {
+#pragma omp parallel for schedule(dynamic, 4)
+            for (int i = 0; i < (int)color.size(); i++) {
+                velements[color[i]]->EleIntLoadResidual_F(R, c);
+            }
+        }
+    } else {
 #pragma omp parallel for schedule(dynamic, 4)
-    for (int ie = 0; ie < velements.size(); ie++) {
-        velements[ie]->EleIntLoadResidual_F(R, c);
+        for (int ie = 0; ie < velements.size(); ie++) {
+            velements[ie]->EleIntLoadResidual_F(R, c);
+        }
     }
     timer_internal_forces.stop();
     ncalls_internal_forces++;
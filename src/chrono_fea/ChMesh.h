@@ -41,6 +41,7 @@ class ChApiFea ChMesh : public ChIndexedNodes {
   private:
     std::vector<std::shared_ptr<ChNodeFEAbase>> vnodes;     ///<  nodes
     std::vector<std::shared_ptr<ChElementBase>> velements;  ///<  elements
+    std::vector<std::vector<int>> element_colors;           ///<  groups of elements without shared nodes
 
     unsigned int n_dofs;    ///< total degrees of freedom
     unsigned int n_dofs_w;  ///< total degrees of freedom, derivative (Lie algebra)
@@ -269,6 +270,11 @@ class ChApiFea ChMesh : public ChIndexedNodes {
     virtual void InjectVariables(ChSystemDescriptor& mdescriptor) override;
 
   private:
+    /// Group the elements in colors, such that the elements of a color do not share any node.
+    /// Used in deterministic mode (see ChSystem::SetDeterministic), to accumulate the internal
+    /// forces in parallel and in a fixed order.
+    void ComputeElementColors();
+
     /// Initial setup (before analysis).
     /// This function is called from ChSystem::SetupInitial, marking a point where system
     /// construction is completed.
@@ -123,20 +123,6 @@ void ChProximityContainerMeshless::ReportAllProximities(ReportProximityCallback*
 
 // SOLVER INTERFACES
 
-static double W_sph(double r, double h) {
-    if (r < h) {
-        return (315.0 / (64.0 * CH_C_PI * pow(h, 9))) * pow((h * h - r * r), 3);
-    } else
-        return 0;
-}
-
-static double W_sq_visco(double r, double h) {
-    if (r < h) {
-        return (45.0 / (CH_C_PI * pow(h, 6))) * (h - r);
-    } else
-        return 0;
-}
-
 void ChProximityContainerMeshless::AccumulateStep1() {
     // Per-edge data computation
     std::list<ChProximityMeshless*>::iterator iterproximity = proximitylist.begin();
@@ -154,8 +140,8 @@ void ChProximityContainerMeshless::AccumulateStep1() {
         ChVector<> d_BA = x_Bref - x_Aref;
         ChVector<> g_BA = u_B - u_A;
         double dist_BA = d_BA.Length();
-        double W_BA = W_sph(dist_BA, mnodeA->GetKernelRadius());
-        double W_AB = W_sph(dist_BA, mnodeB->GetKernelRadius());
+        double W_BA = ChMatterMeshless::W_sph(dist_BA, mnodeA->GetKernelRadius());
+        double W_AB = ChMatterMeshless::W_sph(dist_BA, mnodeB->GetKernelRadius());
 
         // increment data of connected nodes
 
@@ -216,8 +202,8 @@ void ChProximityContainerMeshless::AccumulateStep2() {
         ChVector<> d_BA = x_Bref - x_Aref;
 
         double dist_BA = d_BA.Length();
-        double W_BA = W_sph(dist_BA, mnodeA->GetKernelRadius());
-        double W_AB = W_sph(dist_BA, mnodeB->GetKernelRadius());
+        double W_BA = ChMatterMeshless::W_sph(dist_BA, mnodeA->GetKernelRadius());
+        double W_AB = ChMatterMeshless::W_sph(dist_BA, mnodeB->GetKernelRadius());
 
         // increment elastoplastic forces of connected nodes
 
@@ -231,8 +217,8 @@ void ChProximityContainerMeshless::AccumulateStep2() {
 
         ChVector<> r_BA = x_B - x_A;
         double r_length = r_BA.Length();
-        double W_BA_visc = W_sq_visco(r_length, mnodeA->GetKernelRadius());
-        double W_AB_visc = W_sq_visco(r_length, mnodeB->GetKernelRadius());
+        double W_BA_visc = ChMatterMeshless::W_sq_visco(r_length, mnodeA->GetKernelRadius());
+        double W_AB_visc = ChMatterMeshless::W_sq_visco(r_length, mnodeB->GetKernelRadius());
         ChVector<> velBA = mnodeB->GetPos_dt() - mnodeA->GetPos_dt();
 
         ChMatterMeshless* mmatA = (ChMatterMeshless*)(*iterproximity)->GetModelA()->GetPhysicsItem();
@@ -12,6 +12,9 @@
 // Authors: Alessandro Tasora
 // =============================================================================
 
+#include <cstdint>
+#include <cstring>
+
 #include "chrono/assets/ChAssetLevel.h"
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/assets/ChCamera.h"
@@ -35,6 +38,33 @@ namespace postprocess {
 
 using namespace geometry;
 
+// Write the POV camera defined by a ChCamera asset.
+static void WriteCamera(ChStreamOutAsciiFile& mfilepov,
+                        const ChVector<>& camera_location,
+                        const ChVector<>& camera_aim,
+                        const ChVector<>& camera_up,
+                        double camera_angle,
+                        bool camera_orthographic) {
+    mfilepov << "camera { \n";
+    if (camera_orthographic) {
+        mfilepov << " orthographic \n";
+        mfilepov << " right x * " << (camera_location - camera_aim).Length() << " * tan ((( " << camera_angle
+                 << " *0.5)/180)*3.14) \n";
+        mfilepov << " up y * image_height/image_width * " << (camera_location - camera_aim).Length()
+                 << " * tan (((" << camera_angle << "*0.5)/180)*3.14) \n";
+        ChVector<> mdir = (camera_aim - camera_location) * 0.00001;
+        mfilepov << " direction <" << mdir.x() << "," << mdir.y() << "," << mdir.z() << "> \n";
+    } else {
+        mfilepov << " right -x*image_width/image_height \n";
+        mfilepov << " angle " << camera_angle << " \n";
+    }
+    mfilepov << " location <" << camera_location.x() << "," << camera_location.y() << "," << camera_location.z()
+             << "> \n"
+             << " look_at <" << camera_aim.x() << "," << camera_aim.y() << "," << camera_aim.z() << "> \n"
+             << " sky <" << camera_up.x() << "," << camera_up.y() << "," << camera_up.z() << "> \n";
+    mfilepov << "}\n\n\n";
+}
+
 ChPovRay::ChPovRay(ChSystem* system) : ChPostProcessBase(system) {
     this->pic_filename = "pic";
     this->template_filename = GetChronoDataFile("_template_POV.pov");
@@ -72,6 +102,15 @@ ChPovRay::ChPovRay(ChSystem* system) : ChPostProcessBase(system) {
     this->contacts_colormap_endscale = 10;
     this->contacts_do_colormap = true;
     this->single_asset_file = true;
+    this->binary_data = false;
+    this->binary_max_pending = 8;
+    this->pov_next_object_id = 0;
+    this->binary_stop = false;
+}
+
+ChPovRay::~ChPovRay() {
+    // Write all pending binary frames (errors cannot be reported from here)
+    StopBinaryWriter();
 }
 
 void ChPovRay::Add(std::shared_ptr<ChPhysicsItem> mitem) {
@@ -148,6 +187,15 @@ void ChPovRay::SetupLists() {
             mcachedasset++;
     }
 
+    // Same for the items whose POV macro was exported in binary mode.
+    auto mcachedobject = pov_objects.begin();
+    while (mcachedobject != pov_objects.end()) {
+        if (mcachedobject->second.item.use_count() == 1)
+            mcachedobject = pov_objects.erase(mcachedobject);
+        else
+            mcachedobject++;
+    }
+
     // scan all items in ChSystem to see which were marked by a ChPovAsset asset
     for (auto body : mSystem->Get_bodylist()) {
         if (IsAdded(body))
@@ -233,6 +281,7 @@ void ChPovRay::ExportScript(const std::string& filename) {
     this->out_script_filename = filename;
 
     pov_assets.clear();
+    pov_objects.clear();
 
     this->SetupLists();
 
@@ -437,7 +486,7 @@ void ChPovRay::_recurseExportAssets(std::vector<std::shared_ptr<ChAsset> >& asse
             auto mytrimeshshapeasset = std::dynamic_pointer_cast<ChTriangleMeshShape>(k_asset);
 
             if (myobjshapeasset || mytrimeshshapeasset) {
-                ChTriangleMeshConnected* mytrimesh = 0;
+                const ChTriangleMeshConnected* mytrimesh = 0;
                 ChTriangleMeshConnected* temp_allocated_loadtrimesh = 0;
 
                 if (myobjshapeasset) {
@@ -461,7 +510,7 @@ void ChPovRay::_recurseExportAssets(std::vector<std::shared_ptr<ChAsset> >& asse
                 }
 
                 if (mytrimeshshapeasset) {
-                    mytrimesh = &mytrimeshshapeasset->GetMesh();
+                    mytrimesh = mytrimeshshapeasset->GetSharedMesh().get();
                 }
 
                 // POV macro to build the asset - begin
@@ -778,6 +827,20 @@ void ChPovRay::ExportData(const std::string& filename) {
 
     this->SetupLists();
 
+    // In binary mode, shapes and per-object macros always go in the single asset file,
+    // then only the object transforms are saved in the nnnn.bin file.
+    if (binary_data) {
+        {
+            std::string assets_filename = this->out_script_filename + ".assets";
+            ChStreamOutAsciiFile assets_file(assets_filename.c_str(), std::ios::app);
+            this->ExportAssets(assets_file);
+            this->ExportObjects(assets_file);
+        }
+        this->ExportBinaryData(filename);
+        this->framenumber++;
+        return;
+    }
+
     // If using a single-file asset, update it (because maybe that during the
     // animation someone created an object with asset)
     if (single_asset_file) {
@@ -955,26 +1018,8 @@ void ChPovRay::ExportData(const std::string& filename) {
         }
 
         // If a camera have been found in assets, create it and override the default one
-        if (this->camera_found_in_assets) {
-            mfilepov << "camera { \n";
-            if (camera_orthographic) {
-                mfilepov << " orthographic \n";
-                mfilepov << " right x * " << (camera_location - camera_aim).Length() << " * tan ((( " << camera_angle
-                         << " *0.5)/180)*3.14) \n";
-                mfilepov << " up y * image_height/image_width * " << (camera_location - camera_aim).Length()
-                         << " * tan (((" << camera_angle << "*0.5)/180)*3.14) \n";
-                ChVector<> mdir = (camera_aim - camera_location) * 0.00001;
-                mfilepov << " direction <" << mdir.x() << "," << mdir.y() << "," << mdir.z() << "> \n";
-            } else {
-                mfilepov << " right -x*image_width/image_height \n";
-                mfilepov << " angle " << camera_angle << " \n";
-            }
-            mfilepov << " location <" << camera_location.x() << "," << camera_location.y() << "," << camera_location.z()
-                     << "> \n"
-                     << " look_at <" << camera_aim.x() << "," << camera_aim.y() << "," << camera_aim.z() << "> \n"
-                     << " sky <" << camera_up.x() << "," << camera_up.y() << "," << camera_up.z() << "> \n";
-            mfilepov << "}\n\n\n";
-        }
+        if (this->camera_found_in_assets)
+            WriteCamera(mfilepov, camera_location, camera_aim, camera_up, camera_angle, camera_orthographic);
 
         // At the end of the .pov file, remember to close the .dat
         mfilepov << "\n\n#fclose MyDatFile \n";
@@ -988,5 +1033,475 @@ void ChPovRay::ExportData(const std::string& filename) {
     this->framenumber++;
 }
 
+// -----------------------------------------------------------------------------
+// Binary frames
+//
+// Layout of a .bin frame (native byte order, transforms stored as float32):
+//   char[8]   "CHPOVBIN"
+//   uint32    format version
+//   uint32    flags (show COGs, frames, links, contacts; camera found in assets)
+//   float32   size of the COG, frame and link symbols
+//   uint32    length of the custom POV commands, followed by their characters
+//   float32   camera location[3], aim[3], up[3], angle; uint32 orthographic
+//   uint32    number of bodies, then for each:
+//               uint64 object ID, float32 ref frame[7] (+ COG frame[7] if showing COGs)
+//   uint32    number of particle clusters, then for each:
+//               uint64 object ID, uint32 number of particles n, float32 particle frames[7 * n]
+//   uint32    number of link frame pairs, then for each: float32 frame1[7], frame2[7]
+//   uint32    number of contacts, then for each: float32 point[3], normal[3], force[3]
+// A frame is stored as position and rotation quaternion. Object IDs refer to the
+// obj_<ID> macros written in the asset file by ExportObjects(); they are assigned
+// in increasing order as objects are first exported and are never reused.
+// -----------------------------------------------------------------------------
+
+static const char binary_magic[8] = {'C', 'H', 'P', 'O', 'V', 'B', 'I', 'N'};
+static const uint32_t binary_version = 1;
+
+enum eChBinaryFlags : uint32_t {
+    BINARY_COGS = 1 << 0,
+    BINARY_FRAMES = 1 << 1,
+    BINARY_LINKS = 1 << 2,
+    BINARY_CONTACTS = 1 << 3,
+    BINARY_CAMERA = 1 << 4
+};
+
+static const size_t binary_csys_size = 7 * sizeof(float);
+
+template <typename T>
+static void BinaryPut(std::vector<char>& buf, T val) {
+    size_t pos = buf.size();
+    buf.resize(pos + sizeof(T));
+    std::memcpy(&buf[pos], &val, sizeof(T));
+}
+
+static void BinaryPutVector(std::vector<char>& buf, const ChVector<>& v) {
+    BinaryPut<float>(buf, (float)v.x());
+    BinaryPut<float>(buf, (float)v.y());
+    BinaryPut<float>(buf, (float)v.z());
+}
+
+static void BinaryPutCoordsys(char* dest, const ChCoordsys<>& csys) {
+    float vals[7] = {(float)csys.pos.x(), (float)csys.pos.y(), (float)csys.pos.z(), (float)csys.rot.e0(),
+                     (float)csys.rot.e1(), (float)csys.rot.e2(), (float)csys.rot.e3()};
+    std::memcpy(dest, vals, binary_csys_size);
+}
+
+template <typename T>
+static T BinaryGet(std::istream& file) {
+    T val;
+    if (!file.read(reinterpret_cast<char*>(&val), sizeof(T)))
+        throw ChException("Unexpected end of binary POV data");
+    return val;
+}
+
+static ChVector<> BinaryGetVector(std::istream& file) {
+    float vals[3];
+    for (int i = 0; i < 3; i++)
+        vals[i] = BinaryGet<float>(file);
+    return ChVector<>(vals[0], vals[1], vals[2]);
+}
+
+static ChCoordsys<> BinaryGetCoordsys(std::istream& file) {
+    float vals[7];
+    for (int i = 0; i < 7; i++)
+        vals[i] = BinaryGet<float>(file);
+    return ChCoordsys<>(ChVector<>(vals[0], vals[1], vals[2]), ChQuaternion<>(vals[3], vals[4], vals[5], vals[6]));
+}
+
+// Write a coordinate system as arguments of the sh_csysCOG/sh_csysFRM POV macros.
+static void WriteCoordsysArgs(ChStreamOutAsciiFile& mfilepov, const ChCoordsys<>& csys) {
+    mfilepov << csys.pos.x() << "," << csys.pos.y() << "," << csys.pos.z() << ",";
+    mfilepov << csys.rot.e0() << "," << csys.rot.e1() << "," << csys.rot.e2() << "," << csys.rot.e3() << ",";
+}
+
+void ChPovRay::_recurseFindCamera(std::vector<std::shared_ptr<ChAsset> >& assetlist, const ChFrame<>& parentframe) {
+    for (unsigned int k = 0; k < assetlist.size(); k++) {
+        std::shared_ptr<ChAsset> k_asset = assetlist[k];
+
+        if (auto mycamera = std::dynamic_pointer_cast<ChCamera>(k_asset)) {
+            this->camera_found_in_assets = true;
+
+            this->camera_location = mycamera->GetPosition() >> parentframe;
+            this->camera_aim = mycamera->GetAimPoint() >> parentframe;
+            this->camera_up = mycamera->GetUpVector() >> parentframe;
+            this->camera_angle = mycamera->GetAngle();
+            this->camera_orthographic = mycamera->GetOrthographic();
+        }
+
+        if (auto mylevel = std::dynamic_pointer_cast<ChAssetLevel>(k_asset)) {
+            _recurseFindCamera(mylevel->GetAssets(), mylevel->GetFrame() >> parentframe);
+        }
+    }
+}
+
+void ChPovRay::ExportObjects(ChStreamOutAsciiFile& assets_file) {
+    // Write a POV macro with the asset tree of each body or particle cluster that was
+    // not exported yet, so that binary frames only need to store the object transforms.
+    for (unsigned int i = 0; i < this->mdata.size(); i++) {
+        if (!std::dynamic_pointer_cast<ChBody>(mdata[i]) && !std::dynamic_pointer_cast<ChParticlesClones>(mdata[i]))
+            continue;
+
+        if (pov_objects.find(mdata[i].get()) != pov_objects.end())
+            continue;
+        size_t id = pov_next_object_id++;
+        pov_objects.insert({mdata[i].get(), {id, mdata[i]}});
+
+        assets_file << "#macro obj_" << id << "()\n";
+        ChFrame<> nullframe(CSYSNORM);
+        _recurseExportObjData(mdata[i]->GetAssets(), nullframe, assets_file);
+        assets_file << "#end \n";
+    }
+}
+
+void ChPovRay::ExportBinaryData(const std::string& filename) {
+    // Get a recycled frame buffer, waiting for the writer thread if too many frames are pending.
+    std::vector<char> buf;
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(binary_mutex);
+        if (!binary_writer.joinable()) {
+            binary_stop = false;
+            binary_writer = std::thread(&ChPovRay::BinaryWriterLoop, this);
+        }
+        binary_cv_free.wait(lock, [this]() { return binary_queue.size() < binary_max_pending; });
+        if (!binary_free.empty()) {
+            buf = std::move(binary_free.back());
+            binary_free.pop_back();
+        }
+        std::swap(exception, binary_exception);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+
+    buf.clear();
+
+    // Collect the objects to save
+    std::vector<std::pair<size_t, ChBody*> > bodies;
+    std::vector<std::pair<size_t, ChParticlesClones*> > clusters;
+    std::vector<ChLinkMateGeneric*> links;
+
+    this->camera_found_in_assets = false;
+
+    for (unsigned int i = 0; i < this->mdata.size(); i++) {
+        if (auto mybody = std::dynamic_pointer_cast<ChBody>(mdata[i])) {
+            bodies.push_back({pov_objects.at(mdata[i].get()).id, mybody.get()});
+            _recurseFindCamera(mdata[i]->GetAssets(), mybody->GetFrame_REF_to_abs());
+        }
+        if (auto myclones = std::dynamic_pointer_cast<ChParticlesClones>(mdata[i])) {
+            clusters.push_back({pov_objects.at(mdata[i].get()).id, myclones.get()});
+        }
+        if (auto mylinkmate = std::dynamic_pointer_cast<ChLinkMateGeneric>(mdata[i])) {
+            if (mylinkmate->GetBody1() && mylinkmate->GetBody2() && this->links_show)
+                links.push_back(mylinkmate.get());
+        }
+    }
+
+    // Header
+    uint32_t flags = (COGs_show ? BINARY_COGS : 0) | (frames_show ? BINARY_FRAMES : 0) |
+                     (links_show ? BINARY_LINKS : 0) | (contacts_show ? BINARY_CONTACTS : 0) |
+                     (camera_found_in_assets ? BINARY_CAMERA : 0);
+
+    buf.insert(buf.end(), binary_magic, binary_magic + 8);
+    BinaryPut<uint32_t>(buf, binary_version);
+    BinaryPut<uint32_t>(buf, flags);
+    BinaryPut<float>(buf, (float)COGs_size);
+    BinaryPut<float>(buf, (float)frames_size);
+    BinaryPut<float>(buf, (float)links_size);
+    BinaryPut<uint32_t>(buf, (uint32_t)custom_data.size());
+    buf.insert(buf.end(), custom_data.begin(), custom_data.end());
+    BinaryPutVector(buf, camera_location);
+    BinaryPutVector(buf, camera_aim);
+    BinaryPutVector(buf, camera_up);
+    BinaryPut<float>(buf, (float)camera_angle);
+    BinaryPut<uint32_t>(buf, camera_orthographic ? 1 : 0);
+
+    // Bodies: fixed-size records, filled in parallel
+    size_t body_size = sizeof(uint64_t) + (COGs_show ? 2 : 1) * binary_csys_size;
+    BinaryPut<uint32_t>(buf, (uint32_t)bodies.size());
+    size_t offset = buf.size();
+    buf.resize(offset + bodies.size() * body_size);
+    char* bodydata = buf.data() + offset;
+#pragma omp parallel for
+    for (int i = 0; i < (int)bodies.size(); i++) {
+        char* dest = bodydata + i * body_size;
+        uint64_t id = bodies[i].first;
+        std::memcpy(dest, &id, sizeof(uint64_t));
+        BinaryPutCoordsys(dest + sizeof(uint64_t), bodies[i].second->GetFrame_REF_to_abs().GetCoord());
+        if (COGs_show)
+            BinaryPutCoordsys(dest + sizeof(uint64_t) + binary_csys_size,
+                              bodies[i].second->GetFrame_COG_to_abs().GetCoord());
+    }
+
+    // Particle clusters: particle frames filled in parallel
+    BinaryPut<uint32_t>(buf, (uint32_t)clusters.size());
+    for (auto& cluster : clusters) {
+        ChParticlesClones* myclones = cluster.second;
+        int n = (int)myclones->GetNparticles();
+        BinaryPut<uint64_t>(buf, cluster.first);
+        BinaryPut<uint32_t>(buf, (uint32_t)n);
+        size_t offset = buf.size();
+        buf.resize(offset + n * binary_csys_size);
+        char* particledata = buf.data() + offset;
+#pragma omp parallel for
+        for (int m = 0; m < n; m++)
+            BinaryPutCoordsys(particledata + m * binary_csys_size, myclones->GetParticle(m).GetCoord());
+    }
+
+    // Link frames
+    BinaryPut<uint32_t>(buf, (uint32_t)links.size());
+    for (auto mylinkmate : links) {
+        ChFrame<> frAabs = mylinkmate->GetFrame1() >> *mylinkmate->GetBody1();
+        ChFrame<> frBabs = mylinkmate->GetFrame2() >> *mylinkmate->GetBody2();
+        size_t offset = buf.size();
+        buf.resize(offset + 2 * binary_csys_size);
+        BinaryPutCoordsys(buf.data() + offset, frAabs.GetCoord());
+        BinaryPutCoordsys(buf.data() + offset + binary_csys_size, frBabs.GetCoord());
+    }
+
+    // Contacts (the number of contacts is known only after the scan)
+    size_t count_offset = buf.size();
+    BinaryPut<uint32_t>(buf, 0);
+    if (this->contacts_show) {
+        class _reporter_class : public ChContactContainer::ReportContactCallback {
+          public:
+            virtual bool OnReportContact(const ChVector<>& pA,
+                                         const ChVector<>& pB,
+                                         const ChMatrix33<>& plane_coord,
+                                         const double& distance,
+                                         const double& eff_radius,
+                                         const ChVector<>& react_forces,
+                                         const ChVector<>& react_torques,
+                                         ChContactable* contactobjA,
+                                         ChContactable* contactobjB) override {
+                if (fabs(react_forces.x()) > 1e-8 || fabs(react_forces.y()) > 1e-8 || fabs(react_forces.z()) > 1e-8) {
+                    ChMatrix33<> localmatr(plane_coord);
+                    BinaryPutVector(*mbuf, pA);
+                    BinaryPutVector(*mbuf, localmatr.Get_A_Xaxis());
+                    BinaryPutVector(*mbuf, localmatr * react_forces);
+                    count++;
+                }
+                return true;  // to continue scanning contacts
+            }
+            // Data
+            std::vector<char>* mbuf;
+            uint32_t count;
+        };
+
+        _reporter_class my_contact_reporter;
+        my_contact_reporter.mbuf = &buf;
+        my_contact_reporter.count = 0;
+
+        this->mSystem->GetContactContainer()->ReportAllContacts(&my_contact_reporter);
+        std::memcpy(&buf[count_offset], &my_contact_reporter.count, sizeof(uint32_t));
+    }
+
+    // Hand the frame to the writer thread
+    {
+        std::lock_guard<std::mutex> lock(binary_mutex);
+        binary_queue.emplace_back(filename + ".bin", std::move(buf));
+    }
+    binary_cv_full.notify_one();
+}
+
+void ChPovRay::BinaryWriterLoop() {
+    while (true) {
+        std::pair<std::string, std::vector<char> >* frame;
+        {
+            std::unique_lock<std::mutex> lock(binary_mutex);
+            binary_cv_full.wait(lock, [this]() { return binary_stop || !binary_queue.empty(); });
+            if (binary_queue.empty())
+                return;
+            // references to deque elements stay valid while other frames are appended
+            frame = &binary_queue.front();
+        }
+
+        try {
+            std::ofstream file(frame->first, std::ios::binary);
+            file.write(frame->second.data(), frame->second.size());
+            if (!file)
+                throw ChException("Can't save data into file " + frame->first);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(binary_mutex);
+            if (!binary_exception)
+                binary_exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(binary_mutex);
+            binary_free.push_back(std::move(frame->second));
+            binary_queue.pop_front();
+        }
+        binary_cv_free.notify_all();
+    }
+}
+
+void ChPovRay::Flush() {
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(binary_mutex);
+        binary_cv_free.wait(lock, [this]() { return binary_queue.empty(); });
+        std::swap(exception, binary_exception);
+    }
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void ChPovRay::StopBinaryWriter() {
+    if (!binary_writer.joinable())
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(binary_mutex);
+        binary_stop = true;
+    }
+    binary_cv_full.notify_one();
+    binary_writer.join();
+}
+
+void ChPovRay::ConvertBinaryData(const std::string& filename) {
+    std::string pathbin = filename + ".bin";
+    std::ifstream file(pathbin, std::ios::binary);
+    if (!file)
+        throw ChException("Can't open binary data file " + pathbin);
+
+    char magic[8];
+    if (!file.read(magic, 8) || std::memcmp(magic, binary_magic, 8) != 0 ||
+        BinaryGet<uint32_t>(file) != binary_version)
+        throw ChException("Invalid binary POV data file " + pathbin);
+
+    uint32_t flags = BinaryGet<uint32_t>(file);
+    double cogs_size = BinaryGet<float>(file);
+    double frames_size = BinaryGet<float>(file);
+    double links_size = BinaryGet<float>(file);
+    std::string custom_data(BinaryGet<uint32_t>(file), ' ');
+    if (!custom_data.empty() && !file.read(&custom_data[0], custom_data.size()))
+        throw ChException("Unexpected end of binary POV data");
+    ChVector<> camera_location = BinaryGetVector(file);
+    ChVector<> camera_aim = BinaryGetVector(file);
+    ChVector<> camera_up = BinaryGetVector(file);
+    double camera_angle = BinaryGet<float>(file);
+    bool camera_orthographic = BinaryGet<uint32_t>(file) != 0;
+
+    // Generate the nnnn.dat and nnnn.pov files, as ExportData() in text mode
+    std::string pathdat = filename + ".dat";
+    ChStreamOutAsciiFile mfiledat(pathdat.c_str());
+
+    std::string pathpov = filename + ".pov";
+    ChStreamOutAsciiFile mfilepov(pathpov.c_str());
+
+    if (custom_data.size() > 0) {
+        mfilepov << "// Custom user-added script: \n\n";
+        mfilepov << custom_data;
+        mfilepov << "\n\n";
+    }
+
+    mfilepov << "#declare dat_file = \"" << pathdat.c_str() << "\"\n";
+    mfilepov << "#fopen MyDatFile dat_file read \n\n";
+
+    uint32_t num_bodies = BinaryGet<uint32_t>(file);
+    for (uint32_t i = 0; i < num_bodies; i++) {
+        size_t id = (size_t)BinaryGet<uint64_t>(file);
+        ChCoordsys<> csys = BinaryGetCoordsys(file);
+
+        mfilepov << "union{\n";
+        mfilepov << "obj_" << id << "()\n";
+        mfilepov << " quatRotation(<" << csys.rot.e0() << "," << csys.rot.e1() << "," << csys.rot.e2() << ","
+                 << csys.rot.e3() << ">) \n";
+        mfilepov << " translate  <" << csys.pos.x() << "," << csys.pos.y() << "," << csys.pos.z() << "> \n";
+        mfilepov << "}\n";
+
+        if (flags & BINARY_COGS) {
+            ChCoordsys<> cogcsys = BinaryGetCoordsys(file);
+            mfilepov << "sh_csysCOG(";
+            WriteCoordsysArgs(mfilepov, cogcsys);
+            mfilepov << cogs_size << ")\n";
+        }
+        if (flags & BINARY_FRAMES) {
+            mfilepov << "sh_csysFRM(";
+            WriteCoordsysArgs(mfilepov, csys);
+            mfilepov << frames_size << ")\n";
+        }
+    }
+
+    uint32_t num_clusters = BinaryGet<uint32_t>(file);
+    for (uint32_t i = 0; i < num_clusters; i++) {
+        size_t id = (size_t)BinaryGet<uint64_t>(file);
+        uint32_t num_particles = BinaryGet<uint32_t>(file);
+
+        mfilepov << " \n";
+        mfilepov << "#declare Index = 0; \n";
+        mfilepov << "#while(Index < " << num_particles << ") \n";
+        mfilepov << "  #read (MyDatFile, apx, apy, apz, aq0, aq1, aq2, aq3) \n";
+        mfilepov << "  union{\n";
+        mfilepov << "obj_" << id << "()\n";
+        mfilepov << "  quatRotation(<aq0,aq1,aq2,aq3>)\n";
+        mfilepov << "  translate(<apx,apy,apz>)\n";
+        mfilepov << "  }\n";
+        mfilepov << "  #declare Index = Index + 1; \n";
+        mfilepov << "#end \n";
+
+        for (uint32_t m = 0; m < num_particles; m++) {
+            ChCoordsys<> csys = BinaryGetCoordsys(file);
+            mfiledat << csys.pos.x() << ", ";
+            mfiledat << csys.pos.y() << ", ";
+            mfiledat << csys.pos.z() << ", ";
+            mfiledat << csys.rot.e0() << ", ";
+            mfiledat << csys.rot.e1() << ", ";
+            mfiledat << csys.rot.e2() << ", ";
+            mfiledat << csys.rot.e3() << ", \n";
+        }
+    }
+
+    uint32_t num_links = BinaryGet<uint32_t>(file);
+    for (uint32_t i = 0; i < num_links; i++) {
+        ChCoordsys<> frAabs = BinaryGetCoordsys(file);
+        ChCoordsys<> frBabs = BinaryGetCoordsys(file);
+        mfilepov << "sh_csysFRM(";
+        WriteCoordsysArgs(mfilepov, frAabs);
+        mfilepov << links_size * 0.7 << ")\n";  // smaller, as 'slave' csys.
+        mfilepov << "sh_csysFRM(";
+        WriteCoordsysArgs(mfilepov, frBabs);
+        mfilepov << links_size << ")\n";
+    }
+
+    uint32_t num_contacts = BinaryGet<uint32_t>(file);
+    if (flags & BINARY_CONTACTS) {
+        std::string pathcontacts = filename + ".contacts";
+        ChStreamOutAsciiFile data_contacts(pathcontacts.c_str());
+        for (uint32_t i = 0; i < num_contacts; i++) {
+            for (int j = 0; j < 9; j++)
+                data_contacts << (double)BinaryGet<float>(file) << ", ";
+            data_contacts << "\n";
+        }
+    }
+
+    if (flags & BINARY_CAMERA)
+        WriteCamera(mfilepov, camera_location, camera_aim, camera_up, camera_angle, camera_orthographic);
+
+    mfilepov << "\n\n#fclose MyDatFile \n";
+}
+
+void ChPovRay::ConvertBinaryData(const std::string& filebase, unsigned int first_frame, unsigned int last_frame) {
+    std::string error;
+
+#pragma omp parallel for schedule(dynamic)
+    for (int i = (int)first_frame; i <= (int)last_frame; i++) {
+        char number[20];
+        sprintf(number, "%05d", i);
+        try {
+            ConvertBinaryData(filebase + number);
+        } catch (const std::exception& e) {
+#pragma omp critical(ChPovRay_convert)
+            {
+                if (error.empty())
+                    error = e.what();
+            }
+        }
+    }
+
+    if (!error.empty())
+        throw ChException(error);
+}
+
 }  // end namespace postprocess
 }  // end namespace chrono
@@ -15,10 +15,16 @@
 #ifndef CHPOVRAY_H
 #define CHPOVRAY_H
 
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_map>
+#include <vector>
 
 #include "chrono/assets/ChVisualization.h"
 #include "chrono/physics/ChSystem.h"
@@ -38,7 +44,7 @@ namespace postprocess {
 class ChApiPostProcess ChPovRay : public ChPostProcessBase {
   public:
     ChPovRay(ChSystem* system);
-    virtual ~ChPovRay() {}
+    virtual ~ChPovRay();
 
     enum eChContactSymbol {  // used for displaying contacts
         SYMBOL_VECTOR_SCALELENGTH = 0,
@@ -203,6 +209,31 @@ class ChApiPostProcess ChPovRay : public ChPostProcessBase {
         this->single_asset_file = muse;
     }
 
+    /// Set if ExportData() must write compact binary frames instead of the POV scripts.
+    /// In binary mode, ExportData() writes a single state0001.bin, state0002.bin, etc. file per frame, with the
+    /// transforms of bodies and particles, the link frames and the contact glyphs stored as float32 values.
+    /// The per-object data is collected in parallel and the files are written by a background thread, so
+    /// the simulation loop waits only if more than 'max_pending' frames are queued for writing.
+    /// The shapes of the objects are always written to the single asset file (see SetUseSingleAssetFile).
+    /// Before rendering, the binary frames must be converted to POV data with ConvertBinaryData().
+    void SetUseBinaryData(bool muse, unsigned int max_pending = 8) {
+        this->binary_data = muse;
+        this->binary_max_pending = (max_pending > 0) ? max_pending : 1;
+    }
+
+    /// Wait until all binary frames queued by ExportData() are written to disk.
+    /// Rethrows the first error encountered by the writer thread, if any.
+    void Flush();
+
+    /// Convert a binary frame written by ExportData() in binary mode (ex. "state00001", without the .bin
+    /// suffix) into the .pov, .dat and .contacts files that are loaded by the POV script.
+    /// This does not need the ChSystem, so it can be run offline, after the simulation.
+    static void ConvertBinaryData(const std::string& filename);
+
+    /// Convert a range of binary frames (with numbers from first_frame to last_frame, both included)
+    /// written with the given data filebase (see SetOutputDataFilebase). Frames are converted in parallel.
+    static void ConvertBinaryData(const std::string& filebase, unsigned int first_frame, unsigned int last_frame);
+
   protected:
     virtual void SetupLists();
     virtual void ExportAssets(ChStreamOutAsciiFile& assets_file);
@@ -211,9 +242,23 @@ class ChApiPostProcess ChPovRay : public ChPostProcessBase {
     void _recurseExportObjData(std::vector<std::shared_ptr<ChAsset> >& assetlist,
                                ChFrame<> parentframe,
                                ChStreamOutAsciiFile& mfilepov);
+    void _recurseFindCamera(std::vector<std::shared_ptr<ChAsset> >& assetlist, const ChFrame<>& parentframe);
+
+    virtual void ExportObjects(ChStreamOutAsciiFile& assets_file);
+    virtual void ExportBinaryData(const std::string& filename);
+
+    void BinaryWriterLoop();
+    void StopBinaryWriter();
 
     std::vector<std::shared_ptr<ChPhysicsItem> > mdata;
     std::unordered_map<size_t, std::shared_ptr<ChAsset> > pov_assets;
+    /// Item whose POV macro was exported in binary mode, with the ID of its obj_<ID> macro.
+    struct PovObject {
+        size_t id;
+        std::shared_ptr<ChPhysicsItem> item;
+    };
+    std::unordered_map<ChPhysicsItem*, PovObject> pov_objects;
+    size_t pov_next_object_id;  ///< ID of the next exported item (IDs are never reused)
 
     std::string template_filename;
     std::string pic_filename;
@@ -262,6 +307,17 @@ class ChApiPostProcess ChPovRay : public ChPostProcessBase {
     std::string custom_data;
 
     bool single_asset_file;
+
+    bool binary_data;
+    unsigned int binary_max_pending;
+    std::deque<std::pair<std::string, std::vector<char> > > binary_queue;  ///< frames waiting to be written
+    std::vector<std::vector<char> > binary_free;                          ///< recycled frame buffers
+    std::thread binary_writer;
+    std::mutex binary_mutex;
+    std::condition_variable binary_cv_full;
+    std::condition_variable binary_cv_free;
+    bool binary_stop;
+    std::exception_ptr binary_exception;
 };
 
 }  // end namespace postprocess
@@ -86,7 +86,8 @@ ChVehicle::~ChVehicle() {
 void ChVehicle::SetOutput(ChVehicleOutput::Type type,
                           const std::string& out_dir,
                           const std::string& out_name,
-                          double output_step) {
+                          double output_step,
+                          int compression) {
     m_output = true;
     m_output_step = output_step;
 
@@ -99,7 +100,7 @@ void ChVehicle::SetOutput(ChVehicleOutput::Type type,
             break;
         case ChVehicleOutput::HDF5:
 #ifdef CHRONO_HAS_HDF5
-            m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5");
+            m_output_db = new ChVehicleOutputHDF5(out_dir + "/" + out_name + ".h5", compression);
 #endif
             break;
     }
@@ -118,7 +118,8 @@ class CH_VEHICLE_API ChVehicle {
     void SetOutput(ChVehicleOutput::Type type,   ///< [int] type of ooutput DB
                    const std::string& out_dir,   ///< [in] output directory name
                    const std::string& out_name,  ///< [in] rootname of output file
-                   double output_step            ///< [in] interval between output times
+                   double output_step,           ///< [in] interval between output times
+                   int compression = 0           ///< [in] compression level (HDF5 only; 0: none, 1-9: deflate)
     );
 
     /// Initialize this vehicle at the specified global location and orientation.
@@ -16,6 +16,21 @@
 //
 // =============================================================================
 
+#include <sys/stat.h>
+#include <algorithm>
+#include <cctype>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <unordered_map>
+
+#include "chrono/core/ChException.h"
 #include "chrono/physics/ChGlobal.h"
 #include "chrono_vehicle/ChVehicleModelData.h"
 
@@ -41,5 +56,299 @@ std::string GetDataFile(const std::string& filename) {
     return chrono_vehicle_data_path + filename;
 }
 
+// -----------------------------------------------------------------------------
+// Cache of parsed data files
+// -----------------------------------------------------------------------------
+
+namespace {
+
+// Modification time (in nanoseconds, where the platform provides it) and size of a file; a cached file is reloaded if
+// either changed.
+struct FileStamp {
+    FileStamp() : exists(false), mtime(0), size(0) {}
+    bool operator==(const FileStamp& other) const {
+        return exists == other.exists && mtime == other.mtime && size == other.size;
+    }
+
+    bool exists;
+    long long mtime;
+    long long size;
+};
+
+FileStamp GetFileStamp(const std::string& filename) {
+    FileStamp stamp;
+    struct stat info;
+    if (stat(filename.c_str(), &info) == 0) {
+        stamp.exists = true;
+#if defined(__APPLE__)
+        stamp.mtime = info.st_mtimespec.tv_sec * 1000000000LL + info.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+        stamp.mtime = static_cast<long long>(info.st_mtime) * 1000000000LL;
+#else
+        stamp.mtime = info.st_mtim.tv_sec * 1000000000LL + info.st_mtim.tv_nsec;
+#endif
+        stamp.size = static_cast<long long>(info.st_size);
+    }
+    return stamp;
+}
+
+bool HasExtension(const std::string& filename, const std::string& ext) {
+    if (filename.size() < ext.size())
+        return false;
+    return std::equal(ext.begin(), ext.end(), filename.end() - ext.size(),
+                      [](char a, char b) { return a == std::tolower(static_cast<unsigned char>(b)); });
+}
+
+bool IsJSONFile(const std::string& filename) {
+    return HasExtension(filename, ".json");
+}
+
+bool IsBinaryMeshFile(const std::string& filename) {
+    return HasExtension(filename, ".chmesh");
+}
+
+bool IsMeshFile(const std::string& filename) {
+    return HasExtension(filename, ".obj") || IsBinaryMeshFile(filename);
+}
+
+// Name of the binary mesh file corresponding to the given OBJ file.
+std::string GetBinaryMeshFile(const std::string& filename) {
+    size_t dot = filename.find_last_of('.');
+    size_t sep = filename.find_last_of("/\\");
+    if (dot == std::string::npos || (sep != std::string::npos && dot < sep))
+        return filename + ".chmesh";
+    return filename.substr(0, dot) + ".chmesh";
+}
+
+// Thread-safe cache of items loaded from files, keyed by a string (typically the file path) and validated with the
+// file stamp. Concurrent requests for the same key wait for a single load. Failed loads are not cached.
+template <typename T>
+class FileCache {
+  public:
+    typedef std::shared_ptr<T> Item;
+
+    Item Get(const std::string& key, const FileStamp& stamp, const std::function<Item()>& load) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        auto it = m_entries.find(key);
+        if (it != m_entries.end() && it->second.stamp == stamp) {
+            auto future = it->second.item;
+            lock.unlock();
+            return future.get();
+        }
+
+        std::promise<Item> promise;
+        Entry& entry = m_entries[key];
+        entry.stamp = stamp;
+        entry.item = promise.get_future().share();
+        entry.id = ++m_num_loads;
+        auto id = entry.id;
+        lock.unlock();
+
+        try {
+            Item item = load();
+            promise.set_value(item);
+            return item;
+        } catch (...) {
+            promise.set_exception(std::current_exception());
+            lock.lock();
+            auto it = m_entries.find(key);
+            if (it != m_entries.end() && it->second.id == id)
+                m_entries.erase(it);
+            throw;
+        }
+    }
+
+    void Clear() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_entries.clear();
+    }
+
+  private:
+    struct Entry {
+        FileStamp stamp;                ///< stamp of the file when loaded
+        std::shared_future<Item> item;  ///< loaded (or being loaded) item
+        size_t id;                      ///< load identifier
+    };
+
+    std::unordered_map<std::string, Entry> m_entries;
+    size_t m_num_loads = 0;
+    std::mutex m_mutex;
+};
+
+FileCache<rapidjson::Document> json_cache;
+FileCache<geometry::ChTriangleMeshConnected> mesh_cache;
+
+// Collect the names of the existing data files referenced by string values in the given JSON value.
+void CollectReferences(const rapidjson::Value& v, bool meshes, std::vector<std::string>& files) {
+    if (v.IsString()) {
+        std::string name = v.GetString();
+        if (IsJSONFile(name) || (meshes && IsMeshFile(name))) {
+            std::string filename = GetDataFile(name);
+            if (GetFileStamp(filename).exists)
+                files.push_back(filename);
+        }
+    } else if (v.IsObject()) {
+        for (auto m = v.MemberBegin(); m != v.MemberEnd(); ++m)
+            CollectReferences(m->value, meshes, files);
+    } else if (v.IsArray()) {
+        for (auto e = v.Begin(); e != v.End(); ++e)
+            CollectReferences(*e, meshes, files);
+    }
+}
+
+}  // end anonymous namespace
+
+std::shared_ptr<const rapidjson::Document> ReadFileJSON(const std::string& filename) {
+    FileStamp stamp = GetFileStamp(filename);
+    if (!stamp.exists)
+        throw ChException("Cannot open JSON file " + filename);
+
+    return json_cache.Get(filename, stamp, [&filename]() {
+        std::ifstream stream(filename, std::ios::in | std::ios::binary);
+        std::string buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+
+        auto d = std::make_shared<rapidjson::Document>();
+        d->Parse<rapidjson::ParseFlag::kParseCommentsFlag>(buffer.c_str());
+        if (d->HasParseError())
+            throw ChException("Error parsing JSON file " + filename + " at offset " +
+                              std::to_string(d->GetErrorOffset()));
+        return d;
+    });
+}
+
+std::shared_ptr<const geometry::ChTriangleMeshConnected> LoadMeshFile(const std::string& filename,
+                                                                      bool load_normals,
+                                                                      bool load_uv) {
+    // Use the pre-baked binary mesh if it was baked from the current OBJ file. The modification time and size
+    // of the OBJ file recorded when baking must match exactly (a time comparison alone would miss an OBJ file
+    // modified within the timestamp resolution of the baked file).
+    std::string source = filename;
+    FileStamp stamp = GetFileStamp(filename);
+    if (!IsBinaryMeshFile(filename)) {
+        std::string baked = GetBinaryMeshFile(filename);
+        FileStamp baked_stamp = GetFileStamp(baked);
+        if (baked_stamp.exists) {
+            int64_t source_time = 0;
+            int64_t source_size = 0;
+            try {
+                geometry::ChTriangleMeshConnected::ReadBinaryMeshSource(baked, source_time, source_size);
+            } catch (const ChException&) {
+                baked_stamp.exists = false;
+            }
+            if (baked_stamp.exists &&
+                (!stamp.exists || (source_time == stamp.mtime && source_size == stamp.size))) {
+                source = baked;
+                stamp = baked_stamp;
+            }
+        }
+    }
+    if (!stamp.exists)
+        throw ChException("Cannot open mesh file " + filename);
+
+    // The complete mesh (with normals and UV coordinates) is loaded once...
+    auto mesh = mesh_cache.Get(source, stamp, [&]() {
+        auto m = std::make_shared<geometry::ChTriangleMeshConnected>();
+        if (IsBinaryMeshFile(source))
+            m->LoadBinaryMesh(source);
+        else
+            m->LoadWavefrontMesh(source, true, true);
+        m->m_filename = filename;
+        return m;
+    });
+    if (load_normals && load_uv)
+        return mesh;
+
+    // ...and copies without normals and/or UV coordinates are derived from it.
+    std::string key = source + "#" + std::to_string(load_normals) + std::to_string(load_uv);
+    return mesh_cache.Get(key, stamp, [&]() {
+        auto m = std::make_shared<geometry::ChTriangleMeshConnected>(*mesh);
+        m->m_filename = mesh->m_filename;
+        if (!load_normals) {
+            m->m_normals.clear();
+            m->m_face_n_indices.clear();
+        }
+        if (!load_uv) {
+            m->m_UV.clear();
+            m->m_face_uv_indices.clear();
+        }
+        return m;
+    });
+}
+
+std::string BakeMeshFile(const std::string& filename) {
+    FileStamp stamp = GetFileStamp(filename);
+    geometry::ChTriangleMeshConnected mesh;
+    mesh.LoadWavefrontMesh(filename, true, true);
+    std::string baked = GetBinaryMeshFile(filename);
+    mesh.SaveBinaryMesh(baked, stamp.mtime, stamp.size);
+    return baked;
+}
+
+void PrefetchDataFiles(const std::vector<std::string>& filenames, bool load_meshes, int num_threads) {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::string> queue;  // files waiting to be loaded
+    std::set<std::string> queued;   // all files queued so far
+    int pending = 0;                // files queued or being loaded
+
+    auto enqueue = [&](const std::string& filename) {
+        if (queued.insert(filename).second) {
+            queue.push_back(filename);
+            pending++;
+        }
+    };
+
+    for (const auto& filename : filenames)
+        enqueue(filename);
+
+    // Each worker loads one file at a time and queues the files referenced by the JSON documents it parsed,
+    // until no file is left pending.
+    auto worker = [&]() {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            cv.wait(lock, [&]() { return !queue.empty() || pending == 0; });
+            if (queue.empty())
+                return;
+            std::string filename = queue.front();
+            queue.pop_front();
+            lock.unlock();
+
+            std::vector<std::string> references;
+            try {
+                if (IsJSONFile(filename))
+                    CollectReferences(*ReadFileJSON(filename), load_meshes, references);
+                else if (IsMeshFile(filename))
+                    LoadMeshFile(filename, true, true);
+            } catch (...) {
+            }
+
+            lock.lock();
+            for (const auto& reference : references)
+                enqueue(reference);
+            pending--;
+            cv.notify_all();
+        }
+    };
+
+    if (num_threads < 1)
+        num_threads = std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+
+    if (num_threads == 1) {
+        worker();
+        return;
+    }
+
+    std::vector<std::thread> workers;
+    for (int i = 0; i < num_threads; i++)
+        workers.push_back(std::thread(worker));
+    for (auto& w : workers)
+        w.join();
+}
+
+void ClearDataCache() {
+    json_cache.Clear();
+    mesh_cache.Clear();
+}
+
 }  // end namespace vehicle
 }  // end namespace chrono
@@ -19,9 +19,14 @@
 #ifndef CH_VEHICLE_MODELDATA_H
 #define CH_VEHICLE_MODELDATA_H
 
+#include <memory>
 #include <string>
+#include <vector>
+
+#include "chrono/geometry/ChTriangleMeshConnected.h"
 
 #include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_thirdparty/rapidjson/document.h"
 
 namespace chrono {
 namespace vehicle {
@@ -40,6 +45,41 @@ CH_VEHICLE_API const std::string& GetDataPath();
 /// data directory.
 CH_VEHICLE_API std::string GetDataFile(const std::string& filename);
 
+/// Read and parse the specified JSON file (thread safe).
+/// Parsed documents are cached by file path and checked against the file modification time and size, so that a
+/// specification file shared by many subsystems or vehicles is parsed only once (and again only if it changed).
+/// Concurrent requests for the same file wait for a single parse. The returned document is shared and must not be
+/// modified. An exception is thrown if the file does not exist or cannot be parsed.
+CH_VEHICLE_API std::shared_ptr<const rapidjson::Document> ReadFileJSON(const std::string& filename);
+
+/// Load the specified triangle mesh file (thread safe).
+/// Both Wavefront OBJ files and pre-baked binary mesh files (extension .chmesh, see BakeMeshFile) are accepted. For
+/// an OBJ file, a binary mesh file with the same name and the .chmesh extension is loaded instead if it exists and was
+/// baked from the current OBJ file (same modification time and size). Meshes are cached like JSON documents (see
+/// ReadFileJSON); the returned mesh is shared (e.g. by the visualization assets of all vehicles using it) and cannot
+/// be modified.
+CH_VEHICLE_API std::shared_ptr<const geometry::ChTriangleMeshConnected> LoadMeshFile(const std::string& filename,
+                                                                                     bool load_normals = true,
+                                                                                     bool load_uv = false);
+
+/// Convert the specified Wavefront OBJ file into a binary mesh file, written next to it with the .chmesh extension.
+/// Return the name of the binary mesh file; LoadMeshFile will use it for the given OBJ file until the latter changes.
+CH_VEHICLE_API std::string BakeMeshFile(const std::string& filename);
+
+/// Load concurrently the specified JSON and mesh files, as well as all data files they reference (directly or
+/// through other JSON files), into the cache used by ReadFileJSON and LoadMeshFile.
+/// References are JSON string values naming existing files relative to the data directory. Meshes are loaded only
+/// if load_meshes is true. If num_threads is not positive, the number of available processors is used; with a
+/// single thread, the files are loaded on the calling thread.
+/// Errors are ignored here; they are reported when the file is actually read.
+CH_VEHICLE_API void PrefetchDataFiles(const std::vector<std::string>& filenames,
+                                      bool load_meshes = true,
+                                      int num_threads = 0);
+
+/// Remove all JSON documents and meshes from the data file cache.
+/// Documents and meshes still in use are kept alive by their users.
+CH_VEHICLE_API void ClearDataCache();
+
 /// @} vehicle
 
 }  // end namespace vehicle
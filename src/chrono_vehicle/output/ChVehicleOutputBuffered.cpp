@@ -0,0 +1,294 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Base class for a vehicle output database written asynchronously.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <initializer_list>
+
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
+
+namespace chrono {
+namespace vehicle {
+
+// -----------------------------------------------------------------------------
+// Names of the output quantities for each type of component
+// -----------------------------------------------------------------------------
+
+static const std::vector<std::string> body_columns = {"x", "y", "z", "e0", "e1", "e2", "e3"};
+static const std::vector<std::string> marker_columns = {"x", "y", "z", "xd", "yd", "zd", "xdd", "ydd", "zdd"};
+static const std::vector<std::string> shaft_columns = {"x", "xd", "xdd", "torque"};
+static const std::vector<std::string> joint_columns = {"Fx", "Fy", "Fz", "Tx", "Ty", "Tz"};
+static const std::vector<std::string> couple_columns = {"x", "xd", "xdd", "torque1", "torque2"};
+static const std::vector<std::string> linspring_columns = {"x", "xd", "force"};
+static const std::vector<std::string> rotspring_columns = {"x", "xd", "torque"};
+static const std::vector<std::string> bodyload_columns = {"Fx", "Fy", "Fz", "Tx", "Ty", "Tz"};
+
+// Set the identifier and the output quantities of the i-th component in a table.
+static void SetItem(ChVehicleOutputBuffered::Table& table, size_t i, int id, std::initializer_list<double> vals) {
+    size_t n = table.ids.size();
+    table.ids[i] = id;
+    size_t c = 0;
+    for (auto val : vals)
+        table.values[(c++) * n + i] = val;
+}
+
+// -----------------------------------------------------------------------------
+
+ChVehicleOutputBuffered::ChVehicleOutputBuffered(int buffer_size)
+    : m_frames(std::max(buffer_size, 2)), m_head(0), m_count(0), m_current(nullptr), m_busy(false), m_stop(false) {
+    for (auto& frame : m_frames)
+        frame.num_tables = 0;
+    m_writer = std::thread(&ChVehicleOutputBuffered::WriterLoop, this);
+}
+
+ChVehicleOutputBuffered::~ChVehicleOutputBuffered() {
+    // Derived classes should have stopped the writer already; if not, pending frames are discarded.
+    if (m_writer.joinable()) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_free.wait(lock, [this]() { return !m_busy; });
+            m_count = 0;
+            m_stop = true;
+        }
+        m_cv_full.notify_one();
+        m_writer.join();
+    }
+}
+
+void ChVehicleOutputBuffered::StopWriter() {
+    if (!m_writer.joinable())
+        return;
+
+    CommitFrame();
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_full.notify_one();
+    m_writer.join();
+}
+
+void ChVehicleOutputBuffered::Flush() {
+    CommitFrame();
+
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_free.wait(lock, [this]() { return m_count == 0; });
+        std::swap(exception, m_exception);
+    }
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void ChVehicleOutputBuffered::CommitFrame() {
+    if (!m_current)
+        return;
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_count++;
+    }
+    m_cv_full.notify_one();
+    m_current = nullptr;
+}
+
+void ChVehicleOutputBuffered::WriterLoop() {
+    while (true) {
+        Frame* frame;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_full.wait(lock, [this]() { return m_stop || m_count > 0; });
+            if (m_count == 0)
+                return;
+            frame = &m_frames[m_head];
+            m_busy = true;
+        }
+
+        try {
+            WriteFrame(*frame);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+                m_exception = std::current_exception();
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_head = (m_head + 1) % m_frames.size();
+            m_count--;
+            m_busy = false;
+        }
+        m_cv_free.notify_one();
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChVehicleOutputBuffered::WriteTime(int frame, double time) {
+    CommitFrame();
+
+    // Wait for a free slot in the ring buffer
+    std::exception_ptr exception;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_free.wait(lock, [this]() { return m_count < m_frames.size(); });
+        m_current = &m_frames[(m_head + m_count) % m_frames.size()];
+        std::swap(exception, m_exception);
+    }
+
+    m_current->frame = frame;
+    m_current->time = time;
+    m_current->num_tables = 0;
+    m_section.clear();
+
+    if (exception)
+        std::rethrow_exception(exception);
+}
+
+void ChVehicleOutputBuffered::WriteSection(const std::string& name) {
+    m_section = name;
+}
+
+ChVehicleOutputBuffered::Table& ChVehicleOutputBuffered::AddTable(const std::string& name,
+                                                                  const std::vector<std::string>& columns,
+                                                                  size_t nitems) {
+    // Reuse the tables (and their memory) from the last time this frame slot was filled
+    if (m_current->num_tables == m_current->tables.size())
+        m_current->tables.push_back(Table());
+    Table& table = m_current->tables[m_current->num_tables++];
+
+    table.section = m_section;
+    table.name = name;
+    table.columns = &columns;
+    table.ids.resize(nitems);
+    table.values.resize(columns.size() * nitems);
+
+    return table;
+}
+
+void ChVehicleOutputBuffered::WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) {
+    if (bodies.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Bodies", body_columns, bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const ChVector<>& p = bodies[i]->GetPos();
+        const ChQuaternion<>& q = bodies[i]->GetRot();
+        SetItem(table, i, bodies[i]->GetIdentifier(), {p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) {
+    if (bodies.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Bodies AuxRef", body_columns, bodies.size());
+    for (size_t i = 0; i < bodies.size(); i++) {
+        const ChVector<>& p = bodies[i]->GetPos();
+        const ChQuaternion<>& q = bodies[i]->GetRot();
+        SetItem(table, i, bodies[i]->GetIdentifier(), {p.x(), p.y(), p.z(), q.e0(), q.e1(), q.e2(), q.e3()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) {
+    if (markers.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Markers", marker_columns, markers.size());
+    for (size_t i = 0; i < markers.size(); i++) {
+        const ChVector<>& p = markers[i]->GetAbsCoord().pos;
+        const ChVector<>& pd = markers[i]->GetAbsCoord_dt().pos;
+        const ChVector<>& pdd = markers[i]->GetAbsCoord_dtdt().pos;
+        SetItem(table, i, markers[i]->GetIdentifier(),
+                {p.x(), p.y(), p.z(), pd.x(), pd.y(), pd.z(), pdd.x(), pdd.y(), pdd.z()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    if (shafts.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Shafts", shaft_columns, shafts.size());
+    for (size_t i = 0; i < shafts.size(); i++) {
+        SetItem(table, i, shafts[i]->GetIdentifier(),
+                {shafts[i]->GetPos(), shafts[i]->GetPos_dt(), shafts[i]->GetPos_dtdt(), shafts[i]->GetAppliedTorque()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) {
+    if (joints.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Joints", joint_columns, joints.size());
+    for (size_t i = 0; i < joints.size(); i++) {
+        const ChVector<>& f = joints[i]->Get_react_force();
+        const ChVector<>& t = joints[i]->Get_react_torque();
+        SetItem(table, i, joints[i]->GetIdentifier(), {f.x(), f.y(), f.z(), t.x(), t.y(), t.z()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) {
+    if (couples.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Couples", couple_columns, couples.size());
+    for (size_t i = 0; i < couples.size(); i++) {
+        SetItem(table, i, couples[i]->GetIdentifier(),
+                {couples[i]->GetRelativeRotation(), couples[i]->GetRelativeRotation_dt(),
+                 couples[i]->GetRelativeRotation_dtdt(), couples[i]->GetTorqueReactionOn1(),
+                 couples[i]->GetTorqueReactionOn2()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) {
+    if (springs.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Lin Springs", linspring_columns, springs.size());
+    for (size_t i = 0; i < springs.size(); i++) {
+        SetItem(table, i, springs[i]->GetIdentifier(),
+                {springs[i]->GetSpringLength(), springs[i]->GetSpringVelocity(), springs[i]->GetSpringReact()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) {
+    if (springs.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Rot Springs", rotspring_columns, springs.size());
+    for (size_t i = 0; i < springs.size(); i++) {
+        SetItem(table, i, springs[i]->GetIdentifier(),
+                {springs[i]->GetRotSpringAngle(), springs[i]->GetRotSpringSpeed(), springs[i]->GetRotSpringTorque()});
+    }
+}
+
+void ChVehicleOutputBuffered::WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) {
+    if (loads.empty() || !m_current)
+        return;
+
+    Table& table = AddTable("Body-body Loads", bodyload_columns, loads.size());
+    for (size_t i = 0; i < loads.size(); i++) {
+        ChVector<> f = loads[i]->GetForce();
+        ChVector<> t = loads[i]->GetTorque();
+        SetItem(table, i, loads[i]->GetIdentifier(), {f.x(), f.y(), f.z(), t.x(), t.y(), t.z()});
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
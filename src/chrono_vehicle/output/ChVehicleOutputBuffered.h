@@ -0,0 +1,125 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Base class for a vehicle output database written asynchronously.
+//
+// =============================================================================
+
+#ifndef CH_VEHICLE_OUTPUT_BUFFERED_H
+#define CH_VEHICLE_OUTPUT_BUFFERED_H
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "chrono_vehicle/ChVehicleOutput.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle
+/// @{
+
+/// Base class for a vehicle output database written asynchronously.
+/// The Write functions, called from the simulation loop, only take a snapshot of the output quantities into a
+/// ring buffer of frames. A frame is complete when the next frame is started (or the database is flushed) and is
+/// then handed to a background thread which writes it through WriteFrame(). If all frames in the ring buffer are
+/// pending, the simulation loop waits for the writer thread. An exception thrown by the writer thread is rethrown
+/// in the simulation loop, when the next frame is started or when the database is flushed.
+class CH_VEHICLE_API ChVehicleOutputBuffered : public ChVehicleOutput {
+  public:
+    /// Snapshot of the output quantities of a list of components, stored column-wise.
+    struct Table {
+        std::string section;                          ///< name of the section containing this table
+        std::string name;                             ///< table name (e.g. "Bodies", "Joints")
+        const std::vector<std::string>* columns;      ///< names of the output quantities
+        std::vector<int> ids;                         ///< component identifiers
+        std::vector<double> values;                   ///< values, column-major (values[c * ids.size() + i])
+
+        size_t GetNumItems() const { return ids.size(); }
+        const double* GetColumn(size_t c) const { return values.data() + c * ids.size(); }
+    };
+
+    /// Snapshot of all output quantities at one output time.
+    struct Frame {
+        int frame;                  ///< output frame number
+        double time;                ///< output time
+        std::vector<Table> tables;  ///< output tables (only the first num_tables are valid)
+        size_t num_tables;          ///< number of tables in this frame
+    };
+
+    /// Construct an output database with a ring buffer of the given number of frames.
+    ChVehicleOutputBuffered(int buffer_size = 64);
+
+    virtual ~ChVehicleOutputBuffered();
+
+    /// Hand the current frame to the writer and wait until all frames were written.
+    /// Rethrows any exception thrown by the writer thread.
+    void Flush();
+
+  protected:
+    /// Write a complete frame (called from the writer thread only).
+    virtual void WriteFrame(const Frame& frame) = 0;
+
+    /// Flush all frames and terminate the writer thread.
+    /// Must be called from the destructor of derived classes, before their data is destroyed.
+    void StopWriter();
+
+  private:
+    virtual void WriteTime(int frame, double time) override;
+    virtual void WriteSection(const std::string& name) override;
+
+    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
+    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
+    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
+    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
+    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
+    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
+    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) override;
+    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) override;
+    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+
+    /// Append a new table to the current frame.
+    Table& AddTable(const std::string& name, const std::vector<std::string>& columns, size_t nitems);
+
+    /// Hand the current frame (if any) to the writer thread.
+    void CommitFrame();
+
+    /// Loop executed by the writer thread.
+    void WriterLoop();
+
+    std::vector<Frame> m_frames;  ///< ring buffer of frames
+    size_t m_head;                ///< index of the next frame to be written
+    size_t m_count;               ///< number of frames committed and not yet written
+    Frame* m_current;             ///< frame currently being filled (nullptr if none)
+    std::string m_section;        ///< name of the current section
+
+    std::thread m_writer;               ///< writer thread
+    std::mutex m_mutex;                 ///< mutex protecting the ring buffer state
+    std::condition_variable m_cv_full;  ///< signals frames available for writing
+    std::condition_variable m_cv_free;  ///< signals frames written
+    bool m_busy;                        ///< writer thread is currently writing a frame
+    bool m_stop;                        ///< request the writer thread to terminate
+    std::exception_ptr m_exception;     ///< first exception thrown by the writer thread
+};
+
+/// @} vehicle
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -12,7 +12,7 @@
 // Authors: Radu Serban
 // =============================================================================
 //
-// ASCII text vehicle output database.
+// HDF5 vehicle output database.
 //
 // =============================================================================
 
@@ -20,9 +20,10 @@
 #define CH_VEHICLE_OUTPUT_HDF5_H
 
 #include <string>
-#include <fstream>
+#include <unordered_map>
+#include <vector>
 
-#include "chrono_vehicle/ChVehicleOutput.h"
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
 
 #include "H5Cpp.h"
 
@@ -33,48 +34,49 @@ namespace vehicle {
 /// @{
 
 /// HDF5 vehicle output database.
-class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutput {
+/// Output frames are written asynchronously (see ChVehicleOutputBuffered) in a columnar layout:
+/// - /Time and /Frame: output time and frame number, one entry per output frame;
+/// - /<section>/<table>/id: identifiers of the components in the table (e.g. /Chassis/Bodies/id);
+/// - /<section>/<table>/frame: index in /Time of each row of the table;
+/// - /<section>/<table>/<quantity>: one row per output frame, one column per component (e.g. /Chassis/Bodies/x).
+/// All datasets are chunked and extensible along the frame dimension and can optionally be compressed.
+/// The list of components in a table is assumed to not change during the simulation.
+class CH_VEHICLE_API ChVehicleOutputHDF5 : public ChVehicleOutputBuffered {
   public:
-    ChVehicleOutputHDF5(const std::string& filename);
+    ChVehicleOutputHDF5(const std::string& filename,  ///< [in] name of output file
+                        int compression = 0           ///< [in] deflate compression level (0: none, 1-9)
+                        );
     ~ChVehicleOutputHDF5();
 
   private:
-    virtual void WriteTime(int frame, double time) override;
-    virtual void WriteSection(const std::string& name) override;
-
-    virtual void WriteBodies(const std::vector<std::shared_ptr<ChBody>>& bodies) override;
-    virtual void WriteAuxRefBodies(const std::vector<std::shared_ptr<ChBodyAuxRef>>& bodies) override;
-    virtual void WriteMarkers(const std::vector<std::shared_ptr<ChMarker>>& markers) override;
-    virtual void WriteShafts(const std::vector<std::shared_ptr<ChShaft>>& shafts) override;
-    virtual void WriteJoints(const std::vector<std::shared_ptr<ChLink>>& joints) override;
-    virtual void WriteCouples(const std::vector<std::shared_ptr<ChShaftsCouple>>& couples) override;
-    virtual void WriteLinSprings(const std::vector<std::shared_ptr<ChLinkSpringCB>>& springs) override;
-    virtual void WriteRotSprings(const std::vector<std::shared_ptr<ChLinkRotSpringCB>>& springs) override;
-    virtual void WriteBodyLoads(const std::vector<std::shared_ptr<ChLoadBodyBody>>& loads) override;
+    /// Datasets of an output table.
+    struct TableDataSets {
+        hsize_t nitems;                    ///< number of components
+        hsize_t nrows;                     ///< number of rows written so far
+        H5::DataSet frame;                 ///< frame index of each row
+        std::vector<H5::DataSet> columns;  ///< one dataset per output quantity
+    };
+
+    virtual void WriteFrame(const Frame& frame) override;
+
+    /// Create the group and datasets for a table seen for the first time.
+    TableDataSets& CreateTable(const Table& table);
+
+    /// Create an extensible dataset with rows of the given length (0 for a 1-D dataset).
+    H5::DataSet CreateDataSet(H5::Group& group, const std::string& name, const H5::PredType& type, hsize_t ncols);
+
+    /// Append a row to an extensible dataset.
+    static void AppendRow(H5::DataSet& set, hsize_t row, hsize_t ncols, const H5::PredType& type, const void* data);
 
     H5::H5File* m_fileHDF5;
-    H5::Group* m_frame_group;
-    H5::Group* m_section_group;
-
-    static H5::CompType* m_body_type;
-    static H5::CompType* m_bodyaux_type;
-    static H5::CompType* m_shaft_type;
-    static H5::CompType* m_marker_type;
-    static H5::CompType* m_joint_type;
-    static H5::CompType* m_couple_type;
-    static H5::CompType* m_linspring_type;
-    static H5::CompType* m_rotspring_type;
-    static H5::CompType* m_bodyload_type;
-
-    static const H5::CompType& getBodyType();
-    static const H5::CompType& getBodyAuxType();
-    static const H5::CompType& getShaftType();
-    static const H5::CompType& getMarkerType();
-    static const H5::CompType& getJointType();
-    static const H5::CompType& getCoupleType();
-    static const H5::CompType& getLinSpringType();
-    static const H5::CompType& getRotSpringType();
-    static const H5::CompType& getBodyLoadType();
+    int m_compression;
+
+    hsize_t m_nframes;
+    H5::DataSet m_time_set;
+    H5::DataSet m_frame_set;
+
+    std::unordered_map<std::string, H5::Group> m_sections;
+    std::unordered_map<std::string, TableDataSets> m_tables;
 };
 
 /// @} vehicle
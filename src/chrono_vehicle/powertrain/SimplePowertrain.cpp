@@ -19,8 +19,7 @@
 #include "chrono/physics/ChGlobal.h"
 
 #include "chrono_vehicle/powertrain/SimplePowertrain.h"
-
-#include "chrono_thirdparty/rapidjson/filereadstream.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
 
 using namespace rapidjson;
 
@@ -30,15 +29,8 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 SimplePowertrain::SimplePowertrain(const std::string& filename) : ChSimplePowertrain("") {
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     Create(d);
 
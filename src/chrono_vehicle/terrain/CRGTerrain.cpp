@@ -32,12 +32,14 @@
 //==============================================================================
 
 #include <algorithm>
+#include <cmath>
 
 #include "chrono/assets/ChPathShape.h"
 #include "chrono/physics/ChBodyEasy.h"
 #include "chrono/utils/ChFilters.h"
 
 #include "chrono/core/ChBezierCurve.h"
+#include "chrono/core/ChException.h"
 #include "chrono/geometry/ChLineBezier.h"
 #include "chrono/geometry/ChLineSegment.h"
 
@@ -54,7 +56,14 @@ namespace chrono {
 namespace vehicle {
 
 CRGTerrain::CRGTerrain(ChSystem* system)
-    : m_use_vis_mesh(true), m_friction(0.8f), m_dataSetId(0), m_cpId(0), m_isClosed(false) {
+    : m_use_vis_mesh(true),
+      m_friction(0.8f),
+      m_dataSetId(0),
+      m_cpId(0),
+      m_isClosed(false),
+      m_num_errors(0),
+      m_use_grid(false),
+      m_grid_spacing(0.05) {
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
     m_ground->SetName("ground");
     m_ground->SetPos(ChVector<>(0, 0, 0));
@@ -64,13 +73,24 @@ CRGTerrain::CRGTerrain(ChSystem* system)
 }
 
 CRGTerrain::~CRGTerrain() {
-    crgContactPointDelete(m_cpId);
+    for (auto cpId : m_cpIds)
+        crgContactPointDelete(cpId);
     crgDataSetRelease(m_dataSetId);
     crgMemRelease();
 }
 
 void CRGTerrain::Initialize(const std::string& crg_file) {
+    // Release the contact points and data set of a previous initialization
+    for (auto cpId : m_cpIds)
+        crgContactPointDelete(cpId);
+    if (m_dataSetId > 0)
+        crgDataSetRelease(m_dataSetId);
+    m_dataSetId = 0;
+
     m_v.clear();
+    m_cpIds.clear();
+    m_tiles.clear();
+    m_num_errors = 0;
 
     // Read the crg-file
     m_dataSetId = crgLoaderReadFile(crg_file.c_str());
@@ -90,6 +110,7 @@ void CRGTerrain::Initialize(const std::string& crg_file) {
         std::cout << "CRGTerrain::CRGTTerrain(): could not create contact point!" << std::endl;
         return;
     }
+    m_cpIds.push_back(m_cpId);
 
     int urange_ok = crgDataSetGetURange(m_dataSetId, &m_ubeg, &m_uend);
     if (urange_ok != 1) {
@@ -140,6 +161,22 @@ void CRGTerrain::Initialize(const std::string& crg_file) {
     } else {
         SetupLineGraphics();
     }
+
+    if (m_use_grid) {
+        SetupHeightGrid();
+    }
+}
+
+int CRGTerrain::AddContactPoint() {
+    if (m_dataSetId <= 0)
+        return -1;
+
+    int cpId = crgContactPointCreate(m_dataSetId);
+    if (cpId < 0)
+        return -1;
+
+    m_cpIds.push_back(cpId);
+    return static_cast<int>(m_cpIds.size()) - 1;
 }
 
 float CRGTerrain::GetCoefficientFriction(double x, double y) const {
@@ -147,24 +184,130 @@ float CRGTerrain::GetCoefficientFriction(double x, double y) const {
 }
 
 double CRGTerrain::GetHeight(double x, double y) const {
-    double u, v, z;
-    int uv_ok = crgEvalxy2uv(m_cpId, x, y, &u, &v);
-    if (uv_ok != 1) {
-        std::cout << "CRGTerrain::GetHeight(): error during xy -> uv coordinate transformation" << std::endl;
+    double z;
+    if (GetGridHeight(x, y, z))
+        return z;
+
+    return EvalHeight(m_cpId, x, y);
+}
+
+double CRGTerrain::GetHeight(int cp, double x, double y) const {
+    double z;
+    if (GetGridHeight(x, y, z))
+        return z;
+
+    return EvalHeight(GetContactPointId(cp), x, y);
+}
+
+void CRGTerrain::GetHeights(const std::vector<ChVector<>>& loc, std::vector<double>& heights, int cp) const {
+    int cpId = GetContactPointId(cp);
+    heights.resize(loc.size());
+    for (size_t i = 0; i < loc.size(); i++) {
+        if (!GetGridHeight(loc[i].x(), loc[i].y(), heights[i]))
+            heights[i] = EvalHeight(cpId, loc[i].x(), loc[i].y());
+    }
+}
+
+int CRGTerrain::GetContactPointId(int cp) const {
+    if (cp < 0 || cp >= static_cast<int>(m_cpIds.size()))
+        throw ChException("CRGTerrain: invalid contact point index " + std::to_string(cp));
+    return m_cpIds[cp];
+}
+
+double CRGTerrain::EvalHeight(int cpId, double x, double y) const {
+    double u, v, z = 0;
+    if (crgEvalxy2uv(cpId, x, y, &u, &v) != 1) {
+        m_num_errors++;
     }
 
     // when leaving the road the vehicle should not fall into an abyss
     ChClampValue(u, m_ubeg, m_uend);
     ChClampValue(v, m_vbeg, m_vend);
 
-    int z_ok = crgEvaluv2z(m_cpId, u, v, &z);
-    if (z_ok != 1) {
-        std::cout << "CRGTerrain::GetHeight(): error during uv -> z coordinate transformation" << std::endl;
+    if (crgEvaluv2z(cpId, u, v, &z) != 1) {
+        m_num_errors++;
     }
 
     return z;
 }
 
+// -----------------------------------------------------------------------------
+// Height grid.
+// The grid is split in square tiles of m_tile_cells x m_tile_cells cells; each
+// tile stores the heights at its (m_tile_cells+1)^2 nodes, so that bilinear
+// interpolation never needs data from a neighboring tile. Only the tiles that
+// contain points of the road surface are sampled.
+// -----------------------------------------------------------------------------
+static inline long long TileKey(int tx, int ty) {
+    return (static_cast<long long>(tx) << 32) | static_cast<unsigned int>(ty);
+}
+
+void CRGTerrain::SetupHeightGrid() {
+    const int nn = m_tile_cells + 1;
+    double tile_size = m_tile_cells * m_grid_spacing;
+
+    // Collect the tiles traversed by the road, sampling the road surface at a quarter of the tile size.
+    std::unordered_map<long long, std::vector<float>> tiles;
+    double ds = tile_size / 4;
+    int nu = static_cast<int>(std::ceil((m_uend - m_ubeg) / ds));
+    int nv = static_cast<int>(std::ceil((m_vend - m_vbeg) / ds));
+    for (int i = 0; i <= nu; i++) {
+        double u = std::min(m_ubeg + i * ds, m_uend);
+        for (int j = 0; j <= nv; j++) {
+            double v = std::min(m_vbeg + j * ds, m_vend);
+            double x, y;
+            if (crgEvaluv2xy(m_cpId, u, v, &x, &y) != 1)
+                continue;
+            int tx = static_cast<int>(std::floor(x / tile_size));
+            int ty = static_cast<int>(std::floor(y / tile_size));
+            tiles.emplace(TileKey(tx, ty), std::vector<float>());
+        }
+    }
+
+    // Sample the heights at the nodes of each tile.
+    for (auto& tile : tiles) {
+        int tx = static_cast<int>(tile.first >> 32);
+        int ty = static_cast<int>(static_cast<unsigned int>(tile.first & 0xFFFFFFFF));
+        tile.second.resize(nn * nn);
+        for (int j = 0; j < nn; j++) {
+            double y = (ty * m_tile_cells + j) * m_grid_spacing;
+            for (int i = 0; i < nn; i++) {
+                double x = (tx * m_tile_cells + i) * m_grid_spacing;
+                tile.second[i + j * nn] = static_cast<float>(EvalHeight(m_cpId, x, y));
+            }
+        }
+    }
+
+    m_tiles = std::move(tiles);
+}
+
+bool CRGTerrain::GetGridHeight(double x, double y, double& z) const {
+    if (m_tiles.empty())
+        return false;
+
+    double gx = x / m_grid_spacing;
+    double gy = y / m_grid_spacing;
+    int ix = static_cast<int>(std::floor(gx));
+    int iy = static_cast<int>(std::floor(gy));
+    int tx = (ix >= 0) ? ix / m_tile_cells : -((-ix - 1) / m_tile_cells) - 1;
+    int ty = (iy >= 0) ? iy / m_tile_cells : -((-iy - 1) / m_tile_cells) - 1;
+
+    auto tile = m_tiles.find(TileKey(tx, ty));
+    if (tile == m_tiles.end())
+        return false;
+
+    const int nn = m_tile_cells + 1;
+    const std::vector<float>& h = tile->second;
+    int i = ix - tx * m_tile_cells;
+    int j = iy - ty * m_tile_cells;
+    double a = gx - ix;
+    double b = gy - iy;
+    z = (1 - a) * (1 - b) * h[i + j * nn] + a * (1 - b) * h[i + 1 + j * nn] +  //
+        (1 - a) * b * h[i + (j + 1) * nn] + a * b * h[i + 1 + (j + 1) * nn];
+
+    return true;
+}
+
 ChVector<> CRGTerrain::GetNormal(double x, double y) const {
     // to avoid 'jumping' of the normal vector, we take this smoothing approach
     const double delta = 0.05;
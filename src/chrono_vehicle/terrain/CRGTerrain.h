@@ -28,6 +28,10 @@
 #ifndef CRGTERRAIN_H
 #define CRGTERRAIN_H
 
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
 #include "chrono/assets/ChColor.h"
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/geometry/ChTriangleMeshConnected.h"
@@ -62,16 +66,48 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     /// The default value is 0.8
     void SetContactFrictionCoefficient(float friction_coefficient) { m_friction = friction_coefficient; }
 
+    /// Enable/disable the use of a pre-sampled height grid (default: disabled).
+    /// If enabled, Initialize samples the road surface on a regular (x,y) grid with the specified spacing. Only the
+    /// grid tiles traversed by the road are stored. Height queries inside these tiles use bilinear interpolation of
+    /// the sampled heights; all other queries are evaluated through OpenCRG.
+    void UseHeightGrid(bool val, double spacing = 0.05) {
+        m_use_grid = val;
+        m_grid_spacing = spacing;
+    }
+
     /// Initialize the CRGTerrain from the specified OpenCRG file.
     void Initialize(const std::string& crg_file  ///< [in] OpenCRG road specification file
     );
 
     ~CRGTerrain();
 
+    /// Create an additional OpenCRG contact point and return its index (or -1 on failure).
+    /// OpenCRG uses the history of positions evaluated through a contact point to speed up the xy -> uv
+    /// transformation with a local search along the reference line. A caller issuing spatially coherent
+    /// queries (e.g., a tire) should therefore use its own contact point. Must be called after Initialize.
+    int AddContactPoint();
+
     /// Get the terrain height at the specified (x,y) location.
-    /// Returns the constant value passed at construction.
     virtual double GetHeight(double x, double y) const override;
 
+    /// Get the terrain height at the specified (x,y) location, using the specified contact point.
+    /// An exception is thrown if the contact point index is not valid.
+    double GetHeight(int cp,    ///< [in] contact point index (as returned by AddContactPoint)
+                     double x,  ///< [in] x coordinate of query location
+                     double y   ///< [in] y coordinate of query location
+                     ) const;
+
+    /// Get the terrain height at multiple locations, using the specified contact point.
+    /// Only the x and y components of the specified points are used. Batched queries may run concurrently,
+    /// provided each thread uses its own contact point. An exception is thrown if the contact point index is not valid.
+    void GetHeights(const std::vector<ChVector<>>& loc,  ///< [in] query locations
+                    std::vector<double>& heights,        ///< [out] terrain heights
+                    int cp = 0                           ///< [in] contact point index
+                    ) const;
+
+    /// Get the number of failed OpenCRG evaluations since initialization.
+    unsigned int GetNumEvalErrors() const { return m_num_errors; }
+
     /// Get the terrain normal at the specified (x,y) location.
     /// Returns a constant unit vector along the Z axis.
     virtual ChVector<> GetNormal(double x, double y) const override;
@@ -100,6 +136,18 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
     void SetupLineGraphics();
     void SetupMeshGraphics();
 
+    /// Sample the road surface on the height grid tiles traversed by the road.
+    void SetupHeightGrid();
+
+    /// Interpolate the terrain height from the height grid. Return false if (x,y) is outside the sampled tiles.
+    bool GetGridHeight(double x, double y, double& z) const;
+
+    /// Return the OpenCRG identifier of the specified contact point (throw if the index is not valid).
+    int GetContactPointId(int cp) const;
+
+    /// Evaluate the terrain height through OpenCRG, using the specified contact point.
+    double EvalHeight(int cpId, double x, double y) const;
+
     std::shared_ptr<ChBody> m_ground;  ///< ground body
     bool m_use_vis_mesh;               ///< mesh or boundary visual asset?
     float m_friction;                  ///< contact coefficient of friction
@@ -108,6 +156,14 @@ class CH_VEHICLE_API CRGTerrain : public ChTerrain {
 
     int m_dataSetId;
     int m_cpId;
+    std::vector<int> m_cpIds;  ///< all contact points (m_cpIds[0] = m_cpId)
+
+    mutable std::atomic<unsigned int> m_num_errors;  ///< number of failed OpenCRG evaluations
+
+    static const int m_tile_cells = 32;                         ///< number of grid cells per tile side
+    bool m_use_grid;                                            ///< use pre-sampled height grid?
+    double m_grid_spacing;                                      ///< height grid spacing
+    std::unordered_map<long long, std::vector<float>> m_tiles;  ///< sampled heights, keyed by tile indices
 
     double m_uinc, m_ubeg, m_uend;  // increment, begin , end of longitudinal road coordinates
     double m_vinc, m_vbeg, m_vend;  // increment, begin , end of lateral road coordinates
@@ -16,7 +16,8 @@
 // This class implements a rectangular patch of granular terrain.
 // Optionally, a moving patch feature can be enable so that the patch is
 // relocated (currently only in the positive X direction) based on the position
-// of a user-specified body.
+// of a user-specified body. Relocated particles can be placed in pre-settled
+// configurations drawn from a library of particle tiles.
 // Boundary conditions (model of a container bin) are imposed through a custom
 // collision detection object.
 //
@@ -37,8 +38,11 @@
 //
 // =============================================================================
 
+#include <algorithm>
+#include <cstdint>
 #include <cstdio>
 #include <cmath>
+#include <fstream>
 
 #include "chrono/assets/ChBoxShape.h"
 #include "chrono/utils/ChUtilsGenerators.h"
@@ -71,6 +75,8 @@ GranularTerrain::GranularTerrain(ChSystem* system)
       m_vis_enabled(false),
       m_moving_patch(false),
       m_moved(false),
+      m_initialized(false),
+      m_next_tile(0),
       m_envelope(-1) {
     // Create the ground body and add it to the system.
     m_ground = std::shared_ptr<ChBody>(system->NewBody());
@@ -163,6 +169,103 @@ void GranularTerrain::EnableMovingPatch(std::shared_ptr<ChBody> body,
 
     // Enable moving patch
     m_moving_patch = true;
+    CheckTiles(0);
+}
+
+// -----------------------------------------------------------------------------
+// Tile library
+// -----------------------------------------------------------------------------
+// Each tile is stored as a tag, the number of particles, the tile dimensions, and the particle states.
+static const char TILE_TAG[8] = {'C', 'H', 'T', 'I', 'L', 'E', '0', '1'};
+
+int GranularTerrain::LoadTiles(const std::string& filename) {
+    std::ifstream ifile(filename, std::ios::binary);
+    if (!ifile.is_open())
+        throw ChException("Cannot open particle tile file " + filename);
+
+    size_t first = m_tiles.size();
+    char tag[sizeof(TILE_TAG)];
+    while (ifile.read(tag, sizeof(tag))) {
+        if (!std::equal(tag, tag + sizeof(tag), TILE_TAG))
+            throw ChException("Invalid particle tile file " + filename);
+
+        Tile tile;
+        uint64_t num_particles;
+        ifile.read(reinterpret_cast<char*>(&num_particles), sizeof(num_particles));
+        ifile.read(reinterpret_cast<char*>(&tile.length), sizeof(double));
+        ifile.read(reinterpret_cast<char*>(&tile.width), sizeof(double));
+        if (!ifile)
+            throw ChException("Invalid particle tile file " + filename);
+        tile.pos.resize(num_particles);
+        tile.rot.resize(num_particles);
+        tile.lin_vel.resize(num_particles);
+        tile.ang_vel.resize(num_particles);
+        for (size_t ip = 0; ip < num_particles; ip++) {
+            ifile.read(reinterpret_cast<char*>(&tile.pos[ip].x()), 3 * sizeof(double));
+            ifile.read(reinterpret_cast<char*>(&tile.rot[ip].e0()), 4 * sizeof(double));
+            ifile.read(reinterpret_cast<char*>(&tile.lin_vel[ip].x()), 3 * sizeof(double));
+            ifile.read(reinterpret_cast<char*>(&tile.ang_vel[ip].x()), 3 * sizeof(double));
+        }
+        if (!ifile)
+            throw ChException("Invalid particle tile file " + filename);
+
+        m_tiles.push_back(tile);
+    }
+    if (ifile.gcount() != 0)
+        throw ChException("Invalid particle tile file " + filename);
+
+    // Do not keep tiles which do not fit the patch.
+    try {
+        CheckTiles(first);
+    } catch (...) {
+        m_tiles.resize(first);
+        throw;
+    }
+
+    return (int)(m_tiles.size() - first);
+}
+
+void GranularTerrain::SaveTile(const std::string& filename, double x_start, double length) const {
+    // Collect the particles in the tile volume, sorted by increasing height.
+    std::vector<ChBody*> particles;
+    for (auto body : m_particles) {
+        double x = body->GetPos().x();
+        if (x >= x_start && x < x_start + length)
+            particles.push_back(body);
+    }
+    std::sort(particles.begin(), particles.end(),
+              [](ChBody* a, ChBody* b) { return a->GetPos().z() < b->GetPos().z(); });
+
+    std::ofstream ofile(filename, std::ios::binary | std::ios::app);
+    if (!ofile.is_open())
+        throw ChException("Cannot open particle tile file " + filename);
+
+    ChVector<> origin(x_start, (m_left + m_right) / 2, m_bottom);
+    uint64_t num_particles = particles.size();
+    ofile.write(TILE_TAG, sizeof(TILE_TAG));
+    ofile.write(reinterpret_cast<const char*>(&num_particles), sizeof(num_particles));
+    ofile.write(reinterpret_cast<const char*>(&length), sizeof(double));
+    ofile.write(reinterpret_cast<const char*>(&m_width), sizeof(double));
+    for (auto body : particles) {
+        ChVector<> pos = body->GetPos() - origin;
+        const ChQuaternion<>& rot = body->GetRot();
+        const ChVector<>& lin_vel = body->GetPos_dt();
+        ChVector<> ang_vel = body->GetWvel_par();
+        ofile.write(reinterpret_cast<const char*>(&pos.x()), 3 * sizeof(double));
+        ofile.write(reinterpret_cast<const char*>(&rot.e0()), 4 * sizeof(double));
+        ofile.write(reinterpret_cast<const char*>(&lin_vel.x()), 3 * sizeof(double));
+        ofile.write(reinterpret_cast<const char*>(&ang_vel.x()), 3 * sizeof(double));
+    }
+}
+
+void GranularTerrain::CheckTiles(size_t first) const {
+    if (!m_moving_patch || !m_initialized)
+        return;
+    for (size_t i = first; i < m_tiles.size(); i++) {
+        if (std::abs(m_tiles[i].length - m_shift_distance) > 1e-6 * m_shift_distance ||
+            std::abs(m_tiles[i].width - m_width) > 1e-6 * m_width)
+            throw ChException("Particle tile dimensions inconsistent with moving patch");
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -463,6 +566,17 @@ void GranularTerrain::Initialize(const ChVector<>& center,
         layer++;
     }
 
+    // Cache the particle bodies (reused when relocating the patch).
+    m_particles.clear();
+    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
+        if (body->GetIdentifier() > m_start_id)
+            m_particles.push_back(body.get());
+    }
+
+    // Check consistency of the particle tiles with the moving patch.
+    m_initialized = true;
+    CheckTiles(0);
+
     // If enabled, create visualization assets for the boundaries.
     if (m_vis_enabled) {
         auto box = std::make_shared<ChBoxShape>();
@@ -494,51 +608,74 @@ void GranularTerrain::Synchronize(double time) {
     // Shift rear boundary.
     m_rear += m_shift_distance;
 
-    // Count particles that must be relocated.
-    unsigned int num_moved_particles = 0;
-    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
-            num_moved_particles++;
+    // Collect particles that must be relocated and place them ahead of the front boundary.
+    std::vector<ChBody*> moved_particles;
+    for (auto body : m_particles) {
+        if (body->GetPos().x() - m_radius < m_rear)
+            moved_particles.push_back(body);
+    }
+    RelocateParticles(moved_particles);
+
+    // Shift front boundary.
+    m_front += m_shift_distance;
+
+    m_moved = true;
+
+    if (m_verbose) {
+        std::cout << "Move patch at time " << time << std::endl;
+        std::cout << "   moved " << moved_particles.size() << " particles" << std::endl;
+        std::cout << "   rear: " << m_rear << "  front: " << m_front << std::endl;
+    }
+}
+
+// Relocate the specified particles in the volume of length m_shift_distance ahead of the current front boundary.
+// If a tile library is available, particles are placed in the states recorded in the next tile; any remaining
+// particles (or all of them, if there is no tile library) are placed at rest, in layers of Poisson Disk samples.
+void GranularTerrain::RelocateParticles(const std::vector<ChBody*>& particles) {
+    size_t num_placed = 0;
+    double r = safety_factor * m_radius;
+    double height = m_bottom + offset_factor * r;
+
+    if (!m_tiles.empty()) {
+        const Tile& tile = m_tiles[m_next_tile];
+        m_next_tile = (m_next_tile + 1) % m_tiles.size();
+
+        ChVector<> origin(m_front, (m_left + m_right) / 2, m_bottom);
+        num_placed = std::min(particles.size(), tile.pos.size());
+        for (size_t ip = 0; ip < num_placed; ip++) {
+            particles[ip]->SetPos(origin + tile.pos[ip]);
+            particles[ip]->SetRot(tile.rot[ip]);
+            particles[ip]->SetPos_dt(tile.lin_vel[ip]);
+            particles[ip]->SetWvel_par(tile.ang_vel[ip]);
         }
+        if (num_placed > 0)
+            height = std::max(height, origin.z() + tile.pos[num_placed - 1].z() + 2 * r);
     }
 
+    if (num_placed == particles.size())
+        return;
+
     // Create a Poisson Disk sampler and generate points in layers within the relocation volume.
     std::vector<ChVector<>> new_points;
-    double r = safety_factor * m_radius;
     utils::PDSampler<> sampler(2 * r);
     ChVector<> layer_hdims(m_shift_distance / 2 - r, m_width / 2 - r, 0);
-    ChVector<> layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, m_bottom + offset_factor * r);
-    while (new_points.size() < num_moved_particles) {
+    ChVector<> layer_center(m_front + m_shift_distance / 2, (m_left + m_right) / 2, height);
+    while (new_points.size() < particles.size() - num_placed) {
         auto points = sampler.SampleBox(layer_center, layer_hdims);
         new_points.insert(new_points.end(), points.begin(), points.end());
         layer_center.z() += 2 * r;
     }
 
-    // Relocate particles at their new locations.
-    size_t ip = 0;
-    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().x() - m_radius < m_rear) {
-            body->SetPos(new_points[ip++]);
-            body->SetPos_dt(m_init_part_vel);
-        }
-    }
-
-    // Shift front boundary.
-    m_front += m_shift_distance;
-
-    m_moved = true;
-
-    if (m_verbose) {
-        std::cout << "Move patch at time " << time << std::endl;
-        std::cout << "   moved " << num_moved_particles << " particles" << std::endl;
-        std::cout << "   rear: " << m_rear << "  front: " << m_front << std::endl;
+    for (size_t ip = num_placed; ip < particles.size(); ip++) {
+        particles[ip]->SetPos(new_points[ip - num_placed]);
+        particles[ip]->SetPos_dt(m_init_part_vel);
     }
 }
 
 double GranularTerrain::GetHeight(double x, double y) const {
     double highest = m_bottom;
-    for (auto body : m_ground->GetSystem()->Get_bodylist()) {
-        if (body->GetIdentifier() > m_start_id && body->GetPos().z() > highest)
+    for (auto body : m_particles) {
+        if (body->GetPos().z() > highest)
             highest = body->GetPos().z();
     }
     return highest + m_radius;
@@ -16,7 +16,8 @@
 // This class implements a rectangular patch of granular terrain.
 // Optionally, a moving patch feature can be enable so that the patch is
 // relocated (currently only in the positive X direction) based on the position
-// of a user-specified body.
+// of a user-specified body. Relocated particles can be placed in pre-settled
+// configurations drawn from a library of particle tiles.
 // Boundary conditions (model of a container bin) are imposed through a custom
 // collision detection object.
 //
@@ -28,6 +29,9 @@
 #ifndef GRANULAR_TERRAIN_H
 #define GRANULAR_TERRAIN_H
 
+#include <string>
+#include <vector>
+
 #include "chrono/assets/ChColorAsset.h"
 #include "chrono/physics/ChBody.h"
 #include "chrono/physics/ChMaterialSurfaceNSC.h"
@@ -117,6 +121,25 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
                            const ChVector<>& init_vel = ChVector<>()  ///< initial particle velocity
                            );
 
+    /// Load a library of settled particle tiles from the specified file.
+    /// When the moving patch is relocated, the particles left behind are reused (no bodies are created or
+    /// destroyed) and placed in the states recorded in the next tile from this library (in a round-robin fashion),
+    /// instead of being randomly placed at rest. Tiles must have the same length as the shift distance and the
+    /// same width as the patch; this is checked once both the moving patch and the patch dimensions are known
+    /// (i.e. by Initialize, by LoadTiles, or by EnableMovingPatch, whichever is called last), and an exception is
+    /// thrown otherwise. Tile files are binary files generated with SaveTile and can be concatenated.
+    /// Return the number of tiles loaded.
+    int LoadTiles(const std::string& filename);
+
+    /// Append to the specified file a tile with the current state of all particles in the X interval
+    /// [x_start, x_start + length]. Typically invoked on a patch of the same width, after the particles have
+    /// settled, to generate a tile library offline. Particle states are recorded (in binary form, without loss of
+    /// precision) relative to the location (x_start, patch center y, patch bottom).
+    void SaveTile(const std::string& filename, double x_start, double length) const;
+
+    /// Get the number of tiles in the tile library.
+    size_t GetNumTiles() const { return m_tiles.size(); }
+
     /// Set start value for body identifiers of generated particles (default: 1000000).
     /// It is assumed that all bodies with a larger identifier are granular material particles.
     void SetStartIdentifier(int id) { m_start_id = id; }
@@ -156,6 +179,8 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     /// minimum value (see SetMinNumParticles).
     /// The initial particle locations are obtained with Poisson Disk sampling, using the
     /// given minimum separation distance.
+    /// Only the particles created here are managed by the terrain (moving patch, height queries, tiles);
+    /// bodies added to the system later are ignored, even if their identifiers follow the particle ones.
     void Initialize(const ChVector<>& center,                  ///< [in] center of bottom
                     double length,                             ///< [in] patch dimension in X direction
                     double width,                              ///< [in] patch dimension in Y direction
@@ -202,6 +227,24 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     virtual float GetCoefficientFriction(double x, double y) const override;
 
   private:
+    /// Settled particle states over a tile of granular material.
+    /// Particle states are sorted by increasing height.
+    struct Tile {
+        double length;                        ///< tile dimension in X direction
+        double width;                         ///< tile dimension in Y direction
+        std::vector<ChVector<>> pos;          ///< particle positions (relative to tile origin)
+        std::vector<ChQuaternion<>> rot;      ///< particle orientations
+        std::vector<ChVector<>> lin_vel;      ///< particle linear velocities
+        std::vector<ChVector<>> ang_vel;      ///< particle angular velocities
+    };
+
+    /// Relocate the specified particles in the volume ahead of the current front boundary.
+    void RelocateParticles(const std::vector<ChBody*>& particles);
+
+    /// Check that the tiles (starting at the specified index) match the moving patch.
+    /// Only done once the terrain is initialized and the moving patch enabled.
+    void CheckTiles(size_t first) const;
+
     unsigned int m_min_num_particles;  ///< requested minimum number of particles
     unsigned int m_num_particles;      ///< actual number of particles
     int m_start_id;                    ///< start body identifier for particles
@@ -226,6 +269,11 @@ class CH_VEHICLE_API GranularTerrain : public ChTerrain {
     double m_shift_distance;         ///< size (X direction) of relocated volume
     ChVector<> m_init_part_vel;      ///< initial particle velocity
 
+    bool m_initialized;                ///< was the patch initialized?
+    std::vector<ChBody*> m_particles;  ///< granular material particles (cached at initialization)
+    std::vector<Tile> m_tiles;         ///< library of settled particle tiles
+    size_t m_next_tile;                ///< index of next tile used for particle relocation
+
     // Rough surface (ground-fixed spheres)
     bool m_rough_surface;  ///< rough surface feature enabled?
     int m_nx;              ///< number of fixed spheres in X direction
@@ -16,6 +16,7 @@
 //
 // =============================================================================
 
+#include <algorithm>
 #include <cmath>
 #include <cstdio>
 
@@ -32,7 +33,6 @@
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 #include "chrono_thirdparty/Easy_BMP/EasyBMP.h"
-#include "chrono_thirdparty/rapidjson/filereadstream.h"
 
 using namespace rapidjson;
 
@@ -42,22 +42,16 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 // Default constructor.
 // -----------------------------------------------------------------------------
-RigidTerrain::RigidTerrain(ChSystem* system) : m_system(system), m_num_patches(0) {}
+RigidTerrain::RigidTerrain(ChSystem* system) : m_system(system), m_num_patches(0), m_initialized(false) {}
 
 // -----------------------------------------------------------------------------
 // Constructor from JSON file
 // -----------------------------------------------------------------------------
-RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename) : m_system(system), m_num_patches(0) {
+RigidTerrain::RigidTerrain(ChSystem* system, const std::string& filename)
+    : m_system(system), m_num_patches(0), m_initialized(false) {
     // Open the JSON file and read data
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Read top-level data
     assert(d.HasMember("Type"));
@@ -152,6 +146,7 @@ void RigidTerrain::LoadPatch(const rapidjson::Value& d) {
 std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>& position) {
     m_num_patches++;
     auto patch = std::make_shared<Patch>();
+    patch->m_radius = 0;
 
     // Create the rigid body for this patch (fixed)
     patch->m_body = std::shared_ptr<ChBody>(m_system->NewBody());
@@ -224,8 +219,13 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>&
         patch->m_body->AddAsset(box);
     }
 
+    patch->m_box_hlen = 0.5 * size;
     patch->m_type = BOX;
 
+    // A patch added after initialization is set up right away
+    if (m_initialized)
+        patch->BuildHeightField();
+
     return patch;
 }
 
@@ -257,8 +257,13 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>&
     }
 
     patch->m_mesh_name = mesh_name;
+    patch->m_radius = sweep_sphere_radius;
     patch->m_type = MESH;
 
+    // A patch added after initialization is set up right away
+    if (m_initialized)
+        patch->BuildHeightField();
+
     return patch;
 }
 
@@ -397,6 +402,10 @@ std::shared_ptr<RigidTerrain::Patch> RigidTerrain::AddPatch(const ChCoordsys<>&
     patch->m_mesh_name = mesh_name;
     patch->m_type = HEIGHT_MAP;
 
+    // A patch added after initialization is set up right away
+    if (m_initialized)
+        patch->BuildHeightField();
+
     return patch;
 }
 
@@ -483,14 +492,209 @@ std::shared_ptr<ChBody> RigidTerrain::Patch::GetGroundBody() const {
 // Initialize all terrain patches
 // -----------------------------------------------------------------------------
 void RigidTerrain::Initialize() {
-    // Nothing to do here.
-    // Kept for consistency and possible future extensions.
+    for (auto patch : m_patches) {
+        patch->BuildHeightField();
+    }
+    m_initialized = true;
+}
+
+// -----------------------------------------------------------------------------
+// Set up the data for fast height queries on a patch.
+// The patch bodies are fixed, so all data is cached in the absolute frame.
+// Box patches are intersected analytically (only their bounding box is stored).
+// The faces of mesh and height-map patches are binned in a uniform 2D grid over
+// their (x,y) bounding box, with a cell size equal to the average face extent.
+// -----------------------------------------------------------------------------
+void RigidTerrain::Patch::BuildHeightField() {
+    m_verts.clear();
+    m_cell_start.clear();
+    m_cell_faces.clear();
+    m_nx = 0;
+    m_ny = 0;
+
+    m_xmin = m_ymin = +1e30;
+    m_xmax = m_ymax = -1e30;
+
+    if (m_type == BOX) {
+        for (int i = 0; i < 8; i++) {
+            ChVector<> corner((i & 1) ? m_box_hlen.x() : -m_box_hlen.x(),  //
+                              (i & 2) ? m_box_hlen.y() : -m_box_hlen.y(),  //
+                              (i & 4) ? m_box_hlen.z() : -m_box_hlen.z());
+            ChVector<> abs_corner = m_body->TransformPointLocalToParent(corner);
+            m_xmin = std::min(m_xmin, abs_corner.x());
+            m_xmax = std::max(m_xmax, abs_corner.x());
+            m_ymin = std::min(m_ymin, abs_corner.y());
+            m_ymax = std::max(m_ymax, abs_corner.y());
+        }
+        return;
+    }
+
+    const std::vector<ChVector<>>& vertices = m_trimesh.getCoordsVertices();
+    const std::vector<ChVector<int>>& faces = m_trimesh.m_face_v_indices;
+    if (faces.empty())
+        return;
+
+    // Express mesh vertices in the absolute frame and calculate the (x,y) bounding box.
+    m_verts.resize(vertices.size());
+    for (size_t i = 0; i < vertices.size(); i++) {
+        m_verts[i] = m_body->TransformPointLocalToParent(vertices[i]);
+        m_xmin = std::min(m_xmin, m_verts[i].x());
+        m_xmax = std::max(m_xmax, m_verts[i].x());
+        m_ymin = std::min(m_ymin, m_verts[i].y());
+        m_ymax = std::max(m_ymax, m_verts[i].y());
+    }
+
+    // Set the grid cell size to the average face extent, while limiting the total number of cells.
+    double extent = 0;
+    for (const auto& f : faces) {
+        const ChVector<>& v0 = m_verts[f[0]];
+        const ChVector<>& v1 = m_verts[f[1]];
+        const ChVector<>& v2 = m_verts[f[2]];
+        double dx = std::max(std::max(v0.x(), v1.x()), v2.x()) - std::min(std::min(v0.x(), v1.x()), v2.x());
+        double dy = std::max(std::max(v0.y(), v1.y()), v2.y()) - std::min(std::min(v0.y(), v1.y()), v2.y());
+        extent += std::max(dx, dy);
+    }
+    double lx = m_xmax - m_xmin;
+    double ly = m_ymax - m_ymin;
+    m_cell_size = std::max(extent / faces.size(), std::sqrt(lx * ly / (4.0 * faces.size())));
+    m_cell_size = std::max(m_cell_size, 1e-6);
+    m_nx = std::max(1, (int)std::ceil(lx / m_cell_size));
+    m_ny = std::max(1, (int)std::ceil(ly / m_cell_size));
+
+    // Bin the faces based on their (x,y) bounding boxes (counting pass, then filling pass).
+    int num_cells = m_nx * m_ny;
+    std::vector<int> counts(num_cells + 1, 0);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int it = 0; it < (int)faces.size(); it++) {
+            const ChVector<>& v0 = m_verts[faces[it][0]];
+            const ChVector<>& v1 = m_verts[faces[it][1]];
+            const ChVector<>& v2 = m_verts[faces[it][2]];
+            double x0 = std::min(std::min(v0.x(), v1.x()), v2.x());
+            double x1 = std::max(std::max(v0.x(), v1.x()), v2.x());
+            double y0 = std::min(std::min(v0.y(), v1.y()), v2.y());
+            double y1 = std::max(std::max(v0.y(), v1.y()), v2.y());
+            int ix0 = std::min((int)((x0 - m_xmin) / m_cell_size), m_nx - 1);
+            int ix1 = std::min((int)((x1 - m_xmin) / m_cell_size), m_nx - 1);
+            int iy0 = std::min((int)((y0 - m_ymin) / m_cell_size), m_ny - 1);
+            int iy1 = std::min((int)((y1 - m_ymin) / m_cell_size), m_ny - 1);
+            for (int iy = iy0; iy <= iy1; iy++) {
+                for (int ix = ix0; ix <= ix1; ix++) {
+                    int cell = ix + iy * m_nx;
+                    if (pass == 0)
+                        counts[cell + 1]++;
+                    else
+                        m_cell_faces[counts[cell]++] = it;
+                }
+            }
+        }
+        if (pass == 0) {
+            m_cell_start = counts;
+            for (int cell = 0; cell < num_cells; cell++)
+                m_cell_start[cell + 1] += m_cell_start[cell];
+            m_cell_faces.resize(m_cell_start[num_cells]);
+            counts = m_cell_start;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Find the highest intersection of the vertical through (x,y) with this patch.
+// The returned normal points upward.
+// -----------------------------------------------------------------------------
+bool RigidTerrain::Patch::FindPoint(double x, double y, double& height, ChVector<>& normal) const {
+    if (x < m_xmin || x > m_xmax || y < m_ymin || y > m_ymax)
+        return false;
+
+    if (m_type == BOX) {
+        // Slab test of the vertical segment from z = 1000 to z = -1000, in the box frame.
+        ChVector<> from(x, y, 1000);
+        ChVector<> dir(0, 0, -2000);
+        ChVector<> p = m_body->TransformPointParentToLocal(from);
+        ChVector<> d = m_body->TransformDirectionParentToLocal(dir);
+        double tmin = 0;
+        double tmax = 1;
+        int axis = -1;
+        double sign = 0;
+        for (unsigned int i = 0; i < 3; i++) {
+            if (std::abs(d[i]) < 1e-12) {
+                if (std::abs(p[i]) > m_box_hlen[i])
+                    return false;
+                continue;
+            }
+            double t1 = (-m_box_hlen[i] - p[i]) / d[i];
+            double t2 = (+m_box_hlen[i] - p[i]) / d[i];
+            double s = -1;
+            if (t1 > t2) {
+                std::swap(t1, t2);
+                s = +1;
+            }
+            if (t1 > tmin) {
+                tmin = t1;
+                axis = i;
+                sign = s;
+            }
+            tmax = std::min(tmax, t2);
+            if (tmin > tmax)
+                return false;
+        }
+        if (axis < 0)
+            return false;
+        ChVector<> n_loc(0, 0, 0);
+        n_loc[axis] = sign;
+        height = from.z() + tmin * dir.z();
+        normal = m_body->TransformDirectionLocalToParent(n_loc);
+        return true;
+    }
+
+    if (m_cell_start.empty())
+        return false;
+
+    int ix = std::min((int)((x - m_xmin) / m_cell_size), m_nx - 1);
+    int iy = std::min((int)((y - m_ymin) / m_cell_size), m_ny - 1);
+    int cell = ix + iy * m_nx;
+
+    const std::vector<ChVector<int>>& faces = m_trimesh.m_face_v_indices;
+
+    bool hit = false;
+    for (int k = m_cell_start[cell]; k < m_cell_start[cell + 1]; k++) {
+        const ChVector<int>& f = faces[m_cell_faces[k]];
+        const ChVector<>& v0 = m_verts[f[0]];
+        const ChVector<>& v1 = m_verts[f[1]];
+        const ChVector<>& v2 = m_verts[f[2]];
+        // Barycentric coordinates of (x,y) in the projection of the face onto the horizontal plane.
+        double det = (v1.y() - v2.y()) * (v0.x() - v2.x()) + (v2.x() - v1.x()) * (v0.y() - v2.y());
+        if (std::abs(det) < 1e-14)
+            continue;
+        double a = ((v1.y() - v2.y()) * (x - v2.x()) + (v2.x() - v1.x()) * (y - v2.y())) / det;
+        double b = ((v2.y() - v0.y()) * (x - v2.x()) + (v0.x() - v2.x()) * (y - v2.y())) / det;
+        double c = 1 - a - b;
+        if (a < -1e-10 || b < -1e-10 || c < -1e-10)
+            continue;
+        double z = a * v0.z() + b * v1.z() + c * v2.z();
+        if (!hit || z > height) {
+            hit = true;
+            height = z;
+            normal = Vcross(v1 - v0, v2 - v0);
+        }
+    }
+
+    if (hit) {
+        normal.Normalize();
+        if (normal.z() < 0)
+            normal = -normal;
+        // The contact surface of a sweep-sphere mesh is offset by the sphere radius along the face normal.
+        if (m_radius > 0)
+            height += m_radius / std::max(normal.z(), 1e-6);
+    }
+
+    return hit;
 }
 
 // -----------------------------------------------------------------------------
 // Functions for obtaining the terrain height, normal, and coefficient of
 // friction  at the specified location.
-// This is done by casting vertical rays into each patch collision model.
+// After initialization, this is done through the cached patch data. Otherwise,
+// vertical rays are cast into each patch collision model.
 // -----------------------------------------------------------------------------
 bool RigidTerrain::FindPoint(double x, double y, double& height, ChVector<>& normal, float& friction) const {
     bool hit = false;
@@ -498,6 +702,20 @@ bool RigidTerrain::FindPoint(double x, double y, double& height, ChVector<>& nor
     normal = ChVector<>(0, 0, 1);
     friction = 0.8f;
 
+    if (m_initialized) {
+        for (auto& patch : m_patches) {
+            double p_height;
+            ChVector<> p_normal;
+            if (patch->FindPoint(x, y, p_height, p_normal) && p_height > height) {
+                hit = true;
+                height = p_height;
+                normal = p_normal;
+                friction = patch->m_friction;
+            }
+        }
+        return hit;
+    }
+
     ChVector<> from(x, y, 1000);
     ChVector<> to(x, y, -1000);
 
@@ -535,6 +753,20 @@ ChVector<> RigidTerrain::GetNormal(double x, double y) const {
     return normal;
 }
 
+void RigidTerrain::GetHeightNormal(const std::vector<ChVector<>>& loc,
+                                   std::vector<double>& heights,
+                                   std::vector<ChVector<>>& normals) const {
+    heights.resize(loc.size());
+    normals.resize(loc.size());
+
+    float friction;
+    for (size_t i = 0; i < loc.size(); i++) {
+        bool hit = FindPoint(loc[i].x(), loc[i].y(), heights[i], normals[i], friction);
+        if (!hit)
+            heights[i] = 0.0;
+    }
+}
+
 float RigidTerrain::GetCoefficientFriction(double x, double y) const {
     if (m_friction_fun)
         return (*m_friction_fun)(x, y);
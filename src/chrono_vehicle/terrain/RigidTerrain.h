@@ -100,6 +100,23 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
         std::string m_mesh_name;
         float m_friction;
 
+        // Data for accelerated height queries (set up in RigidTerrain::Initialize, or in AddPatch afterwards).
+        ChVector<> m_box_hlen;              ///< half-lengths of a BOX patch
+        double m_radius;                    ///< sweep sphere radius of a MESH patch
+        std::vector<ChVector<>> m_verts;    ///< mesh vertices, expressed in the absolute frame
+        double m_xmin, m_xmax;              ///< patch bounding box in the x direction
+        double m_ymin, m_ymax;              ///< patch bounding box in the y direction
+        double m_cell_size;                 ///< size of a grid cell
+        int m_nx, m_ny;                     ///< number of grid cells in x and y directions
+        std::vector<int> m_cell_start;      ///< start index in m_cell_faces for each grid cell
+        std::vector<int> m_cell_faces;      ///< indices of faces overlapping each grid cell
+
+        /// Set up the data for accelerated height queries.
+        void BuildHeightField();
+
+        /// Find the highest point of this patch along the vertical through (x,y).
+        bool FindPoint(double x, double y, double& height, ChVector<>& normal) const;
+
         friend class RigidTerrain;
     };
 
@@ -127,6 +144,8 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
 
     /// Add a terrain patch represented by a triangular mesh.
     /// The mesh is specified through a Wavefront file and is used for both contact and visualization.
+    /// With a non-zero sweep sphere radius, terrain height queries report the swept contact surface, offset by the
+    /// radius along the normal of the face below the query point (rounded edges between faces are not modeled).
     std::shared_ptr<Patch> AddPatch(
         const ChCoordsys<>& position,    ///< [in] patch location and orientation
         const std::string& mesh_file,    ///< [in] filename of the input mesh (OBJ)
@@ -149,14 +168,26 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     );
 
     /// Initialize all defined terrain patches.
+    /// This function also sets up the data structures used for fast height and normal queries: box patches are
+    /// intersected analytically and the triangles of mesh and height-map patches are binned in a uniform 2D grid.
+    /// Until Initialize is called, terrain queries fall back on ray casting into the patch collision models. Patches
+    /// added after Initialize are set up when they are added.
     void Initialize();
 
     /// Get the terrain height at the specified (x,y) location.
     virtual double GetHeight(double x, double y) const override;
 
-    /// Get the terrain height at the specified (x,y) location.
+    /// Get the terrain normal at the specified (x,y) location.
     virtual ChVector<> GetNormal(double x, double y) const override;
 
+    /// Get the terrain height and normal at multiple locations.
+    /// Only the x and y components of the specified points are used. On return, the output vectors have the same
+    /// size as the input vector.
+    void GetHeightNormal(const std::vector<ChVector<>>& loc,  ///< [in] query locations
+                         std::vector<double>& heights,        ///< [out] terrain heights
+                         std::vector<ChVector<>>& normals     ///< [out] terrain normals
+                         ) const;
+
     /// Get the terrain coefficient of friction at the specified (x,y) location.
     /// This coefficient of friction value may be used by certain tire models to modify
     /// the tire characteristics, but it will have no effect on the interaction of the terrain
@@ -174,6 +205,7 @@ class CH_VEHICLE_API RigidTerrain : public ChTerrain {
     ChSystem* m_system;
     int m_num_patches;
     std::vector<std::shared_ptr<Patch>> m_patches;
+    bool m_initialized;
 
     std::shared_ptr<Patch> AddPatch(const ChCoordsys<>& position);
     void LoadPatch(const rapidjson::Value& a);
@@ -39,7 +39,6 @@
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
-#include "chrono_thirdparty/rapidjson/filereadstream.h"
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
 #include "chrono_thirdparty/rapidjson/stringbuffer.h"
 
@@ -95,15 +94,8 @@ ChTrackTestRig::ChTrackTestRig(const std::string& filename,
                                ChMaterialSurface::ContactMethod contact_method)
     : ChVehicle("TrackTestRig", contact_method), m_location(location), m_max_torque(0) {
     // Open and parse the input file (track assembly JSON specification file)
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Read top-level data
     assert(d.HasMember("Type"));
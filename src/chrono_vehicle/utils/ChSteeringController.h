@@ -33,6 +33,7 @@
 #include <string>
 
 #include "chrono/core/ChBezierCurve.h"
+#include "chrono/core/ChBezierCurveNetwork.h"
 #include "chrono/utils/ChUtilsInputOutput.h"
 #include "chrono/utils/ChFilters.h"
 
@@ -177,6 +178,13 @@ class CH_VEHICLE_API ChPathSteeringController : public ChSteeringController {
     /// Return a pointer to the Bezier curve
     std::shared_ptr<ChBezierCurve> GetPath() const { return m_path; }
 
+    /// Use a path network, shared with other controllers, to locate the sentinel on the path at reset.
+    /// The tracked path must be the path with the specified index in the network, with the same closed flag
+    /// (a ChException is thrown otherwise).
+    void SetPathNetwork(std::shared_ptr<ChBezierCurveNetwork> network, int path_index) {
+        m_tracker->setNetwork(network, path_index);
+    }
+
     /// Reset the PID controller.
     /// This function resets the underlying path tracker using the current location
     /// of the sentinel point.
@@ -222,6 +230,13 @@ class CH_VEHICLE_API ChPathSteeringControllerXT : public ChSteeringController {
     /// Return a pointer to the Bezier curve
     std::shared_ptr<ChBezierCurve> GetPath() const { return m_path; }
 
+    /// Use a path network, shared with other controllers, to locate the sentinel on the path at reset.
+    /// The tracked path must be the path with the specified index in the network, with the same closed flag
+    /// (a ChException is thrown otherwise).
+    void SetPathNetwork(std::shared_ptr<ChBezierCurveNetwork> network, int path_index) {
+        m_tracker->setNetwork(network, path_index);
+    }
+
     /// Reset the PID controller.
     /// This function resets the underlying path tracker using the current location
     /// of the sentinel point.
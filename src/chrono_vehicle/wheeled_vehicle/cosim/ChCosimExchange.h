@@ -0,0 +1,438 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Non-blocking exchange of tire mesh data and contact forces between the tire
+// and terrain nodes of the distributed wheeled vehicle cosimulation.
+//
+// Only the mesh vertices inside the current contact region (the bounding box of
+// the vertices that received contact forces at the previous exchange, inflated
+// by a margin) are sent from a tire node to the terrain node. The terrain node
+// moves all other vertices rigidly with the wheel. Real-valued mesh and force
+// data can be transferred in single or double precision.
+//
+// The exchange classes are header-only, so that they can be used independently
+// of the cosimulation nodes (e.g., by the exchange benchmark).
+//
+// =============================================================================
+
+#ifndef CH_COSIM_EXCHANGE_H
+#define CH_COSIM_EXCHANGE_H
+
+#include <algorithm>
+#include <vector>
+
+#include "mpi.h"
+
+#include "chrono/core/ChFrameMoving.h"
+#include "chrono/core/ChVector.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// Message kinds used in tire-terrain data exchange.
+/// The MPI tag of a message is COSIM_TAG(tire_id, kind).
+enum ChCosimMessageKind {
+    COSIM_MSG_MESH_HEADER = 0,   ///< wheel frame and velocities (double)
+    COSIM_MSG_MESH_INDICES = 1,  ///< indices of the vertices sent (int)
+    COSIM_MSG_MESH_DATA = 2,     ///< positions and velocities of the vertices sent (real)
+    COSIM_MSG_FORCE_INDICES = 3, ///< indices of the vertices with contact forces (int)
+    COSIM_MSG_FORCE_DATA = 4,    ///< contact forces (real)
+    COSIM_MSG_REGION = 5         ///< contact region for the next exchange (double)
+};
+
+#define COSIM_TAG(id, kind) (8 * (id) + (kind))
+
+// -----------------------------------------------------------------------------
+
+/// Buffer of real values exchanged between cosimulation nodes, in single or double precision.
+class ChCosimBuffer {
+  public:
+    ChCosimBuffer() : m_single(false) {}
+
+    void SetSinglePrecision(bool val) { m_single = val; }
+    bool IsSinglePrecision() const { return m_single; }
+
+    void Resize(int n) {
+        if (m_single)
+            m_fbuf.resize(n);
+        else
+            m_dbuf.resize(n);
+    }
+
+    void Set(int i, double val) {
+        if (m_single)
+            m_fbuf[i] = static_cast<float>(val);
+        else
+            m_dbuf[i] = val;
+    }
+
+    double Get(int i) const { return m_single ? static_cast<double>(m_fbuf[i]) : m_dbuf[i]; }
+
+    void* Data() { return m_single ? static_cast<void*>(m_fbuf.data()) : static_cast<void*>(m_dbuf.data()); }
+
+    MPI_Datatype GetType() const { return m_single ? MPI_FLOAT : MPI_DOUBLE; }
+
+    /// Return the number of bytes occupied by the given number of values.
+    int GetNumBytes(int count) const { return count * (m_single ? (int)sizeof(float) : (int)sizeof(double)); }
+
+  private:
+    bool m_single;
+    std::vector<double> m_dbuf;
+    std::vector<float> m_fbuf;
+};
+
+// -----------------------------------------------------------------------------
+
+/// Contact region, used to select the tire mesh vertices sent to the terrain node.
+struct ChCosimContactRegion {
+    ChCosimContactRegion() : full(true) {}
+
+    bool Contains(const ChVector<>& p) const {
+        return full || (p.x() >= min.x() && p.x() <= max.x() && p.y() >= min.y() && p.y() <= max.y() &&
+                        p.z() >= min.z() && p.z() <= max.z());
+    }
+
+    bool full;        ///< if true, the region includes the entire mesh
+    ChVector<> min;   ///< lower corner of the region bounding box
+    ChVector<> max;   ///< upper corner of the region bounding box
+};
+
+// -----------------------------------------------------------------------------
+
+/// Sender of tire mesh data (on a tire node).
+class ChCosimMeshSender {
+  public:
+    ChCosimMeshSender(int num_vert, bool single_precision, int dest, int id)
+        : m_dest(dest), m_id(id), m_pending(false), m_num_bytes(0) {
+        m_data.SetSinglePrecision(single_precision);
+        m_data.Resize(6 * num_vert);
+        m_indices.reserve(num_vert);
+    }
+
+    ~ChCosimMeshSender() { Wait(); }
+
+    /// Post non-blocking sends for the vertices inside the given region.
+    /// The wheel frame (with velocities) is used by the receiver to move the vertices that are not sent.
+    void Send(const ChFrameMoving<>& wheel,
+              const std::vector<ChVector<>>& vert_pos,
+              const std::vector<ChVector<>>& vert_vel,
+              const ChCosimContactRegion& region,
+              MPI_Comm comm) {
+        // Buffers cannot be modified before the previous sends complete.
+        Wait();
+
+        m_header[0] = wheel.GetPos().x();
+        m_header[1] = wheel.GetPos().y();
+        m_header[2] = wheel.GetPos().z();
+        m_header[3] = wheel.GetRot().e0();
+        m_header[4] = wheel.GetRot().e1();
+        m_header[5] = wheel.GetRot().e2();
+        m_header[6] = wheel.GetRot().e3();
+        m_header[7] = wheel.GetPos_dt().x();
+        m_header[8] = wheel.GetPos_dt().y();
+        m_header[9] = wheel.GetPos_dt().z();
+        m_header[10] = wheel.GetWvel_par().x();
+        m_header[11] = wheel.GetWvel_par().y();
+        m_header[12] = wheel.GetWvel_par().z();
+
+        m_indices.clear();
+        for (int iv = 0; iv < (int)vert_pos.size(); iv++) {
+            if (!region.Contains(vert_pos[iv]))
+                continue;
+            int k = 6 * (int)m_indices.size();
+            m_data.Set(k + 0, vert_pos[iv].x());
+            m_data.Set(k + 1, vert_pos[iv].y());
+            m_data.Set(k + 2, vert_pos[iv].z());
+            m_data.Set(k + 3, vert_vel[iv].x());
+            m_data.Set(k + 4, vert_vel[iv].y());
+            m_data.Set(k + 5, vert_vel[iv].z());
+            m_indices.push_back(iv);
+        }
+        int n = (int)m_indices.size();
+
+        MPI_Isend(m_header, 13, MPI_DOUBLE, m_dest, COSIM_TAG(m_id, COSIM_MSG_MESH_HEADER), comm, &m_requests[0]);
+        MPI_Isend(m_indices.data(), n, MPI_INT, m_dest, COSIM_TAG(m_id, COSIM_MSG_MESH_INDICES), comm,
+                  &m_requests[1]);
+        MPI_Isend(m_data.Data(), 6 * n, m_data.GetType(), m_dest, COSIM_TAG(m_id, COSIM_MSG_MESH_DATA), comm,
+                  &m_requests[2]);
+        m_pending = true;
+        m_num_bytes = 13 * (int)sizeof(double) + n * (int)sizeof(int) + m_data.GetNumBytes(6 * n);
+    }
+
+    /// Wait for completion of the last posted sends.
+    void Wait() {
+        if (m_pending)
+            MPI_Waitall(3, m_requests, MPI_STATUSES_IGNORE);
+        m_pending = false;
+    }
+
+    /// Return the number of vertices sent in the last exchange.
+    int GetNumSent() const { return (int)m_indices.size(); }
+
+    /// Return the number of bytes sent in the last exchange.
+    int GetNumBytes() const { return m_num_bytes; }
+
+  private:
+    int m_dest;
+    int m_id;
+    double m_header[13];
+    std::vector<int> m_indices;
+    ChCosimBuffer m_data;
+    MPI_Request m_requests[3];
+    bool m_pending;
+    int m_num_bytes;
+};
+
+// -----------------------------------------------------------------------------
+
+/// Receiver of tire mesh data (on the terrain node).
+/// Maintains the positions and velocities of all mesh vertices: vertices not received in an exchange are moved
+/// rigidly with the wheel, based on their location relative to the wheel at the last exchange that included them.
+/// The first exchange must include all mesh vertices.
+class ChCosimMeshReceiver {
+  public:
+    ChCosimMeshReceiver(int num_vert, bool single_precision, int source, int id)
+        : m_source(source), m_id(id), m_posted(false), m_num_received(0) {
+        m_data.SetSinglePrecision(single_precision);
+        m_data.Resize(6 * num_vert);
+        m_indices.resize(num_vert);
+        m_pos.resize(num_vert);
+        m_vel.resize(num_vert);
+        m_loc.resize(num_vert);
+        m_received.resize(num_vert);
+        m_requests[0] = m_requests[1] = m_requests[2] = MPI_REQUEST_NULL;
+    }
+
+    ~ChCosimMeshReceiver() { Cancel(); }
+
+    /// Post non-blocking receives for the next exchange.
+    void Post(MPI_Comm comm) {
+        int nv = (int)m_pos.size();
+        MPI_Irecv(m_header, 13, MPI_DOUBLE, m_source, COSIM_TAG(m_id, COSIM_MSG_MESH_HEADER), comm, &m_requests[0]);
+        MPI_Irecv(m_indices.data(), nv, MPI_INT, m_source, COSIM_TAG(m_id, COSIM_MSG_MESH_INDICES), comm,
+                  &m_requests[1]);
+        MPI_Irecv(m_data.Data(), 6 * nv, m_data.GetType(), m_source, COSIM_TAG(m_id, COSIM_MSG_MESH_DATA), comm,
+                  &m_requests[2]);
+        m_posted = true;
+    }
+
+    /// Return the request for the mesh data message (e.g., for use with MPI_Waitany).
+    MPI_Request& GetDataRequest() { return m_requests[2]; }
+
+    /// Complete the current exchange and update the mesh vertex states.
+    void Complete() {
+        MPI_Status status;
+        MPI_Wait(&m_requests[0], MPI_STATUS_IGNORE);
+        MPI_Wait(&m_requests[1], &status);
+        MPI_Wait(&m_requests[2], MPI_STATUS_IGNORE);
+        m_posted = false;
+
+        int n;
+        MPI_Get_count(&status, MPI_INT, &n);
+
+        ChFrameMoving<> wheel(ChVector<>(m_header[0], m_header[1], m_header[2]),
+                              ChQuaternion<>(m_header[3], m_header[4], m_header[5], m_header[6]));
+        ChVector<> lin_vel(m_header[7], m_header[8], m_header[9]);
+        ChVector<> ang_vel(m_header[10], m_header[11], m_header[12]);
+
+        std::fill(m_received.begin(), m_received.end(), false);
+        for (int k = 0; k < n; k++) {
+            int iv = m_indices[k];
+            m_pos[iv] = ChVector<>(m_data.Get(6 * k + 0), m_data.Get(6 * k + 1), m_data.Get(6 * k + 2));
+            m_vel[iv] = ChVector<>(m_data.Get(6 * k + 3), m_data.Get(6 * k + 4), m_data.Get(6 * k + 5));
+            m_loc[iv] = wheel.TransformPointParentToLocal(m_pos[iv]);
+            m_received[iv] = true;
+        }
+        for (int iv = 0; iv < (int)m_pos.size(); iv++) {
+            if (m_received[iv])
+                continue;
+            m_pos[iv] = wheel.TransformPointLocalToParent(m_loc[iv]);
+            m_vel[iv] = lin_vel + Vcross(ang_vel, m_pos[iv] - wheel.GetPos());
+        }
+        m_num_received = n;
+    }
+
+    /// Cancel any pending receives.
+    void Cancel() {
+        if (!m_posted)
+            return;
+        for (int i = 0; i < 3; i++) {
+            if (m_requests[i] != MPI_REQUEST_NULL) {
+                MPI_Cancel(&m_requests[i]);
+                MPI_Request_free(&m_requests[i]);
+            }
+        }
+        m_posted = false;
+    }
+
+    const std::vector<ChVector<>>& GetPositions() const { return m_pos; }
+    const std::vector<ChVector<>>& GetVelocities() const { return m_vel; }
+
+    /// Return the number of vertices received in the last exchange.
+    int GetNumReceived() const { return m_num_received; }
+
+  private:
+    int m_source;
+    int m_id;
+    double m_header[13];
+    std::vector<int> m_indices;
+    ChCosimBuffer m_data;
+    MPI_Request m_requests[3];
+    bool m_posted;
+    int m_num_received;
+
+    std::vector<ChVector<>> m_pos;  ///< current vertex positions
+    std::vector<ChVector<>> m_vel;  ///< current vertex velocities
+    std::vector<ChVector<>> m_loc;  ///< vertex positions relative to the wheel, at last exchange including them
+    std::vector<bool> m_received;   ///< flags for vertices received in the current exchange
+};
+
+// -----------------------------------------------------------------------------
+
+/// Sender of contact forces and of the contact region for the next exchange (on the terrain node).
+class ChCosimForceSender {
+  public:
+    ChCosimForceSender(int num_vert, bool single_precision, int dest, int id)
+        : m_dest(dest), m_id(id), m_pending(false), m_margin(0.1), m_full_interval(0), m_num_exchanges(0) {
+        m_data.SetSinglePrecision(single_precision);
+        m_data.Resize(3 * num_vert);
+        m_indices.reserve(num_vert);
+    }
+
+    ~ChCosimForceSender() { Wait(); }
+
+    /// Set the margin used to inflate the bounding box of the vertices in contact (default: 0.1).
+    void SetMargin(double margin) { m_margin = margin; }
+
+    /// Request that the full mesh be exchanged every 'interval' exchanges (default: 0, never).
+    /// Periodic full exchanges allow detection of new contact areas away from the current contact region.
+    void SetFullExchangeInterval(int interval) { m_full_interval = interval; }
+
+    /// Post non-blocking sends for the specified vertex forces.
+    /// The contact region is the bounding box of the specified vertices (at the given positions), inflated by the
+    /// margin. If no vertex is in contact, the full mesh is requested for the next exchange.
+    void Send(const std::vector<int>& vert_indices,
+              const std::vector<ChVector<>>& vert_forces,
+              const std::vector<ChVector<>>& vert_pos,
+              MPI_Comm comm) {
+        Wait();
+
+        int n = (int)vert_indices.size();
+        m_indices = vert_indices;
+        ChVector<> min(+1e30, +1e30, +1e30);
+        ChVector<> max(-1e30, -1e30, -1e30);
+        for (int k = 0; k < n; k++) {
+            m_data.Set(3 * k + 0, vert_forces[k].x());
+            m_data.Set(3 * k + 1, vert_forces[k].y());
+            m_data.Set(3 * k + 2, vert_forces[k].z());
+            const ChVector<>& p = vert_pos[vert_indices[k]];
+            min = ChVector<>(std::min(min.x(), p.x()), std::min(min.y(), p.y()), std::min(min.z(), p.z()));
+            max = ChVector<>(std::max(max.x(), p.x()), std::max(max.y(), p.y()), std::max(max.z(), p.z()));
+        }
+
+        m_num_exchanges++;
+        bool full = (n == 0) || (m_full_interval > 0 && m_num_exchanges % m_full_interval == 0);
+        m_region[0] = full ? 1 : 0;
+        m_region[1] = min.x() - m_margin;
+        m_region[2] = min.y() - m_margin;
+        m_region[3] = min.z() - m_margin;
+        m_region[4] = max.x() + m_margin;
+        m_region[5] = max.y() + m_margin;
+        m_region[6] = max.z() + m_margin;
+
+        MPI_Isend(m_indices.data(), n, MPI_INT, m_dest, COSIM_TAG(m_id, COSIM_MSG_FORCE_INDICES), comm,
+                  &m_requests[0]);
+        MPI_Isend(m_data.Data(), 3 * n, m_data.GetType(), m_dest, COSIM_TAG(m_id, COSIM_MSG_FORCE_DATA), comm,
+                  &m_requests[1]);
+        MPI_Isend(m_region, 7, MPI_DOUBLE, m_dest, COSIM_TAG(m_id, COSIM_MSG_REGION), comm, &m_requests[2]);
+        m_pending = true;
+    }
+
+    /// Wait for completion of the last posted sends.
+    void Wait() {
+        if (m_pending)
+            MPI_Waitall(3, m_requests, MPI_STATUSES_IGNORE);
+        m_pending = false;
+    }
+
+  private:
+    int m_dest;
+    int m_id;
+    std::vector<int> m_indices;
+    ChCosimBuffer m_data;
+    double m_region[7];
+    MPI_Request m_requests[3];
+    bool m_pending;
+    double m_margin;
+    int m_full_interval;
+    int m_num_exchanges;
+};
+
+// -----------------------------------------------------------------------------
+
+/// Receiver of contact forces and of the contact region for the next exchange (on a tire node).
+class ChCosimForceReceiver {
+  public:
+    ChCosimForceReceiver(int num_vert, bool single_precision, int source, int id)
+        : m_num_vert(num_vert), m_source(source), m_id(id), m_posted(false) {
+        m_data.SetSinglePrecision(single_precision);
+        m_data.Resize(3 * num_vert);
+        m_indices.resize(num_vert);
+    }
+
+    /// Post non-blocking receives for the next exchange.
+    void Post(MPI_Comm comm) {
+        MPI_Irecv(m_indices.data(), m_num_vert, MPI_INT, m_source, COSIM_TAG(m_id, COSIM_MSG_FORCE_INDICES), comm,
+                  &m_requests[0]);
+        MPI_Irecv(m_data.Data(), 3 * m_num_vert, m_data.GetType(), m_source, COSIM_TAG(m_id, COSIM_MSG_FORCE_DATA),
+                  comm, &m_requests[1]);
+        MPI_Irecv(m_region, 7, MPI_DOUBLE, m_source, COSIM_TAG(m_id, COSIM_MSG_REGION), comm, &m_requests[2]);
+        m_posted = true;
+    }
+
+    /// Complete the current exchange and extract the vertex forces and the new contact region.
+    void Complete(std::vector<int>& vert_indices,
+                  std::vector<ChVector<>>& vert_forces,
+                  ChCosimContactRegion& region) {
+        MPI_Status status[3];
+        MPI_Waitall(3, m_requests, status);
+        m_posted = false;
+
+        int n;
+        MPI_Get_count(&status[0], MPI_INT, &n);
+        vert_indices.assign(m_indices.begin(), m_indices.begin() + n);
+        vert_forces.resize(n);
+        for (int k = 0; k < n; k++)
+            vert_forces[k] = ChVector<>(m_data.Get(3 * k + 0), m_data.Get(3 * k + 1), m_data.Get(3 * k + 2));
+
+        region.full = (m_region[0] != 0);
+        region.min = ChVector<>(m_region[1], m_region[2], m_region[3]);
+        region.max = ChVector<>(m_region[4], m_region[5], m_region[6]);
+    }
+
+  private:
+    int m_num_vert;
+    int m_source;
+    int m_id;
+    std::vector<int> m_indices;
+    ChCosimBuffer m_data;
+    double m_region[7];
+    MPI_Request m_requests[3];
+    bool m_posted;
+};
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,130 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Manager for an in-process (multi-threaded) multi-rate cosimulation.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalManager.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChCosimLocalManager::ChCosimLocalManager(double coupling_step, int num_threads)
+    : m_coupling_step(coupling_step), m_time(0), m_generation(0), m_num_busy(0), m_stop(false), m_next_node(0) {
+    if (num_threads <= 0)
+        num_threads = std::max<int>(1, (int)std::thread::hardware_concurrency());
+
+    for (int i = 1; i < num_threads; i++)
+        m_workers.push_back(std::thread(&ChCosimLocalManager::WorkerLoop, this));
+}
+
+ChCosimLocalManager::~ChCosimLocalManager() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv_start.notify_all();
+    for (auto& worker : m_workers)
+        worker.join();
+}
+
+std::shared_ptr<ChCosimChannel> ChCosimLocalManager::AddChannel() {
+    auto channel = std::make_shared<ChCosimChannel>();
+    m_channels.push_back(channel);
+    return channel;
+}
+
+void ChCosimLocalManager::Initialize(double time) {
+    m_time = time;
+
+    // Initialize nodes sequentially and publish their initial outputs.
+    for (auto& node : m_nodes)
+        node->Initialize();
+    for (auto& node : m_nodes)
+        node->Output(m_time);
+    for (auto& channel : m_channels)
+        channel->Swap();
+}
+
+void ChCosimLocalManager::Advance() {
+    // Wake up the worker threads and let the calling thread also process nodes.
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_next_node = 0;
+        m_num_busy = (int)m_workers.size();
+        m_exception = nullptr;
+        m_generation++;
+    }
+    m_cv_start.notify_all();
+
+    ProcessNodes();
+
+    // Wait for all workers to finish the current coupling step.
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_cv_done.wait(lock, [this]() { return m_num_busy == 0; });
+    }
+
+    if (m_exception)
+        std::rethrow_exception(m_exception);
+
+    // All nodes are idle: make the newly published data visible.
+    for (auto& channel : m_channels)
+        channel->Swap();
+
+    m_time += m_coupling_step;
+}
+
+void ChCosimLocalManager::ProcessNodes() {
+    int num_nodes = (int)m_nodes.size();
+    int i;
+    while ((i = m_next_node++) < num_nodes) {
+        try {
+            m_nodes[i]->Synchronize(m_time);
+            m_nodes[i]->Advance(m_time, m_coupling_step);
+            m_nodes[i]->Output(m_time + m_coupling_step);
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_exception)
+                m_exception = std::current_exception();
+        }
+    }
+}
+
+void ChCosimLocalManager::WorkerLoop() {
+    unsigned int generation = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_cv_start.wait(lock, [this, generation]() { return m_stop || m_generation != generation; });
+            if (m_stop)
+                return;
+            generation = m_generation;
+        }
+
+        ProcessNodes();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_num_busy--;
+        }
+        m_cv_done.notify_one();
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,101 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Manager for an in-process (multi-threaded) multi-rate cosimulation.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_LOCAL_MANAGER_H
+#define CH_COSIM_LOCAL_MANAGER_H
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// Manager for an in-process multi-rate cosimulation.
+/// The manager advances a set of cosimulation nodes (each with its own Chrono system and step size) with a fixed
+/// coupling step, using a Jacobi scheme: within a coupling step all nodes are advanced concurrently on a pool of
+/// threads, using the coupling data published at the end of the previous coupling step (possibly extrapolated to
+/// intermediate times). The data published during a coupling step is made visible to all nodes at its end.
+/// Unlike ChCosimManager, this does not require MPI; all nodes run in the calling process.
+class CH_VEHICLE_API ChCosimLocalManager {
+  public:
+    /// Construct a cosimulation manager with the given coupling step.
+    /// If num_threads is 0, the number of hardware threads is used. The calling thread is always one of the
+    /// worker threads.
+    ChCosimLocalManager(double coupling_step, int num_threads = 0);
+
+    ~ChCosimLocalManager();
+
+    /// Add a cosimulation node.
+    void AddNode(std::shared_ptr<ChCosimLocalNode> node) { m_nodes.push_back(node); }
+
+    /// Create a new data channel, managed by this cosimulation.
+    std::shared_ptr<ChCosimChannel> AddChannel();
+
+    /// Get the coupling step.
+    double GetCouplingStep() const { return m_coupling_step; }
+
+    /// Get the current cosimulation time.
+    double GetTime() const { return m_time; }
+
+    /// Initialize all nodes and publish their initial outputs.
+    void Initialize(double time = 0);
+
+    /// Advance all nodes over one coupling step.
+    void Advance();
+
+  private:
+    /// Advance all nodes over the current coupling step (executed concurrently by all threads).
+    void ProcessNodes();
+
+    /// Loop executed by each worker thread.
+    void WorkerLoop();
+
+    double m_coupling_step;
+    double m_time;
+
+    std::vector<std::shared_ptr<ChCosimLocalNode>> m_nodes;
+    std::vector<std::shared_ptr<ChCosimChannel>> m_channels;
+
+    std::vector<std::thread> m_workers;   ///< worker threads (in addition to the calling thread)
+    std::mutex m_mutex;                   ///< mutex protecting the work generation and completion counts
+    std::condition_variable m_cv_start;   ///< signals the start of a coupling step
+    std::condition_variable m_cv_done;    ///< signals completion of a coupling step by a worker
+    unsigned int m_generation;            ///< coupling step counter
+    int m_num_busy;                       ///< number of workers still processing the current coupling step
+    bool m_stop;                          ///< request workers to terminate
+    std::atomic<int> m_next_node;         ///< index of next node to be processed
+    std::exception_ptr m_exception;       ///< first exception thrown while processing nodes
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
@@ -0,0 +1,37 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Base class for a node of an in-process (multi-threaded) cosimulation.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+void ChCosimLocalNode::Advance(double time, double step) {
+    double t = 0;
+    while (t < step) {
+        double h = std::min<>(m_stepsize, step - t);
+        OnSubstep(time + t, h);
+        m_system->DoStepDynamics(h);
+        t += h;
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,143 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Base class for a node of an in-process (multi-threaded) cosimulation and the
+// data channels used to exchange coupling data between nodes.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_LOCAL_NODE_H
+#define CH_COSIM_LOCAL_NODE_H
+
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono_vehicle/ChApiVehicle.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// Data channel for an in-process cosimulation.
+/// A channel has a single writer node and any number of reader nodes. Coupling data are published by the writer
+/// as time-stamped samples (flat arrays of doubles) into a back buffer; the cosimulation manager makes them visible
+/// to readers at the end of each coupling step (see Swap). Readers only ever access the two most recent visible
+/// samples, so that no locking is required while nodes are advanced concurrently.
+class CH_VEHICLE_API ChCosimChannel {
+  public:
+    ChCosimChannel() : m_cur(0), m_prev(1), m_back(2), m_num_samples(0), m_pending(false) {}
+
+    /// Publish a new sample (called by the writer node only).
+    void Put(double time, const std::vector<double>& data) {
+        m_time[m_back] = time;
+        m_data[m_back] = data;
+        m_pending = true;
+    }
+
+    /// Make the last published sample visible to readers.
+    /// Called by the cosimulation manager, while no node is being advanced.
+    void Swap() {
+        if (!m_pending)
+            return;
+        int tmp = m_prev;
+        m_prev = m_cur;
+        m_cur = m_back;
+        m_back = tmp;
+        m_pending = false;
+        if (m_num_samples < 2)
+            m_num_samples++;
+    }
+
+    /// Return true if at least one sample is visible to readers.
+    bool HasData() const { return m_num_samples > 0; }
+
+    /// Get the time stamp of the most recent visible sample.
+    double GetTime() const { return m_time[m_cur]; }
+
+    /// Get the most recent visible sample.
+    const std::vector<double>& Get() const { return m_data[m_cur]; }
+
+    /// Evaluate the channel data at the specified time.
+    /// The value is obtained by linear interpolation (or extrapolation) through the two most recent visible
+    /// samples. A zero-order hold is used if a single sample is available or if the two samples differ in size.
+    void Get(double time, std::vector<double>& data) const {
+        const std::vector<double>& d1 = m_data[m_cur];
+        const std::vector<double>& d0 = m_data[m_prev];
+        data = d1;
+        if (m_num_samples < 2 || d0.size() != d1.size() || m_time[m_cur] <= m_time[m_prev])
+            return;
+        double a = (time - m_time[m_cur]) / (m_time[m_cur] - m_time[m_prev]);
+        for (size_t i = 0; i < data.size(); i++)
+            data[i] += a * (d1[i] - d0[i]);
+    }
+
+  private:
+    double m_time[3];               ///< sample time stamps
+    std::vector<double> m_data[3];  ///< sample data
+    int m_cur;                      ///< index of most recent visible sample
+    int m_prev;                     ///< index of previous visible sample
+    int m_back;                     ///< index of sample being written
+    int m_num_samples;              ///< number of visible samples (at most 2)
+    bool m_pending;                 ///< was a new sample published since the last swap?
+};
+
+/// Base class for a node of an in-process cosimulation.
+/// Each node owns a separate Chrono system (with its own solver and integrator settings) which it advances with
+/// its own step size. Nodes only interact through ChCosimChannel objects, at the coupling times defined by the
+/// cosimulation manager. Within a coupling step, nodes are advanced concurrently.
+class CH_VEHICLE_API ChCosimLocalNode {
+  public:
+    ChCosimLocalNode(ChSystem* system) : m_system(system), m_stepsize(1e-3) {}
+    virtual ~ChCosimLocalNode() {}
+
+    /// Set the integration step size for this node.
+    virtual void SetStepsize(double stepsize) { m_stepsize = stepsize; }
+
+    /// Get the integration step size for this node.
+    double GetStepsize() const { return m_stepsize; }
+
+    /// Get the Chrono system advanced by this node.
+    ChSystem* GetSystem() const { return m_system; }
+
+    /// Initialize the node.
+    /// Called once by the cosimulation manager, before the node publishes its initial outputs.
+    virtual void Initialize() {}
+
+    /// Process inputs at the beginning of a coupling step.
+    virtual void Synchronize(double time) {}
+
+    /// Advance the node over one coupling step of length 'step', starting at 'time'.
+    /// The default implementation takes steps no larger than the node step size and calls OnSubstep before each
+    /// of them (so that a derived class can update its inputs at intermediate times).
+    virtual void Advance(double time, double step);
+
+    /// Publish outputs at the end of a coupling step.
+    virtual void Output(double time) {}
+
+  protected:
+    /// Update inputs before a node step starting at the specified time.
+    virtual void OnSubstep(double time, double h) {}
+
+    ChSystem* m_system;  ///< Chrono system associated with this node
+    double m_stepsize;   ///< integration step size
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
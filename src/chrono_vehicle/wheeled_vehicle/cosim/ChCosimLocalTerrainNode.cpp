@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// In-process cosimulation node responsible for simulating a terrain system.
+//
+// =============================================================================
+
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalTerrainNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChCosimLocalTerrainNode::ChCosimLocalTerrainNode(ChSystem* system, ChTerrain* terrain, int num_tires)
+    : ChCosimLocalNode(system), m_terrain(terrain), m_num_tires(num_tires) {
+    m_mesh_channels.resize(num_tires);
+    m_force_channels.resize(num_tires);
+}
+
+void ChCosimLocalTerrainNode::SetTireChannels(int which,
+                                              std::shared_ptr<ChCosimChannel> tire_mesh,
+                                              std::shared_ptr<ChCosimChannel> tire_forces) {
+    m_mesh_channels[which] = tire_mesh;
+    m_force_channels[which] = tire_forces;
+}
+
+void ChCosimLocalTerrainNode::Synchronize(double time) {
+    std::vector<ChVector<>> vert_pos;
+    std::vector<ChVector<>> vert_vel;
+    std::vector<ChVector<int>> triangles;
+    for (int it = 0; it < m_num_tires; it++) {
+        if (!m_mesh_channels[it] || !m_mesh_channels[it]->HasData())
+            continue;
+        UnpackTireMesh(m_mesh_channels[it]->Get(), vert_pos, vert_vel, triangles);
+        OnReceiveTireData(it, vert_pos, vert_vel, triangles);
+    }
+
+    m_terrain->Synchronize(time);
+}
+
+void ChCosimLocalTerrainNode::Advance(double time, double step) {
+    ChCosimLocalNode::Advance(time, step);
+    m_terrain->Advance(step);
+}
+
+void ChCosimLocalTerrainNode::Output(double time) {
+    std::vector<ChVector<>> vert_forces;
+    std::vector<int> vert_indices;
+    for (int it = 0; it < m_num_tires; it++) {
+        if (!m_force_channels[it])
+            continue;
+        vert_forces.clear();
+        vert_indices.clear();
+        OnSendTireForces(it, vert_forces, vert_indices);
+        PackVertexForces(vert_forces, vert_indices, m_buffer);
+        m_force_channels[it]->Put(time, m_buffer);
+    }
+}
+
+// -----------------------------------------------------------------------------
+// Tire mesh sample layout:
+//   [num_vert, num_tri, pos (3 * num_vert), vel (3 * num_vert), tri (3 * num_tri)]
+// Vertex forces sample layout:
+//   [index, fx, fy, fz] for each vertex in contact
+// -----------------------------------------------------------------------------
+
+void ChCosimLocalTerrainNode::PackTireMesh(const std::vector<ChVector<>>& vert_pos,
+                                           const std::vector<ChVector<>>& vert_vel,
+                                           const std::vector<ChVector<int>>& triangles,
+                                           std::vector<double>& data) {
+    size_t num_vert = vert_pos.size();
+    size_t num_tri = triangles.size();
+    data.resize(2 + 6 * num_vert + 3 * num_tri);
+    data[0] = (double)num_vert;
+    data[1] = (double)num_tri;
+    double* pos = &data[2];
+    double* vel = pos + 3 * num_vert;
+    double* tri = vel + 3 * num_vert;
+    for (size_t i = 0; i < num_vert; i++) {
+        pos[3 * i + 0] = vert_pos[i].x();
+        pos[3 * i + 1] = vert_pos[i].y();
+        pos[3 * i + 2] = vert_pos[i].z();
+        vel[3 * i + 0] = vert_vel[i].x();
+        vel[3 * i + 1] = vert_vel[i].y();
+        vel[3 * i + 2] = vert_vel[i].z();
+    }
+    for (size_t i = 0; i < num_tri; i++) {
+        tri[3 * i + 0] = triangles[i].x();
+        tri[3 * i + 1] = triangles[i].y();
+        tri[3 * i + 2] = triangles[i].z();
+    }
+}
+
+void ChCosimLocalTerrainNode::UnpackTireMesh(const std::vector<double>& data,
+                                             std::vector<ChVector<>>& vert_pos,
+                                             std::vector<ChVector<>>& vert_vel,
+                                             std::vector<ChVector<int>>& triangles) {
+    size_t num_vert = (size_t)data[0];
+    size_t num_tri = (size_t)data[1];
+    const double* pos = &data[2];
+    const double* vel = pos + 3 * num_vert;
+    const double* tri = vel + 3 * num_vert;
+    vert_pos.resize(num_vert);
+    vert_vel.resize(num_vert);
+    triangles.resize(num_tri);
+    for (size_t i = 0; i < num_vert; i++) {
+        vert_pos[i] = ChVector<>(pos[3 * i + 0], pos[3 * i + 1], pos[3 * i + 2]);
+        vert_vel[i] = ChVector<>(vel[3 * i + 0], vel[3 * i + 1], vel[3 * i + 2]);
+    }
+    for (size_t i = 0; i < num_tri; i++) {
+        triangles[i] = ChVector<int>((int)tri[3 * i + 0], (int)tri[3 * i + 1], (int)tri[3 * i + 2]);
+    }
+}
+
+void ChCosimLocalTerrainNode::PackVertexForces(const std::vector<ChVector<>>& vert_forces,
+                                               const std::vector<int>& vert_indices,
+                                               std::vector<double>& data) {
+    size_t num_vert = vert_indices.size();
+    data.resize(4 * num_vert);
+    for (size_t i = 0; i < num_vert; i++) {
+        data[4 * i + 0] = (double)vert_indices[i];
+        data[4 * i + 1] = vert_forces[i].x();
+        data[4 * i + 2] = vert_forces[i].y();
+        data[4 * i + 3] = vert_forces[i].z();
+    }
+}
+
+void ChCosimLocalTerrainNode::UnpackVertexForces(const std::vector<double>& data,
+                                                 std::vector<ChVector<>>& vert_forces,
+                                                 std::vector<int>& vert_indices) {
+    size_t num_vert = data.size() / 4;
+    vert_forces.resize(num_vert);
+    vert_indices.resize(num_vert);
+    for (size_t i = 0; i < num_vert; i++) {
+        vert_indices[i] = (int)data[4 * i + 0];
+        vert_forces[i] = ChVector<>(data[4 * i + 1], data[4 * i + 2], data[4 * i + 3]);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,100 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// In-process cosimulation node responsible for simulating a terrain system.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_LOCAL_TERRAIN_NODE_H
+#define CH_COSIM_LOCAL_TERRAIN_NODE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// In-process cosimulation node for a terrain system interacting with deformable tires.
+/// Inputs: one tire mesh channel per tire (vertex positions and velocities, and mesh connectivity).
+/// Outputs: one channel per tire with the forces on the tire mesh vertices in contact.
+/// A derived class must implement the processing of tire mesh data and the calculation of contact forces.
+class CH_VEHICLE_API ChCosimLocalTerrainNode : public ChCosimLocalNode {
+  public:
+    ChCosimLocalTerrainNode(ChSystem* system, ChTerrain* terrain, int num_tires);
+
+    /// Set the data channels for the specified tire.
+    void SetTireChannels(int which,                                   ///< [in] tire index
+                         std::shared_ptr<ChCosimChannel> tire_mesh,   ///< [in] input tire mesh channel
+                         std::shared_ptr<ChCosimChannel> tire_forces  ///< [in] output vertex forces channel
+    );
+
+    virtual void Synchronize(double time) override;
+    virtual void Advance(double time, double step) override;
+    virtual void Output(double time) override;
+
+    /// Process tire mesh data received at the beginning of a coupling step.
+    virtual void OnReceiveTireData(int which,
+                                   const std::vector<ChVector<>>& vert_pos,
+                                   const std::vector<ChVector<>>& vert_vel,
+                                   const std::vector<ChVector<int>>& triangles) = 0;
+
+    /// Provide the contact forces on the vertices of the specified tire mesh at the end of a coupling step.
+    /// This function is also called at initialization, before any tire data was received.
+    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int>& vert_indices) = 0;
+
+    /// Pack tire mesh data as a channel sample.
+    static void PackTireMesh(const std::vector<ChVector<>>& vert_pos,
+                             const std::vector<ChVector<>>& vert_vel,
+                             const std::vector<ChVector<int>>& triangles,
+                             std::vector<double>& data);
+
+    /// Unpack tire mesh data from a channel sample.
+    static void UnpackTireMesh(const std::vector<double>& data,
+                               std::vector<ChVector<>>& vert_pos,
+                               std::vector<ChVector<>>& vert_vel,
+                               std::vector<ChVector<int>>& triangles);
+
+    /// Pack vertex forces as a channel sample.
+    static void PackVertexForces(const std::vector<ChVector<>>& vert_forces,
+                                 const std::vector<int>& vert_indices,
+                                 std::vector<double>& data);
+
+    /// Unpack vertex forces from a channel sample.
+    static void UnpackVertexForces(const std::vector<double>& data,
+                                   std::vector<ChVector<>>& vert_forces,
+                                   std::vector<int>& vert_indices);
+
+  protected:
+    ChTerrain* m_terrain;  ///< underlying terrain object
+    int m_num_tires;       ///< number of tires
+
+  private:
+    std::vector<std::shared_ptr<ChCosimChannel>> m_mesh_channels;
+    std::vector<std::shared_ptr<ChCosimChannel>> m_force_channels;
+    std::vector<double> m_buffer;
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
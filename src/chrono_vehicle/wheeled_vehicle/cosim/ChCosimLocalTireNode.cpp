@@ -0,0 +1,122 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// In-process cosimulation node responsible for simulating a deformable tire.
+//
+// =============================================================================
+
+#include "chrono_vehicle/terrain/FlatTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalTerrainNode.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalTireNode.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalVehicleNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChCosimLocalTireNode::ChCosimLocalTireNode(ChSystem* system, ChDeformableTire* tire, WheelID id)
+    : ChCosimLocalNode(system), m_tire(tire), m_id(id), m_wheel_mass(1), m_wheel_inertia(1, 1, 1) {}
+
+void ChCosimLocalTireNode::SetWheelProperties(double mass, const ChVector<>& inertia) {
+    m_wheel_mass = mass;
+    m_wheel_inertia = inertia;
+}
+
+void ChCosimLocalTireNode::SetVehicleChannels(std::shared_ptr<ChCosimChannel> wheel_state,
+                                              std::shared_ptr<ChCosimChannel> tire_force) {
+    m_wheel_state_channel = wheel_state;
+    m_tire_force_channel = tire_force;
+}
+
+void ChCosimLocalTireNode::SetTerrainChannels(std::shared_ptr<ChCosimChannel> tire_mesh,
+                                              std::shared_ptr<ChCosimChannel> tire_forces) {
+    m_mesh_channel = tire_mesh;
+    m_vertex_force_channel = tire_forces;
+}
+
+void ChCosimLocalTireNode::Initialize() {
+    // Ghost wheel body (driven kinematically with the wheel state from the vehicle node)
+    m_wheel = std::shared_ptr<ChBody>(m_system->NewBody());
+    m_wheel->SetMass(m_wheel_mass);
+    m_wheel->SetInertiaXX(m_wheel_inertia);
+    m_system->AddBody(m_wheel);
+
+    // Dummy terrain (needed for tire synchronization)
+    m_terrain = std::make_shared<FlatTerrain>(0);
+
+    // Ensure that tire contact is enabled and enforce TRIANGLE_MESH contact surface type
+    m_tire->EnableContact(true);
+    m_tire->SetContactSurfaceType(ChDeformableTire::TRIANGLE_MESH);
+
+    // Initialize the underlying tire
+    m_tire->Initialize(m_wheel, m_id.side());
+
+    // Create a mesh load for contact forces and add it to the tire's load container.
+    auto contact_surface = std::static_pointer_cast<fea::ChContactSurfaceMesh>(m_tire->GetContactSurface());
+    m_contact_load = std::make_shared<fea::ChLoadContactSurfaceMesh>(contact_surface);
+    m_tire->GetLoadContainer()->Add(m_contact_load);
+}
+
+void ChCosimLocalTireNode::Synchronize(double time) {
+    // Apply the terrain forces on the mesh vertices (held constant over the coupling step)
+    if (m_vertex_force_channel && m_vertex_force_channel->HasData()) {
+        std::vector<ChVector<>> vert_forces;
+        std::vector<int> vert_indices;
+        ChCosimLocalTerrainNode::UnpackVertexForces(m_vertex_force_channel->Get(), vert_forces, vert_indices);
+        m_contact_load->InputSimpleForces(vert_forces, vert_indices);
+    }
+}
+
+void ChCosimLocalTireNode::OnSubstep(double time, double h) {
+    if (!m_wheel_state_channel || !m_wheel_state_channel->HasData())
+        return;
+
+    // Drive the ghost wheel with the wheel state extrapolated at the current time
+    WheelState wheel_state;
+    m_wheel_state_channel->Get(time, m_buffer);
+    ChCosimLocalVehicleNode::UnpackWheelState(m_buffer, wheel_state);
+
+    m_wheel->SetPos(wheel_state.pos);
+    m_wheel->SetRot(wheel_state.rot);
+    m_wheel->SetPos_dt(wheel_state.lin_vel);
+    m_wheel->SetWvel_par(wheel_state.ang_vel);
+
+    m_tire->Synchronize(time, wheel_state, *m_terrain);
+}
+
+void ChCosimLocalTireNode::Advance(double time, double step) {
+    ChCosimLocalNode::Advance(time, step);
+    m_tire->Advance(step);
+}
+
+void ChCosimLocalTireNode::Output(double time) {
+    // Send tire force to the vehicle node
+    if (m_tire_force_channel) {
+        TerrainForce tire_force = m_tire->ReportTireForce(m_terrain.get());
+        ChCosimLocalVehicleNode::PackTireForce(tire_force, m_buffer);
+        m_tire_force_channel->Put(time, m_buffer);
+    }
+
+    // Send tire mesh vertex locations and velocities to the terrain node
+    if (m_mesh_channel) {
+        std::vector<ChVector<>> vert_pos;
+        std::vector<ChVector<>> vert_vel;
+        std::vector<ChVector<int>> triangles;
+        m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
+        ChCosimLocalTerrainNode::PackTireMesh(vert_pos, vert_vel, triangles, m_buffer);
+        m_mesh_channel->Put(time, m_buffer);
+    }
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,93 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// In-process cosimulation node responsible for simulating a deformable tire.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_LOCAL_TIRE_NODE_H
+#define CH_COSIM_LOCAL_TIRE_NODE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono/physics/ChSystem.h"
+#include "chrono_fea/ChLoadContactSurfaceMesh.h"
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalNode.h"
+#include "chrono_vehicle/wheeled_vehicle/tire/ChDeformableTire.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// In-process cosimulation node for a deformable tire.
+/// Only FEA-based tires (ChDeformableTire) are supported: the terrain interaction is exchanged as vertex forces on
+/// the tire contact mesh. Rigid or force-element tires are not supported by this node; they can be kept on the
+/// vehicle node instead. This node is only available if the FEA module is enabled.
+/// The tire is attached to a ghost wheel body, driven kinematically with the wheel state received from the vehicle
+/// node (extrapolated at each tire step).
+/// Inputs: wheel state channel, vertex forces channel.
+/// Outputs: tire force channel, tire mesh channel.
+class CH_VEHICLE_API ChCosimLocalTireNode : public ChCosimLocalNode {
+  public:
+    ChCosimLocalTireNode(ChSystem* system, ChDeformableTire* tire, WheelID id);
+
+    /// Set mass and moments of inertia of the ghost wheel body.
+    /// Typically, these are the properties of the corresponding wheel body in the vehicle node.
+    void SetWheelProperties(double mass, const ChVector<>& inertia);
+
+    /// Set the channels for data exchange with the vehicle node.
+    void SetVehicleChannels(std::shared_ptr<ChCosimChannel> wheel_state,  ///< [in] input wheel state channel
+                            std::shared_ptr<ChCosimChannel> tire_force    ///< [in] output tire force channel
+    );
+
+    /// Set the channels for data exchange with the terrain node.
+    void SetTerrainChannels(std::shared_ptr<ChCosimChannel> tire_mesh,   ///< [in] output tire mesh channel
+                            std::shared_ptr<ChCosimChannel> tire_forces  ///< [in] input vertex forces channel
+    );
+
+    virtual void Initialize() override;
+    virtual void Synchronize(double time) override;
+    virtual void Advance(double time, double step) override;
+    virtual void Output(double time) override;
+
+  private:
+    virtual void OnSubstep(double time, double h) override;
+
+    ChDeformableTire* m_tire;
+    WheelID m_id;
+    std::shared_ptr<ChBody> m_wheel;
+    std::shared_ptr<ChTerrain> m_terrain;
+    std::shared_ptr<fea::ChLoadContactSurfaceMesh> m_contact_load;
+
+    double m_wheel_mass;
+    ChVector<> m_wheel_inertia;
+
+    std::shared_ptr<ChCosimChannel> m_wheel_state_channel;
+    std::shared_ptr<ChCosimChannel> m_tire_force_channel;
+    std::shared_ptr<ChCosimChannel> m_mesh_channel;
+    std::shared_ptr<ChCosimChannel> m_vertex_force_channel;
+
+    std::vector<double> m_buffer;
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
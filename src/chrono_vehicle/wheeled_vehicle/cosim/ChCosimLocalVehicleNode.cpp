@@ -0,0 +1,139 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// In-process cosimulation node responsible for simulating a wheeled vehicle.
+//
+// =============================================================================
+
+#include <algorithm>
+
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalVehicleNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+ChCosimLocalVehicleNode::ChCosimLocalVehicleNode(ChWheeledVehicle* vehicle, ChPowertrain* powertrain, ChDriver* driver)
+    : ChCosimLocalNode(vehicle->GetSystem()), m_vehicle(vehicle), m_powertrain(powertrain), m_driver(driver) {
+    m_num_wheels = 2 * m_vehicle->GetNumberAxles();
+    m_tire_forces.resize(m_num_wheels);
+    m_wheel_state_channels.resize(m_num_wheels);
+    m_tire_force_channels.resize(m_num_wheels);
+    SetStepsize(m_vehicle->GetStepsize());
+}
+
+void ChCosimLocalVehicleNode::SetWheelChannels(int wheel,
+                                               std::shared_ptr<ChCosimChannel> wheel_state,
+                                               std::shared_ptr<ChCosimChannel> tire_force) {
+    m_wheel_state_channels[wheel] = wheel_state;
+    m_tire_force_channels[wheel] = tire_force;
+}
+
+void ChCosimLocalVehicleNode::SetStepsize(double stepsize) {
+    ChCosimLocalNode::SetStepsize(stepsize);
+    m_vehicle->SetStepsize(stepsize);
+}
+
+void ChCosimLocalVehicleNode::OnSubstep(double time, double h) {
+    // Tire forces, interpolated at the current time
+    for (int iw = 0; iw < m_num_wheels; iw++) {
+        if (m_tire_force_channels[iw] && m_tire_force_channels[iw]->HasData()) {
+            m_tire_force_channels[iw]->Get(time, m_buffer);
+            UnpackTireForce(m_buffer, m_tire_forces[iw]);
+        }
+    }
+
+    // Current driver outputs, driveshaft speed, and powertrain output torque
+    double steering = m_driver->GetSteering();
+    double throttle = m_driver->GetThrottle();
+    double braking = m_driver->GetBraking();
+    double driveshaft_speed = m_vehicle->GetDriveshaftSpeed();
+    double powertrain_torque = m_powertrain->GetOutputTorque();
+
+    // Synchronize vehicle, powertrain, and driver
+    m_driver->Synchronize(time);
+    m_powertrain->Synchronize(time, throttle, driveshaft_speed);
+    m_vehicle->Synchronize(time, steering, braking, powertrain_torque, m_tire_forces);
+}
+
+void ChCosimLocalVehicleNode::Advance(double time, double step) {
+    double t = 0;
+    while (t < step) {
+        double h = std::min<>(m_stepsize, step - t);
+        OnSubstep(time + t, h);
+        m_driver->Advance(h);
+        m_powertrain->Advance(h);
+        m_vehicle->Advance(h);
+        t += h;
+    }
+}
+
+void ChCosimLocalVehicleNode::Output(double time) {
+    for (int iw = 0; iw < m_num_wheels; iw++) {
+        if (!m_wheel_state_channels[iw])
+            continue;
+        PackWheelState(m_vehicle->GetWheelState(WheelID(iw)), m_buffer);
+        m_wheel_state_channels[iw]->Put(time, m_buffer);
+    }
+}
+
+// -----------------------------------------------------------------------------
+
+void ChCosimLocalVehicleNode::PackWheelState(const WheelState& state, std::vector<double>& data) {
+    data.resize(14);
+    data[0] = state.pos.x();
+    data[1] = state.pos.y();
+    data[2] = state.pos.z();
+    data[3] = state.rot.e0();
+    data[4] = state.rot.e1();
+    data[5] = state.rot.e2();
+    data[6] = state.rot.e3();
+    data[7] = state.lin_vel.x();
+    data[8] = state.lin_vel.y();
+    data[9] = state.lin_vel.z();
+    data[10] = state.ang_vel.x();
+    data[11] = state.ang_vel.y();
+    data[12] = state.ang_vel.z();
+    data[13] = state.omega;
+}
+
+void ChCosimLocalVehicleNode::UnpackWheelState(const std::vector<double>& data, WheelState& state) {
+    state.pos = ChVector<>(data[0], data[1], data[2]);
+    state.rot = ChQuaternion<>(data[3], data[4], data[5], data[6]);
+    state.rot.Normalize();
+    state.lin_vel = ChVector<>(data[7], data[8], data[9]);
+    state.ang_vel = ChVector<>(data[10], data[11], data[12]);
+    state.omega = data[13];
+}
+
+void ChCosimLocalVehicleNode::PackTireForce(const TerrainForce& force, std::vector<double>& data) {
+    data.resize(9);
+    data[0] = force.force.x();
+    data[1] = force.force.y();
+    data[2] = force.force.z();
+    data[3] = force.moment.x();
+    data[4] = force.moment.y();
+    data[5] = force.moment.z();
+    data[6] = force.point.x();
+    data[7] = force.point.y();
+    data[8] = force.point.z();
+}
+
+void ChCosimLocalVehicleNode::UnpackTireForce(const std::vector<double>& data, TerrainForce& force) {
+    force.force = ChVector<>(data[0], data[1], data[2]);
+    force.moment = ChVector<>(data[3], data[4], data[5]);
+    force.point = ChVector<>(data[6], data[7], data[8]);
+}
+
+}  // end namespace vehicle
+}  // end namespace chrono
@@ -0,0 +1,90 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// In-process cosimulation node responsible for simulating a wheeled vehicle.
+//
+// =============================================================================
+
+#ifndef CH_COSIM_LOCAL_VEHICLE_NODE_H
+#define CH_COSIM_LOCAL_VEHICLE_NODE_H
+
+#include <memory>
+#include <vector>
+
+#include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/ChDriver.h"
+#include "chrono_vehicle/ChPowertrain.h"
+#include "chrono_vehicle/wheeled_vehicle/ChWheeledVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalNode.h"
+
+namespace chrono {
+namespace vehicle {
+
+/// @addtogroup vehicle_wheeled
+/// @{
+
+/// In-process cosimulation node for a wheeled vehicle (with powertrain and driver).
+/// Inputs: one tire force channel per wheel (interpolated at each vehicle step).
+/// Outputs: one wheel state channel per wheel.
+/// The vehicle, powertrain, and driver must be initialized before the cosimulation manager is initialized.
+class CH_VEHICLE_API ChCosimLocalVehicleNode : public ChCosimLocalNode {
+  public:
+    ChCosimLocalVehicleNode(ChWheeledVehicle* vehicle, ChPowertrain* powertrain, ChDriver* driver);
+
+    /// Get the number of vehicle wheels.
+    int GetNumWheels() const { return m_num_wheels; }
+
+    /// Set the data channels for the specified wheel.
+    void SetWheelChannels(int wheel,                                   ///< [in] wheel index
+                          std::shared_ptr<ChCosimChannel> wheel_state,  ///< [in] output wheel state channel
+                          std::shared_ptr<ChCosimChannel> tire_force    ///< [in] input tire force channel
+    );
+
+    virtual void SetStepsize(double stepsize) override;
+
+    virtual void Advance(double time, double step) override;
+    virtual void Output(double time) override;
+
+    /// Pack a wheel state as a channel sample.
+    static void PackWheelState(const WheelState& state, std::vector<double>& data);
+
+    /// Unpack a wheel state from a channel sample.
+    static void UnpackWheelState(const std::vector<double>& data, WheelState& state);
+
+    /// Pack a tire force as a channel sample.
+    static void PackTireForce(const TerrainForce& force, std::vector<double>& data);
+
+    /// Unpack a tire force from a channel sample.
+    static void UnpackTireForce(const std::vector<double>& data, TerrainForce& force);
+
+  private:
+    virtual void OnSubstep(double time, double h) override;
+
+    ChWheeledVehicle* m_vehicle;
+    ChPowertrain* m_powertrain;
+    ChDriver* m_driver;
+
+    int m_num_wheels;
+    TerrainForces m_tire_forces;
+    std::vector<std::shared_ptr<ChCosimChannel>> m_wheel_state_channels;
+    std::vector<std::shared_ptr<ChCosimChannel>> m_tire_force_channels;
+    std::vector<double> m_buffer;
+};
+
+/// @} vehicle_wheeled
+
+}  // end namespace vehicle
+}  // end namespace chrono
+
+#endif
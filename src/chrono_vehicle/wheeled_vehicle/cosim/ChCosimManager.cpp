@@ -25,7 +25,14 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimManager::ChCosimManager(int num_tires)
-    : m_num_tires(num_tires), m_vehicle_node(NULL), m_terrain_node(NULL), m_tire_node(NULL), m_verbose(false) {}
+    : m_num_tires(num_tires),
+      m_vehicle_node(NULL),
+      m_terrain_node(NULL),
+      m_tire_node(NULL),
+      m_verbose(false),
+      m_single_precision(false),
+      m_region_margin(0.1),
+      m_full_interval(0) {}
 
 ChCosimManager::~ChCosimManager() {
     delete m_vehicle_node;
@@ -71,6 +78,9 @@ bool ChCosimManager::Initialize() {
         m_terrain_node = new ChCosimTerrainNode(m_rank, GetChronoSystemTerrain(), GetTerrain(), m_num_tires);
         m_terrain_node->m_manager = this;
         m_terrain_node->SetStepsize(GetTerrainStepsize());
+        m_terrain_node->SetSinglePrecisionExchange(m_single_precision);
+        m_terrain_node->SetContactRegionMargin(m_region_margin);
+        m_terrain_node->SetFullExchangeInterval(m_full_interval);
         m_terrain_node->Initialize();
         if (m_verbose) {
             std::cout << "TERRAIN NODE created.  rank = " << m_rank << std::endl;
@@ -80,6 +90,7 @@ bool ChCosimManager::Initialize() {
         SetAsTireNode(id);
         m_tire_node = new ChCosimTireNode(m_rank, GetChronoSystemTire(id), GetTire(id), id);
         m_tire_node->SetStepsize(GetTireStepsize(id));
+        m_tire_node->SetSinglePrecisionExchange(m_single_precision);
         m_tire_node->Initialize();
         if (m_verbose) {
             std::cout << "TIRE NODE created.  rank = " << m_rank << std::endl;
@@ -61,7 +61,7 @@ class CH_VEHICLE_API ChCosimManager {
                                    const std::vector<ChVector<>>& vert_pos,
                                    const std::vector<ChVector<>>& vert_vel,
                                    const std::vector<ChVector<int>>& triangles) = 0;
-    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int> vert_indeces) = 0;
+    virtual void OnSendTireForces(int which, std::vector<ChVector<>>& vert_forces, std::vector<int>& vert_indeces) = 0;
     virtual void OnAdvanceTerrain() {}
 
     // Functions invoked only on a TIRE node
@@ -74,6 +74,19 @@ class CH_VEHICLE_API ChCosimManager {
 
     void SetVerbose(bool val) { m_verbose = val; }
 
+    /// Exchange tire mesh data and contact forces in single precision (default: false).
+    /// Must be called before Initialize.
+    void SetSinglePrecisionExchange(bool val) { m_single_precision = val; }
+
+    /// Set the margin used to inflate the bounding box of the tire vertices in contact (default: 0.1).
+    /// Only tire mesh vertices within this contact region are sent to the terrain node at the next step.
+    /// Must be called before Initialize.
+    void SetContactRegionMargin(double margin) { m_region_margin = margin; }
+
+    /// Request a full tire mesh exchange every 'interval' steps (default: 0, never).
+    /// Must be called before Initialize.
+    void SetFullExchangeInterval(int interval) { m_full_interval = interval; }
+
     bool Initialize();
     void Abort();
 
@@ -84,6 +97,9 @@ class CH_VEHICLE_API ChCosimManager {
     int m_rank;
     int m_num_tires;
     bool m_verbose;
+    bool m_single_precision;
+    double m_region_margin;
+    int m_full_interval;
 
     ChCosimVehicleNode* m_vehicle_node;
     ChCosimTerrainNode* m_terrain_node;
@@ -29,18 +29,23 @@ namespace vehicle {
 
 class CH_VEHICLE_API ChCosimNode {
   public:
-    ChCosimNode(int rank, ChSystem* system) : m_rank(rank), m_system(system), m_verbose(false) {}
+    ChCosimNode(int rank, ChSystem* system)
+        : m_rank(rank), m_system(system), m_verbose(false), m_single_precision(false) {}
 
     virtual void SetStepsize(double stepsize) { m_stepsize = stepsize; }
     double GetStepsize() const { return m_stepsize; }
 
     void SetVerbose(bool val) { m_verbose = val; }
 
+    /// Exchange real-valued tire mesh and contact force data in single precision (default: false).
+    void SetSinglePrecisionExchange(bool val) { m_single_precision = val; }
+
   protected:
     int m_rank;
     ChSystem* m_system;
     double m_stepsize;
     bool m_verbose;
+    bool m_single_precision;
 };
 
 }  // end namespace vehicle
@@ -17,6 +17,7 @@
 // =============================================================================
 
 #include <algorithm>
+#include <cstdio>
 
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimManager.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimTerrainNode.h"
@@ -25,7 +26,13 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimTerrainNode::ChCosimTerrainNode(int rank, ChSystem* system, ChTerrain* terrain, int num_tires)
-    : ChCosimNode(rank, system), m_terrain(terrain), m_num_tires(num_tires) {}
+    : ChCosimNode(rank, system), m_terrain(terrain), m_num_tires(num_tires), m_region_margin(0.1), m_full_interval(0) {}
+
+ChCosimTerrainNode::~ChCosimTerrainNode() {
+    // Cancel receives pre-posted for a step that will not be taken.
+    for (auto& receiver : m_mesh_receivers)
+        receiver->Cancel();
+}
 
 void ChCosimTerrainNode::Initialize() {
     // Receive contact specification from tire nodes
@@ -39,58 +46,57 @@ void ChCosimTerrainNode::Initialize() {
             printf("Terrain node %d.  Recv from %d props = %d %d\n", m_rank, TIRE_NODE_RANK(it), props[0], props[1]);
         }
 
+        // Receive mesh connectivity (sent only once)
+        std::vector<int> tri_data(3 * props[1]);
+        MPI_Recv(tri_data.data(), 3 * props[1], MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
+        std::vector<ChVector<int>> triangles(props[1]);
+        for (unsigned int i = 0; i < props[1]; i++)
+            triangles[i] = ChVector<int>(tri_data[3 * i + 0], tri_data[3 * i + 1], tri_data[3 * i + 2]);
+        m_triangles.push_back(triangles);
+
+        // Create the exchange objects and pre-post the receives for the first step
+        m_mesh_receivers.emplace_back(new ChCosimMeshReceiver(props[0], m_single_precision, TIRE_NODE_RANK(it), it));
+        m_force_senders.emplace_back(new ChCosimForceSender(props[0], m_single_precision, TIRE_NODE_RANK(it), it));
+        m_force_senders.back()->SetMargin(m_region_margin);
+        m_force_senders.back()->SetFullExchangeInterval(m_full_interval);
+        m_mesh_receivers.back()->Post(MPI_COMM_WORLD);
+
         m_manager->OnReceiveTireInfo(it, props[0], props[1]);
     }
 }
 
 void ChCosimTerrainNode::Synchronize(double time) {
-    for (int it = 0; it < m_num_tires; it++) {
-        // Receive tire mesh vertex locations and velocities from the tire node
-        MPI_Status status;
-        unsigned int num_vert = m_num_vertices[it];
-        unsigned int num_tri = m_num_triangles[it];
-        double* vert_data = new double[2 * 3 * num_vert];
-        int* tri_data = new int[3 * num_tri];
-        MPI_Recv(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
-        MPI_Recv(tri_data, 3 * num_tri, MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD, &status);
-
-        // Unpack received data
-        std::vector<ChVector<>> vert_pos;
-        std::vector<ChVector<>> vert_vel;
-        std::vector<ChVector<int>> triangles;
-        for (unsigned int i = 0; i < num_vert; i++) {
-            vert_pos.push_back(ChVector<>(vert_data[3 * i + 0], vert_data[3 * i + 1], vert_data[3 * i + 2]));
-            vert_vel.push_back(ChVector<>(vert_data[3 * num_vert + 3 * i + 0], vert_data[3 * num_vert + 3 * i + 1],
-                                          vert_data[3 * num_vert + 3 * i + 2]));
-        }
-        for (unsigned int i = 0; i < num_tri; i++) {
-            triangles.push_back(ChVector<int>(tri_data[3 * i + 0], tri_data[3 * i + 1], tri_data[3 * i + 2]));
+    // Process the tire nodes in the order in which their mesh data arrives.
+    std::vector<MPI_Request> requests(m_num_tires);
+    for (int it = 0; it < m_num_tires; it++)
+        requests[it] = m_mesh_receivers[it]->GetDataRequest();
+
+    for (int k = 0; k < m_num_tires; k++) {
+        int it;
+        MPI_Waitany(m_num_tires, requests.data(), &it, MPI_STATUS_IGNORE);
+        m_mesh_receivers[it]->GetDataRequest() = requests[it];
+
+        // Complete the exchange (vertices outside the contact region are moved rigidly with the wheel)
+        auto& receiver = m_mesh_receivers[it];
+        receiver->Complete();
+        if (m_verbose) {
+            printf("Terrain node %d.  Recv from %d  %d vertices\n", m_rank, TIRE_NODE_RANK(it),
+                   receiver->GetNumReceived());
         }
 
-        delete[] vert_data;
-        delete[] tri_data;
-
         // Let derived class process received data
-        m_manager->OnReceiveTireData(it, vert_pos, vert_vel, triangles);
+        m_manager->OnReceiveTireData(it, receiver->GetPositions(), receiver->GetVelocities(), m_triangles[it]);
 
         // Let derived class produce tire contact forces
         std::vector<ChVector<>> vert_forces;
         std::vector<int> vert_indeces;
         m_manager->OnSendTireForces(it, vert_forces, vert_indeces);
-        num_vert = (unsigned int)vert_indeces.size();
-
-        // Send vertex indeces and forces to the tire node
-        //// TODO: use custom derived MPI types?
-        double* force_data = new double[3 * num_vert];
-        for (unsigned int i = 0; i < num_vert; i++) {
-            force_data[3 * i + 0] = vert_forces[i].x;
-            force_data[3 * i + 1] = vert_forces[i].y;
-            force_data[3 * i + 2] = vert_forces[i].z;
-        }
-        MPI_Send(vert_indeces.data(), num_vert, MPI_INT, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
-        MPI_Send(force_data, 3 * num_vert, MPI_DOUBLE, TIRE_NODE_RANK(it), it, MPI_COMM_WORLD);
 
-        delete[] force_data;
+        // Send vertex indeces and forces (and the contact region for the next exchange) to the tire node
+        m_force_senders[it]->Send(vert_indeces, vert_forces, receiver->GetPositions(), MPI_COMM_WORLD);
+
+        // Pre-post the receives for the next step
+        receiver->Post(MPI_COMM_WORLD);
     }
 
     m_terrain->Synchronize(time);
@@ -19,12 +19,14 @@
 #ifndef CH_COSIM_TERRAIN_NODE_H
 #define CH_COSIM_TERRAIN_NODE_H
 
+#include <memory>
 #include <vector>
 #include "mpi.h"
 
 #include "chrono/physics/ChSystem.h"
 #include "chrono_vehicle/ChApiVehicle.h"
 #include "chrono_vehicle/ChTerrain.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimExchange.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimNode.h"
 
 namespace chrono {
@@ -35,6 +37,14 @@ class ChCosimManager;
 class CH_VEHICLE_API ChCosimTerrainNode : public ChCosimNode {
   public:
     ChCosimTerrainNode(int rank, ChSystem* system, ChTerrain* terrain, int num_tires);
+    ~ChCosimTerrainNode();
+
+    /// Set the margin used to inflate the bounding box of the tire vertices in contact (default: 0.1).
+    /// Only tire mesh vertices within this contact region are exchanged at the next step.
+    void SetContactRegionMargin(double margin) { m_region_margin = margin; }
+
+    /// Request a full tire mesh exchange every 'interval' steps (default: 0, never).
+    void SetFullExchangeInterval(int interval) { m_full_interval = interval; }
 
     void Initialize();
     void Synchronize(double time);
@@ -46,6 +56,12 @@ class CH_VEHICLE_API ChCosimTerrainNode : public ChCosimNode {
     int m_num_tires;                            // number of tires
     std::vector<unsigned int> m_num_vertices;   // number of contact vertices received from each tire
     std::vector<unsigned int> m_num_triangles;  // number of contact triangles received from each tire
+    std::vector<std::vector<ChVector<int>>> m_triangles;  // mesh connectivity for each tire
+
+    std::vector<std::unique_ptr<ChCosimMeshReceiver>> m_mesh_receivers;  // receivers of tire mesh data
+    std::vector<std::unique_ptr<ChCosimForceSender>> m_force_senders;    // non-blocking senders of contact forces
+    double m_region_margin;                                              // contact region margin
+    int m_full_interval;                                                 // interval for full mesh exchanges
 
     friend class ChCosimManager;
 };
@@ -28,7 +28,7 @@ namespace chrono {
 namespace vehicle {
 
 ChCosimTireNode::ChCosimTireNode(int rank, ChSystem* system, ChDeformableTire* tire, WheelID id)
-    : ChCosimNode(rank, system), m_tire(tire), m_id(id) {}
+    : ChCosimNode(rank, system), m_tire(tire), m_id(id), m_exchange_pending(false) {}
 
 void ChCosimTireNode::Initialize() {
     // Ghost wheel body (driven kinematically through messages from vehicle node)
@@ -67,30 +67,48 @@ void ChCosimTireNode::Initialize() {
     m_tire->GetLoadContainer()->Add(m_contact_load);
 
     // Send contact specification to terrain node
+    unsigned int props[2];
+    props[0] = contact_surface->GetNumVertices();
+    props[1] = contact_surface->GetNumTriangles();
+    MPI_Send(props, 2, MPI_UNSIGNED, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
+    if (m_verbose) {
+        printf("Tire node %d. Send to %d props = %d %d\n", m_rank, TERRAIN_NODE_RANK, props[0], props[1]);
+    }
+
+    // Send mesh connectivity to terrain node (once; it does not change during the simulation)
     {
-        unsigned int props[2];
-        props[0] = contact_surface->GetNumVertices();
-        props[1] = contact_surface->GetNumTriangles();
-        MPI_Send(props, 2, MPI_UNSIGNED, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
-        if (m_verbose) {
-            printf("Tire node %d. Send to %d props = %d %d\n", m_rank, TERRAIN_NODE_RANK, props[0], props[1]);
+        std::vector<ChVector<>> vert_pos;
+        std::vector<ChVector<>> vert_vel;
+        std::vector<ChVector<int>> triangles;
+        m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
+        std::vector<int> tri_data(3 * triangles.size());
+        for (size_t it = 0; it < triangles.size(); it++) {
+            tri_data[3 * it + 0] = triangles[it].x();
+            tri_data[3 * it + 1] = triangles[it].y();
+            tri_data[3 * it + 2] = triangles[it].z();
         }
+        MPI_Send(tri_data.data(), (int)tri_data.size(), MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
     }
+
+    // Create the mesh data and contact force exchange objects.
+    // The first exchange includes the full mesh (default contact region).
+    m_mesh_sender.reset(new ChCosimMeshSender(props[0], m_single_precision, TERRAIN_NODE_RANK, m_id.id()));
+    m_force_receiver.reset(new ChCosimForceReceiver(props[0], m_single_precision, TERRAIN_NODE_RANK, m_id.id()));
 }
 
 void ChCosimTireNode::Synchronize(double time) {
     // Send tire force to the vehicle node
-    TireForce tire_force = m_tire->GetTireForce(true);
+    TerrainForce tire_force = m_tire->ReportTireForce(m_terrain.get());
     double bufTF[9];
-    bufTF[0] = tire_force.force.x;
-    bufTF[1] = tire_force.force.y;
-    bufTF[2] = tire_force.force.z;
-    bufTF[3] = tire_force.moment.x;
-    bufTF[4] = tire_force.moment.y;
-    bufTF[5] = tire_force.moment.z;
-    bufTF[6] = tire_force.point.x;
-    bufTF[7] = tire_force.point.y;
-    bufTF[8] = tire_force.point.z;
+    bufTF[0] = tire_force.force.x();
+    bufTF[1] = tire_force.force.y();
+    bufTF[2] = tire_force.force.z();
+    bufTF[3] = tire_force.moment.x();
+    bufTF[4] = tire_force.moment.y();
+    bufTF[5] = tire_force.moment.z();
+    bufTF[6] = tire_force.point.x();
+    bufTF[7] = tire_force.point.y();
+    bufTF[8] = tire_force.point.z();
     MPI_Send(bufTF, 9, MPI_DOUBLE, VEHICLE_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
 
     // Receive wheel state from the vehicle node
@@ -104,61 +122,22 @@ void ChCosimTireNode::Synchronize(double time) {
     wheel_state.ang_vel = ChVector<>(bufWS[10], bufWS[11], bufWS[12]);
     wheel_state.omega = bufWS[13];
 
-    // Extract tire mesh vertex locations and velocities
+    // Post receives for the terrain forces before sending the mesh data, so that the reply from the terrain
+    // node can be delivered directly into the receive buffers.
+    m_force_receiver->Post(MPI_COMM_WORLD);
+
+    // Send tire mesh vertex locations and velocities (in the current contact region) to the terrain node.
+    // Vertices outside the contact region are moved rigidly with the wheel on the terrain node, so the wheel frame
+    // consistent with the current mesh state (i.e., before synchronizing the ghost wheel) is sent along.
     std::vector<ChVector<>> vert_pos;
     std::vector<ChVector<>> vert_vel;
     std::vector<ChVector<int>> triangles;
     m_contact_load->OutputSimpleMesh(vert_pos, vert_vel, triangles);
-    unsigned int num_vert = (unsigned int)vert_pos.size();
-    unsigned int num_tri = (unsigned int)triangles.size();
-
-    // Send tire mesh vertex locations and velocities to the terrain node
-    //// TODO: use custom derived MPI types?
-    double* vert_data = new double[2 * 3 * num_vert];
-    int* tri_data = new int[3 * num_tri];
-    for (unsigned int iv = 0; iv < num_vert; iv++) {
-        vert_data[3 * iv + 0] = vert_pos[iv].x;
-        vert_data[3 * iv + 1] = vert_pos[iv].y;
-        vert_data[3 * iv + 2] = vert_pos[iv].z;
-    }
-    for (unsigned int iv = 0; iv < num_vert; iv++) {
-        vert_data[3 * num_vert + 3 * iv + 0] = vert_vel[iv].x;
-        vert_data[3 * num_vert + 3 * iv + 1] = vert_vel[iv].y;
-        vert_data[3 * num_vert + 3 * iv + 2] = vert_vel[iv].z;
-    }
-    for (unsigned int it = 0; it < num_tri; it++) {
-        tri_data[3 * it + 0] = triangles[it].x;
-        tri_data[3 * it + 1] = triangles[it].y;
-        tri_data[3 * it + 2] = triangles[it].z;
-    }
-    MPI_Send(vert_data, 2 * 3 * num_vert, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
-    MPI_Send(tri_data, 3 * num_tri, MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD);
-
-    delete[] vert_data;
-    delete[] tri_data;
-
-    // Receive terrain force(s) from the terrain node
-    // Note that we use MPI_Probe to figure out the number of indeces and forces received.
-    MPI_Status status;
-    int count;
-    MPI_Probe(TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
-    MPI_Get_count(&status, MPI_INT, &count);
-    int* index_data = new int[count];
-    double* force_data = new double[3 * count];
-    MPI_Recv(index_data, count, MPI_INT, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
-    MPI_Recv(force_data, 3 * count, MPI_DOUBLE, TERRAIN_NODE_RANK, m_id.id(), MPI_COMM_WORLD, &status);
-
-    // Repack data and apply forces to the mesh vertices
-    std::vector<ChVector<>> vert_forces;
-    std::vector<int> vert_indeces;
-    for (int iv = 0; iv < count; iv++) {
-        vert_forces.push_back(ChVector<>(force_data[3 * iv + 0], force_data[3 * iv + 1], force_data[3 * iv + 2]));
-        vert_indeces.push_back(index_data[iv]);
-    }
-    m_contact_load->InputSimpleForces(vert_forces, vert_indeces);
+    m_mesh_sender->Send(*m_wheel, vert_pos, vert_vel, m_region, MPI_COMM_WORLD);
 
-    delete[] index_data;
-    delete[] force_data;
+    // The terrain forces are received at the beginning of Advance, so that the terrain node can process the mesh
+    // data while this node synchronizes the ghost wheel and the tire.
+    m_exchange_pending = true;
 
     // Synchronize the ghost wheel and the tire
     m_wheel->SetPos(wheel_state.pos);
@@ -170,6 +149,21 @@ void ChCosimTireNode::Synchronize(double time) {
 }
 
 void ChCosimTireNode::Advance(double step) {
+    // Complete the exchange started in Synchronize: receive terrain force(s) and the contact region for the next
+    // exchange from the terrain node
+    if (m_exchange_pending) {
+        std::vector<ChVector<>> vert_forces;
+        std::vector<int> vert_indeces;
+        m_force_receiver->Complete(vert_indeces, vert_forces, m_region);
+        m_contact_load->InputSimpleForces(vert_forces, vert_indeces);
+        m_exchange_pending = false;
+
+        if (m_verbose) {
+            printf("Tire node %d. Sent %d vertices (%d bytes). Recv %d forces\n", m_rank,
+                   m_mesh_sender->GetNumSent(), m_mesh_sender->GetNumBytes(), (int)vert_indeces.size());
+        }
+    }
+
     double t = 0;
     while (t < step) {
         double h = std::min<>(m_stepsize, step - t);
@@ -19,11 +19,13 @@
 #ifndef CH_COSIM_TIRE_NODE_H
 #define CH_COSIM_TIRE_NODE_H
 
+#include <memory>
 #include "mpi.h"
 
 #include "chrono/physics/ChSystem.h"
 #include "chrono_fea/ChLoadContactSurfaceMesh.h"
 #include "chrono_vehicle/ChApiVehicle.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimExchange.h"
 #include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimNode.h"
 #include "chrono_vehicle/wheeled_vehicle/tire/ChDeformableTire.h"
 
@@ -45,6 +47,11 @@ class CH_VEHICLE_API ChCosimTireNode : public ChCosimNode {
     std::shared_ptr<ChTerrain> m_terrain;
 
     std::shared_ptr<fea::ChLoadContactSurfaceMesh> m_contact_load;
+
+    std::unique_ptr<ChCosimMeshSender> m_mesh_sender;        // non-blocking sender of mesh data
+    std::unique_ptr<ChCosimForceReceiver> m_force_receiver;  // receiver of contact forces
+    ChCosimContactRegion m_region;                           // current contact region (set by terrain node)
+    bool m_exchange_pending;                                 // terrain forces posted but not yet received
 };
 
 }  // end namespace vehicle
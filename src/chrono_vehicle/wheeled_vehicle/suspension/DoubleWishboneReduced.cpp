@@ -19,10 +19,9 @@
 #include <cstdio>
 
 #include "chrono_vehicle/wheeled_vehicle/suspension/DoubleWishboneReduced.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
-#include "chrono_thirdparty/rapidjson/filereadstream.h"
-
 using namespace rapidjson;
 
 namespace chrono {
@@ -34,15 +33,8 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 DoubleWishboneReduced::DoubleWishboneReduced(const std::string& filename)
     : ChDoubleWishboneReduced(""), m_shockForceCB(NULL) {
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     Create(d);
 
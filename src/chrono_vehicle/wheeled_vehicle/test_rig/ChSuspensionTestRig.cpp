@@ -51,7 +51,6 @@
 #include "chrono_vehicle/utils/ChUtilsJSON.h"
 
 #include "chrono_thirdparty/rapidjson/document.h"
-#include "chrono_thirdparty/rapidjson/filereadstream.h"
 #include "chrono_thirdparty/rapidjson/prettywriter.h"
 #include "chrono_thirdparty/rapidjson/stringbuffer.h"
 
@@ -98,15 +97,8 @@ const double ChSuspensionTestRig::m_post_radius = 0.4;
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
 void ChSuspensionTestRig::LoadSteering(const std::string& filename) {
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Check that the given file is a steering specification file.
     assert(d.HasMember("Type"));
@@ -129,15 +121,8 @@ void ChSuspensionTestRig::LoadSteering(const std::string& filename) {
 }
 
 void ChSuspensionTestRig::LoadSuspension(const std::string& filename) {
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Check that the given file is a suspension specification file.
     assert(d.HasMember("Type"));
@@ -169,15 +154,8 @@ void ChSuspensionTestRig::LoadSuspension(const std::string& filename) {
 }
 
 void ChSuspensionTestRig::LoadWheel(const std::string& filename, int side) {
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Check that the given file is a wheel specification file.
     assert(d.HasMember("Type"));
@@ -197,15 +175,8 @@ void ChSuspensionTestRig::LoadWheel(const std::string& filename, int side) {
 }
 
 void ChSuspensionTestRig::LoadAntirollbar(const std::string& filename) {
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Check that the given file is an antirollbar specification file.
     assert(d.HasMember("Type"));
@@ -263,15 +234,8 @@ ChSuspensionTestRig::ChSuspensionTestRig(const std::string& filename,
                                          ChMaterialSurface::ContactMethod contact_method)
     : ChVehicle("SuspensionTestRig", contact_method), m_displ_limit(displ_limit) {
     // Open and parse the input file (vehicle JSON specification file)
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Read top-level data
     assert(d.HasMember("Type"));
@@ -325,15 +289,8 @@ ChSuspensionTestRig::ChSuspensionTestRig(const std::string& filename,
                                          ChMaterialSurface::ContactMethod contact_method)
     : ChVehicle("SuspensionTestRig", contact_method) {
     // Open and parse the input file (rig JSON specification file)
-    FILE* fp = fopen(filename.c_str(), "r");
-
-    char readBuffer[65536];
-    FileReadStream is(fp, readBuffer, sizeof(readBuffer));
-
-    fclose(fp);
-
-    Document d;
-    d.ParseStream<ParseFlag::kParseCommentsFlag>(is);
+    auto doc = ReadFileJSON(filename);
+    const Document& d = *doc;
 
     // Read top-level data
     assert(d.HasMember("Type"));
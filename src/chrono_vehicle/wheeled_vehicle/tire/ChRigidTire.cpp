@@ -22,6 +22,7 @@
 #include "chrono/physics/ChSystem.h"
 #include "chrono/physics/ChContactContainer.h"
 
+#include "chrono_vehicle/ChVehicleModelData.h"
 #include "chrono_vehicle/wheeled_vehicle/tire/ChRigidTire.h"
 
 #include "chrono_vehicle/terrain/SCMDeformableTerrain.h"
@@ -33,9 +34,7 @@ namespace vehicle {
 // -----------------------------------------------------------------------------
 ChRigidTire::ChRigidTire(const std::string& name) : ChTire(name), m_use_contact_mesh(false), m_trimesh(nullptr) {}
 
-ChRigidTire::~ChRigidTire() {
-    delete m_trimesh;
-}
+ChRigidTire::~ChRigidTire() {}
 
 // -----------------------------------------------------------------------------
 // -----------------------------------------------------------------------------
@@ -58,8 +57,7 @@ void ChRigidTire::Initialize(std::shared_ptr<ChBody> wheel, VehicleSide side) {
 
     if (m_use_contact_mesh) {
         // Mesh contact
-        m_trimesh = new geometry::ChTriangleMeshConnected;
-        m_trimesh->LoadWavefrontMesh(m_contact_meshFile, true, false);
+        m_trimesh = LoadMeshFile(m_contact_meshFile, true, false);
 
         wheel->GetCollisionModel()->AddTriangleMesh(*m_trimesh, false, false, ChVector<>(0), ChMatrix33<>(1),
                                                     m_sweep_sphere_radius);
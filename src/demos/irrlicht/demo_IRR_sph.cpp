@@ -159,6 +159,7 @@ int main(int argc, char* argv[]) {
 
     // IMPORTANT!
     // This takes care of the interaction between the particles of the SPH material
+    // (not needed if the fluid uses its built-in neighbor search, see ChMatterSPH::SetUseNeighborGrid)
     auto my_sph_proximity = std::make_shared<ChProximityContainerSPH>();
     mphysicalSystem.Add(my_sph_proximity);
 
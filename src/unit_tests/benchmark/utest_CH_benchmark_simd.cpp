@@ -0,0 +1,213 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Benchmark for the SIMD (AVX) implementations of the small fixed-size math
+// operations used in body/frame transforms and in FEA element loops:
+//    quaternion products
+//    3x3 matrix - vector products (only [M]'*v has an AVX implementation)
+//    small ChMatrixNM products (A*B and A'*B)
+// Each operation is timed for the library implementation (which uses AVX for
+// double types, if available) and for a scalar reference implementation.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/core/ChMatrix33.h"
+#include "chrono/core/ChMatrixNM.h"
+#include "chrono/core/ChQuaternion.h"
+#include "chrono/core/ChTimer.h"
+
+using namespace chrono;
+
+const int num_reps = 2000000;
+
+// Scalar reference implementations
+// --------------------------------
+
+void RefCross(ChQuaternion<>& q, const ChQuaternion<>& qa, const ChQuaternion<>& qb) {
+    q = ChQuaternion<>(qa.e0() * qb.e0() - qa.e1() * qb.e1() - qa.e2() * qb.e2() - qa.e3() * qb.e3(),
+                       qa.e0() * qb.e1() + qa.e1() * qb.e0() - qa.e3() * qb.e2() + qa.e2() * qb.e3(),
+                       qa.e0() * qb.e2() + qa.e2() * qb.e0() + qa.e3() * qb.e1() - qa.e1() * qb.e3(),
+                       qa.e0() * qb.e3() + qa.e3() * qb.e0() - qa.e2() * qb.e1() + qa.e1() * qb.e2());
+}
+
+ChVector<> RefMatr_x_Vect(const ChMatrix33<>& M, const ChVector<>& v) {
+    return ChVector<>(M(0, 0) * v.x() + M(0, 1) * v.y() + M(0, 2) * v.z(),
+                      M(1, 0) * v.x() + M(1, 1) * v.y() + M(1, 2) * v.z(),
+                      M(2, 0) * v.x() + M(2, 1) * v.y() + M(2, 2) * v.z());
+}
+
+ChVector<> RefMatrT_x_Vect(const ChMatrix33<>& M, const ChVector<>& v) {
+    return ChVector<>(M(0, 0) * v.x() + M(1, 0) * v.y() + M(2, 0) * v.z(),
+                      M(0, 1) * v.x() + M(1, 1) * v.y() + M(2, 1) * v.z(),
+                      M(0, 2) * v.x() + M(1, 2) * v.y() + M(2, 2) * v.z());
+}
+
+void RefMultiply(ChMatrix<>& C, const ChMatrix<>& A, const ChMatrix<>& B) {
+    for (int j = 0; j < B.GetColumns(); ++j) {
+        for (int i = 0; i < A.GetRows(); ++i) {
+            double sum = 0;
+            for (int k = 0; k < A.GetColumns(); ++k)
+                sum += A.Element(i, k) * B.Element(k, j);
+            C.SetElement(i, j, sum);
+        }
+    }
+}
+
+void RefTMultiply(ChMatrix<>& C, const ChMatrix<>& A, const ChMatrix<>& B) {
+    for (int j = 0; j < B.GetColumns(); ++j) {
+        for (int i = 0; i < A.GetColumns(); ++i) {
+            double sum = 0;
+            for (int k = 0; k < A.GetRows(); ++k)
+                sum += A.Element(k, i) * B.Element(k, j);
+            C.SetElement(i, j, sum);
+        }
+    }
+}
+
+// Benchmarks
+// ----------
+
+void Report(const char* name, int reps, double t_ref, double t_lib, double check) {
+    printf("%-24s  scalar: %8.2f ns   library: %8.2f ns   speedup: %5.2f   (check %g)\n", name, 1e9 * t_ref / reps,
+           1e9 * t_lib / reps, t_ref / t_lib, check);
+}
+
+void BenchQuaternion() {
+    ChTimer<double> t_ref, t_lib;
+    ChQuaternion<> qa(0.5, 0.5, 0.5, 0.5);
+    ChQuaternion<> qb = Q_from_AngAxis(1e-3, ChVector<>(1, 2, 3).GetNormalized());
+    ChQuaternion<> q1 = qa, q2 = qa;
+
+    t_ref.start();
+    for (int i = 0; i < num_reps; i++)
+        RefCross(q1, q1, qb);
+    t_ref.stop();
+
+    t_lib.start();
+    for (int i = 0; i < num_reps; i++)
+        q2.Cross(q2, qb);
+    t_lib.stop();
+
+    Report("quaternion product", num_reps, t_ref(), t_lib(), (q1 - q2).Length());
+}
+
+void BenchMatrixVector() {
+    ChTimer<double> t_ref, t_lib;
+    ChMatrix33<> M(Q_from_AngAxis(1e-3, ChVector<>(1, 2, 3).GetNormalized()));
+    ChVector<> v1(1, 2, 3), v2(1, 2, 3);
+
+    t_ref.start();
+    for (int i = 0; i < num_reps; i++)
+        v1 = RefMatr_x_Vect(M, v1);
+    t_ref.stop();
+
+    t_lib.start();
+    for (int i = 0; i < num_reps; i++)
+        v2 = M.Matr_x_Vect(v2);
+    t_lib.stop();
+
+    Report("ChMatrix33 * v", num_reps, t_ref(), t_lib(), (v1 - v2).Length());
+
+    t_ref.reset();
+    t_lib.reset();
+
+    t_ref.start();
+    for (int i = 0; i < num_reps; i++)
+        v1 = RefMatrT_x_Vect(M, v1);
+    t_ref.stop();
+
+    t_lib.start();
+    for (int i = 0; i < num_reps; i++)
+        v2 = M.MatrT_x_Vect(v2);
+    t_lib.stop();
+
+    Report("ChMatrix33' * v", num_reps, t_ref(), t_lib(), (v1 - v2).Length());
+}
+
+template <int M, int N, int K>
+void BenchMultiply(const char* name, int reps) {
+    ChTimer<double> t_ref, t_lib;
+    ChMatrixNM<double, M, N> A;
+    ChMatrixNM<double, N, K> B;
+    ChMatrixNM<double, M, K> C1, C2;
+    A.FillRandom(1, -1);
+    B.FillRandom(1, -1);
+    double sum1 = 0, sum2 = 0;
+
+    t_ref.start();
+    for (int i = 0; i < reps; i++) {
+        RefMultiply(C1, A, B);
+        sum1 += C1(i % M, i % K);
+    }
+    t_ref.stop();
+
+    t_lib.start();
+    for (int i = 0; i < reps; i++) {
+        C2.MatrMultiply(A, B);
+        sum2 += C2(i % M, i % K);
+    }
+    t_lib.stop();
+
+    Report(name, reps, t_ref(), t_lib(), sum1 - sum2);
+}
+
+template <int M, int N, int K>
+void BenchTMultiply(const char* name, int reps) {
+    ChTimer<double> t_ref, t_lib;
+    ChMatrixNM<double, N, M> A;
+    ChMatrixNM<double, N, K> B;
+    ChMatrixNM<double, M, K> C1, C2;
+    A.FillRandom(1, -1);
+    B.FillRandom(1, -1);
+    double sum1 = 0, sum2 = 0;
+
+    t_ref.start();
+    for (int i = 0; i < reps; i++) {
+        RefTMultiply(C1, A, B);
+        sum1 += C1(i % M, i % K);
+    }
+    t_ref.stop();
+
+    t_lib.start();
+    for (int i = 0; i < reps; i++) {
+        C2.MatrTMultiply(A, B);
+        sum2 += C2(i % M, i % K);
+    }
+    t_lib.stop();
+
+    Report(name, reps, t_ref(), t_lib(), sum1 - sum2);
+}
+
+int main(int argc, char* argv[]) {
+#ifdef CHRONO_HAS_AVX
+    printf("AVX implementations enabled\n\n");
+#else
+    printf("AVX not available: library uses the scalar implementations\n\n");
+#endif
+
+    BenchQuaternion();
+    BenchMatrixVector();
+
+    BenchMultiply<3, 3, 3>("ChMatrix33 * ChMatrix33", num_reps);
+    BenchMultiply<3, 3, 4>("(3x3) * (3x4)", num_reps);
+    BenchMultiply<6, 6, 6>("(6x6) * (6x6)", num_reps / 4);
+    BenchMultiply<12, 12, 12>("(12x12) * (12x12)", num_reps / 20);
+    BenchMultiply<24, 24, 24>("(24x24) * (24x24)", num_reps / 100);
+    BenchTMultiply<24, 6, 24>("(6x24)' * (6x24)", num_reps / 50);
+    BenchTMultiply<9, 24, 9>("(24x9)' * (24x9)", num_reps / 50);
+
+    return 0;
+}
@@ -12,10 +12,13 @@
 // Authors: Milad Rakhsha, Radu Serban
 // =============================================================================
 //
-// Unit test for MatrMultiplyAVX and MatrMultiplyTAVX.
+// Unit test for the AVX implementations of matrix products (MatrMultiplyAVX,
+// MatrMultiplyTAVX, and the double specializations of MatrMultiply,
+// MatrTMultiply, ChMatrix33 matrix-vector products and quaternion products).
 //
 // =============================================================================
 
+#include "chrono/core/ChMatrix33.h"
 #include "chrono/core/ChMatrixDynamic.h"
 #include "chrono/core/ChLog.h"
 
@@ -32,6 +35,18 @@ void FillRand(ChMatrix<double>& matra) {
     }
 }
 
+// Reference (scalar) multiplication [A]*[B], or [A]'*[B] if transposeA is true
+void RefMultiply(const ChMatrix<double>& A, const ChMatrix<double>& B, ChMatrix<double>& C, bool transposeA) {
+    for (int i = 0; i < C.GetRows(); i++) {
+        for (int j = 0; j < C.GetColumns(); j++) {
+            double sum = 0;
+            for (int k = 0; k < B.GetRows(); k++)
+                sum += (transposeA ? A(k, i) : A(i, k)) * B(k, j);
+            C(i, j) = sum;
+        }
+    }
+}
+
 // Check multiplication A*B of random matrices A (MxN) and B (NxK)
 bool CheckMatMult(int M, int N, int K, double tolerance) {
     GetLog() << "(" << M << "x" << N << ") * (" << N << "x" << K << ")   ... ";
@@ -42,12 +57,16 @@ bool CheckMatMult(int M, int N, int K, double tolerance) {
     B.FillRandom(10, -10);
 
     ChMatrixDynamic<double> ref(M, K);
-    ref.MatrMultiply(A, B);
+    RefMultiply(A, B, ref, false);
 
     ChMatrixDynamic<double> avx(M, K);
     avx.MatrMultiplyAVX(A, B);
 
-    if (avx.Equals(ref, tolerance)) {
+    // MatrMultiply uses the same implementation for double matrices
+    ChMatrixDynamic<double> mul(M, K);
+    mul.MatrMultiply(A, B);
+
+    if (avx.Equals(ref, tolerance) && mul.Equals(ref, tolerance)) {
         GetLog() << "OK\n";
         return true;
     }
@@ -63,6 +82,37 @@ bool CheckMatMult(int M, int N, int K, double tolerance) {
     return false;
 }
 
+// Check multiplication A'*B of random matrices A (NxM) and B (NxK)
+bool CheckMatTMult(int M, int N, int K, double tolerance) {
+    GetLog() << "(" << N << "x" << M << ")^T * (" << N << "x" << K << ")   ... ";
+
+    ChMatrixDynamic<double> A(N, M);
+    ChMatrixDynamic<double> B(N, K);
+    A.FillRandom(10, -10);
+    B.FillRandom(10, -10);
+
+    ChMatrixDynamic<double> ref(M, K);
+    RefMultiply(A, B, ref, true);
+
+    ChMatrixDynamic<double> avx(M, K);
+    avx.MatrTMultiply(A, B);
+
+    if (avx.Equals(ref, tolerance)) {
+        GetLog() << "OK\n";
+        return true;
+    }
+
+    GetLog() << "FAILED\n";
+    GetLog() << "\n(A'*B)_ref";
+    ref.StreamOUT(GetLog());
+    GetLog() << "\n(A'*B)_avx";
+    avx.StreamOUT(GetLog());
+    GetLog() << "\n(A'*B)_avx - (A'*B)_ref";
+    (avx - ref).StreamOUT(GetLog());
+
+    return false;
+}
+
 // Check multiplication A*B' of random matrices A (MxN) and B (KxN)
 bool CheckMatMultT(int M, int N, int K, double tolerance) {
     GetLog() << "(" << M << "x" << N << ") * (" << K << "x" << N << ")^T   ... ";
@@ -94,6 +144,51 @@ bool CheckMatMultT(int M, int N, int K, double tolerance) {
     return false;
 }
 
+// Check 3x3 matrix-vector products and quaternion products
+bool CheckSmall(double tolerance) {
+    GetLog() << "ChMatrix33 * ChVector, ChQuaternion * ChQuaternion   ... ";
+
+    ChMatrix33<double> R;
+    R.FillRandom(10, -10);
+    ChVector<double> v(1.5, -2.25, 3.125);
+
+    ChMatrixNM<double, 3, 1> vm;
+    vm.PasteVector(v, 0, 0);
+    ChMatrixNM<double, 3, 1> ref;
+    RefMultiply(R, vm, ref, false);
+    ChMatrixNM<double, 3, 1> refT;
+    RefMultiply(R, vm, refT, true);
+
+    bool ok = (R.Matr_x_Vect(v) - ref.ClipVector(0, 0)).Length() < tolerance &&
+              (R.MatrT_x_Vect(v) - refT.ClipVector(0, 0)).Length() < tolerance;
+
+    ChQuaternion<double> qa(0.1, -0.7, 0.5, 1.3);
+    ChQuaternion<double> qb(-0.4, 0.2, 1.1, 0.6);
+    ChQuaternion<double> q = qa * qb;
+    ChQuaternion<double> q_ref(qa.e0() * qb.e0() - qa.e1() * qb.e1() - qa.e2() * qb.e2() - qa.e3() * qb.e3(),
+                               qa.e0() * qb.e1() + qa.e1() * qb.e0() - qa.e3() * qb.e2() + qa.e2() * qb.e3(),
+                               qa.e0() * qb.e2() + qa.e2() * qb.e0() + qa.e3() * qb.e1() - qa.e1() * qb.e3(),
+                               qa.e0() * qb.e3() + qa.e3() * qb.e0() - qa.e2() * qb.e1() + qa.e1() * qb.e2());
+    ok &= (q - q_ref).Length() < tolerance;
+
+    // In-place product (result aliased with the first operand)
+    qa *= qb;
+    ok &= (qa - q_ref).Length() < tolerance;
+
+    // Same for the scalar implementation, with the result aliased with either operand
+    ChQuaternion<float> fa(0.1f, -0.7f, 0.5f, 1.3f);
+    ChQuaternion<float> fb(-0.4f, 0.2f, 1.1f, 0.6f);
+    ChQuaternion<float> f_ref = fa * fb;
+    ChQuaternion<float> f1 = fa;
+    f1.Cross(f1, fb);
+    ChQuaternion<float> f2 = fb;
+    f2.Cross(fa, f2);
+    ok &= (f1 - f_ref).Length() < 1e-6 && (f2 - f_ref).Length() < 1e-6;
+
+    GetLog() << (ok ? "OK\n" : "FAILED\n");
+    return ok;
+}
+
 int main(int argc, char* argv[]) {
     // Print differences between standard and AVX-based multiplications
     bool printMul = true;
@@ -151,6 +246,21 @@ int main(int argc, char* argv[]) {
     passed &= CheckMatMultT(22, 11, 24, tolerance);
     passed &= CheckMatMultT(23, 11, 24, tolerance);
 
+    GetLog() << "\n-----------------MatrTMultiply---------------------- \n";
+
+    passed &= CheckMatTMult(12, 12, 12, tolerance);
+    passed &= CheckMatTMult(24, 9, 3, tolerance);
+    passed &= CheckMatTMult(9, 24, 5, tolerance);
+    passed &= CheckMatTMult(3, 24, 9, tolerance);
+
+    GetLog() << "\n-----------------Small sizes---------------------- \n";
+
+    passed &= CheckMatMult(3, 3, 3, tolerance);
+    passed &= CheckMatMult(3, 3, 1, tolerance);
+    passed &= CheckMatMult(6, 4, 6, tolerance);
+    passed &= CheckMatMult(7, 12, 7, tolerance);
+    passed &= CheckSmall(tolerance);
+
     // Return 0 if all tests passed.
     return !passed;
 }
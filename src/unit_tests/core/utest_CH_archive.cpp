@@ -0,0 +1,195 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+//
+// Test for the serialization of contiguous arrays of plain-old-data with
+// binary archives (stored as single blocks, optionally compressed).
+//
+// =============================================================================
+
+#include <cmath>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/core/ChMatrixDynamic.h"
+#include "chrono/core/ChQuaternion.h"
+#include "chrono/serialization/ChArchiveBinary.h"
+
+using namespace chrono;
+
+class ArrayData {
+  public:
+    std::vector<double> vals;
+    std::vector<int> ids;
+    std::vector<bool> flags;
+    std::vector<ChVector<>> points;
+    std::vector<ChQuaternion<>> rots;
+    float fixed[5];
+    ChMatrixDynamic<> mat;
+    std::string name;
+
+    void Fill(int n) {
+        vals.resize(n);
+        ids.resize(n);
+        flags.resize(n);
+        points.resize(n);
+        rots.resize(n);
+        for (int i = 0; i < n; i++) {
+            vals[i] = std::sin(0.001 * i);
+            ids[i] = 3 * i - n;
+            flags[i] = (i % 3 == 0);
+            points[i] = ChVector<>(0.01 * i, 1.0, std::cos(0.01 * i));
+            rots[i] = Q_from_AngZ(0.001 * i);
+        }
+        for (int i = 0; i < 5; i++)
+            fixed[i] = 0.5f * i;
+        mat.Reset(7, 11);
+        for (int i = 0; i < 7; i++)
+            for (int j = 0; j < 11; j++)
+                mat(i, j) = i - 0.1 * j;
+        name = "array_data";
+    }
+
+    bool Equals(const ArrayData& other) const {
+        if (vals != other.vals || ids != other.ids || flags != other.flags || name != other.name)
+            return false;
+        if (points.size() != other.points.size() || rots.size() != other.rots.size())
+            return false;
+        for (size_t i = 0; i < points.size(); i++)
+            if (!points[i].Equals(other.points[i]) || !rots[i].Equals(other.rots[i]))
+                return false;
+        for (int i = 0; i < 5; i++)
+            if (fixed[i] != other.fixed[i])
+                return false;
+        return mat.Equals(other.mat);
+    }
+
+    void ArchiveOUT(ChArchiveOut& marchive) {
+        marchive << CHNVP(vals);
+        marchive << CHNVP(ids);
+        marchive << CHNVP(flags);
+        marchive << CHNVP(points);
+        marchive << CHNVP(rots);
+        marchive << CHNVP(fixed);
+        marchive << CHNVP(mat);
+        marchive << CHNVP(name);
+    }
+
+    void ArchiveIN(ChArchiveIn& marchive) {
+        marchive >> CHNVP(vals);
+        marchive >> CHNVP(ids);
+        marchive >> CHNVP(flags);
+        marchive >> CHNVP(points);
+        marchive >> CHNVP(rots);
+        marchive >> CHNVP(fixed);
+        marchive >> CHNVP(mat);
+        marchive >> CHNVP(name);
+    }
+};
+
+bool RoundTrip(const ArrayData& data, bool compress, size_t& nbytes) {
+    std::vector<char> buffer;
+    {
+        ChStreamOutBinaryVector ostream(&buffer);
+        ChArchiveOutBinary oarchive(ostream);
+        oarchive.SetCompression(compress);
+        ArrayData copy = data;
+        oarchive << CHNVP(copy);
+    }
+    nbytes = buffer.size();
+
+    ArrayData result;
+    ChStreamInBinaryVector istream(&buffer);
+    ChArchiveInBinary iarchive(istream);
+    iarchive >> CHNVP(result);
+
+    return data.Equals(result);
+}
+
+int main(int argc, char* argv[]) {
+    ArrayData data;
+    data.Fill(10000);
+
+    size_t raw_bytes;
+    size_t packed_bytes;
+    if (!RoundTrip(data, false, raw_bytes)) {
+        GetLog() << "Uncompressed round trip failed\n";
+        return 1;
+    }
+    if (!RoundTrip(data, true, packed_bytes)) {
+        GetLog() << "Compressed round trip failed\n";
+        return 1;
+    }
+    GetLog() << "Archive size: " << raw_bytes << " bytes (uncompressed), " << packed_bytes
+             << " bytes (compressed)\n";
+    if (packed_bytes >= raw_bytes) {
+        GetLog() << "Compression did not reduce the archive size\n";
+        return 1;
+    }
+
+    // Empty arrays
+    ArrayData empty;
+    empty.Fill(0);
+    if (!RoundTrip(empty, false, raw_bytes) || !RoundTrip(empty, true, packed_bytes)) {
+        GetLog() << "Round trip of empty arrays failed\n";
+        return 1;
+    }
+
+    // Streams without the archive signature (e.g. written before the format was versioned) are rejected
+    {
+        std::vector<char> buffer;
+        {
+            ChStreamOutBinaryVector ostream(&buffer);
+            ostream << (size_t)3 << 1.0 << 2.0 << 3.0;
+        }
+        bool caught = false;
+        try {
+            ChStreamInBinaryVector istream(&buffer);
+            ChArchiveInBinary iarchive(istream);
+        } catch (const ChExceptionArchive&) {
+            caught = true;
+        }
+        if (!caught) {
+            GetLog() << "Unversioned archive not detected\n";
+            return 1;
+        }
+
+        // ...unless the caller asks for the version 1 layout
+        std::vector<double> vec;
+        ChStreamInBinaryVector istream(&buffer);
+        ChArchiveInBinary iarchive(istream, true);
+        iarchive >> CHNVP(vec);
+        if (iarchive.GetVersion() != 1 || vec != std::vector<double>{1.0, 2.0, 3.0}) {
+            GetLog() << "Unversioned archive not read back\n";
+            return 1;
+        }
+    }
+
+    // Codec on incompressible and highly repetitive data
+    std::vector<char> src(100000);
+    unsigned int seed = 12345;
+    for (auto& c : src) {
+        seed = seed * 1103515245u + 12345u;
+        c = (char)(seed >> 16);
+    }
+    for (int k = 0; k < 2; k++) {
+        std::vector<char> packed;
+        std::vector<char> unpacked(src.size());
+        ChArchiveBinaryCodec::Compress(src.data(), src.size(), packed);
+        if (!ChArchiveBinaryCodec::Decompress(packed.data(), packed.size(), unpacked.data(), unpacked.size()) ||
+            unpacked != src) {
+            GetLog() << "Codec round trip failed\n";
+            return 1;
+        }
+        std::fill(src.begin() + 1000, src.end(), 'x');
+    }
+
+    return 0;
+}
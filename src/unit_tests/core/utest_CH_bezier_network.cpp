@@ -0,0 +1,181 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the spatial index over a network of Bezier paths. Closest points
+// returned by the (batched) network queries are compared against a brute-force
+// search over all curve intervals, and look-ahead locations are checked
+// against the arc length between the two points on a straight path and on a
+// closed path (wrapping around its start). Also checked is that a path tracker
+// rejects a network path that differs from its own curve or closed flag.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+#include "chrono/core/ChBezierCurve.h"
+#include "chrono/core/ChBezierCurveNetwork.h"
+#include "chrono/core/ChException.h"
+
+using namespace chrono;
+
+// Brute-force closest point: dense sampling of all intervals, refined with the Newton search.
+double BruteForceDist2(const std::vector<std::shared_ptr<ChBezierCurve>>& paths, const ChVector<>& loc) {
+    double best = 1e30;
+    for (auto& path : paths) {
+        for (size_t i = 0; i + 1 < path->getNumPoints(); i++) {
+            for (int j = 0; j <= 50; j++) {
+                double t = j / 50.0;
+                ChVector<> p = path->calcClosestPoint(loc, i, t);
+                best = std::min(best, (p - loc).Length2());
+            }
+        }
+    }
+    return best;
+}
+
+int main(int argc, char* argv[]) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> uni(-1, 1);
+
+    // A set of wavy paths (lanes) spread over a 1 km x 1 km area
+    std::vector<std::shared_ptr<ChBezierCurve>> paths;
+    ChBezierCurveNetwork network;
+    for (int k = 0; k < 20; k++) {
+        std::vector<ChVector<>> points;
+        double y0 = 50.0 * k - 500;
+        for (int i = 0; i < 100; i++)
+            points.push_back(ChVector<>(10.0 * i - 500, y0 + 5 * std::sin(0.1 * i) + uni(gen), 0));
+        paths.push_back(std::make_shared<ChBezierCurve>(points));
+        network.addPath(paths.back());
+    }
+    network.initialize();
+
+    // Closest points for many random locations, one at a time and batched
+    std::vector<ChVector<>> locs;
+    for (int i = 0; i < 200; i++)
+        locs.push_back(ChVector<>(600 * uni(gen), 600 * uni(gen), 5 * uni(gen)));
+
+    std::vector<ChBezierCurveNetwork::Location> results;
+    network.calcClosestPoints(locs, results);
+
+    for (size_t i = 0; i < locs.size(); i++) {
+        ChBezierCurveNetwork::Location result;
+        if (!network.calcClosestPoint(locs[i], result)) {
+            printf("No closest point found for location %d\n", (int)i);
+            return 1;
+        }
+        if (result.path != results[i].path || result.interval != results[i].interval) {
+            printf("Batched query differs from single query for location %d\n", (int)i);
+            return 1;
+        }
+        double d_net = std::sqrt(result.dist2);
+        double d_ref = std::sqrt(BruteForceDist2(paths, locs[i]));
+        if (d_net > d_ref + 0.02) {
+            printf("Location %d: network distance %g, brute-force distance %g\n", (int)i, d_net, d_ref);
+            return 1;
+        }
+        if ((paths[result.path]->eval(result.interval, result.param) - result.point).Length() > 1e-10) {
+            printf("Inconsistent curve location for location %d\n", (int)i);
+            return 1;
+        }
+    }
+
+    // Queries restricted to one path
+    std::vector<int> path_ids(locs.size(), 7);
+    network.calcClosestPoints(locs, results, path_ids);
+    for (size_t i = 0; i < locs.size(); i++) {
+        if (results[i].path != 7) {
+            printf("Restricted query returned path %d\n", results[i].path);
+            return 1;
+        }
+    }
+
+    // Look-ahead on a straight path (arc length = distance between points)
+    std::vector<ChVector<>> line = {ChVector<>(0, 0, 0), ChVector<>(10, 0, 0), ChVector<>(20, 0, 0), ChVector<>(30, 0, 0)};
+    ChBezierCurveNetwork line_network;
+    line_network.addPath(std::make_shared<ChBezierCurve>(line));
+    line_network.initialize();
+
+    ChBezierCurveNetwork::Location start;
+    line_network.calcClosestPoint(ChVector<>(3, 1, 0), start);
+    ChBezierCurveNetwork::Location ahead = line_network.calcLocationAhead(start, 15);
+    if (std::abs(ahead.point.x() - 18) > 1e-6 || std::abs(ahead.point.y()) > 1e-6) {
+        printf("Wrong look-ahead location (%g, %g)\n", ahead.point.x(), ahead.point.y());
+        return 1;
+    }
+    ChBezierCurveNetwork::Location back = line_network.calcLocationAhead(ahead, -100);
+    if (back.interval != 0 || back.param != 0) {
+        printf("Look-ahead not clamped to the path start\n");
+        return 1;
+    }
+
+    // Look-ahead on a closed square path with straight edges (perimeter 40), wrapping around the start
+    std::vector<ChVector<>> square = {ChVector<>(0, 0, 0), ChVector<>(10, 0, 0), ChVector<>(10, 10, 0),
+                                      ChVector<>(0, 10, 0), ChVector<>(0, 0, 0)};
+    std::vector<ChVector<>> inCV(square.size());
+    std::vector<ChVector<>> outCV(square.size());
+    for (size_t i = 0; i < square.size(); i++) {
+        inCV[i] = (i > 0) ? square[i] - (square[i] - square[i - 1]) / 3 : square[i];
+        outCV[i] = (i + 1 < square.size()) ? square[i] + (square[i + 1] - square[i]) / 3 : square[i];
+    }
+    auto square_path = std::make_shared<ChBezierCurve>(square, inCV, outCV);
+    auto square_network = std::make_shared<ChBezierCurveNetwork>();
+    square_network->addPath(square_path, true);
+    square_network->initialize();
+
+    square_network->calcClosestPoint(ChVector<>(2, -1, 0), start);
+    ChBezierCurveNetwork::Location fwd = square_network->calcLocationAhead(start, 45);
+    ChBezierCurveNetwork::Location bwd = square_network->calcLocationAhead(start, -5);
+    if ((fwd.point - ChVector<>(7, 0, 0)).Length() > 1e-6 || (bwd.point - ChVector<>(0, 3, 0)).Length() > 1e-6) {
+        printf("Wrong look-ahead on closed path: (%g, %g) (%g, %g)\n", fwd.point.x(), fwd.point.y(), bwd.point.x(),
+               bwd.point.y());
+        return 1;
+    }
+
+    // A tracker can only use a network containing its own path, with the same closed flag
+    ChBezierCurveTracker tracker(square_path, true);
+    int num_caught = 0;
+    try {
+        tracker.setNetwork(square_network, 1);
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    try {
+        ChBezierCurveTracker open_tracker(square_path, false);
+        open_tracker.setNetwork(square_network, 0);
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    try {
+        ChBezierCurveTracker other_tracker(line_network.getPath(0), true);
+        other_tracker.setNetwork(square_network, 0);
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    tracker.setNetwork(square_network, 0);
+    try {
+        tracker.setIsClosedPath(false);
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    if (num_caught != 4) {
+        printf("Inconsistent tracker network not detected\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
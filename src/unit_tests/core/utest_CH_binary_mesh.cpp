@@ -0,0 +1,137 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the binary mesh format of ChTriangleMeshConnected. A mesh loaded
+// from a Wavefront OBJ file is saved in binary format and loaded back; all
+// vertex data and face indices must be preserved exactly, as well as the stamp
+// of the source file recorded in the header. Loading a file which
+// is not a binary mesh, or a file with an array size larger than the file
+// itself, must throw an exception.
+//
+// =============================================================================
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+
+#include "chrono/core/ChException.h"
+#include "chrono/geometry/ChTriangleMeshConnected.h"
+
+using namespace chrono;
+using namespace chrono::geometry;
+
+template <typename T>
+bool Compare(const std::vector<T>& a, const std::vector<T>& b, const char* name) {
+    if (a.size() != b.size()) {
+        printf("Different number of %s: %d %d\n", name, (int)a.size(), (int)b.size());
+        return false;
+    }
+    for (size_t i = 0; i < a.size(); i++) {
+        if (!(a[i] == b[i])) {
+            printf("Different %s at index %d\n", name, (int)i);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    // Write a small OBJ file (two quads with normals and texture coordinates)
+    const char* obj_file = "utest_binary_mesh.obj";
+    const char* bin_file = "utest_binary_mesh.chmesh";
+    {
+        std::ofstream obj(obj_file);
+        obj << "v 0 0 0\nv 1 0 0\nv 1 1 0\nv 0 1 0\nv 0 1 0.5\nv 1 1 0.5\n";
+        obj << "vn 0 0 1\nvn 0 -0.707107 0.707107\n";
+        obj << "vt 0 0\nvt 1 0\nvt 1 1\nvt 0 1\n";
+        obj << "f 1/1/1 2/2/1 3/3/1\nf 1/1/1 3/3/1 4/4/1\n";
+        obj << "f 4/1/2 3/2/2 6/3/2\nf 4/1/2 6/3/2 5/4/2\n";
+    }
+
+    ChTriangleMeshConnected mesh;
+    mesh.LoadWavefrontMesh(obj_file, true, true);
+    mesh.m_colors.push_back(ChVector<float>(0.1f, 0.2f, 0.3f));
+    mesh.m_face_col_indices.push_back(ChVector<int>(0, 0, 0));
+
+    printf("  %d vertices, %d normals, %d UV, %d faces\n", (int)mesh.m_vertices.size(), (int)mesh.m_normals.size(),
+           (int)mesh.m_UV.size(), mesh.getNumTriangles());
+
+    if (mesh.getNumTriangles() != 4 || mesh.m_normals.empty() || mesh.m_UV.empty()) {
+        printf("Error loading OBJ file\n");
+        return 1;
+    }
+
+    // Round trip through the binary format, with the stamp of a source file
+    mesh.SaveBinaryMesh(bin_file, 1234567890, 4321);
+
+    int64_t source_time = 0;
+    int64_t source_size = 0;
+    ChTriangleMeshConnected::ReadBinaryMeshSource(bin_file, source_time, source_size);
+    if (source_time != 1234567890 || source_size != 4321) {
+        printf("Wrong source stamp\n");
+        return 1;
+    }
+
+    ChTriangleMeshConnected loaded;
+    loaded.LoadBinaryMesh(bin_file);
+
+    bool ok = Compare(mesh.m_vertices, loaded.m_vertices, "vertices") &&
+              Compare(mesh.m_normals, loaded.m_normals, "normals") && Compare(mesh.m_UV, loaded.m_UV, "UV") &&
+              Compare(mesh.m_colors, loaded.m_colors, "colors") &&
+              Compare(mesh.m_face_v_indices, loaded.m_face_v_indices, "vertex indices") &&
+              Compare(mesh.m_face_n_indices, loaded.m_face_n_indices, "normal indices") &&
+              Compare(mesh.m_face_uv_indices, loaded.m_face_uv_indices, "UV indices") &&
+              Compare(mesh.m_face_col_indices, loaded.m_face_col_indices, "color indices");
+
+    // An OBJ file is not a binary mesh
+    bool caught = false;
+    try {
+        ChTriangleMeshConnected invalid;
+        invalid.LoadBinaryMesh(obj_file);
+    } catch (const ChException&) {
+        caught = true;
+    }
+
+    // A corrupted array size (larger than the file) is rejected before allocating
+    bool caught_size = false;
+    {
+        std::fstream bin(bin_file, std::ios::in | std::ios::out | std::ios::binary);
+        uint64_t size = uint64_t(1) << 60;
+        bin.seekp(8 + 2 * sizeof(int64_t));
+        bin.write(reinterpret_cast<const char*>(&size), sizeof(size));
+    }
+    try {
+        ChTriangleMeshConnected corrupted;
+        corrupted.LoadBinaryMesh(bin_file);
+    } catch (const ChException&) {
+        caught_size = true;
+    }
+
+    std::remove(obj_file);
+    std::remove(bin_file);
+
+    if (!ok)
+        return 1;
+    if (!caught) {
+        printf("Invalid binary mesh file not detected\n");
+        return 1;
+    }
+    if (!caught_size) {
+        printf("Corrupted array size not detected\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,166 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the bulk gather/scatter of body quantities and of the system state
+// (ChUtilsBulkState). Gathered matrices must match the per-body accessors, be
+// reused across calls, and scattering them to a second system must reproduce
+// the same state. Scattering matrices of the wrong size must throw.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/core/ChException.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsBulkState.h"
+
+using namespace chrono;
+
+const int num_bodies = 4;
+
+// Create a chain of bodies (the first one fixed) connected by revolute joints.
+void CreateSystem(ChSystemNSC& system) {
+    std::shared_ptr<ChBody> prev;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(i, 0, 0));
+        body->SetBodyFixed(i == 0);
+        system.AddBody(body);
+
+        if (prev) {
+            auto joint = std::make_shared<ChLinkLockRevolute>();
+            joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(i - 0.5, 0, 0), QUNIT));
+            system.AddLink(joint);
+        }
+        prev = body;
+    }
+}
+
+double MaxDiff(const ChMatrix<>& a, const ChMatrix<>& b) {
+    double diff = 0;
+    for (int i = 0; i < a.GetRows(); i++)
+        for (int j = 0; j < a.GetColumns(); j++)
+            diff = std::max(diff, std::abs(a(i, j) - b(i, j)));
+    return diff;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC sys1;
+    CreateSystem(sys1);
+    for (int i = 0; i < 100; i++)
+        sys1.DoStepDynamics(1e-3);
+
+    // Gathered quantities match the per-body accessors
+    ChMatrixDynamic<> pos, rot, vel, frc;
+    utils::GetBodyPositions(&sys1, pos);
+    utils::GetBodyRotations(&sys1, rot);
+    utils::GetBodyVelocities(&sys1, vel);
+    utils::GetBodyContactForces(&sys1, frc);
+
+    if (pos.GetRows() != num_bodies || pos.GetColumns() != 3 || rot.GetColumns() != 4 || vel.GetColumns() != 6 ||
+        frc.GetRows() != num_bodies || frc.GetColumns() != 6) {
+        printf("Wrong dimensions of gathered matrices\n");
+        return 1;
+    }
+
+    double err = 0;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = sys1.Get_bodylist()[i];
+        err = std::max(err, (body->GetPos() - ChVector<>(pos(i, 0), pos(i, 1), pos(i, 2))).Length());
+        err = std::max(err, (body->GetRot() - ChQuaternion<>(rot(i, 0), rot(i, 1), rot(i, 2), rot(i, 3))).Length());
+        err = std::max(err, (body->GetPos_dt() - ChVector<>(vel(i, 0), vel(i, 1), vel(i, 2))).Length());
+        err = std::max(err, (body->GetWvel_par() - ChVector<>(vel(i, 3), vel(i, 4), vel(i, 5))).Length());
+    }
+    if (err != 0) {
+        printf("Gathered quantities differ from the body data: %g\n", err);
+        return 1;
+    }
+
+    // Output buffers are reused by later calls
+    const double* address = pos.GetAddress();
+    sys1.DoStepDynamics(1e-3);
+    utils::GetBodyPositions(&sys1, pos);
+    if (pos.GetAddress() != address) {
+        printf("Output matrix reallocated\n");
+        return 1;
+    }
+
+    // Scatter the body quantities to a second system
+    ChSystemNSC sys2;
+    CreateSystem(sys2);
+    utils::GetBodyRotations(&sys1, rot);
+    utils::GetBodyVelocities(&sys1, vel);
+    utils::SetBodyPositions(&sys2, pos);
+    utils::SetBodyRotations(&sys2, rot);
+    utils::SetBodyVelocities(&sys2, vel);
+
+    ChMatrixDynamic<> pos2, rot2, vel2;
+    utils::GetBodyPositions(&sys2, pos2);
+    utils::GetBodyRotations(&sys2, rot2);
+    utils::GetBodyVelocities(&sys2, vel2);
+    // (angular velocities are stored in the body frame, hence may differ by roundoff)
+    if (MaxDiff(pos, pos2) != 0 || MaxDiff(rot, rot2) != 0 || MaxDiff(vel, vel2) > 1e-14) {
+        printf("Scattered body quantities differ: %g %g %g\n", MaxDiff(pos, pos2), MaxDiff(rot, rot2),
+               MaxDiff(vel, vel2));
+        return 1;
+    }
+
+    // System state round trip: the two systems must then evolve identically
+    ChVectorDynamic<> x, v;
+    double time = utils::GetSystemState(&sys1, x, v);
+    if (x.GetRows() != sys1.GetNcoords_x() || v.GetRows() != sys1.GetNcoords_v() || time != sys1.GetChTime()) {
+        printf("Wrong system state dimensions\n");
+        return 1;
+    }
+    utils::SetSystemState(&sys2, x, v, time);
+
+    for (int i = 0; i < 50; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+    }
+    utils::GetBodyPositions(&sys1, pos);
+    utils::GetBodyPositions(&sys2, pos2);
+    printf("  max position difference after state transfer: %g\n", MaxDiff(pos, pos2));
+    if (MaxDiff(pos, pos2) > 1e-12) {
+        printf("Systems differ after state transfer\n");
+        return 1;
+    }
+
+    // Input matrices of the wrong size are rejected
+    int num_caught = 0;
+    try {
+        utils::SetBodyPositions(&sys2, ChMatrixDynamic<>(num_bodies - 1, 3));
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    try {
+        utils::SetBodyVelocities(&sys2, ChMatrixDynamic<>(num_bodies, 3));
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    try {
+        utils::SetSystemState(&sys2, ChVectorDynamic<>(3), v, time);
+    } catch (const ChException&) {
+        num_caught++;
+    }
+    if (num_caught != 3) {
+        printf("Invalid input sizes not detected\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,169 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the binary checkpoint/restart of a Chrono system.
+// A system with a pendulum and a set of free bodies sharing a contact material
+// is simulated, checkpointed, and restored into a second identical system.
+// The restored states must match (up to roundoff in the conversion between
+// angular velocities and quaternion derivatives) and the two systems must
+// continue to evolve identically. Checkpoints that do not match the target
+// system must be rejected without modifying it.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/core/ChLog.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/utils/ChUtilsInputOutput.h"
+
+using namespace chrono;
+
+void CreateSystem(ChSystemNSC& system, bool spherical = false) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetIdentifier(-1);
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto pend = std::make_shared<ChBody>();
+    pend->SetIdentifier(0);
+    pend->SetPos(ChVector<>(1, 0, 0));
+    system.AddBody(pend);
+
+    std::shared_ptr<ChLinkLock> joint;
+    if (spherical)
+        joint = std::make_shared<ChLinkLockSpherical>();
+    else
+        joint = std::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(ground, pend, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(joint);
+
+    // Free bodies, far away from each other and from the pendulum.
+    auto mat = std::make_shared<ChMaterialSurfaceNSC>();
+    for (int i = 1; i <= 10; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetIdentifier(i);
+        body->SetPos(ChVector<>(10.0 * i, 0, 0));
+        body->SetWvel_loc(ChVector<>(0, 0.1 * i, 0));
+        body->SetMaterialSurface(mat);
+        system.AddBody(body);
+    }
+}
+
+bool Compare(ChSystemNSC& sys1, ChSystemNSC& sys2, double tol) {
+    ChState x1(sys1.GetNcoords_x(), &sys1), x2(sys2.GetNcoords_x(), &sys2);
+    ChStateDelta v1(sys1.GetNcoords_w(), &sys1), v2(sys2.GetNcoords_w(), &sys2);
+    ChStateDelta a1(sys1.GetNcoords_w(), &sys1), a2(sys2.GetNcoords_w(), &sys2);
+    double t1, t2;
+    sys1.StateGather(x1, v1, t1);
+    sys2.StateGather(x2, v2, t2);
+    sys1.StateGatherAcceleration(a1);
+    sys2.StateGatherAcceleration(a2);
+
+    if (x1.GetRows() != x2.GetRows() || v1.GetRows() != v2.GetRows() || std::abs(t1 - t2) > tol)
+        return false;
+    for (int i = 0; i < x1.GetRows(); i++)
+        if (std::abs(x1(i) - x2(i)) > tol)
+            return false;
+    for (int i = 0; i < v1.GetRows(); i++)
+        if (std::abs(v1(i) - v2(i)) > tol || std::abs(a1(i) - a2(i)) > tol)
+            return false;
+
+    auto link1 = sys1.Get_linklist()[0];
+    auto link2 = sys2.Get_linklist()[0];
+    if ((link1->Get_react_force() - link2->Get_react_force()).Length() > tol)
+        return false;
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    const std::string filename = "utest_CH_checkpoint.dat";
+    double step = 1e-3;
+
+    ChSystemNSC sys1;
+    CreateSystem(sys1);
+    for (int i = 0; i < 200; i++)
+        sys1.DoStepDynamics(step);
+
+    // Modify some body properties after construction.
+    sys1.Get_bodylist()[5]->SetBodyFixed(true);
+    sys1.Get_bodylist()[6]->GetMaterialSurfaceNSC()->SetFriction(0.8f);
+
+    if (!utils::WriteCheckpointBinary(&sys1, filename)) {
+        GetLog() << "Error writing checkpoint file\n";
+        return 1;
+    }
+
+    ChSystemNSC sys2;
+    CreateSystem(sys2);
+    if (!utils::ReadCheckpointBinary(&sys2, filename)) {
+        GetLog() << "Error reading checkpoint file\n";
+        return 1;
+    }
+
+    if (!Compare(sys1, sys2, 1e-12)) {
+        GetLog() << "Restored state does not match\n";
+        return 1;
+    }
+
+    if (!sys2.Get_bodylist()[5]->GetBodyFixed() ||
+        sys2.Get_bodylist()[6]->GetMaterialSurfaceNSC()->GetKfriction() != 0.8f ||
+        sys2.Get_bodylist()[6]->GetMaterialSurfaceBase() != sys2.Get_bodylist()[7]->GetMaterialSurfaceBase()) {
+        GetLog() << "Restored body properties do not match\n";
+        return 1;
+    }
+
+    for (int i = 0; i < 200; i++) {
+        sys1.DoStepDynamics(step);
+        sys2.DoStepDynamics(step);
+    }
+
+    if (!Compare(sys1, sys2, 1e-10)) {
+        GetLog() << "States diverged after restart\n";
+        return 1;
+    }
+
+    // A system with a different topology must be rejected.
+    ChSystemNSC sys3;
+    CreateSystem(sys3);
+    sys3.AddBody(std::make_shared<ChBody>());
+    if (utils::ReadCheckpointBinary(&sys3, filename)) {
+        GetLog() << "Checkpoint accepted for a mismatched system\n";
+        return 1;
+    }
+
+    // A system with the same bodies but a different number of constraints must be rejected, and left unchanged.
+    ChSystemNSC sys4;
+    CreateSystem(sys4, true);
+    auto body4 = sys4.Get_bodylist()[5];
+    ChVector<> pos4 = body4->GetPos();
+    if (utils::ReadCheckpointBinary(&sys4, filename)) {
+        GetLog() << "Checkpoint accepted for a system with a different state layout\n";
+        return 1;
+    }
+    if (body4->GetBodyFixed() || body4->GetPos() != pos4 ||
+        sys4.Get_bodylist()[6]->GetMaterialSurfaceNSC()->GetKfriction() == 0.8f) {
+        GetLog() << "Rejected checkpoint modified the system\n";
+        return 1;
+    }
+
+    std::remove(filename.c_str());
+
+    return 0;
+}
@@ -0,0 +1,135 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for heap allocations during a simulation step.
+// The global operator new is replaced with a counting version. With the matrix
+// arena enabled, once the memory pools are warm, DoStepDynamics on a system of
+// bodies, joints and springs (without collision) must not perform any heap
+// allocation, neither through operator new nor through ChMatrixArena.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+
+#include "chrono/core/ChMatrixArena.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkSpring.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// Counting replacement of the global operator new
+// -----------------------------------------------
+
+static size_t num_new = 0;
+
+void* operator new(size_t size) {
+    num_new++;
+    void* ptr = std::malloc(size > 0 ? size : 1);
+    if (!ptr)
+        throw std::bad_alloc();
+    return ptr;
+}
+
+void* operator new[](size_t size) {
+    return operator new(size);
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete[](void* ptr) noexcept {
+    std::free(ptr);
+}
+
+// Number of heap allocations so far
+size_t NumAllocations() {
+    return num_new + ChMatrixArena::GetNumHeapAllocations();
+}
+
+// -----------------------------------------------------------------------------
+
+bool TestSmallMatrices() {
+    size_t start = NumAllocations();
+    {
+        ChMatrixDynamic<> A(2, 3);
+        ChMatrixDynamic<> B(A);
+        ChVectorDynamic<> v(ChVectorDynamic<>::SMALL_SIZE);
+        A.Resize(1, ChMatrixDynamic<>::SMALL_SIZE);
+        v.Resize(3);
+    }
+    size_t num = NumAllocations() - start;
+    printf("  small matrices: %d allocations\n", (int)num);
+    return num == 0;
+}
+
+bool TestSimulation() {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto prev = ground;
+    for (int i = 0; i < 10; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(i + 1.0, 0, 0));
+        system.AddBody(body);
+
+        auto joint = std::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(i + 0.5, 0, 0), QUNIT));
+        system.AddLink(joint);
+
+        auto spring = std::make_shared<ChLinkSpring>();
+        spring->Initialize(ground, body, false, ChVector<>(i + 1.0, 1, 0), body->GetPos());
+        spring->Set_SpringK(100);
+        system.AddLink(spring);
+
+        prev = body;
+    }
+
+    // Warm up the memory pools
+    for (int i = 0; i < 10; i++)
+        system.DoStepDynamics(1e-3);
+
+    size_t start = NumAllocations();
+    for (int i = 0; i < 100; i++)
+        system.DoStepDynamics(1e-3);
+    size_t num = NumAllocations() - start;
+
+    printf("  DoStepDynamics: %d allocations in 100 steps\n", (int)num);
+    return num == 0;
+}
+
+int main(int argc, char* argv[]) {
+    ChMatrixArena::Enable(true);
+
+    bool passed = true;
+    passed &= TestSmallMatrices();
+    passed &= TestSimulation();
+
+    ChMatrixArena::Enable(false);
+    ChMatrixArena::Clear();
+
+    if (!passed) {
+        printf("FAILED\n");
+        return 1;
+    }
+    printf("PASSED\n");
+    return 0;
+}
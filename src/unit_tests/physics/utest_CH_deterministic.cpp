@@ -0,0 +1,132 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the deterministic mode of multithreaded simulations.
+// A stack of boxes falls on the ground, while a pendulum chain swings through
+// it, so that the solver deals with frictional contacts and joints. The same
+// scenario is simulated several times with the multithreaded SOR solver in
+// deterministic mode, with different numbers of threads; the final states must
+// be bitwise identical. The same holds when the islands of the system are
+// solved separately. Finally, the colors of the constraints, which the solver
+// keeps from one step to the next, must not go stale as contacts come and go:
+// a solver replaced at each step must give the same results.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include "chrono/physics/ChBodyEasy.h"
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono/solver/ChSolverSORmultithread.h"
+
+using namespace chrono;
+
+void CreateSystem(ChSystemNSC& system, int nthreads, bool islands) {
+    system.SetParallelThreadNumber(nthreads);
+    system.SetUseIslands(islands);
+    system.SetSolverType(ChSolver::Type::SOR_MULTITHREAD);
+    system.SetMaxItersSolverSpeed(50);
+    system.SetDeterministic(true);
+
+    auto ground = std::make_shared<ChBodyEasyBox>(10, 1, 10, 1000, true, false);
+    ground->SetPos(ChVector<>(0, -0.5, 0));
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    for (int ix = 0; ix < 4; ix++) {
+        for (int iy = 0; iy < 4; iy++) {
+            for (int iz = 0; iz < 4; iz++) {
+                auto box = std::make_shared<ChBodyEasyBox>(0.4, 0.4, 0.4, 1000, true, false);
+                box->SetPos(ChVector<>(0.5 * ix - 0.75, 0.25 + 0.45 * iy, 0.5 * iz - 0.75 + 0.05 * iy));
+                system.AddBody(box);
+            }
+        }
+    }
+
+    auto prev = ground;
+    for (int il = 0; il < 6; il++) {
+        auto body = std::make_shared<ChBodyEasyBox>(0.3, 0.1, 0.1, 1000, true, false);
+        body->SetPos(ChVector<>(-3 + 0.4 * il, 2.5, 0));
+        system.AddBody(body);
+
+        auto joint = std::make_shared<ChLinkLockSpherical>();
+        joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(-3.2 + 0.4 * il, 2.5, 0), QUNIT));
+        system.AddLink(joint);
+
+        prev = body;
+    }
+}
+
+void Simulate(ChSystemNSC& system, ChState& x, ChStateDelta& v, int& ncontacts, bool new_solver = false) {
+    ncontacts = 0;
+    for (int i = 0; i < 300; i++) {
+        if (new_solver)
+            system.SetSolver(std::make_shared<ChSolverSORmultithread>("speedSolver", system.GetParallelThreadNumber()));
+        system.DoStepDynamics(2e-3);
+        ncontacts = std::max(ncontacts, system.GetNcontacts());
+    }
+
+    double t;
+    x.Reset(system.GetNcoords_x(), &system);
+    v.Reset(system.GetNcoords_w(), &system);
+    system.StateGather(x, v, t);
+}
+
+bool Identical(const ChVectorDynamic<>& a, const ChVectorDynamic<>& b) {
+    return a.GetRows() == b.GetRows() && std::memcmp(a.GetAddress(), b.GetAddress(), a.GetRows() * sizeof(double)) == 0;
+}
+
+struct Run {
+    int nthreads;
+    bool islands;
+    bool new_solver;
+};
+
+int main(int argc, char* argv[]) {
+    const int num_runs = 6;
+    const Run runs[num_runs] = {{4, false, false}, {4, false, false}, {2, false, false},
+                                {4, false, true},  {4, true, false},  {1, true, false}};
+
+    ChState x[num_runs];
+    ChStateDelta v[num_runs];
+    for (int i = 0; i < num_runs; i++) {
+        ChSystemNSC system;
+        CreateSystem(system, runs[i].nthreads, runs[i].islands);
+        int ncontacts;
+        Simulate(system, x[i], v[i], ncontacts, runs[i].new_solver);
+        printf("  run %d (%d threads%s%s): max %d contacts\n", i, runs[i].nthreads, runs[i].islands ? ", islands" : "",
+               runs[i].new_solver ? ", new solver at each step" : "", ncontacts);
+        if (ncontacts == 0) {
+            printf("No contacts\n");
+            return 1;
+        }
+    }
+
+    // Runs without islands must all match the first one, runs with islands the first one with islands
+    for (int i = 1; i < num_runs; i++) {
+        int ref = runs[i].islands ? 4 : 0;
+        if (i == ref)
+            continue;
+        if (!Identical(x[ref], x[i]) || !Identical(v[ref], v[i])) {
+            printf("Run %d differs from run %d\n", i, ref);
+            return 1;
+        }
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
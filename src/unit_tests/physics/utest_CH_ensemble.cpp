@@ -0,0 +1,163 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the concurrent simulation of an ensemble of independent systems.
+// Each member is a pendulum (of member-dependent length) with a ball dropped
+// on a fixed ground box, so that both the solver and the collision detection
+// are exercised concurrently. The ensemble is simulated on several threads and
+// the final states must match those obtained with a single thread. Each member
+// also sets its own default collision envelope, which must not leak into the
+// members created concurrently on other threads, nor into the process-wide
+// default of the calling thread. Finally, an exception thrown
+// by one of the members must be propagated to the caller.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+#include "chrono/physics/ChSystemEnsemble.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+const int num_members = 24;
+
+class PendulumEnsemble : public ChSystemEnsemble::MemberCallback {
+  public:
+    PendulumEnsemble(int fail_member = -1)
+        : m_results(num_members), m_steps(num_members, 0), m_envelope_ok(num_members, false), m_fail(fail_member) {}
+
+    virtual std::shared_ptr<ChSystem> CreateSystem(int member) override {
+        if (member == m_fail)
+            throw std::runtime_error("member failed");
+
+        auto system = std::make_shared<ChSystemNSC>();
+        system->Set_G_acc(ChVector<>(0, -9.81, 0));
+
+        double envelope = 0.01 + 0.001 * member;
+        collision::ChCollisionModel::SetDefaultSuggestedEnvelope(envelope);
+
+        auto ground = std::make_shared<ChBody>();
+        ground->SetBodyFixed(true);
+        ground->GetCollisionModel()->ClearModel();
+        ground->GetCollisionModel()->AddBox(2, 0.1, 2, ChVector<>(0, -0.1, 0));
+        ground->GetCollisionModel()->BuildModel();
+        ground->SetCollide(true);
+        system->AddBody(ground);
+
+        double length = 0.5 + 0.05 * member;
+        auto pendulum = std::make_shared<ChBody>();
+        pendulum->SetPos(ChVector<>(length, 2, 0));
+        system->AddBody(pendulum);
+
+        auto joint = std::make_shared<ChLinkLockRevolute>();
+        joint->Initialize(ground, pendulum, ChCoordsys<>(ChVector<>(0, 2, 0)));
+        system->AddLink(joint);
+
+        auto ball = std::make_shared<ChBody>();
+        ball->SetPos(ChVector<>(0.1 * member, 0.5, 0));
+        ball->GetCollisionModel()->ClearModel();
+        ball->GetCollisionModel()->AddSphere(0.1);
+        ball->GetCollisionModel()->BuildModel();
+        ball->SetCollide(true);
+        system->AddBody(ball);
+
+        m_envelope_ok[member] = std::abs(ball->GetCollisionModel()->GetEnvelope() - envelope) < 1e-6;
+
+        return system;
+    }
+
+    virtual bool OnStep(int member, ChSystem& system) override {
+        m_steps[member]++;
+        return true;
+    }
+
+    virtual void OnComplete(int member, ChSystem& system) override {
+        m_results[member] = system.Get_bodylist()[1]->GetPos() + system.Get_bodylist()[2]->GetPos();
+    }
+
+    std::vector<ChVector<>> m_results;
+    std::vector<int> m_steps;
+    std::vector<bool> m_envelope_ok;
+    int m_fail;
+};
+
+int main(int argc, char* argv[]) {
+    ChSystemEnsemble ensemble;
+    ensemble.SetStepSize(1e-3);
+    ensemble.SetEndTime(0.5);
+
+    // Reference results with a single worker thread
+    PendulumEnsemble reference;
+    ensemble.SetNumThreads(1);
+    ensemble.Run(num_members, &reference);
+
+    // Concurrent simulation
+    collision::ChCollisionModel::SetDefaultSuggestedEnvelope(0.02);
+    PendulumEnsemble concurrent;
+    ensemble.SetNumThreads(4);
+    ensemble.Run(num_members, &concurrent);
+
+    if (collision::ChCollisionModel::GetDefaultSuggestedEnvelope() != 0.02) {
+        printf("Process-wide default collision envelope changed by the members\n");
+        return 1;
+    }
+
+    printf("  %d members completed on %d threads\n", ensemble.GetNumCompleted(), ensemble.GetNumThreads());
+
+    if (ensemble.GetNumCompleted() != num_members) {
+        printf("Wrong number of completed members\n");
+        return 1;
+    }
+
+    for (int i = 0; i < num_members; i++) {
+        if (concurrent.m_steps[i] != 500) {
+            printf("Member %d: wrong number of steps (%d)\n", i, concurrent.m_steps[i]);
+            return 1;
+        }
+        if (!concurrent.m_envelope_ok[i]) {
+            printf("Member %d: default collision envelope not used\n", i);
+            return 1;
+        }
+        if ((concurrent.m_results[i] - reference.m_results[i]).Length() > 1e-10) {
+            printf("Member %d: results differ from the single-threaded run\n", i);
+            return 1;
+        }
+    }
+
+    // Members with different pendulum lengths must produce different results
+    if ((concurrent.m_results[0] - concurrent.m_results[1]).Length() < 1e-6) {
+        printf("Members are not independent\n");
+        return 1;
+    }
+
+    // Exception propagation
+    PendulumEnsemble failing(num_members / 2);
+    bool caught = false;
+    try {
+        ensemble.Run(num_members, &failing);
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    if (!caught) {
+        printf("Exception not propagated\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,235 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the island decomposition of the solver problem.
+// A set of independent pendulum chains is simulated with and without islands.
+// With the SOR solver run to a fixed number of iterations, the two simulations
+// must produce the same results. Also tested is the island-wide sleeping: a
+// chain at rest goes to sleep, while a chain containing a body which is not
+// allowed to sleep stays awake. A constraint whose variables are all inactive
+// must not keep the reaction of a previous step. Finally, solver settings changed
+// between steps must be used by the island solvers, and the solver statistics
+// must be the same as for the global solve.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+const int num_chains = 6;
+const int num_links = 8;
+
+std::vector<std::vector<std::shared_ptr<ChBody>>> CreateSystem(ChSystemNSC& system, bool islands) {
+    system.SetParallelThreadNumber(4);
+    system.SetUseIslands(islands);
+    system.SetSolverType(ChSolver::Type::SOR);
+    system.SetMaxItersSolverSpeed(50);
+    system.SetTolForce(0);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::vector<std::shared_ptr<ChBody>>> chains;
+    for (int ic = 0; ic < num_chains; ic++) {
+        std::vector<std::shared_ptr<ChBody>> chain;
+        auto prev = ground;
+        // Chains of different length, to test the load balancing of islands
+        for (int il = 0; il < num_links + ic; il++) {
+            auto body = std::make_shared<ChBody>();
+            body->SetPos(ChVector<>(il + 1.0, 0, ic));
+            system.AddBody(body);
+
+            auto joint = std::make_shared<ChLinkLockRevolute>();
+            joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(il + 0.5, 0, ic), QUNIT));
+            system.AddLink(joint);
+
+            chain.push_back(body);
+            prev = body;
+        }
+        chains.push_back(chain);
+    }
+
+    // A free body, not involved in any constraint
+    auto body = std::make_shared<ChBody>();
+    body->SetPos(ChVector<>(0, 0, -2));
+    body->SetPos_dt(ChVector<>(1, 2, 3));
+    system.AddBody(body);
+
+    return chains;
+}
+
+bool TestSolve() {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_isl;
+    CreateSystem(sys_ref, false);
+    CreateSystem(sys_isl, true);
+
+    for (int i = 0; i < 50; i++) {
+        sys_ref.DoStepDynamics(1e-3);
+        sys_isl.DoStepDynamics(1e-3);
+    }
+
+    if (sys_ref.GetNislands() != 0 || sys_isl.GetNislands() != num_chains) {
+        printf("Wrong number of islands: %d\n", sys_isl.GetNislands());
+        return false;
+    }
+
+    ChState x1(sys_ref.GetNcoords_x(), &sys_ref), x2(sys_isl.GetNcoords_x(), &sys_isl);
+    ChStateDelta v1(sys_ref.GetNcoords_w(), &sys_ref), v2(sys_isl.GetNcoords_w(), &sys_isl);
+    double t1, t2;
+    sys_ref.StateGather(x1, v1, t1);
+    sys_isl.StateGather(x2, v2, t2);
+
+    double err = std::abs(t1 - t2);
+    for (int i = 0; i < x1.GetRows(); i++)
+        err = std::max(err, std::abs(x1(i) - x2(i)));
+    for (int i = 0; i < v1.GetRows(); i++)
+        err = std::max(err, std::abs(v1(i) - v2(i)));
+
+    printf("  %d islands, max state difference: %g\n", sys_isl.GetNislands(), err);
+
+    if (err > 1e-12) {
+        printf("Results with and without islands differ\n");
+        return false;
+    }
+    return true;
+}
+
+bool TestSleeping() {
+    ChSystemNSC system;
+    auto chains = CreateSystem(system, true);
+    system.Set_G_acc(ChVector<>(0, 0, 0));
+    system.SetUseSleeping(true);
+
+    for (auto& chain : chains)
+        for (auto& body : chain)
+            body->SetSleepTime(0.05f);
+
+    // One body of the first chain is never allowed to sleep
+    chains[0].back()->SetUseSleeping(false);
+
+    for (int i = 0; i < 200; i++)
+        system.DoStepDynamics(1e-3);
+
+    for (int ic = 0; ic < num_chains; ic++) {
+        for (auto& body : chains[ic]) {
+            if (body->GetSleeping() != (ic > 0)) {
+                printf("Wrong sleeping state for a body in chain %d\n", ic);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+bool TestInactive() {
+    ChSystemNSC system;
+    system.SetUseIslands(true);
+    system.SetSolverType(ChSolver::Type::SOR);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    // Pendulum hanging at rest, loaded by gravity
+    auto body = std::make_shared<ChBody>();
+    body->SetPos(ChVector<>(0, -1, 0));
+    system.AddBody(body);
+
+    auto joint = std::make_shared<ChLinkLockRevolute>();
+    joint->Initialize(ground, body, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(joint);
+
+    for (int i = 0; i < 10; i++)
+        system.DoStepDynamics(1e-3);
+
+    double force_loaded = joint->Get_react_force().Length();
+
+    // Once the body is fixed, the joint constraints have no active variables
+    body->SetBodyFixed(true);
+    for (int i = 0; i < 2; i++)
+        system.DoStepDynamics(1e-3);
+
+    double force_fixed = joint->Get_react_force().Length();
+
+    printf("  joint reaction: %g (loaded), %g (fixed)\n", force_loaded, force_fixed);
+
+    if (force_loaded < 1 || force_fixed != 0) {
+        printf("Wrong reaction for a constraint with inactive variables\n");
+        return false;
+    }
+    return true;
+}
+
+bool TestStatistics() {
+    ChSystemNSC sys_ref;
+    ChSystemNSC sys_isl;
+    CreateSystem(sys_ref, false);
+    CreateSystem(sys_isl, true);
+
+    auto solver_ref = std::static_pointer_cast<ChIterativeSolver>(sys_ref.GetSolver());
+    auto solver_isl = std::static_pointer_cast<ChIterativeSolver>(sys_isl.GetSolver());
+    solver_ref->SetRecordViolation(true);
+    solver_isl->SetRecordViolation(true);
+
+    for (int i = 0; i < 10; i++) {
+        // Change the solver settings halfway
+        if (i == 5) {
+            sys_ref.SetMaxItersSolverSpeed(20);
+            sys_isl.SetMaxItersSolverSpeed(20);
+        }
+        sys_ref.DoStepDynamics(1e-3);
+        sys_isl.DoStepDynamics(1e-3);
+    }
+
+    const auto& hist_ref = solver_ref->GetViolationHistory();
+    const auto& hist_isl = solver_isl->GetViolationHistory();
+
+    printf("  iterations: %d (global), %d (islands)\n", solver_ref->GetTotalIterations(),
+           solver_isl->GetTotalIterations());
+
+    if (solver_ref->GetTotalIterations() != 20 || solver_isl->GetTotalIterations() != 20 ||
+        hist_ref.size() != 20 || hist_isl.size() != 20) {
+        printf("Wrong number of iterations\n");
+        return false;
+    }
+    for (size_t i = 0; i < hist_ref.size(); i++) {
+        if (std::abs(hist_ref[i] - hist_isl[i]) > 1e-12 * (1 + hist_ref[i])) {
+            printf("Violation history differs at iteration %d\n", (int)i);
+            return false;
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    if (!TestSolve())
+        return 1;
+    if (!TestSleeping())
+        return 1;
+    if (!TestInactive())
+        return 1;
+    if (!TestStatistics())
+        return 1;
+
+    printf("PASSED\n");
+    return 0;
+}
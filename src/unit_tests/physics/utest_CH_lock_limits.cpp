@@ -0,0 +1,148 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Tests for ChLinkLock joints with inactive Jacobian blocks and lazily created
+// limits.
+//
+// - A spherical joint (no rotational constraints), and a parallel and an align
+//   joint (no translational constraints) are compared against the equivalent
+//   ChLinkMateGeneric joints.
+// - A limit on a translational coordinate of a parallel joint must activate
+//   the translational block and stop the falling body.
+// - Limits are created (inactive) at first access and copied with the link.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkMate.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+// Create a system with a fixed ground and a free body at (1,0,0), with an initial angular velocity.
+std::shared_ptr<ChBody> CreateSystem(ChSystemNSC& system, std::shared_ptr<ChBody>& ground) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    auto body = std::make_shared<ChBody>();
+    body->SetPos(ChVector<>(1, 0, 0));
+    body->SetInertiaXX(ChVector<>(0.1, 0.2, 0.3));
+    body->SetPos_dt(ChVector<>(0, 0, 0.5));
+    body->SetWvel_loc(ChVector<>(0.3, -0.2, 0.5));
+    system.AddBody(body);
+
+    return body;
+}
+
+// Simulate a body connected to ground with a lock joint and with an equivalent mate joint.
+bool CompareJoints(const char* name, std::shared_ptr<ChLinkLock> lock, std::shared_ptr<ChLinkMateGeneric> mate) {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    std::shared_ptr<ChBody> ground1;
+    std::shared_ptr<ChBody> ground2;
+    auto body1 = CreateSystem(sys1, ground1);
+    auto body2 = CreateSystem(sys2, ground2);
+
+    lock->Initialize(body1, ground1, ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    sys1.AddLink(lock);
+    mate->Initialize(body2, ground2, ChFrame<>(ChVector<>(0, 0, 0), QUNIT));
+    sys2.AddLink(mate);
+
+    double max_err = 0;
+    for (int i = 0; i < 1000; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+        max_err = std::max(max_err, (body1->GetPos() - body2->GetPos()).Length());
+        max_err = std::max(max_err, (body1->GetRot() - body2->GetRot()).Length());
+    }
+
+    printf("  %s: max difference %g\n", name, max_err);
+    if (max_err > 1e-4) {
+        printf("%s joint does not match the equivalent mate joint\n", name);
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    // Rotational block inactive
+    if (!CompareJoints("spherical", std::make_shared<ChLinkLockSpherical>(),
+                       std::make_shared<ChLinkMateGeneric>(true, true, true, false, false, false)))
+        return 1;
+
+    // Translational block inactive
+    if (!CompareJoints("parallel", std::make_shared<ChLinkLockParallel>(),
+                       std::make_shared<ChLinkMateGeneric>(false, false, false, true, true, false)))
+        return 1;
+    if (!CompareJoints("align", std::make_shared<ChLinkLockAlign>(),
+                       std::make_shared<ChLinkMateGeneric>(false, false, false, true, true, true)))
+        return 1;
+
+    // Limit on a translational coordinate of a parallel joint
+    {
+        ChSystemNSC system;
+        std::shared_ptr<ChBody> ground;
+        auto body = CreateSystem(system, ground);
+        body->SetWvel_loc(ChVector<>(0, 0, 0));
+
+        auto parallel = std::make_shared<ChLinkLockParallel>();
+        parallel->Initialize(body, ground, ChCoordsys<>(ChVector<>(1, 0, 0), QUNIT));
+        parallel->GetLimit_Y()->Set_active(true);
+        parallel->GetLimit_Y()->Set_min(-0.5);
+        parallel->GetLimit_Y()->Set_max(0.5);
+        system.AddLink(parallel);
+
+        for (int i = 0; i < 2000; i++)
+            system.DoStepDynamics(1e-3);
+
+        double y = body->GetPos().y();
+        printf("  parallel with Y limit: y = %g\n", y);
+        if (std::abs(y + 0.5) > 1e-2) {
+            printf("Translational limit of parallel joint not enforced\n");
+            return 1;
+        }
+        if ((body->GetRot() - QUNIT).Length() > 1e-6) {
+            printf("Parallel joint rotation not preserved with active limit\n");
+            return 1;
+        }
+    }
+
+    // Limits are created inactive at first access and copied with the link
+    {
+        ChLinkLockRevolute rev;
+        ChLinkLimit* limit = rev.GetLimit_Rz();
+        if (!limit || limit->Get_active() || rev.GetLimit_Rz() != limit || !rev.GetLimit_Rp()->Get_polar()) {
+            printf("Incorrect lazily created limit\n");
+            return 1;
+        }
+        limit->Set_active(true);
+        limit->Set_max(0.25);
+
+        ChLinkLockRevolute copy(rev);
+        if (!copy.GetLimit_Rz()->Get_active() || copy.GetLimit_Rz()->Get_max() != 0.25 ||
+            copy.GetLimit_Rz() == limit || copy.GetLimit_X()->Get_active()) {
+            printf("Incorrect copy of link limits\n");
+            return 1;
+        }
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,211 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the multithreaded processing of bodies and links in ChAssembly.
+// A set of pendulum chains, connected by spherical joints and springs, is
+// simulated with sequential and with multithreaded processing. The link groups
+// must not share any non-fixed body and the two simulations must produce the
+// same results (up to roundoff in the accumulation of link loads).
+// The link groups must also be updated when a link already in the system is
+// initialized again with other bodies, and when a fixed body is released.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <set>
+
+#include "chrono/physics/ChLinkLock.h"
+#include "chrono/physics/ChLinkSpring.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+
+const int num_chains = 10;
+const int num_links = 10;
+
+// Access to the link groups of an assembly.
+class TestSystem : public ChSystemNSC {
+  public:
+    const std::vector<std::vector<int>>& GetLinkColors() const { return link_colors; }
+};
+
+void CreateSystem(TestSystem& system, bool parallel) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+    system.SetParallelThreadNumber(4);
+    system.SetParallelUpdate(parallel);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> prev_chain;
+    for (int ic = 0; ic < num_chains; ic++) {
+        std::vector<std::shared_ptr<ChBody>> chain;
+        auto prev = ground;
+        for (int il = 0; il < num_links; il++) {
+            auto body = std::make_shared<ChBody>();
+            body->SetPos(ChVector<>(il + 1.0, 0, ic));
+            system.AddBody(body);
+
+            auto joint = std::make_shared<ChLinkLockSpherical>();
+            joint->Initialize(prev, body, ChCoordsys<>(ChVector<>(il + 0.5, 0, ic), QUNIT));
+            system.AddLink(joint);
+
+            // Springs between neighboring chains
+            if (ic > 0) {
+                auto spring = std::make_shared<ChLinkSpring>();
+                spring->Initialize(prev_chain[il], body, false, prev_chain[il]->GetPos(), body->GetPos());
+                spring->Set_SpringK(100);
+                spring->Set_SpringR(1);
+                system.AddLink(spring);
+            }
+
+            chain.push_back(body);
+            prev = body;
+        }
+        prev_chain = chain;
+    }
+}
+
+// Check that the links in each group do not share any non-fixed body.
+bool CheckColors(TestSystem& system) {
+    const auto& colors = system.GetLinkColors();
+    if (colors.empty())
+        return false;
+
+    size_t num_colored = 0;
+    for (const auto& color : colors) {
+        std::set<ChBodyFrame*> bodies;
+        for (auto ip : color) {
+            auto link = system.Get_linklist()[ip];
+            ChBodyFrame* frames[2] = {link->GetBody1(), link->GetBody2()};
+            for (auto frame : frames) {
+                if (static_cast<ChBody*>(frame)->GetBodyFixed())
+                    continue;
+                if (!bodies.insert(frame).second)
+                    return false;
+            }
+        }
+        num_colored += color.size();
+    }
+
+    printf("  %d link groups for %d links\n", (int)colors.size(), (int)system.Get_linklist().size());
+
+    return num_colored == system.Get_linklist().size();
+}
+
+// Check that the link groups follow changes of the links and bodies after the first step.
+bool TestColorUpdates() {
+    TestSystem system;
+    system.SetParallelThreadNumber(4);
+    system.SetParallelUpdate(true);
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    system.AddBody(ground);
+
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < 4; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetPos(ChVector<>(i, 0, 0));
+        system.AddBody(body);
+        bodies.push_back(body);
+    }
+
+    // Two links on distinct bodies, and two links on the fixed ground: a single group
+    auto link1 = std::make_shared<ChLinkLockSpherical>();
+    link1->Initialize(bodies[0], bodies[1], ChCoordsys<>(ChVector<>(0.5, 0, 0), QUNIT));
+    system.AddLink(link1);
+    auto link2 = std::make_shared<ChLinkLockSpherical>();
+    link2->Initialize(bodies[2], bodies[3], ChCoordsys<>(ChVector<>(2.5, 0, 0), QUNIT));
+    system.AddLink(link2);
+    auto link3 = std::make_shared<ChLinkLockSpherical>();
+    link3->Initialize(ground, bodies[0], ChCoordsys<>(ChVector<>(0, 0, 0), QUNIT));
+    system.AddLink(link3);
+    auto link4 = std::make_shared<ChLinkLockSpherical>();
+    link4->Initialize(ground, bodies[3], ChCoordsys<>(ChVector<>(3, 0, 0), QUNIT));
+    system.AddLink(link4);
+
+    system.DoStepDynamics(1e-3);
+    if (!CheckColors(system) || system.GetLinkColors().size() != 2) {
+        printf("Invalid link groups\n");
+        return false;
+    }
+
+    // Initialize the second link again, now sharing a body with the first one
+    link2->Initialize(bodies[1], bodies[2], ChCoordsys<>(ChVector<>(1.5, 0, 0), QUNIT));
+    system.DoStepDynamics(1e-3);
+    if (!CheckColors(system)) {
+        printf("Link groups not updated after initializing a link again\n");
+        return false;
+    }
+
+    // Release the ground, now shared by the last two links
+    ground->SetBodyFixed(false);
+    system.DoStepDynamics(1e-3);
+    if (!CheckColors(system)) {
+        printf("Link groups not updated after releasing a fixed body\n");
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    TestSystem sys_seq;
+    TestSystem sys_par;
+    CreateSystem(sys_seq, false);
+    CreateSystem(sys_par, true);
+
+    for (int i = 0; i < 50; i++) {
+        sys_seq.DoStepDynamics(1e-3);
+        sys_par.DoStepDynamics(1e-3);
+    }
+
+    if (!sys_seq.GetLinkColors().empty()) {
+        printf("Link groups computed with sequential processing\n");
+        return 1;
+    }
+    if (!CheckColors(sys_par)) {
+        printf("Invalid link groups\n");
+        return 1;
+    }
+
+    ChState x1(sys_seq.GetNcoords_x(), &sys_seq), x2(sys_par.GetNcoords_x(), &sys_par);
+    ChStateDelta v1(sys_seq.GetNcoords_w(), &sys_seq), v2(sys_par.GetNcoords_w(), &sys_par);
+    double t1, t2;
+    sys_seq.StateGather(x1, v1, t1);
+    sys_par.StateGather(x2, v2, t2);
+
+    double err = std::abs(t1 - t2);
+    for (int i = 0; i < x1.GetRows(); i++)
+        err = std::max(err, std::abs(x1(i) - x2(i)));
+    for (int i = 0; i < v1.GetRows(); i++)
+        err = std::max(err, std::abs(v1(i) - v2(i)));
+
+    printf("  max state difference: %g\n", err);
+
+    if (err > 1e-8) {
+        printf("Sequential and multithreaded results differ\n");
+        return 1;
+    }
+
+    if (!TestColorUpdates())
+        return 1;
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,189 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the batched insertion and removal of particles in a cluster of
+// clones. Particles are emitted in small batches (forcing reallocations of the
+// particle storage) while the cluster settles on a fixed ground box, then the
+// particles in one half of the domain are removed in a single batch. After
+// each operation, the collision models must be attached to the particles at
+// their current location and the collision system must contain exactly one
+// object per particle. Removing particles must only drop the contacts of the
+// particles, not those of other objects.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/collision/ChCCollisionSystemBullet.h"
+#include "chrono/particlefactory/ChParticleEmitter.h"
+#include "chrono/particlefactory/ChParticleRemover.h"
+#include "chrono/physics/ChParticlesClones.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono/collision/bullet/BulletCollision/CollisionDispatch/btCollisionWorld.h"
+
+using namespace chrono;
+using namespace chrono::particlefactory;
+
+// Check that the particle collision models point back to the particles and that
+// the collision system holds the ground, the box, plus one object per particle.
+bool CheckClones(ChSystemNSC& system, ChParticlesClones& clones) {
+    for (unsigned int i = 0; i < clones.GetNparticles(); i++) {
+        auto& particle = static_cast<ChAparticle&>(clones.GetParticle(i));
+        if (particle.GetContainer() != &clones)
+            return false;
+        if (particle.collision_model->GetContactable() != &particle)
+            return false;
+        if (particle.variables.GetSharedMass() == NULL)
+            return false;
+    }
+
+    auto coll_sys = std::static_pointer_cast<collision::ChCollisionSystemBullet>(system.GetCollisionSystem());
+    int num_objects = coll_sys->GetBulletCollisionWorld()->getNumCollisionObjects();
+
+    return num_objects == (int)clones.GetNparticles() + 2;
+}
+
+// Count the contacts that involve (or not) a given physics item.
+class ContactCounter : public ChContactContainer::ReportContactCallback {
+  public:
+    ContactCounter(ChPhysicsItem* item) : m_item(item), m_with(0), m_without(0) {}
+
+    virtual bool OnReportContact(const ChVector<>& pA,
+                                 const ChVector<>& pB,
+                                 const ChMatrix33<>& plane_coord,
+                                 const double& distance,
+                                 const double& eff_radius,
+                                 const ChVector<>& react_forces,
+                                 const ChVector<>& react_torques,
+                                 ChContactable* contactobjA,
+                                 ChContactable* contactobjB) override {
+        if (contactobjA->GetPhysicsItem() == m_item || contactobjB->GetPhysicsItem() == m_item)
+            m_with++;
+        else
+            m_without++;
+        return true;
+    }
+
+    ChPhysicsItem* m_item;
+    int m_with;
+    int m_without;
+};
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC system;
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    auto ground = std::make_shared<ChBody>();
+    ground->SetBodyFixed(true);
+    ground->GetCollisionModel()->ClearModel();
+    ground->GetCollisionModel()->AddBox(2, 0.1, 2, ChVector<>(0, -0.1, 0));
+    ground->GetCollisionModel()->BuildModel();
+    ground->SetCollide(true);
+    system.AddBody(ground);
+
+    auto clones = std::make_shared<ChParticlesClones>();
+    clones->SetMass(0.1);
+    clones->SetInertiaXX(ChVector<>(1e-4, 1e-4, 1e-4));
+    clones->GetCollisionModel()->ClearModel();
+    clones->GetCollisionModel()->AddSphere(0.05);
+    clones->GetCollisionModel()->BuildModel();
+    clones->SetCollide(true);
+    system.Add(clones);
+
+    // A box resting on the ground, away from the particles
+    auto box = std::make_shared<ChBody>();
+    box->SetPos(ChVector<>(1.8, 0.1, 1.8));
+    box->GetCollisionModel()->ClearModel();
+    box->GetCollisionModel()->AddBox(0.1, 0.1, 0.1);
+    box->GetCollisionModel()->BuildModel();
+    box->SetCollide(true);
+    system.AddBody(box);
+
+    // Emit particles from a rectangular outlet above the ground
+    auto positioner = std::make_shared<ChRandomParticlePositionRectangleOutlet>();
+    positioner->Outlet() = ChCoordsys<>(ChVector<>(0, 1, 0), Q_from_AngX(CH_C_PI_2));
+    positioner->OutletWidth() = 1.5;
+    positioner->OutletHeight() = 1.5;
+
+    ChParticleEmitter emitter;
+    emitter.SetParticlePositioner(positioner);
+    emitter.ParticlesPerSecond() = 10000;
+    emitter.SetUseParticleReservoir(true);
+    emitter.ParticleReservoirAmount() = 300;
+
+    for (int i = 0; i < 100; i++) {
+        emitter.EmitParticles(*clones, 1e-3);
+        system.DoStepDynamics(1e-3);
+        if (!CheckClones(system, *clones)) {
+            printf("Invalid particle state after emission (step %d)\n", i);
+            return 1;
+        }
+    }
+
+    printf("  %d particles, %d contacts\n", (int)clones->GetNparticles(), system.GetNcontacts());
+
+    if (clones->GetNparticles() != 300) {
+        printf("Wrong number of emitted particles\n");
+        return 1;
+    }
+
+    ContactCounter before(clones.get());
+    system.GetContactContainer()->ReportAllContacts(&before);
+
+    // Remove all particles with x < 0
+    ChParticleRemoverBox remover;
+    remover.GetBox().Pos = ChVector<>(50, 0, 0);
+    remover.GetBox().Size = ChVector<>(50, 50, 50);
+    int num_removed = remover.ProcessParticles(*clones);
+
+    printf("  removed %d particles\n", num_removed);
+
+    ContactCounter after(clones.get());
+    system.GetContactContainer()->ReportAllContacts(&after);
+
+    printf("  contacts of other objects: %d before removal, %d after\n", before.m_without, after.m_without);
+
+    if (before.m_with == 0 || before.m_without == 0 || after.m_with != 0 || after.m_without != before.m_without ||
+        system.GetNcontacts() != before.m_without) {
+        printf("Wrong contacts after removal\n");
+        return 1;
+    }
+
+    if (num_removed == 0 || clones->GetNparticles() + num_removed != 300) {
+        printf("Wrong number of removed particles\n");
+        return 1;
+    }
+    for (unsigned int i = 0; i < clones->GetNparticles(); i++) {
+        if (clones->GetParticle(i).GetPos().x() < -1e-10) {
+            printf("Particle %d not removed\n", i);
+            return 1;
+        }
+    }
+    if (!CheckClones(system, *clones)) {
+        printf("Invalid particle state after removal\n");
+        return 1;
+    }
+
+    for (int i = 0; i < 20; i++)
+        system.DoStepDynamics(1e-3);
+
+    if (!CheckClones(system, *clones)) {
+        printf("Invalid particle state after simulation\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,228 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the sharing of collision shapes and visualization meshes through a
+// collision shape library. A number of identical convex rocks are dropped on a
+// static triangle mesh; all rocks must reference the same Bullet shape and the
+// same visualization mesh, and the results must match those obtained with one
+// shape per body. Connected meshes must not be shared, but represented by the
+// same triangle proxies as when added directly to the collision model. A shared
+// visualization mesh modified through one asset must be copied first, leaving the
+// other assets unchanged. Shapes no longer in use must be released when the
+// library is purged.
+//
+// =============================================================================
+
+#include <cstdio>
+
+#include "chrono/assets/ChTriangleMeshShape.h"
+#include "chrono/collision/ChCCollisionShapeLibrary.h"
+#include "chrono/collision/ChCModelBullet.h"
+#include "chrono/geometry/ChTriangleMeshSoup.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+#include "chrono/collision/bullet/BulletCollision/CollisionDispatch/btCollisionObject.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btCompoundShape.h"
+#include "chrono/collision/bullet/BulletCollision/CollisionShapes/btConvexHullShape.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+const int num_rocks = 20;
+
+// Create a system with two static triangle mesh grounds and identical convex rocks (pyramids).
+// If a library is provided, all geometry is added through the library.
+void CreateSystem(ChSystemNSC& system, ChCollisionShapeLibrary* library, std::vector<std::shared_ptr<ChBody>>& rocks) {
+    system.Set_G_acc(ChVector<>(0, -9.81, 0));
+
+    geometry::ChTriangleMeshSoup ground_mesh;
+    ground_mesh.addTriangle(ChVector<>(-10, 0, -10), ChVector<>(-10, 0, 10), ChVector<>(10, 0, 10));
+    ground_mesh.addTriangle(ChVector<>(-10, 0, -10), ChVector<>(10, 0, 10), ChVector<>(10, 0, -10));
+
+    for (int i = 0; i < 2; i++) {
+        auto ground = std::make_shared<ChBody>();
+        ground->SetBodyFixed(true);
+        ground->SetPos(ChVector<>(0, 0, 20.0 * i));
+        ground->GetCollisionModel()->ClearModel();
+        if (library)
+            library->AddTriangleMesh(ground->GetCollisionModel().get(), ground_mesh, true, false);
+        else
+            ground->GetCollisionModel()->AddTriangleMesh(ground_mesh, true, false);
+        ground->GetCollisionModel()->BuildModel();
+        ground->SetCollide(true);
+        system.AddBody(ground);
+    }
+
+    std::vector<ChVector<>> points = {ChVector<>(-0.2, -0.1, -0.2), ChVector<>(0.2, -0.1, -0.2),
+                                      ChVector<>(0.2, -0.1, 0.2), ChVector<>(-0.2, -0.1, 0.2), ChVector<>(0, 0.2, 0)};
+    geometry::ChTriangleMeshConnected rock_mesh;
+    rock_mesh.addTriangle(points[0], points[1], points[4]);
+    rock_mesh.addTriangle(points[1], points[2], points[4]);
+    rock_mesh.addTriangle(points[2], points[3], points[4]);
+    rock_mesh.addTriangle(points[3], points[0], points[4]);
+
+    for (int i = 0; i < num_rocks; i++) {
+        auto rock = std::make_shared<ChBody>();
+        rock->SetPos(ChVector<>(-5 + 0.5 * i, 0.5, 0));
+        rock->SetRot(Q_from_AngY(0.1 * i));
+        rock->GetCollisionModel()->ClearModel();
+        if (library)
+            library->AddConvexHull(rock->GetCollisionModel().get(), points);
+        else
+            rock->GetCollisionModel()->AddConvexHull(points);
+        rock->GetCollisionModel()->BuildModel();
+        rock->SetCollide(true);
+
+        auto asset = std::make_shared<ChTriangleMeshShape>();
+        if (library)
+            asset->SetMesh(library->GetMesh(rock_mesh));
+        else
+            asset->SetMesh(rock_mesh);
+        rock->AddAsset(asset);
+
+        system.AddBody(rock);
+        rocks.push_back(rock);
+    }
+}
+
+int main(int argc, char* argv[]) {
+    ChCollisionShapeLibrary library;
+
+    ChSystemNSC system;
+    std::vector<std::shared_ptr<ChBody>> rocks;
+    CreateSystem(system, &library, rocks);
+
+    ChSystemNSC ref_system;
+    std::vector<std::shared_ptr<ChBody>> ref_rocks;
+    CreateSystem(ref_system, nullptr, ref_rocks);
+
+    printf("  %d shapes, %d meshes, %d reused, %d bytes\n", (int)library.GetNumShapes(), (int)library.GetNumMeshes(),
+           (int)library.GetNumReused(), (int)library.GetMemoryUsage());
+
+    if (library.GetNumShapes() != 2 || library.GetNumMeshes() != 1) {
+        printf("Wrong number of shapes or meshes in the library\n");
+        return 1;
+    }
+    if (library.GetNumReused() != (num_rocks - 1) + 1 + (num_rocks - 1)) {
+        printf("Wrong number of reused shapes\n");
+        return 1;
+    }
+    if (library.GetMemoryUsage() == 0) {
+        printf("Memory usage not tracked\n");
+        return 1;
+    }
+
+    // All rocks reference the same Bullet shape and visualization mesh
+    auto object0 = std::static_pointer_cast<ChModelBullet>(rocks[0]->GetCollisionModel())->GetBulletModel();
+    auto mesh0 = std::static_pointer_cast<ChTriangleMeshShape>(rocks[0]->GetAssets()[0])->GetSharedMesh();
+    for (int i = 1; i < num_rocks; i++) {
+        auto object = std::static_pointer_cast<ChModelBullet>(rocks[i]->GetCollisionModel())->GetBulletModel();
+        if (object->getCollisionShape() != object0->getCollisionShape()) {
+            printf("Rock %d does not share the collision shape\n", i);
+            return 1;
+        }
+        auto mesh = std::static_pointer_cast<ChTriangleMeshShape>(rocks[i]->GetAssets()[0])->GetSharedMesh();
+        if (mesh != mesh0) {
+            printf("Rock %d does not share the visualization mesh\n", i);
+            return 1;
+        }
+    }
+
+    // Drop the rocks on the ground; shared shapes must give the same results as individual shapes
+    for (int i = 0; i < 1000; i++) {
+        system.DoStepDynamics(1e-3);
+        ref_system.DoStepDynamics(1e-3);
+    }
+
+    printf("  %d contacts\n", system.GetNcontacts());
+
+    if (system.GetNcontacts() != ref_system.GetNcontacts()) {
+        printf("Wrong number of contacts\n");
+        return 1;
+    }
+    for (int i = 0; i < num_rocks; i++) {
+        double y = rocks[i]->GetPos().y();
+        if (y < 0 || y > 0.2) {
+            printf("Rock %d not on the ground (y = %g)\n", i, y);
+            return 1;
+        }
+        if ((rocks[i]->GetPos() - ref_rocks[i]->GetPos()).Length() > 1e-10) {
+            printf("Rock %d: results differ from individual shapes\n", i);
+            return 1;
+        }
+    }
+
+    // Connected meshes are not shared, but represented by per-triangle proxies as with the collision model
+    {
+        geometry::ChTriangleMeshConnected plate;
+        plate.addTriangle(ChVector<>(-1, 0, -1), ChVector<>(-1, 0, 1), ChVector<>(1, 0, 1));
+        plate.addTriangle(ChVector<>(-1, 0, -1), ChVector<>(1, 0, 1), ChVector<>(1, 0, -1));
+
+        size_t num_shapes = library.GetNumShapes();
+        size_t num_reused = library.GetNumReused();
+        auto model = std::make_shared<ChModelBullet>();
+        auto ref_model = std::make_shared<ChModelBullet>();
+        library.AddTriangleMesh(model.get(), plate, false, false, ChVector<>(), ChMatrix33<>(1), 0.01);
+        ref_model->AddTriangleMesh(plate, false, false, ChVector<>(), ChMatrix33<>(1), 0.01);
+
+        auto shape = model->GetBulletModel()->getCollisionShape();
+        auto ref_shape = ref_model->GetBulletModel()->getCollisionShape();
+        if (library.GetNumShapes() != num_shapes || library.GetNumReused() != num_reused || !shape ||
+            !shape->isCompound() || !ref_shape->isCompound() ||
+            static_cast<btCompoundShape*>(shape)->getNumChildShapes() !=
+                static_cast<btCompoundShape*>(ref_shape)->getNumChildShapes()) {
+            printf("Connected mesh not represented by triangle proxies\n");
+            return 1;
+        }
+    }
+
+    // Modifying the mesh of one asset (or of a copy of it) does not affect the other assets
+    {
+        auto asset0 = std::static_pointer_cast<ChTriangleMeshShape>(rocks[0]->GetAssets()[0]);
+        auto asset1 = std::static_pointer_cast<ChTriangleMeshShape>(rocks[1]->GetAssets()[0]);
+        auto asset_copy = std::make_shared<ChTriangleMeshShape>(*asset1);
+        ChVector<> v0 = mesh0->getCoordsVertices()[0];
+        asset0->GetMesh().getCoordsVertices()[0] += ChVector<>(1, 0, 0);
+        asset_copy->GetMesh().getCoordsVertices()[0] += ChVector<>(2, 0, 0);
+        if (asset0->GetSharedMesh() == mesh0 || asset_copy->GetSharedMesh() == mesh0 ||
+            asset1->GetSharedMesh() != mesh0 || mesh0->getCoordsVertices()[0] != v0 ||
+            asset0->GetSharedMesh()->getCoordsVertices()[0] != v0 + ChVector<>(1, 0, 0) ||
+            asset_copy->GetSharedMesh()->getCoordsVertices()[0] != v0 + ChVector<>(2, 0, 0)) {
+            printf("Shared visualization mesh not copied on write\n");
+            return 1;
+        }
+
+        // A mesh owned by a single asset is modified in place
+        auto owned = asset0->GetSharedMesh().get();
+        if (&asset0->GetMesh() != owned) {
+            printf("Unshared visualization mesh copied\n");
+            return 1;
+        }
+    }
+
+    // Release the rocks; only the ground shape remains in use
+    for (auto& rock : rocks)
+        system.RemoveBody(rock);
+    rocks.clear();
+    mesh0.reset();
+    library.Purge();
+
+    if (library.GetNumShapes() != 1 || library.GetNumMeshes() != 0) {
+        printf("Unused shapes not purged\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
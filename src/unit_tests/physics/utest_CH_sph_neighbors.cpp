@@ -0,0 +1,151 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the cell-list neighbor search used by ChMatterSPH.
+// - the neighbor lists of random particles are compared with a brute force
+//   search, also after moving the particles within and beyond the skin;
+// - an SPH fluid is simulated with the built-in neighbor lists, without and
+//   with a skin distance; the two simulations must give the same results (up
+//   to roundoff) and the lists must be rebuilt less often with the skin.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <set>
+
+#include "chrono/collision/ChCNeighborGrid.h"
+#include "chrono/core/ChMathematics.h"
+#include "chrono/physics/ChMatterSPH.h"
+#include "chrono/physics/ChSystemNSC.h"
+
+using namespace chrono;
+using namespace chrono::collision;
+
+// Check the neighbor lists against a brute force search.
+bool CheckNeighbors(const ChNeighborGrid& grid, const std::vector<ChVector<>>& pos, double radius) {
+    int n = (int)pos.size();
+    const auto& order = grid.GetOrder();
+    const auto& start = grid.GetStart();
+    const auto& neighbors = grid.GetNeighbors();
+
+    if (grid.GetNumParticles() != n)
+        return false;
+
+    std::vector<int> visited(n, 0);
+    for (int k = 0; k < n; k++) {
+        int i = order[k];
+        visited[i]++;
+        std::set<int> list(neighbors.begin() + start[k], neighbors.begin() + start[k + 1]);
+        if (list.size() != start[k + 1] - start[k] || list.count(i))
+            return false;
+        // all actual neighbors must be in the list
+        for (int j = 0; j < n; j++) {
+            if (j != i && (pos[j] - pos[i]).Length() < radius && !list.count(j))
+                return false;
+        }
+    }
+
+    return std::all_of(visited.begin(), visited.end(), [](int v) { return v == 1; });
+}
+
+bool TestGrid() {
+    const int n = 2000;
+    const double radius = 0.1;
+    const double skin = 0.02;
+
+    std::vector<ChVector<>> pos(n);
+    for (auto& p : pos)
+        p = ChVector<>(ChRandom(), 0.5 * ChRandom(), 0.2 * ChRandom());
+
+    ChNeighborGrid grid;
+    grid.SetSkin(skin);
+    if (!grid.Update(pos, radius) || !CheckNeighbors(grid, pos, radius)) {
+        printf("Wrong neighbors after first build\n");
+        return false;
+    }
+    int num_pairs = (int)grid.GetNeighbors().size();
+
+    // Move the particles less than half the skin: lists are not rebuilt but still valid
+    for (auto& p : pos)
+        p += ChVector<>(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5) * (0.5 * skin / std::sqrt(3.0));
+    if (grid.Update(pos, radius) || !CheckNeighbors(grid, pos, radius)) {
+        printf("Wrong neighbors within the skin\n");
+        return false;
+    }
+
+    // Move the particles more than half the skin: lists are rebuilt
+    for (auto& p : pos)
+        p += ChVector<>(ChRandom() - 0.5, ChRandom() - 0.5, ChRandom() - 0.5) * (4 * skin);
+    if (!grid.Update(pos, radius) || !CheckNeighbors(grid, pos, radius)) {
+        printf("Wrong neighbors after rebuild\n");
+        return false;
+    }
+
+    printf("  %d particles, %d neighbor entries, %u builds\n", n, num_pairs, grid.GetNumRebuilds());
+    return grid.GetNumRebuilds() == 2;
+}
+
+std::shared_ptr<ChMatterSPH> CreateFluid(ChSystemNSC& system, double skin) {
+    auto fluid = std::make_shared<ChMatterSPH>();
+    fluid->SetUseNeighborGrid(true);
+    fluid->GetNeighborGrid().SetSkin(skin);
+    fluid->FillBox(ChVector<>(0.4, 0.2, 0.2), 0.02, 1000, ChCoordsys<>(ChVector<>(0, 0.1, 0)), true, 2.2, 0.1);
+    fluid->GetMaterial().Set_viscosity(0.5);
+    fluid->GetMaterial().Set_pressure_stiffness(300);
+    system.Add(fluid);
+    return fluid;
+}
+
+bool TestFluid() {
+    ChSystemNSC sys1;
+    ChSystemNSC sys2;
+    ChSetRandomSeed(1);
+    auto fluid1 = CreateFluid(sys1, 0);
+    ChSetRandomSeed(1);
+    auto fluid2 = CreateFluid(sys2, 0.01);
+
+    for (int i = 0; i < 20; i++) {
+        sys1.DoStepDynamics(1e-3);
+        sys2.DoStepDynamics(1e-3);
+    }
+
+    double err = 0;
+    double max_density = 0;
+    for (unsigned int i = 0; i < fluid1->GetNnodes(); i++) {
+        auto node1 = std::dynamic_pointer_cast<ChNodeSPH>(fluid1->GetNode(i));
+        auto node2 = std::dynamic_pointer_cast<ChNodeSPH>(fluid2->GetNode(i));
+        err = std::max(err, (node1->GetPos() - node2->GetPos()).Length());
+        err = std::max(err, (node1->GetPos_dt() - node2->GetPos_dt()).Length());
+        max_density = std::max(max_density, node1->density);
+    }
+
+    unsigned int builds1 = fluid1->GetNeighborGrid().GetNumRebuilds();
+    unsigned int builds2 = fluid2->GetNeighborGrid().GetNumRebuilds();
+    printf("  %d SPH nodes, max density %g, builds %u (no skin) %u (skin), max difference %g\n",
+           (int)fluid1->GetNnodes(), max_density, builds1, builds2, err);
+
+    return max_density > 0 && builds2 < builds1 && err < 1e-10;
+}
+
+int main(int argc, char* argv[]) {
+    if (!TestGrid())
+        return 1;
+    if (!TestFluid())
+        return 1;
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,160 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Benchmark for the tire-terrain data exchange of the distributed vehicle
+// cosimulation. Must be run on 2 MPI ranks:
+//    rank 0 plays the role of a tire node (sends mesh data, receives forces)
+//    rank 1 plays the role of the terrain node
+//
+// A synthetic cylindrical tire mesh rolls over a flat surface. The exchange of
+// the full mesh is compared against the contact-region exchange, in double and
+// in single precision. Reported are the average round-trip latency per step and
+// the number of bytes transferred per step.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "mpi.h"
+
+#include "chrono/core/ChTimer.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimExchange.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_circ = 360;   // number of vertices around the tire
+const int num_width = 20;   // number of vertices across the tire
+const double radius = 0.5;  // tire radius
+const double width = 0.2;   // tire width
+const int num_steps = 2000;
+
+// Generate the tire mesh vertices for the given rolling angle.
+void MeshState(double angle,
+               const std::vector<ChVector<>>& loc,
+               ChFrameMoving<>& wheel,
+               std::vector<ChVector<>>& pos,
+               std::vector<ChVector<>>& vel) {
+    double omega = 10;
+    wheel.SetPos(ChVector<>(radius * angle, 0, 0));
+    wheel.SetRot(Q_from_AngY(angle));
+    wheel.SetPos_dt(ChVector<>(radius * omega, 0, 0));
+    wheel.SetWvel_par(ChVector<>(0, omega, 0));
+    for (size_t i = 0; i < loc.size(); i++) {
+        pos[i] = wheel.TransformPointLocalToParent(loc[i]);
+        vel[i] = wheel.GetPos_dt() + Vcross(wheel.GetWvel_par(), pos[i] - wheel.GetPos());
+    }
+}
+
+void Run(int rank, bool full, bool single_precision) {
+    int num_vert = num_circ * num_width;
+
+    std::vector<ChVector<>> loc(num_vert);
+    for (int ic = 0; ic < num_circ; ic++) {
+        double a = ic * CH_C_2PI / num_circ;
+        for (int iw = 0; iw < num_width; iw++) {
+            double y = -width / 2 + iw * width / (num_width - 1);
+            loc[ic * num_width + iw] = ChVector<>(radius * std::cos(a), y, radius * std::sin(a));
+        }
+    }
+
+    ChTimer<double> timer;
+    double bytes = 0;
+
+    if (rank == 0) {
+        ChCosimMeshSender sender(num_vert, single_precision, 1, 0);
+        ChCosimForceReceiver receiver(num_vert, single_precision, 1, 0);
+        ChCosimContactRegion region;
+        ChFrameMoving<> wheel;
+        std::vector<ChVector<>> pos(num_vert);
+        std::vector<ChVector<>> vel(num_vert);
+        std::vector<int> indices;
+        std::vector<ChVector<>> forces;
+
+        MPI_Barrier(MPI_COMM_WORLD);
+        for (int is = 0; is < num_steps; is++) {
+            MeshState(is * 1e-3, loc, wheel, pos, vel);
+            timer.start();
+            receiver.Post(MPI_COMM_WORLD);
+            sender.Send(wheel, pos, vel, region, MPI_COMM_WORLD);
+            receiver.Complete(indices, forces, region);
+            timer.stop();
+            bytes += sender.GetNumBytes() + 7 * sizeof(double) + indices.size() * sizeof(int) +
+                     3 * indices.size() * (single_precision ? sizeof(float) : sizeof(double));
+        }
+        sender.Wait();
+
+        printf("%-8s %-7s  latency = %8.2f us   bytes/step = %10.0f\n", full ? "full" : "region",
+               single_precision ? "float" : "double", 1e6 * timer() / num_steps, bytes / num_steps);
+    } else {
+        ChCosimMeshReceiver receiver(num_vert, single_precision, 0, 0);
+        ChCosimForceSender sender(num_vert, single_precision, 0, 0);
+        sender.SetMargin(0.05);
+        if (full)
+            sender.SetFullExchangeInterval(1);
+        std::vector<int> indices;
+        std::vector<ChVector<>> forces;
+
+        receiver.Post(MPI_COMM_WORLD);
+        MPI_Barrier(MPI_COMM_WORLD);
+        for (int is = 0; is < num_steps; is++) {
+            receiver.Complete();
+            const std::vector<ChVector<>>& pos = receiver.GetPositions();
+            indices.clear();
+            forces.clear();
+            for (int iv = 0; iv < num_vert; iv++) {
+                double pen = -(radius - 0.01) - pos[iv].z();
+                if (pen > 0) {
+                    indices.push_back(iv);
+                    forces.push_back(ChVector<>(0, 0, 1e5 * pen));
+                }
+            }
+            if (is < num_steps - 1)
+                receiver.Post(MPI_COMM_WORLD);
+            sender.Send(indices, forces, pos, MPI_COMM_WORLD);
+        }
+        sender.Wait();
+    }
+
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+
+    int num_procs;
+    int rank;
+    MPI_Comm_size(MPI_COMM_WORLD, &num_procs);
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+    if (num_procs != 2) {
+        if (rank == 0)
+            printf("This benchmark must be run on 2 MPI ranks.\n");
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (rank == 0)
+        printf("Tire mesh: %d vertices,  %d steps\n", num_circ * num_width, num_steps);
+
+    Run(rank, true, false);
+    Run(rank, true, true);
+    Run(rank, false, false);
+    Run(rank, false, true);
+
+    MPI_Finalize();
+    return 0;
+}
@@ -0,0 +1,245 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the in-process multi-rate cosimulation framework.
+//
+// A mass (a ChBody in its own system) rests on an analytical spring-damper
+// "tire" advanced by a separate node with a different step size. The two nodes
+// only exchange data through cosimulation channels, at a coupling step larger
+// than either node step. The cosimulation results are compared against the
+// analytical solution of the equivalent single-degree-of-freedom oscillator,
+// and runs with 1 and 2 threads must produce identical results.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/wheeled_vehicle/cosim/ChCosimLocalManager.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+// Node with a single body, moving along the global Z axis under the force read from its input channel.
+// Outputs: body vertical position and velocity.
+class MassNode : public ChCosimLocalNode {
+  public:
+    MassNode(double mass, double z0) : ChCosimLocalNode(&m_sys), m_mass(mass), m_z0(z0) {}
+
+    void SetChannels(std::shared_ptr<ChCosimChannel> state, std::shared_ptr<ChCosimChannel> force) {
+        m_state_channel = state;
+        m_force_channel = force;
+    }
+
+    virtual void Initialize() override {
+        m_sys.Set_G_acc(ChVector<>(0, 0, 0));
+        m_body = std::make_shared<ChBody>();
+        m_body->SetMass(m_mass);
+        m_body->SetPos(ChVector<>(0, 0, m_z0));
+        m_sys.AddBody(m_body);
+    }
+
+    virtual void Output(double time) override {
+        m_buffer.resize(2);
+        m_buffer[0] = m_body->GetPos().z();
+        m_buffer[1] = m_body->GetPos_dt().z();
+        m_state_channel->Put(time, m_buffer);
+    }
+
+    double GetZ() const { return m_body->GetPos().z(); }
+
+  private:
+    virtual void OnSubstep(double time, double h) override {
+        m_body->Empty_forces_accumulators();
+        if (!m_force_channel->HasData())
+            return;
+        m_force_channel->Get(time, m_buffer);
+        m_body->Accumulate_force(ChVector<>(0, 0, m_buffer[0]), m_body->GetPos(), false);
+    }
+
+    ChSystemNSC m_sys;
+    double m_mass;
+    double m_z0;
+    std::shared_ptr<ChBody> m_body;
+    std::shared_ptr<ChCosimChannel> m_state_channel;
+    std::shared_ptr<ChCosimChannel> m_force_channel;
+    std::vector<double> m_buffer;
+};
+
+// Analytical spring-damper tire: no Chrono dynamics, the force is evaluated at each node step from the mass state
+// extrapolated at the middle of that step. The output force is the average over the coupling step (i.e., the force
+// impulse divided by the coupling step), time-stamped at the middle of the coupling step. The initial output is
+// the spring force at the initial deflection.
+class SpringNode : public ChCosimLocalNode {
+  public:
+    SpringNode(double k, double c, double z0)
+        : ChCosimLocalNode(&m_sys), m_k(k), m_c(c), m_z0(z0), m_impulse(0), m_duration(0) {}
+
+    void SetChannels(std::shared_ptr<ChCosimChannel> state, std::shared_ptr<ChCosimChannel> force) {
+        m_state_channel = state;
+        m_force_channel = force;
+    }
+
+    virtual void Synchronize(double time) override {
+        m_impulse = 0;
+        m_duration = 0;
+    }
+
+    virtual void Advance(double time, double step) override {
+        double t = 0;
+        while (t < step) {
+            double h = std::min<>(m_stepsize, step - t);
+            m_state_channel->Get(time + t + h / 2, m_buffer);
+            m_impulse += h * (-m_k * m_buffer[0] - m_c * m_buffer[1]);
+            m_duration += h;
+            t += h;
+        }
+    }
+
+    virtual void Output(double time) override {
+        m_buffer.resize(1);
+        m_buffer[0] = m_duration > 0 ? m_impulse / m_duration : -m_k * m_z0;
+        m_force_channel->Put(time - m_duration / 2, m_buffer);
+    }
+
+  private:
+    ChSystemNSC m_sys;
+    double m_k;
+    double m_c;
+    double m_z0;
+    double m_impulse;
+    double m_duration;
+    std::shared_ptr<ChCosimChannel> m_state_channel;
+    std::shared_ptr<ChCosimChannel> m_force_channel;
+    std::vector<double> m_buffer;
+};
+
+bool TestChannel() {
+    ChCosimChannel channel;
+    std::vector<double> data;
+
+    // Data published but not yet swapped is not visible
+    channel.Put(0.0, std::vector<double>{1.0, -1.0});
+    if (channel.HasData()) {
+        printf("Channel data visible before swap\n");
+        return false;
+    }
+    channel.Swap();
+
+    // Zero-order hold with a single sample
+    channel.Get(0.5, data);
+    if (data.size() != 2 || data[0] != 1.0 || data[1] != -1.0) {
+        printf("Incorrect zero-order hold\n");
+        return false;
+    }
+
+    // Linear interpolation and extrapolation through the two most recent samples
+    channel.Put(1.0, std::vector<double>{3.0, -2.0});
+    channel.Swap();
+    channel.Get(0.5, data);
+    if (std::abs(data[0] - 2.0) > 1e-12 || std::abs(data[1] + 1.5) > 1e-12) {
+        printf("Incorrect interpolation: %g %g\n", data[0], data[1]);
+        return false;
+    }
+    channel.Get(1.5, data);
+    if (std::abs(data[0] - 4.0) > 1e-12 || std::abs(data[1] + 2.5) > 1e-12) {
+        printf("Incorrect extrapolation: %g %g\n", data[0], data[1]);
+        return false;
+    }
+
+    // A swap without a new sample does not change the visible data
+    channel.Swap();
+    if (channel.GetTime() != 1.0 || channel.Get()[0] != 3.0) {
+        printf("Channel changed without a new sample\n");
+        return false;
+    }
+
+    return true;
+}
+
+// Run the two-rate cosimulation and return the mass positions at the coupling times.
+std::vector<double> RunCosim(int num_threads, double mass, double k, double c, double z0, double t_end) {
+    ChCosimLocalManager manager(2e-3, num_threads);
+
+    auto mass_node = std::make_shared<MassNode>(mass, z0);
+    auto spring_node = std::make_shared<SpringNode>(k, c, z0);
+    mass_node->SetStepsize(2.5e-4);
+    spring_node->SetStepsize(1e-3);
+
+    auto state = manager.AddChannel();
+    auto force = manager.AddChannel();
+    mass_node->SetChannels(state, force);
+    spring_node->SetChannels(state, force);
+
+    manager.AddNode(mass_node);
+    manager.AddNode(spring_node);
+    manager.Initialize();
+
+    std::vector<double> z;
+    while (manager.GetTime() < t_end - 1e-10) {
+        manager.Advance();
+        z.push_back(mass_node->GetZ());
+    }
+
+    return z;
+}
+
+int main(int argc, char* argv[]) {
+    if (!TestChannel())
+        return 1;
+
+    // Lightly damped oscillator: m z'' + c z' + k z = 0, z(0) = z0, z'(0) = 0
+    double mass = 1;
+    double k = 400;
+    double c = 4;
+    double z0 = 0.1;
+    double t_end = 1;
+
+    std::vector<double> z1 = RunCosim(1, mass, k, c, z0, t_end);
+    std::vector<double> z2 = RunCosim(2, mass, k, c, z0, t_end);
+
+    if (z1.size() != z2.size()) {
+        printf("Different number of coupling steps: %d %d\n", (int)z1.size(), (int)z2.size());
+        return 1;
+    }
+    for (size_t i = 0; i < z1.size(); i++) {
+        if (z1[i] != z2[i]) {
+            printf("Results depend on the number of threads (step %d: %g %g)\n", (int)i, z1[i], z2[i]);
+            return 1;
+        }
+    }
+
+    double zeta = c / (2 * std::sqrt(k * mass));
+    double wn = std::sqrt(k / mass);
+    double wd = wn * std::sqrt(1 - zeta * zeta);
+    double H = t_end / z1.size();
+    double max_err = 0;
+    for (size_t i = 0; i < z1.size(); i++) {
+        double t = (i + 1) * H;
+        double z = z0 * std::exp(-zeta * wn * t) * (std::cos(wd * t) + zeta * wn / wd * std::sin(wd * t));
+        max_err = std::max(max_err, std::abs(z1[i] - z));
+    }
+
+    printf("  %d coupling steps, max error %g (amplitude %g)\n", (int)z1.size(), max_err, z0);
+
+    if (max_err > 0.01 * z0) {
+        printf("Cosimulation does not match the analytical solution\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
@@ -0,0 +1,141 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the height queries of CRGTerrain (requires OpenCRG).
+//
+// Heights interpolated from the pre-sampled height grid must agree with the
+// heights evaluated through OpenCRG, for single and batched queries. Queries
+// through an invalid contact point index must throw. A terrain initialized
+// again from another road must give the same heights as a terrain initialized
+// only from that road.
+//
+// The data files are found relative to the directory of the test executable.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "chrono/core/ChException.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/ChVehicleModelData.h"
+#include "chrono_vehicle/terrain/CRGTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const std::string road1 = "terrain/crg_roads/handmade_curved_banked_sloped.crg";
+const std::string road2 = "terrain/crg_roads/handmade_arc.crg";
+
+// Query points along the road midline and at a lateral offset on both sides.
+std::vector<ChVector<>> GetQueryPoints(CRGTerrain& terrain) {
+    std::vector<ChVector<>> points;
+    auto path = terrain.GetPath();
+    for (size_t i = 0; i + 1 < path->getNumPoints(); i++) {
+        const ChVector<>& p = path->getPoint(i);
+        ChVector<> t = path->getPoint(i + 1) - p;
+        ChVector<> n = ChVector<>(-t.y(), t.x(), 0).GetNormalized();
+        for (double offset : {-0.5, 0.0, 0.5})
+            points.push_back(p + 0.5 * t + offset * n);
+    }
+    return points;
+}
+
+// Return the maximum height difference between two terrains at the given points.
+double MaxHeightDifference(CRGTerrain& terrain1, CRGTerrain& terrain2, const std::vector<ChVector<>>& points) {
+    double max_err = 0;
+    for (const auto& p : points)
+        max_err = std::max(max_err, std::abs(terrain1.GetHeight(p.x(), p.y()) - terrain2.GetHeight(p.x(), p.y())));
+    return max_err;
+}
+
+int main(int argc, char* argv[]) {
+    ChSystemNSC system;
+
+    // Height grid against OpenCRG
+    CRGTerrain terrain_grid(&system);
+    terrain_grid.UseHeightGrid(true, 0.05);
+    terrain_grid.Initialize(GetDataFile(road1));
+
+    CRGTerrain terrain_crg(&system);
+    terrain_crg.Initialize(GetDataFile(road1));
+
+    auto points = GetQueryPoints(terrain_crg);
+    double max_err = MaxHeightDifference(terrain_grid, terrain_crg, points);
+    printf("  %d points: max grid height difference %g\n", (int)points.size(), max_err);
+    if (points.empty() || max_err > 1e-3) {
+        printf("Height grid differs from OpenCRG\n");
+        return 1;
+    }
+
+    // Batched queries through an additional contact point
+    int cp = terrain_grid.AddContactPoint();
+    std::vector<double> heights;
+    terrain_grid.GetHeights(points, heights, cp);
+    for (size_t i = 0; i < points.size(); i++) {
+        if (heights[i] != terrain_grid.GetHeight(points[i].x(), points[i].y())) {
+            printf("Batched query differs from single query\n");
+            return 1;
+        }
+    }
+
+    // Invalid contact point indices
+    for (int invalid : {-1, cp + 1}) {
+        bool caught_single = false;
+        bool caught_batched = false;
+        try {
+            terrain_grid.GetHeight(invalid, points[0].x(), points[0].y());
+        } catch (const ChException&) {
+            caught_single = true;
+        }
+        try {
+            terrain_grid.GetHeights(points, heights, invalid);
+        } catch (const ChException&) {
+            caught_batched = true;
+        }
+        if (!caught_single || !caught_batched) {
+            printf("Invalid contact point %d accepted\n", invalid);
+            return 1;
+        }
+    }
+
+    // Initialize again from another road; the contact points of the first road are released
+    terrain_grid.Initialize(GetDataFile(road2));
+    bool caught = false;
+    try {
+        terrain_grid.GetHeight(cp, points[0].x(), points[0].y());
+    } catch (const ChException&) {
+        caught = true;
+    }
+    if (!caught) {
+        printf("Contact point kept after initializing again\n");
+        return 1;
+    }
+
+    CRGTerrain terrain_new(&system);
+    terrain_new.UseHeightGrid(true, 0.05);
+    terrain_new.Initialize(GetDataFile(road2));
+    auto points2 = GetQueryPoints(terrain_new);
+    double max_diff = MaxHeightDifference(terrain_grid, terrain_new, points2);
+    printf("  %d points: max height difference after initializing again %g\n", (int)points2.size(), max_diff);
+    if (points2.empty() || max_diff != 0) {
+        printf("Terrain initialized again differs from new terrain\n");
+        return 1;
+    }
+
+    printf("PASSED\n");
+    return 0;
+}
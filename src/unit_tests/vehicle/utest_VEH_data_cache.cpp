@@ -0,0 +1,80 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the cache of vehicle mesh files. A mesh loaded twice must be shared.
+// A pre-baked binary mesh must be used only as long as the OBJ file it was baked
+// from does not change: an OBJ file rewritten right after baking (typically
+// within the timestamp resolution of the file system) must be loaded again.
+//
+// =============================================================================
+
+#include <cstdio>
+#include <fstream>
+
+#include "chrono_vehicle/ChVehicleModelData.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const char* obj_file = "utest_data_cache.obj";
+const char* bin_file = "utest_data_cache.chmesh";
+
+// Write a flat mesh with the given number of triangles (a fan around the origin).
+void WriteMesh(int num_triangles) {
+    std::ofstream obj(obj_file);
+    obj << "v 0 0 0\n";
+    for (int i = 0; i <= num_triangles; i++)
+        obj << "v " << i << " 1 0\n";
+    for (int i = 0; i < num_triangles; i++)
+        obj << "f 1 " << i + 2 << " " << i + 3 << "\n";
+}
+
+int main(int argc, char* argv[]) {
+    WriteMesh(1);
+    if (BakeMeshFile(obj_file) != bin_file) {
+        printf("Wrong binary mesh file name\n");
+        return 1;
+    }
+
+    auto mesh1 = LoadMeshFile(obj_file);
+    auto mesh2 = LoadMeshFile(obj_file);
+    if (mesh1 != mesh2 || mesh1->getNumTriangles() != 1) {
+        printf("Mesh not loaded or not shared\n");
+        return 1;
+    }
+
+    // Rewrite the OBJ file right away; the binary mesh is now stale
+    WriteMesh(2);
+    auto mesh3 = LoadMeshFile(obj_file);
+    printf("  %d triangles after changing the OBJ file\n", mesh3->getNumTriangles());
+    if (mesh3->getNumTriangles() != 2) {
+        printf("Stale binary mesh used\n");
+        return 1;
+    }
+
+    // Once baked again, the binary mesh is used, even without the OBJ file
+    BakeMeshFile(obj_file);
+    std::remove(obj_file);
+    auto mesh4 = LoadMeshFile(obj_file);
+    if (mesh4->getNumTriangles() != 2) {
+        printf("Binary mesh not used\n");
+        return 1;
+    }
+
+    ClearDataCache();
+    std::remove(bin_file);
+
+    printf("PASSED\n");
+    return 0;
+}
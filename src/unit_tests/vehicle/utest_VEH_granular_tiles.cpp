@@ -0,0 +1,192 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the particle tiles of the GranularTerrain moving patch.
+//
+// A tile is saved from a patch whose particles were given distinct states. On a
+// second patch, the particles relocated by the moving patch must be placed in
+// exactly these states (shifted to the new location). Tiles which do not match
+// the moving patch must be rejected, whichever of Initialize, LoadTiles, and
+// EnableMovingPatch is called last.
+//
+// =============================================================================
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+#include "chrono/core/ChException.h"
+#include "chrono/physics/ChSystemSMC.h"
+#include "chrono_vehicle/terrain/GranularTerrain.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const char* tile_file = "utest_granular_tiles.dat";
+
+const double length = 2;
+const double width = 1;
+const double radius = 0.05;
+const double shift = 0.5;
+
+// Return the particles of a granular patch (bodies with identifiers above the one of the ground body).
+std::vector<std::shared_ptr<ChBody>> GetParticles(ChSystem& system, GranularTerrain& terrain) {
+    std::vector<std::shared_ptr<ChBody>> particles;
+    for (auto body : system.Get_bodylist()) {
+        if (body->GetIdentifier() > terrain.GetGroundBody()->GetIdentifier())
+            particles.push_back(body);
+    }
+    return particles;
+}
+
+void InitializePatch(GranularTerrain& terrain) {
+    terrain.Initialize(ChVector<>(0, 0, 0), length, width, 2, radius, 2000);
+}
+
+// Check that the tile is rejected by a moving patch with the given shift distance, for the given call order.
+bool CheckRejected(int order, double shift_distance) {
+    ChSystemSMC system;
+    auto body = std::make_shared<ChBody>();
+    system.AddBody(body);
+    GranularTerrain terrain(&system);
+
+    try {
+        switch (order) {
+            case 0:
+                terrain.EnableMovingPatch(body, 0.5, shift_distance);
+                terrain.LoadTiles(tile_file);
+                InitializePatch(terrain);
+                break;
+            case 1:
+                terrain.EnableMovingPatch(body, 0.5, shift_distance);
+                InitializePatch(terrain);
+                terrain.LoadTiles(tile_file);
+                break;
+            case 2:
+                InitializePatch(terrain);
+                terrain.LoadTiles(tile_file);
+                terrain.EnableMovingPatch(body, 0.5, shift_distance);
+                break;
+        }
+    } catch (const ChException&) {
+        return true;
+    }
+    printf("Inconsistent tile accepted (case %d)\n", order);
+    return false;
+}
+
+int main(int argc, char* argv[]) {
+    std::remove(tile_file);
+
+    // Patch from which the tile is saved. Give each particle a distinct state, with distinct heights so that the
+    // order of the tile particles is well defined.
+    ChSystemSMC sys_tile;
+    GranularTerrain terrain_tile(&sys_tile);
+    InitializePatch(terrain_tile);
+    auto tile_particles = GetParticles(sys_tile, terrain_tile);
+    for (size_t i = 0; i < tile_particles.size(); i++) {
+        auto& p = tile_particles[i];
+        p->SetPos(p->GetPos() + ChVector<>(0, 0, 1e-6 * i));
+        p->SetRot(Q_from_AngAxis(0.01 * i, ChVector<>(1, 2, 3).GetNormalized()));
+        p->SetPos_dt(ChVector<>(0.1 * std::sin(1.0 * i), 0.2, -0.01 * i));
+        p->SetWvel_par(ChVector<>(1, -0.5 * i, 0.3));
+    }
+    terrain_tile.SaveTile(tile_file, -length / 2, shift);
+
+    // Tile particles in the order stored (increasing height).
+    std::vector<std::shared_ptr<ChBody>> saved;
+    for (auto p : tile_particles) {
+        if (p->GetPos().x() >= -length / 2 && p->GetPos().x() < -length / 2 + shift)
+            saved.push_back(p);
+    }
+    std::sort(saved.begin(), saved.end(), [](const std::shared_ptr<ChBody>& a, const std::shared_ptr<ChBody>& b) {
+        return a->GetPos().z() < b->GetPos().z();
+    });
+
+    // Moving patch using the tile. The tracked body is within the buffer distance, so that the next
+    // synchronization relocates the particles behind the new rear boundary ahead of the front boundary.
+    ChSystemSMC sys_move;
+    auto body = std::make_shared<ChBody>();
+    body->SetPos(ChVector<>(length / 2 - 0.1, 0, 0));
+    sys_move.AddBody(body);
+    GranularTerrain terrain_move(&sys_move);
+    terrain_move.EnableMovingPatch(body, 0.5, shift);
+    InitializePatch(terrain_move);
+    if (terrain_move.LoadTiles(tile_file) != 1) {
+        printf("Tile not loaded\n");
+        return 1;
+    }
+
+    auto particles = GetParticles(sys_move, terrain_move);
+    size_t num_relocated = 0;
+    for (auto p : particles) {
+        if (p->GetPos().x() - radius < -length / 2 + shift)
+            num_relocated++;
+    }
+
+    terrain_move.Synchronize(0);
+    if (!terrain_move.PatchMoved()) {
+        printf("Patch not moved\n");
+        return 1;
+    }
+
+    // The lowest tile particles (all of them, if enough particles were relocated) must be found in the moved patch,
+    // shifted by the patch length, with the same orientation and velocities. The angular velocity is stored in the
+    // body frame, so it is only recovered up to roundoff.
+    size_t num_expected = std::min(num_relocated, saved.size());
+    printf("  %d tile particles, %d relocated particles\n", (int)saved.size(), (int)num_relocated);
+    if (num_expected == 0) {
+        printf("No relocated particles\n");
+        return 1;
+    }
+
+    double max_err = 0;
+    for (size_t i = 0; i < num_expected; i++) {
+        ChVector<> pos = saved[i]->GetPos() + ChVector<>(length, 0, 0);
+        auto match = std::find_if(particles.begin(), particles.end(), [&](const std::shared_ptr<ChBody>& p) {
+            return (p->GetPos() - pos).Length() < 1e-9;
+        });
+        if (match == particles.end()) {
+            printf("Tile particle %d not placed\n", (int)i);
+            return 1;
+        }
+        max_err = std::max(max_err, ((*match)->GetPos() - pos).Length());
+        if ((*match)->GetRot() != saved[i]->GetRot() || (*match)->GetPos_dt() != saved[i]->GetPos_dt() ||
+            ((*match)->GetWvel_par() - saved[i]->GetWvel_par()).Length() > 1e-12) {
+            printf("Tile particle %d: wrong orientation or velocity\n", (int)i);
+            return 1;
+        }
+    }
+    printf("  max position error: %g\n", max_err);
+
+    // No particle may be left behind the new rear boundary.
+    for (auto p : particles) {
+        if (p->GetPos().x() < terrain_move.GetPatchRear()) {
+            printf("Particle left behind the rear boundary\n");
+            return 1;
+        }
+    }
+
+    // A tile which does not match the moving patch is rejected in any call order.
+    for (int order = 0; order < 3; order++) {
+        if (!CheckRejected(order, 0.4))
+            return 1;
+    }
+
+    std::remove(tile_file);
+
+    printf("PASSED\n");
+    return 0;
+}
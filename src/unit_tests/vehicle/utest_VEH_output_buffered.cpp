@@ -0,0 +1,239 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the asynchronous vehicle output databases.
+//
+// - Writer thread and ring buffer: a database with a ring buffer much smaller
+//   than the number of output frames must write all frames, in order, from a
+//   thread other than the simulation thread, with the values at the time the
+//   frame was written by the simulation loop. Exceptions thrown by the writer
+//   thread are rethrown by Flush().
+// - Columnar HDF5 layout (only if Chrono was built with HDF5 support): the
+//   datasets written by ChVehicleOutputHDF5 are read back and checked for shape
+//   and values.
+//
+// =============================================================================
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <stdexcept>
+#include <thread>
+
+#include "chrono/ChConfig.h"
+#include "chrono/physics/ChBody.h"
+#include "chrono/physics/ChShaft.h"
+#include "chrono_vehicle/output/ChVehicleOutputBuffered.h"
+
+#ifdef CHRONO_HAS_HDF5
+#include "chrono_vehicle/output/ChVehicleOutputHDF5.h"
+#endif
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const int num_bodies = 5;
+const int num_frames = 1000;
+
+// Output database recording the frames received by the writer thread.
+class RecordingOutput : public ChVehicleOutputBuffered {
+  public:
+    RecordingOutput(int buffer_size, int throw_frame = -1)
+        : ChVehicleOutputBuffered(buffer_size), m_throw_frame(throw_frame), m_ok(true), m_num_written(0) {}
+    ~RecordingOutput() { StopWriter(); }
+
+    bool IsOk() const { return m_ok; }
+    int GetNumWritten() const { return m_num_written; }
+
+  private:
+    virtual void WriteFrame(const Frame& frame) override {
+        if (frame.frame == m_throw_frame)
+            throw std::runtime_error("write error");
+
+        // Frames in order, written from the writer thread
+        m_ok = m_ok && frame.frame == m_num_written && std::this_thread::get_id() != m_main_thread;
+
+        // Bodies in all frames, steering section only in even frames
+        m_ok = m_ok && frame.num_tables == (frame.frame % 2 == 0 ? 3 : 2);
+        const Table& bodies = frame.tables[0];
+        m_ok = m_ok && bodies.section == "Chassis" && bodies.name == "Bodies" && bodies.GetNumItems() == num_bodies;
+        for (int i = 0; i < num_bodies; i++) {
+            m_ok = m_ok && bodies.ids[i] == 10 + i;
+            m_ok = m_ok && bodies.GetColumn(0)[i] == i;                    // x
+            m_ok = m_ok && bodies.GetColumn(1)[i] == frame.frame * 1e-3;  // y
+        }
+        const Table& shafts = frame.tables[1];
+        m_ok = m_ok && shafts.section == "Driveline" && shafts.name == "Shafts" && shafts.GetNumItems() == 2;
+
+        // Slow writer, so that the simulation loop has to wait for free frames
+        if (frame.frame % 100 == 0)
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+        m_num_written++;
+    }
+
+    std::thread::id m_main_thread = std::this_thread::get_id();
+    int m_throw_frame;
+    bool m_ok;
+    int m_num_written;
+};
+
+// Write the output frames, moving the bodies between frames.
+void WriteFrames(ChVehicleOutput& database,
+                 std::vector<std::shared_ptr<ChBody>>& bodies,
+                 std::vector<std::shared_ptr<ChShaft>>& shafts,
+                 int nframes) {
+    for (int f = 0; f < nframes; f++) {
+        for (int i = 0; i < num_bodies; i++)
+            bodies[i]->SetPos(ChVector<>(i, f * 1e-3, 0));
+        database.WriteTime(f, f * 1e-3);
+        database.WriteSection("Chassis");
+        database.WriteBodies(bodies);
+        database.WriteSection("Driveline");
+        database.WriteShafts(shafts);
+        if (f % 2 == 0) {
+            database.WriteSection("Steering");
+            database.WriteBodies(bodies);
+        }
+    }
+}
+
+bool TestWriter(std::vector<std::shared_ptr<ChBody>>& bodies, std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    RecordingOutput database(4);
+    WriteFrames(database, bodies, shafts, num_frames);
+    database.Flush();
+
+    printf("  writer thread: %d frames written\n", database.GetNumWritten());
+    if (!database.IsOk() || database.GetNumWritten() != num_frames) {
+        printf("Incorrect frames received by the writer thread\n");
+        return false;
+    }
+
+    // Errors in the writer thread are reported by the next frame or by Flush
+    RecordingOutput failing(4, 10);
+    bool caught = false;
+    try {
+        WriteFrames(failing, bodies, shafts, 20);
+        failing.Flush();
+    } catch (const std::runtime_error&) {
+        caught = true;
+    }
+    if (!caught) {
+        printf("Writer exception not rethrown\n");
+        return false;
+    }
+
+    return true;
+}
+
+#ifdef CHRONO_HAS_HDF5
+
+// Get the dimensions of a dataset.
+std::vector<hsize_t> GetDims(H5::H5File& file, const std::string& name) {
+    H5::DataSpace space = file.openDataSet(name).getSpace();
+    std::vector<hsize_t> dims(space.getSimpleExtentNdims());
+    space.getSimpleExtentDims(dims.data());
+    return dims;
+}
+
+bool TestHDF5(std::vector<std::shared_ptr<ChBody>>& bodies, std::vector<std::shared_ptr<ChShaft>>& shafts) {
+    const char* filename = "utest_output.h5";
+    {
+        ChVehicleOutputHDF5 database(filename, 4);
+        WriteFrames(database, bodies, shafts, num_frames);
+    }
+
+    bool ok = true;
+    {
+        H5::H5File file(filename, H5F_ACC_RDONLY);
+
+        // Shapes: one row per frame, one column per component
+        ok = ok && GetDims(file, "/Time") == std::vector<hsize_t>{num_frames};
+        ok = ok && GetDims(file, "/Chassis/Bodies/id") == std::vector<hsize_t>{num_bodies};
+        ok = ok && GetDims(file, "/Chassis/Bodies/y") == std::vector<hsize_t>{num_frames, num_bodies};
+        ok = ok && GetDims(file, "/Driveline/Shafts/torque") == std::vector<hsize_t>{num_frames, 2};
+        ok = ok && GetDims(file, "/Steering/Bodies/frame") == std::vector<hsize_t>{num_frames / 2};
+        ok = ok && GetDims(file, "/Steering/Bodies/e0") == std::vector<hsize_t>{num_frames / 2, num_bodies};
+        if (!ok) {
+            printf("Incorrect HDF5 dataset dimensions\n");
+            return false;
+        }
+
+        // Values
+        std::vector<double> time(num_frames);
+        file.openDataSet("/Time").read(time.data(), H5::PredType::NATIVE_DOUBLE);
+        std::vector<int> ids(num_bodies);
+        file.openDataSet("/Chassis/Bodies/id").read(ids.data(), H5::PredType::NATIVE_INT);
+        H5::DataSet y_set = file.openDataSet("/Chassis/Bodies/y");
+        std::vector<double> y(num_frames * num_bodies);
+        y_set.read(y.data(), H5::PredType::NATIVE_DOUBLE);
+        std::vector<int> steering_frames(num_frames / 2);
+        file.openDataSet("/Steering/Bodies/frame").read(steering_frames.data(), H5::PredType::NATIVE_INT);
+
+        for (int f = 0; f < num_frames; f++) {
+            ok = ok && time[f] == f * 1e-3;
+            for (int i = 0; i < num_bodies; i++)
+                ok = ok && y[f * num_bodies + i] == f * 1e-3;
+        }
+        for (int i = 0; i < num_bodies; i++)
+            ok = ok && ids[i] == 10 + i;
+        for (int r = 0; r < num_frames / 2; r++)
+            ok = ok && steering_frames[r] == 2 * r;
+        if (!ok) {
+            printf("Incorrect HDF5 dataset values\n");
+            return false;
+        }
+
+        // Compression filter
+        if (y_set.getCreatePlist().getNfilters() != 1) {
+            printf("HDF5 dataset not compressed\n");
+            return false;
+        }
+    }
+
+    std::remove(filename);
+
+    printf("  HDF5: %d frames read back\n", num_frames);
+    return true;
+}
+
+#endif
+
+int main(int argc, char* argv[]) {
+    std::vector<std::shared_ptr<ChBody>> bodies;
+    for (int i = 0; i < num_bodies; i++) {
+        auto body = std::make_shared<ChBody>();
+        body->SetIdentifier(10 + i);
+        bodies.push_back(body);
+    }
+    std::vector<std::shared_ptr<ChShaft>> shafts;
+    for (int i = 0; i < 2; i++) {
+        auto shaft = std::make_shared<ChShaft>();
+        shaft->SetIdentifier(i);
+        shafts.push_back(shaft);
+    }
+
+    if (!TestWriter(bodies, shafts))
+        return 1;
+
+#ifdef CHRONO_HAS_HDF5
+    if (!TestHDF5(bodies, shafts))
+        return 1;
+#else
+    printf("  HDF5 support not available, columnar layout not tested\n");
+#endif
+
+    printf("PASSED\n");
+    return 0;
+}
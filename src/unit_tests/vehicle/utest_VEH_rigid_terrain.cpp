@@ -0,0 +1,257 @@
+// =============================================================================
+// PROJECT CHRONO - http://projectchrono.org
+//
+// Copyright (c) 2014 projectchrono.org
+// All rights reserved.
+//
+// Use of this source code is governed by a BSD-style license that can be found
+// in the LICENSE file at the top level of the distribution and at
+// http://projectchrono.org/license-chrono.txt.
+//
+// =============================================================================
+// Authors:
+// =============================================================================
+//
+// Test for the cached height and normal queries of RigidTerrain.
+//
+// Two terrains with the same patches (a tilted box, a rotated mesh with a sweep
+// sphere radius, and a height map) are queried at the same points. The first
+// one is never initialized, so it casts rays into the patch collision models.
+// The second one uses the cached patch data; its height-map patch is added after
+// Initialize.
+//
+// The cached heights and normals must match the exact patch geometry. The ray
+// casts hit the collision shapes, which are inflated by the collision margin,
+// so they must agree with the cached heights only up to that margin.
+//
+// =============================================================================
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <random>
+#include <vector>
+
+#include "chrono/collision/ChCCollisionModel.h"
+#include "chrono/physics/ChSystemNSC.h"
+#include "chrono_vehicle/terrain/RigidTerrain.h"
+
+#include "chrono_thirdparty/Easy_BMP/EasyBMP.h"
+
+using namespace chrono;
+using namespace chrono::vehicle;
+
+const char* mesh_file = "utest_rigid_terrain.obj";
+const char* hmap_file = "utest_rigid_terrain.bmp";
+
+const double sweep_radius = 0.05;
+const ChCoordsys<> box_pos(ChVector<>(-20, 0, 0), Q_from_AngX(0.1));
+const ChCoordsys<> mesh_pos(ChVector<>(0, 0, 0.5), Q_from_AngZ(CH_C_PI / 6));
+const ChCoordsys<> hmap_pos(ChVector<>(20, 0, 0), QUNIT);
+
+// Write a 6x6 grid mesh over [-5,5]x[-5,5] with a wavy surface and return its vertices and faces.
+void WriteMesh(std::vector<ChVector<>>& verts, std::vector<ChVector<int>>& faces) {
+    const int n = 6;
+    for (int iy = 0; iy < n; iy++) {
+        for (int ix = 0; ix < n; ix++) {
+            double x = -5 + 10.0 * ix / (n - 1);
+            double y = -5 + 10.0 * iy / (n - 1);
+            double z = 0.5 * std::sin(x) * std::cos(0.5 * y);
+            // OBJ files are read in single precision.
+            verts.push_back(ChVector<>((float)x, (float)y, (float)z));
+        }
+    }
+    for (int iy = 0; iy < n - 1; iy++) {
+        for (int ix = 0; ix < n - 1; ix++) {
+            int v = ix + iy * n;
+            faces.push_back(ChVector<int>(v, v + 1, v + 1 + n));
+            faces.push_back(ChVector<int>(v, v + 1 + n, v + n));
+        }
+    }
+
+    std::ofstream obj(mesh_file);
+    obj << std::setprecision(17);
+    for (const auto& v : verts)
+        obj << "v " << v.x() << " " << v.y() << " " << v.z() << "\n";
+    for (const auto& f : faces)
+        obj << "f " << f[0] + 1 << " " << f[1] + 1 << " " << f[2] + 1 << "\n";
+}
+
+// Write a 9x9 gray-scale height map over [-5,5]x[-5,5] with heights in [0,2] and return the vertices and faces of
+// the corresponding mesh. The first BMP row is the top (largest y) row of vertices.
+void WriteHeightMap(std::vector<ChVector<>>& verts, std::vector<ChVector<int>>& faces) {
+    const int n = 9;
+    BMP hmap;
+    hmap.SetSize(n, n);
+    for (int i = 0; i < n; i++) {
+        for (int j = 0; j < n; j++) {
+            ebmpBYTE gray = (ebmpBYTE)((37 * i + 11 * j * j) % 256);
+            hmap(i, j)->Red = gray;
+            hmap(i, j)->Green = gray;
+            hmap(i, j)->Blue = gray;
+        }
+    }
+    hmap.WriteToFile(hmap_file);
+
+    for (int iy = 0; iy < n; iy++) {
+        for (int ix = 0; ix < n; ix++) {
+            double gray = (37 * ix + 11 * (n - 1 - iy) * (n - 1 - iy)) % 256;
+            verts.push_back(ChVector<>(-5 + 10.0 * ix / (n - 1), -5 + 10.0 * iy / (n - 1), 2 * gray / 255));
+        }
+    }
+    for (int iy = 0; iy < n - 1; iy++) {
+        for (int ix = 0; ix < n - 1; ix++) {
+            int v = ix + iy * n;
+            faces.push_back(ChVector<int>(v, v + 1, v + 1 + n));
+            faces.push_back(ChVector<int>(v, v + 1 + n, v + n));
+        }
+    }
+}
+
+// Exact height and upward normal of a mesh with the given sweep sphere radius, by checking all faces.
+bool MeshPoint(const std::vector<ChVector<>>& verts,
+               const std::vector<ChVector<int>>& faces,
+               const ChCoordsys<>& pos,
+               double radius,
+               double x,
+               double y,
+               double& height,
+               ChVector<>& normal) {
+    bool hit = false;
+    for (const auto& f : faces) {
+        ChVector<> v0 = pos.TransformLocalToParent(verts[f[0]]);
+        ChVector<> v1 = pos.TransformLocalToParent(verts[f[1]]);
+        ChVector<> v2 = pos.TransformLocalToParent(verts[f[2]]);
+        ChVector<> n = Vcross(v1 - v0, v2 - v0).GetNormalized();
+        if (n.z() < 0)
+            n = -n;
+        // Intersection of the vertical through (x,y) with the face plane, checked against the face edges.
+        double z = v0.z() - (n.x() * (x - v0.x()) + n.y() * (y - v0.y())) / n.z();
+        ChVector<> p(x, y, z);
+        double e0 = Vdot(Vcross(v1 - v0, p - v0), n);
+        double e1 = Vdot(Vcross(v2 - v1, p - v1), n);
+        double e2 = Vdot(Vcross(v0 - v2, p - v2), n);
+        bool inside_ccw = e0 > -1e-10 && e1 > -1e-10 && e2 > -1e-10;
+        bool inside_cw = e0 < 1e-10 && e1 < 1e-10 && e2 < 1e-10;
+        if (!inside_ccw && !inside_cw)
+            continue;
+        z += radius / n.z();
+        if (!hit || z > height) {
+            hit = true;
+            height = z;
+            normal = n;
+        }
+    }
+    return hit;
+}
+
+void AddPatches(RigidTerrain& terrain, bool cached) {
+    terrain.AddPatch(box_pos, ChVector<>(10, 10, 1));
+    terrain.AddPatch(mesh_pos, mesh_file, "mesh", sweep_radius);
+    if (cached)
+        terrain.Initialize();
+    terrain.AddPatch(hmap_pos, hmap_file, "hmap", 10, 10, 0, 2);
+}
+
+int main(int argc, char* argv[]) {
+    std::vector<ChVector<>> mesh_verts;
+    std::vector<ChVector<int>> mesh_faces;
+    WriteMesh(mesh_verts, mesh_faces);
+    std::vector<ChVector<>> hmap_verts;
+    std::vector<ChVector<int>> hmap_faces;
+    WriteHeightMap(hmap_verts, hmap_faces);
+
+    ChSystemNSC sys_ray;
+    RigidTerrain terrain_ray(&sys_ray);
+    AddPatches(terrain_ray, false);
+
+    ChSystemNSC sys_cached;
+    RigidTerrain terrain_cached(&sys_cached);
+    AddPatches(terrain_cached, true);
+
+    double margin = collision::ChCollisionModel::GetDefaultSuggestedEnvelope() +
+                    collision::ChCollisionModel::GetDefaultSuggestedMargin();
+
+    // Random query points on each patch (away from the patch boundaries)
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<double> dist(-4.5, 4.5);
+
+    double max_herr = 0;
+    double max_nerr = 0;
+    double max_offset_ray = 0;
+    for (int i = 0; i < 200; i++) {
+        for (int patch = 0; patch < 3; patch++) {
+            ChVector<> p;
+            double h_exact;
+            ChVector<> n_exact;
+            switch (patch) {
+                case 0: {
+                    // Top face of the box
+                    p = box_pos.pos + ChVector<>(dist(gen), dist(gen), 0);
+                    ChVector<> top = box_pos.TransformLocalToParent(ChVector<>(0, 0, 0.5));
+                    n_exact = box_pos.TransformDirectionLocalToParent(ChVector<>(0, 0, 1));
+                    h_exact = top.z() - Vdot(n_exact, ChVector<>(p.x() - top.x(), p.y() - top.y(), 0)) / n_exact.z();
+                    break;
+                }
+                case 1:
+                    p = mesh_pos.TransformLocalToParent(ChVector<>(dist(gen), dist(gen), 0));
+                    MeshPoint(mesh_verts, mesh_faces, mesh_pos, sweep_radius, p.x(), p.y(), h_exact, n_exact);
+                    break;
+                case 2:
+                    p = hmap_pos.pos + ChVector<>(dist(gen), dist(gen), 0);
+                    MeshPoint(hmap_verts, hmap_faces, hmap_pos, 0, p.x(), p.y(), h_exact, n_exact);
+                    break;
+            }
+
+            double h_cached = terrain_cached.GetHeight(p.x(), p.y());
+            ChVector<> n_cached = terrain_cached.GetNormal(p.x(), p.y());
+            max_herr = std::max(max_herr, std::abs(h_cached - h_exact));
+            max_nerr = std::max(max_nerr, (n_cached - n_exact).Length());
+
+            double h_ray = terrain_ray.GetHeight(p.x(), p.y());
+            max_offset_ray = std::max(max_offset_ray, std::abs(h_ray - h_cached) * n_cached.z());
+        }
+    }
+
+    printf("  exact geometry: max height error %g, max normal error %g\n", max_herr, max_nerr);
+    if (max_herr > 1e-9 || max_nerr > 1e-9) {
+        printf("Cached terrain queries differ from the patch geometry\n");
+        return 1;
+    }
+
+    // The collision shapes are inflated by up to the collision margin along the surface normal.
+    printf("  ray casting: max offset along the normal %g (collision margin %g)\n", max_offset_ray, margin);
+    if (max_offset_ray > margin) {
+        printf("Cached terrain queries differ from ray casting\n");
+        return 1;
+    }
+
+    // Outside all patches, both terrains report no hit.
+    if (terrain_cached.GetHeight(0, 50) != terrain_ray.GetHeight(0, 50) ||
+        terrain_cached.GetNormal(0, 50) != terrain_ray.GetNormal(0, 50)) {
+        printf("Query outside the patches differs from ray casting\n");
+        return 1;
+    }
+
+    // Batched queries return the same values
+    std::vector<ChVector<>> points;
+    for (int i = 0; i < 100; i++)
+        points.push_back(ChVector<>(10 * dist(gen), dist(gen), 0));
+    std::vector<double> heights;
+    std::vector<ChVector<>> normals;
+    terrain_cached.GetHeightNormal(points, heights, normals);
+    for (size_t i = 0; i < points.size(); i++) {
+        if (heights[i] != terrain_cached.GetHeight(points[i].x(), points[i].y()) ||
+            normals[i] != terrain_cached.GetNormal(points[i].x(), points[i].y())) {
+            printf("Batched query differs from single query\n");
+            return 1;
+        }
+    }
+
+    std::remove(mesh_file);
+    std::remove(hmap_file);
+
+    printf("PASSED\n");
+    return 0;
+}